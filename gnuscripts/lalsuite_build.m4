@@ -1164,7 +1164,7 @@ AC_DEFUN([LALSUITE_CHECK_SIMD],[
   # list of recognised SIMD instruction sets
   m4_define([simd_isets],[m4_normalize([
     [SSE],[SSE2],[SSE3],[SSSE3],[SSE4.1],[SSE4.2],
-    [AVX],[AVX2]
+    [AVX],[AVX2],[AVX512F]
   ])])
 
   # push compiler environment
@@ -1175,7 +1175,8 @@ AC_DEFUN([LALSUITE_CHECK_SIMD],[
   # check compiler support for each SIMD instruction set
   simd_supported=
   m4_foreach([iset],simd_isets,[
-    m4_pushdef([option],m4_translit(iset,[A-Z.],[a-z.]))
+    # AVX-512 kernels also use FMA instructions, which every AVX-512 processor supports
+    m4_pushdef([option],m4_case(iset,[AVX512F],[avx512f -mfma],[m4_translit(iset,[A-Z.],[a-z.])]))
     m4_pushdef([symbol],m4_translit(iset,[A-Z.],[A-Z_]))
 
     # assume supported until test fails, in which break out of loop
@@ -0,0 +1,56 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#ifndef _LALRUNNINGMEDIAN_INTERNAL_H
+#define _LALRUNNINGMEDIAN_INTERNAL_H
+
+#include <lal/LALDatatypes.h>
+
+/*
+ * Rank kernels used by the sorted-window running median for small block
+ * sizes: given an array w[0..n-1], return in *rold and *rnew the number of
+ * elements of w which are less than xold and xnew respectively.
+ */
+
+void XLALRunningMedianRankREAL4_AVX2( const REAL4 *w, UINT4 n, REAL4 xold, REAL4 xnew, UINT4 *rold, UINT4 *rnew );
+void XLALRunningMedianRankREAL8_AVX2( const REAL8 *w, UINT4 n, REAL8 xold, REAL8 xnew, UINT4 *rold, UINT4 *rnew );
+
+/*
+ * Double heap used by the running median for large block sizes, and by the
+ * median and median-mean PSD streams in AverageSpectrum.c: v[0..b-1] is a
+ * ring buffer of values, indexed by a max-heap of the values below the
+ * median and a min-heap of those above it, which share the median at heap
+ * position 0.
+ * heap points to the middle of an array of b heap positions, so that
+ * heap[-b/2..(b-1)/2] are valid; pos[0..b-1] maps ring buffer slots to heap
+ * positions, and heap[] maps heap positions back to slots.  The median is
+ * v[heap[0]] if b is odd, otherwise the mean of v[heap[0]] and v[heap[-1]].
+ *
+ * XLALRunningMedianHeapInit() sets up pos[] and heap[] for a block size b;
+ * XLALRunningMedianHeapInsert() then stores x in ring buffer slot idx,
+ * where ct is the number of values in the heap including x, and isnew is
+ * non-zero while the heap is still being filled.
+ */
+
+void XLALRunningMedianHeapInitREAL4( INT4 *pos, INT4 *heap, UINT4 b );
+void XLALRunningMedianHeapInitREAL8( INT4 *pos, INT4 *heap, UINT4 b );
+void XLALRunningMedianHeapInsertREAL4( REAL4 *v, INT4 *pos, INT4 *heap, UINT4 idx, INT4 ct, int isnew, REAL4 x );
+void XLALRunningMedianHeapInsertREAL8( REAL8 *v, INT4 *pos, INT4 *heap, UINT4 idx, INT4 ct, int isnew, REAL8 x );
+
+#endif /* _LALRUNNINGMEDIAN_INTERNAL_H */
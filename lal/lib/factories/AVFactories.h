@@ -8,6 +8,7 @@ File Name: AVFactories.h
 #define _AVFACTORIES_H
 
 #include <lal/LALDatatypes.h>
+#include <lal/LALMalloc.h>
 #include <stdarg.h>
 
 #ifdef  __cplusplus
@@ -97,6 +98,13 @@ extern "C" {
  * is realloced using \c LALRealloc().  The function
  * \c XLALResizeVector() is the same as \c XLALResizeREAL4Vector().
  *
+ * The <tt>XLALArenaCreate\<type\>%Vector</tt> functions create vectors like
+ * <tt>XLALCreate\<type\>%Vector</tt>, but allocate both the vector and its
+ * data from the arena allocator \c arena (see \ref LALMalloc_h).  Such vectors
+ * must not be passed to <tt>XLALDestroy\<type\>%Vector</tt> or
+ * <tt>XLALResize\<type\>%Vector</tt>; their memory is released by
+ * XLALArenaReset() or XLALArenaDestroy().
+ *
  * The <tt>XLALCreate\<type\>Array</tt>
  * <tt>XLALCreate\<type\>ArrayL</tt>
  * <tt>XLALCreate\<type\>ArrayV</tt>
@@ -123,6 +131,14 @@ extern "C" {
  * \c XLALCreateREAL4ArrayV()
  * functions respectively.
  *
+ * The <tt>XLALArenaCreate\<type\>Array</tt>
+ * <tt>XLALArenaCreate\<type\>ArrayL</tt>
+ * <tt>XLALArenaCreate\<type\>ArrayV</tt>
+ * functions create arrays like the corresponding <tt>XLALCreate\<type\>Array</tt>
+ * functions, but allocate the array, its dimension vector and its data from
+ * the arena allocator \c arena.  As for arena vectors, such arrays must not be
+ * passed to <tt>XLALDestroy\<type\>Array</tt> or <tt>XLALResize\<type\>Array</tt>.
+ *
  * The <tt>XLALDestroy\<type\>Array</tt> functions deallocate the memory allocation
  * pointed to by \c array including its contents.  The function
  * \c XLALDestroyArray() is the same as \c XLALDestroyREAL4Array().
@@ -363,6 +379,42 @@ void LALZDestroyArray ( LALStatus *, COMPLEX16Array ** );
 /** @} */
 
 
+/** \name Arena array prototypes */
+/** @{ */
+#ifndef SWIG   /* exclude from SWIG interface */
+INT2Array * XLALArenaCreateINT2ArrayL ( LALArena *, UINT4, ... );
+INT2Array * XLALArenaCreateINT2ArrayV ( LALArena *, UINT4, UINT4 * );
+INT2Array * XLALArenaCreateINT2Array ( LALArena *, UINT4Vector * );
+INT4Array * XLALArenaCreateINT4ArrayL ( LALArena *, UINT4, ... );
+INT4Array * XLALArenaCreateINT4ArrayV ( LALArena *, UINT4, UINT4 * );
+INT4Array * XLALArenaCreateINT4Array ( LALArena *, UINT4Vector * );
+INT8Array * XLALArenaCreateINT8ArrayL ( LALArena *, UINT4, ... );
+INT8Array * XLALArenaCreateINT8ArrayV ( LALArena *, UINT4, UINT4 * );
+INT8Array * XLALArenaCreateINT8Array ( LALArena *, UINT4Vector * );
+UINT2Array * XLALArenaCreateUINT2ArrayL ( LALArena *, UINT4, ... );
+UINT2Array * XLALArenaCreateUINT2ArrayV ( LALArena *, UINT4, UINT4 * );
+UINT2Array * XLALArenaCreateUINT2Array ( LALArena *, UINT4Vector * );
+UINT4Array * XLALArenaCreateUINT4ArrayL ( LALArena *, UINT4, ... );
+UINT4Array * XLALArenaCreateUINT4ArrayV ( LALArena *, UINT4, UINT4 * );
+UINT4Array * XLALArenaCreateUINT4Array ( LALArena *, UINT4Vector * );
+UINT8Array * XLALArenaCreateUINT8ArrayL ( LALArena *, UINT4, ... );
+UINT8Array * XLALArenaCreateUINT8ArrayV ( LALArena *, UINT4, UINT4 * );
+UINT8Array * XLALArenaCreateUINT8Array ( LALArena *, UINT4Vector * );
+REAL4Array * XLALArenaCreateREAL4ArrayL ( LALArena *, UINT4, ... );
+REAL4Array * XLALArenaCreateREAL4ArrayV ( LALArena *, UINT4, UINT4 * );
+REAL4Array * XLALArenaCreateREAL4Array ( LALArena *, UINT4Vector * );
+REAL8Array * XLALArenaCreateREAL8ArrayL ( LALArena *, UINT4, ... );
+REAL8Array * XLALArenaCreateREAL8ArrayV ( LALArena *, UINT4, UINT4 * );
+REAL8Array * XLALArenaCreateREAL8Array ( LALArena *, UINT4Vector * );
+COMPLEX8Array * XLALArenaCreateCOMPLEX8ArrayL ( LALArena *, UINT4, ... );
+COMPLEX8Array * XLALArenaCreateCOMPLEX8ArrayV ( LALArena *, UINT4, UINT4 * );
+COMPLEX8Array * XLALArenaCreateCOMPLEX8Array ( LALArena *, UINT4Vector * );
+COMPLEX16Array * XLALArenaCreateCOMPLEX16ArrayL ( LALArena *, UINT4, ... );
+COMPLEX16Array * XLALArenaCreateCOMPLEX16ArrayV ( LALArena *, UINT4, UINT4 * );
+COMPLEX16Array * XLALArenaCreateCOMPLEX16Array ( LALArena *, UINT4Vector * );
+#endif   /* SWIG */
+/** @} */
+
 /** @} */
 /* ---------- end: ArrayFactories_c ---------- */
 
@@ -507,6 +559,23 @@ void LALZResizeVector ( LALStatus *, COMPLEX16Vector **, UINT4 );
 void LALZDestroyVector ( LALStatus *, COMPLEX16Vector ** );
 /** @} */
 
+/** \name Arena vector prototypes */
+/** @{ */
+#ifndef SWIG   /* exclude from SWIG interface */
+CHARVector * XLALArenaCreateCHARVector ( LALArena *arena, UINT4 length );
+INT2Vector * XLALArenaCreateINT2Vector ( LALArena *arena, UINT4 length );
+INT4Vector * XLALArenaCreateINT4Vector ( LALArena *arena, UINT4 length );
+INT8Vector * XLALArenaCreateINT8Vector ( LALArena *arena, UINT4 length );
+UINT2Vector * XLALArenaCreateUINT2Vector ( LALArena *arena, UINT4 length );
+UINT4Vector * XLALArenaCreateUINT4Vector ( LALArena *arena, UINT4 length );
+UINT8Vector * XLALArenaCreateUINT8Vector ( LALArena *arena, UINT4 length );
+REAL4Vector * XLALArenaCreateREAL4Vector ( LALArena *arena, UINT4 length );
+REAL8Vector * XLALArenaCreateREAL8Vector ( LALArena *arena, UINT4 length );
+COMPLEX8Vector * XLALArenaCreateCOMPLEX8Vector ( LALArena *arena, UINT4 length );
+COMPLEX16Vector * XLALArenaCreateCOMPLEX16Vector ( LALArena *arena, UINT4 length );
+#endif   /* SWIG */
+/** @} */
+
 /** @} */
 
 /* ---------- end: VectorFactories_c ---------- */
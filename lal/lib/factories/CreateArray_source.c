@@ -11,6 +11,9 @@
 #define XFUNC CONCAT2(XLALCreate,ATYPE)
 #define XFUNCL CONCAT3(XLALCreate,ATYPE,L)
 #define XFUNCV CONCAT3(XLALCreate,ATYPE,V)
+#define AFUNC CONCAT2(XLALArenaCreate,ATYPE)
+#define AFUNCL CONCAT3(XLALArenaCreate,ATYPE,L)
+#define AFUNCV CONCAT3(XLALArenaCreate,ATYPE,V)
 #else
 #define FUNC LALCreateArray
 #define XFUNC XLALCreateArray
@@ -113,6 +116,89 @@ ATYPE * XFUNC ( UINT4Vector *dimLength )
 }
 
 
+#ifdef TYPECODE
+ATYPE * AFUNCL ( LALArena *arena, UINT4 ndim, ... )
+{
+  enum { maxdim = 16 };
+  va_list ap;
+  ATYPE *arr;
+  UINT4 dims[maxdim];
+  UINT4 dim;
+
+  if ( ! ndim )
+    XLAL_ERROR_NULL( XLAL_EBADLEN );
+  if ( ndim > maxdim )
+    XLAL_ERROR_NULL( XLAL_EINVAL );
+
+  va_start( ap, ndim );
+  for ( dim = 0; dim < ndim; ++dim )
+    dims[dim] = va_arg( ap, UINT4 );
+  va_end( ap );
+
+  arr = AFUNCV ( arena, ndim, dims );
+  if ( ! arr )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  return arr;
+}
+
+ATYPE * AFUNCV ( LALArena *arena, UINT4 ndim, UINT4 *dims )
+{
+  ATYPE *arr;
+  UINT4Vector dimLength;
+
+  if ( ! ndim )
+    XLAL_ERROR_NULL( XLAL_EBADLEN );
+  if ( ! dims )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+
+  dimLength.length = ndim;
+  dimLength.data   = dims;
+
+  arr = AFUNC ( arena, &dimLength );
+  if ( ! arr )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  return arr;
+}
+
+ATYPE * AFUNC ( LALArena *arena, UINT4Vector *dimLength )
+{
+  ATYPE *arr;
+  UINT4 size = 1;
+  UINT4 ndim;
+  UINT4 dim;
+
+  if ( ! dimLength )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+  if ( ! dimLength->length )
+    XLAL_ERROR_NULL( XLAL_EBADLEN );
+  if ( ! dimLength->data )
+    XLAL_ERROR_NULL( XLAL_EINVAL );
+
+  ndim = dimLength->length;
+  for ( dim = 0; dim < ndim; ++dim )
+    size *= dimLength->data[dim];
+
+  if ( ! size )
+    XLAL_ERROR_NULL( XLAL_EBADLEN );
+
+  /* create array, its dimensions and its data storage in the arena;
+   * on failure, whatever was allocated is released with the arena */
+  arr = XLALArenaAlloc( arena, sizeof( *arr ) );
+  if ( ! arr )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  arr->dimLength = XLALArenaCreateUINT4Vector( arena, ndim );
+  if ( ! arr->dimLength )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  memcpy( arr->dimLength->data, dimLength->data,
+      ndim * sizeof( *arr->dimLength->data ) );
+  arr->data = XLALArenaAlloc( arena, size * sizeof( *arr->data ) );
+  if ( ! arr->data )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+
+  return arr;
+}
+#endif
+
 
 void FUNC ( LALStatus *status, ATYPE **array, UINT4Vector *dimLength )
 {
@@ -158,3 +244,6 @@ void FUNC ( LALStatus *status, ATYPE **array, UINT4Vector *dimLength )
 #undef XFUNC
 #undef XFUNCL
 #undef XFUNCV
+#undef AFUNC
+#undef AFUNCL
+#undef AFUNCV
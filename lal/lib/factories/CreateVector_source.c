@@ -9,6 +9,7 @@
 #ifdef TYPECODE
 #define FUNC CONCAT3(LAL,TYPECODE,CreateVector)
 #define XFUNC CONCAT2(XLALCreate,VTYPE)
+#define AFUNC CONCAT2(XLALArenaCreate,VTYPE)
 #else
 #define FUNC LALCreateVector
 #define XFUNC XLALCreateVector
@@ -40,6 +41,27 @@ VTYPE * XFUNC ( UINT4 length )
 }
 
 
+#ifdef TYPECODE
+VTYPE * AFUNC ( LALArena *arena, UINT4 length )
+{
+  VTYPE * vector;
+  vector = XLALArenaAlloc( arena, sizeof( *vector ) );
+  if ( ! vector )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  vector->length = length;
+  if ( ! length ) /* zero length: set data pointer to be NULL */
+    vector->data = NULL;
+  else /* non-zero length: allocate memory for data */
+  {
+    vector->data = XLALArenaAlloc( arena, length * sizeof( *vector->data ) );
+    if ( ! vector->data )
+      XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+  return vector;
+}
+#endif
+
+
 void FUNC ( LALStatus *status, VTYPE **vector, UINT4 length )
 {
   /*
@@ -83,3 +105,4 @@ void FUNC ( LALStatus *status, VTYPE **vector, UINT4 length )
 #undef VTYPE
 #undef FUNC
 #undef XFUNC
+#undef AFUNC
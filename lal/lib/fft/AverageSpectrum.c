@@ -31,6 +31,8 @@
 #include <lal/Window.h>
 #include <lal/Date.h>
 
+#include <LALRunningMedian_internal.h>
+
 static COMPLEX16 cabs2(COMPLEX16 z)
 {
 	double x = creal(z);
@@ -1898,6 +1900,425 @@ int XLALPSDRegressorSetPSD(LALPSDRegressor *r, const REAL8FrequencySeries *psd,
 }
 
 
+/*
+ * Streaming PSD estimation.
+ */
+
+
+/*
+ * Each frequency bin of a LALPSDStream keeps the periodogram values of the
+ * most recent segments in a ring buffer.  For the median method, the ring
+ * buffer is indexed by a double heap (a max-heap of the values below the
+ * median and a min-heap of the values above it, sharing the median at
+ * heap position 0) so that replacing the oldest value and finding the new
+ * median costs O(log nsegments) per bin.  The double heap is the one used by
+ * XLALRunningMedianREAL8() for large block sizes; see
+ * LALRunningMedian_internal.h.
+ *
+ * For the median-mean method nsegments is even, so that ring buffer slot
+ * idx holds segments of the same parity as idx.  The even and odd slots of
+ * each bin are then kept as two separate ring buffers of nsegments/2 values,
+ * each with its own double heap: slot idx is slot idx/2 of group idx%2.
+ */
+
+struct tagLALPSDStream {
+  LALPSDStreamMethod method;
+  UINT4 seglen;
+  UINT4 stride;
+  UINT4 nsegments;
+  UINT4 nbins;
+  const REAL8FFTPlan *plan;
+  REAL8 *window;        /* unitary-normalized window, or NULL */
+  REAL8Vector *buffer;  /* buffered time series samples */
+  REAL8Vector *work;    /* windowed segment */
+  REAL8Vector *pgram;   /* periodogram of the newest segment */
+  UINT4 nbuffered;      /* number of samples in buffer */
+  REAL8 *value;         /* ring buffers of periodogram values, one per bin */
+  INT4 *pos;            /* heap position of each ring buffer slot */
+  INT4 *heap;           /* ring buffer slot at each heap position */
+  REAL8 *sum;           /* sum of ring buffer values, one per bin */
+  UINT4 idx;            /* next ring buffer slot to be replaced */
+  UINT4 count;          /* number of segments in the ring buffers */
+  UINT4 nupdates;       /* number of updates since sums were recomputed */
+  INT8 offset;          /* index of first buffered sample since start */
+  LIGOTimeGPS start;    /* epoch of first sample added */
+  LIGOTimeGPS last;     /* epoch of newest segment */
+  REAL8 deltaT;
+  REAL8 f0;
+  LALUnit sampleUnits;
+};
+
+/* number of double heaps per bin, and number of values in each */
+#define PSD_STREAM_NGROUPS(s) ( (s)->method == LAL_PSD_STREAM_MEDIAN_MEAN ? 2 : 1 )
+#define PSD_STREAM_GROUPLEN(s) ( (s)->nsegments / PSD_STREAM_NGROUPS(s) )
+
+/* set up the initial heap fill pattern of each bin */
+static void psd_stream_init_heaps( LALPSDStream *s )
+{
+  const UINT4 b = PSD_STREAM_GROUPLEN( s );
+  UINT4 k;
+  for ( k = 0; k < s->nbins * PSD_STREAM_NGROUPS( s ); ++k )
+    XLALRunningMedianHeapInitREAL8( s->pos + k * b, s->heap + k * b + b / 2, b );
+}
+
+/* median of the ct values of group g of bin k */
+static REAL8 psd_stream_group_median( const LALPSDStream *s, UINT4 k, UINT4 g, UINT4 ct )
+{
+  const UINT4 b = PSD_STREAM_GROUPLEN( s );
+  const REAL8 *v = s->value + k * s->nsegments + g * b;
+  const INT4 *heap = s->heap + k * s->nsegments + g * b + b / 2;
+  REAL8 median = v[heap[0]];
+  if ( ct % 2 == 0 )
+    median = 0.5 * ( median + v[heap[-1]] );
+  return median;
+}
+
+/* compute the periodogram of the buffered segment and add it to the history */
+static int psd_stream_add_segment( LALPSDStream *s )
+{
+  const REAL8 normfac = s->deltaT / s->seglen;
+  const int isnew = s->count < s->nsegments;
+  const INT4 ct = s->count + isnew;
+  UINT4 j, k;
+
+  if ( s->window )
+    for ( j = 0; j < s->seglen; ++j )
+      s->work->data[j] = s->buffer->data[j] * s->window[j];
+  else
+    memcpy( s->work->data, s->buffer->data, s->seglen * sizeof( *s->work->data ) );
+
+  if ( XLALREAL8PowerSpectrum( s->pgram, s->work, s->plan ) == XLAL_FAILURE )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  for ( k = 0; k < s->nbins; ++k )
+  {
+    REAL8 *v = s->value + k * s->nsegments;
+    REAL8 x = s->pgram->data[k] * normfac;
+    if ( s->method == LAL_PSD_STREAM_MEDIAN )
+      XLALRunningMedianHeapInsertREAL8( v, s->pos + k * s->nsegments, s->heap + k * s->nsegments + s->nsegments / 2, s->idx, ct, isnew, x );
+    else if ( s->method == LAL_PSD_STREAM_MEDIAN_MEAN )
+    {
+      /* while filling, slot idx is preceded by idx/2 slots of its group */
+      const UINT4 b = s->nsegments / 2;
+      const UINT4 off = k * s->nsegments + ( s->idx % 2 ) * b;
+      XLALRunningMedianHeapInsertREAL8( s->value + off, s->pos + off, s->heap + off + b / 2, s->idx / 2, isnew ? (INT4) ( s->idx / 2 + 1 ) : (INT4) b, isnew, x );
+    }
+    else
+    {
+      s->sum[k] += isnew ? x : x - v[s->idx];
+      v[s->idx] = x;
+    }
+  }
+
+  /* running sums accumulate rounding errors: recompute them periodically */
+  if ( s->method == LAL_PSD_STREAM_WELCH && ++s->nupdates >= s->nsegments )
+  {
+    for ( k = 0; k < s->nbins; ++k )
+    {
+      const REAL8 *v = s->value + k * s->nsegments;
+      REAL8 sum = 0;
+      for ( j = 0; j < (UINT4) ct; ++j )
+        sum += v[j];
+      s->sum[k] = sum;
+    }
+    s->nupdates = 0;
+  }
+
+  s->idx = ( s->idx + 1 ) % s->nsegments;
+  s->count = ct;
+  s->last = s->start;
+  XLALGPSAdd( &s->last, s->offset * s->deltaT );
+
+  return 0;
+}
+
+/**
+ * Allocate and initialize a LALPSDStream object.
+ *
+ * The LALPSDStream object estimates the power spectral density of a time
+ * series which is supplied incrementally, in arbitrarily sized contiguous
+ * blocks, using XLALPSDStreamAddData().  The time series is divided into
+ * segments of length seglen which start every stride samples, exactly as
+ * in XLALREAL8AverageSpectrumWelch() and XLALREAL8AverageSpectrumMedian().
+ * The modified periodogram of each segment is computed as soon as the
+ * segment is complete, and the PSD returned by XLALPSDStreamGetPSD() is
+ * the mean (for #LAL_PSD_STREAM_WELCH), the bias-corrected median (for
+ * #LAL_PSD_STREAM_MEDIAN), or the mean of the bias-corrected medians of the
+ * even and the odd segments (for #LAL_PSD_STREAM_MEDIAN_MEAN) of the
+ * periodograms of the most recent nsegments segments.  Once nsegments
+ * segments have been seen, the result is identical to that of
+ * XLALREAL8AverageSpectrumWelch(), XLALREAL8AverageSpectrumMedian() or
+ * XLALREAL8AverageSpectrumMedianMean() applied to the corresponding stretch
+ * of data, but each new segment only costs one FFT and an
+ * \f$O(\log \mathrm{nsegments})\f$ update per frequency bin.
+ *
+ * The window, if not NULL, is copied.  The FFT plan must be a forward plan
+ * of length seglen; it is not copied, and must not be destroyed before
+ * the LALPSDStream object.  The stride must be positive and no larger than
+ * seglen.  As for XLALREAL8AverageSpectrumMedianMean(), the median-mean
+ * method requires an even nsegments and a stride of at least seglen/2.
+ */
+LALPSDStream *XLALPSDStreamNew(
+    UINT4                        seglen,
+    UINT4                        stride,
+    UINT4                        nsegments,
+    LALPSDStreamMethod           method,
+    const REAL8Window           *window,
+    const REAL8FFTPlan          *plan
+    )
+{
+  LALPSDStream *s;
+  UINT4 j;
+
+  if ( ! plan )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+  if ( seglen == 0 || nsegments == 0 )
+    XLAL_ERROR_NULL( XLAL_EBADLEN );
+  if ( stride == 0 || stride > seglen )
+    XLAL_ERROR_NULL( XLAL_EINVAL, "stride must be positive and no larger than seglen" );
+  if ( method != LAL_PSD_STREAM_WELCH && method != LAL_PSD_STREAM_MEDIAN && method != LAL_PSD_STREAM_MEDIAN_MEAN )
+    XLAL_ERROR_NULL( XLAL_EINVAL, "unrecognized method %d", (int) method );
+  if ( method == LAL_PSD_STREAM_MEDIAN_MEAN && ( nsegments % 2 || stride < seglen / 2 ) )
+    XLAL_ERROR_NULL( XLAL_EBADLEN, "median-mean requires an even nsegments and stride >= seglen/2" );
+  if ( window )
+  {
+    if ( ! window->data )
+      XLAL_ERROR_NULL( XLAL_EINVAL );
+    if ( window->data->length != seglen )
+      XLAL_ERROR_NULL( XLAL_EBADLEN );
+    if ( window->sumofsquares <= 0 )
+      XLAL_ERROR_NULL( XLAL_EDOM );
+  }
+
+  s = XLALCalloc( 1, sizeof( *s ) );
+  if ( ! s )
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+
+  s->method    = method;
+  s->seglen    = seglen;
+  s->stride    = stride;
+  s->nsegments = nsegments;
+  s->nbins     = seglen / 2 + 1;
+  s->plan      = plan;
+
+  s->buffer = XLALCreateREAL8Vector( seglen );
+  s->work   = XLALCreateREAL8Vector( seglen );
+  s->pgram  = XLALCreateREAL8Vector( s->nbins );
+  s->value  = XLALMalloc( s->nbins * nsegments * sizeof( *s->value ) );
+  if ( method != LAL_PSD_STREAM_WELCH )
+  {
+    s->pos  = XLALMalloc( s->nbins * nsegments * sizeof( *s->pos ) );
+    s->heap = XLALMalloc( s->nbins * nsegments * sizeof( *s->heap ) );
+  }
+  else
+    s->sum  = XLALMalloc( s->nbins * sizeof( *s->sum ) );
+  if ( window )
+    s->window = XLALMalloc( seglen * sizeof( *s->window ) );
+  if ( ! s->buffer || ! s->work || ! s->pgram || ! s->value
+      || ( method != LAL_PSD_STREAM_WELCH && ( ! s->pos || ! s->heap ) )
+      || ( method == LAL_PSD_STREAM_WELCH && ! s->sum )
+      || ( window && ! s->window ) )
+  {
+    XLALPSDStreamFree( s );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+
+  /* store the window with the normalization of XLALUnitaryWindowREAL8Sequence() */
+  if ( window )
+  {
+    REAL8 norm = sqrt( window->data->length / window->sumofsquares );
+    for ( j = 0; j < seglen; ++j )
+      s->window[j] = window->data->data[j] * norm;
+  }
+
+  XLALPSDStreamReset( s );
+
+  return s;
+}
+
+/**
+ * Free all memory associated with a LALPSDStream object.  The FFT plan
+ * passed to XLALPSDStreamNew() is not destroyed.
+ */
+void XLALPSDStreamFree( LALPSDStream *s )
+{
+  if ( s )
+  {
+    XLALDestroyREAL8Vector( s->buffer );
+    XLALDestroyREAL8Vector( s->work );
+    XLALDestroyREAL8Vector( s->pgram );
+    XLALFree( s->value );
+    XLALFree( s->pos );
+    XLALFree( s->heap );
+    XLALFree( s->sum );
+    XLALFree( s->window );
+    XLALFree( s );
+  }
+}
+
+/**
+ * Reset a LALPSDStream object to the newly-allocated state, discarding
+ * all buffered data and periodogram history.  The next call to
+ * XLALPSDStreamAddData() may start at any epoch and sample rate.
+ */
+void XLALPSDStreamReset( LALPSDStream *s )
+{
+  if ( ! s )
+    return;
+  s->nbuffered = 0;
+  s->idx       = 0;
+  s->count     = 0;
+  s->nupdates  = 0;
+  s->offset    = 0;
+  s->deltaT    = 0;
+  s->f0        = 0;
+  XLALGPSSetREAL8( &s->start, 0 );
+  s->last      = s->start;
+  s->sampleUnits = lalDimensionlessUnit;
+  if ( s->sum )
+    memset( s->sum, 0, s->nbins * sizeof( *s->sum ) );
+  if ( s->method != LAL_PSD_STREAM_WELCH )
+    psd_stream_init_heaps( s );
+}
+
+/**
+ * Return the number of segments from which the current PSD estimate of a
+ * LALPSDStream object is computed.  This counts the segments processed
+ * since the object was created or reset, until the count reaches the
+ * nsegments passed to XLALPSDStreamNew() and then it stops increasing.
+ */
+UINT4 XLALPSDStreamGetNSegments( const LALPSDStream *s )
+{
+  if ( ! s )
+    XLAL_ERROR_VAL( 0, XLAL_EFAULT );
+  return s->count;
+}
+
+/**
+ * Add a block of time series data to a LALPSDStream object.  The block
+ * must immediately follow the data previously added, i.e., its epoch must
+ * be that of the previous block plus the previous block's duration, and it
+ * must have the same sample interval.  The data are copied.
+ *
+ * Returns the number of new segments that were completed by the block,
+ * each of which updates the PSD estimate, or #XLAL_FAILURE on error.
+ */
+int XLALPSDStreamAddData( LALPSDStream *s, const REAL8TimeSeries *tseries )
+{
+  UINT4 nseg = 0;
+  UINT4 i = 0;
+
+  if ( ! s || ! tseries )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( ! tseries->data )
+    XLAL_ERROR( XLAL_EINVAL );
+  if ( tseries->deltaT <= 0.0 )
+    XLAL_ERROR( XLAL_EINVAL );
+
+  if ( s->deltaT == 0 )
+  {
+    /* first data since creation or reset */
+    s->start       = tseries->epoch;
+    s->deltaT      = tseries->deltaT;
+    s->f0          = tseries->f0;
+    s->sampleUnits = tseries->sampleUnits;
+  }
+  else
+  {
+    LIGOTimeGPS expected = s->start;
+    XLALGPSAdd( &expected, ( s->offset + s->nbuffered ) * s->deltaT );
+    if ( fabs( tseries->deltaT - s->deltaT ) > 1e-9 * s->deltaT )
+      XLAL_ERROR( XLAL_EINVAL, "sample interval %g does not match %g", tseries->deltaT, s->deltaT );
+    if ( fabs( XLALGPSDiff( &tseries->epoch, &expected ) ) > 0.5 * s->deltaT )
+      XLAL_ERROR( XLAL_EINVAL, "data are not contiguous with previous data" );
+  }
+
+  while ( i < tseries->data->length )
+  {
+    UINT4 n = s->seglen - s->nbuffered;
+    if ( n > tseries->data->length - i )
+      n = tseries->data->length - i;
+    memcpy( s->buffer->data + s->nbuffered, tseries->data->data + i, n * sizeof( *s->buffer->data ) );
+    s->nbuffered += n;
+    i += n;
+
+    if ( s->nbuffered == s->seglen )
+    {
+      if ( psd_stream_add_segment( s ) < 0 )
+        XLAL_ERROR( XLAL_EFUNC );
+      memmove( s->buffer->data, s->buffer->data + s->stride, ( s->seglen - s->stride ) * sizeof( *s->buffer->data ) );
+      s->nbuffered -= s->stride;
+      s->offset += s->stride;
+      ++nseg;
+    }
+  }
+
+  return nseg;
+}
+
+/**
+ * Return the current PSD estimate of a LALPSDStream object as a
+ * newly-allocated frequency series, which the calling code must free.
+ * The epoch of the PSD is that of the oldest segment contributing to the
+ * estimate.  At least one segment must have been completed.
+ */
+REAL8FrequencySeries *XLALPSDStreamGetPSD( const LALPSDStream *s )
+{
+  REAL8FrequencySeries *psd;
+  LIGOTimeGPS epoch;
+  LALUnit unit;
+  REAL8 normfac;
+  UINT4 k;
+
+  if ( ! s )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+  if ( ! s->count )
+    XLAL_ERROR_NULL( XLAL_EDATA, "no complete segments" );
+
+  epoch = s->last;
+  XLALGPSAdd( &epoch, -( (REAL8) ( s->count - 1 ) * s->stride ) * s->deltaT );
+
+  if ( ! XLALUnitSquare( &unit, &s->sampleUnits ) || ! XLALUnitMultiply( &unit, &unit, &lalSecondUnit ) )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+
+  psd = XLALCreateREAL8FrequencySeries( "PSD", &epoch, s->f0, 1.0 / ( s->seglen * s->deltaT ), &unit, s->nbins );
+  if ( ! psd )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+
+  if ( s->method == LAL_PSD_STREAM_MEDIAN )
+  {
+    normfac = 1.0 / XLALMedianBias( s->count );
+    for ( k = 0; k < s->nbins; ++k )
+      psd->data->data[k] = psd_stream_group_median( s, k, 0, s->count ) * normfac;
+  }
+  else if ( s->method == LAL_PSD_STREAM_MEDIAN_MEAN )
+  {
+    /* until the ring buffers are full, the even slots may hold one more
+     * segment than the odd slots, which may still be empty */
+    const UINT4 cteven = ( s->count + 1 ) / 2;
+    const UINT4 ctodd = s->count / 2;
+    const REAL8 evenfac = 1.0 / XLALMedianBias( cteven );
+    const REAL8 oddfac = ctodd ? 1.0 / XLALMedianBias( ctodd ) : 0;
+    for ( k = 0; k < s->nbins; ++k )
+    {
+      REAL8 x = psd_stream_group_median( s, k, 0, cteven ) * evenfac;
+      if ( ctodd )
+        x = 0.5 * ( x + psd_stream_group_median( s, k, 1, ctodd ) * oddfac );
+      psd->data->data[k] = x;
+    }
+  }
+  else
+  {
+    normfac = 1.0 / s->count;
+    for ( k = 0; k < s->nbins; ++k )
+      psd->data->data[k] = s->sum[k] * normfac;
+  }
+
+  return psd;
+}
+
+
+
 /**
  * Compute the two-point spectral correlation function for a whitened
  * frequency series from the window applied to the original time series.
@@ -30,6 +30,8 @@
 #include <lal/LALMalloc.h>
 #include <lal/XLALError.h>
 
+#include "FFTBatchPlan.h"
+
 /**
  * \addtogroup ComplexFFT_h
  *
@@ -140,6 +142,34 @@ tagCOMPLEX16FFTPlan
   fftw_plan  plan; /**< the FFTW plan */
 };
 
+/**
+ * Plan to perform a batch of FFTs of COMPLEX8 data
+ */
+struct
+tagCOMPLEX8FFTBatchPlan
+{
+  INT4       sign;    /**< sign in transform exponential, -1 for forward, +1 for reverse */
+  UINT4      size;    /**< length of each complex data vector for this plan */
+  UINT4      howmany; /**< number of transforms performed by this plan */
+  UINT4      stride;  /**< stride between successive elements of each data vector */
+  UINT4      dist;    /**< distance between the first elements of successive data vectors */
+  fftwf_plan plan;    /**< the FFTW plan */
+};
+
+/**
+ * Plan to perform a batch of FFTs of COMPLEX16 data
+ */
+struct
+tagCOMPLEX16FFTBatchPlan
+{
+  INT4       sign;    /**< sign in transform exponential, -1 for forward, +1 for reverse */
+  UINT4      size;    /**< length of each complex data vector for this plan */
+  UINT4      howmany; /**< number of transforms performed by this plan */
+  UINT4      stride;  /**< stride between successive elements of each data vector */
+  UINT4      dist;    /**< distance between the first elements of successive data vectors */
+  fftw_plan  plan;    /**< the FFTW plan */
+};
+
 /* single- and double-precision routines */
 
 #define SINGLE_PRECISION
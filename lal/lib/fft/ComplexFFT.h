@@ -43,6 +43,13 @@ extern "C" {
  * Perform complex-to-complex fast Fourier transforms of vectors using the
  * package FFTW \cite fj_1998 .
  *
+ * A COMPLEX8FFTBatchPlan performs \c howmany transforms of length \c size
+ * with a single call into the FFT library.  Element \c j of data vector
+ * \c i is located at index <tt>i * dist + j * stride</tt> of the data array
+ * of both the input and the output VectorSequence; a sequence of
+ * \c howmany contiguous vectors of length \c size corresponds to
+ * <tt>stride = 1</tt> and <tt>dist = size</tt>.
+ *
  */
 /** @{ */
 
@@ -81,10 +88,16 @@ typedef struct tagCOMPLEX8FFTPlan COMPLEX8FFTPlan;
 typedef struct tagCOMPLEX16FFTPlan COMPLEX16FFTPlan;
 #define tagComplexFFTPlan tagCOMPLEX8FFTPlan
 #define ComplexFFTPlan COMPLEX8FFTPlan
+/** Plan to perform a batch of FFTs of COMPLEX8 data */
+typedef struct tagCOMPLEX8FFTBatchPlan COMPLEX8FFTBatchPlan;
+/** Plan to perform a batch of FFTs of COMPLEX16 data */
+typedef struct tagCOMPLEX16FFTBatchPlan COMPLEX16FFTBatchPlan;
 
 #ifdef SWIG /* SWIG interface directives */
 SWIGLAL(VIEWIN_ARRAYS(COMPLEX8Vector, output));
 SWIGLAL(VIEWIN_ARRAYS(COMPLEX16Vector, output));
+SWIGLAL(VIEWIN_ARRAYS(COMPLEX8VectorSequence, output));
+SWIGLAL(VIEWIN_ARRAYS(COMPLEX16VectorSequence, output));
 #endif /* SWIG */
 
 /*
@@ -358,6 +371,117 @@ void XLALDestroyCOMPLEX16FFTPlan( COMPLEX16FFTPlan *plan );
  */
 int XLALCOMPLEX16VectorFFT( COMPLEX16Vector * _LAL_RESTRICT_ output, const COMPLEX16Vector * _LAL_RESTRICT_ input, const COMPLEX16FFTPlan *plan );
 
+/*
+ *
+ * XLAL batched functions
+ *
+ */
+
+/**
+ * Returns a new COMPLEX8FFTBatchPlan
+ *
+ * A COMPLEX8FFTBatchPlan performs \c howmany FFTs of complex data vectors
+ * of length \c size at once.  Element \c j of data vector \c i is stored
+ * at index <tt>i * dist + j * stride</tt> of the input and output data
+ * arrays.  The output vectors must not overlap.
+ *
+ * @param[in] size The number of points in each complex data vector.
+ * @param[in] howmany The number of transforms performed by the plan.
+ * @param[in] stride The stride between successive elements of each data vector.
+ * @param[in] dist The distance between the first elements of successive
+ * data vectors.
+ * @param[in] fwdflg Set non-zero for a forward FFT plan;
+ * otherwise create a reverse plan
+ * @param[in] measurelvl Measurement level for plan creation, as for
+ * XLALCreateCOMPLEX8FFTPlan().
+ * @return A pointer to an allocated \c COMPLEX8FFTBatchPlan structure is
+ * returned upon successful completion.  Otherwise, a \c NULL pointer is
+ * returned and \c xlalErrno is set to indicate the error.
+ * @par Errors:
+ * The \c XLALCreateCOMPLEX8FFTBatchPlan() function shall fail if:
+ * - [\c XLAL_EBADLEN] The size or number of transforms of the requested plan is 0.
+ * - [\c XLAL_EINVAL] The stride is 0, the distance is 0 for more than one
+ * transform, or the data vectors overlap.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * - [\c XLAL_EFAILED] The call to the underlying FFTW routine failed.
+ * .
+ */
+COMPLEX8FFTBatchPlan * XLALCreateCOMPLEX8FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, int measurelvl );
+
+/**
+ * Returns a new COMPLEX8FFTBatchPlan for forward transforms;
+ * equivalent to XLALCreateCOMPLEX8FFTBatchPlan() with \c fwdflg set to 1.
+ */
+COMPLEX8FFTBatchPlan * XLALCreateForwardCOMPLEX8FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+
+/**
+ * Returns a new COMPLEX8FFTBatchPlan for reverse transforms;
+ * equivalent to XLALCreateCOMPLEX8FFTBatchPlan() with \c fwdflg set to 0.
+ */
+COMPLEX8FFTBatchPlan * XLALCreateReverseCOMPLEX8FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+
+/**
+ * Destroys a COMPLEX8FFTBatchPlan
+ * @param[in] plan A pointer to the COMPLEX8FFTBatchPlan to be destroyed.
+ * @return None.
+ */
+void XLALDestroyCOMPLEX8FFTBatchPlan( COMPLEX8FFTBatchPlan *plan );
+
+/**
+ * Perform a batch of COMPLEX8 FFTs
+ *
+ * Each data vector in \c input, laid out as described by the plan, is
+ * transformed as by XLALCOMPLEX8VectorFFT() and stored with the same
+ * layout in \c output.
+ *
+ * @param[out] output The complex output data
+ * @param[in] input The complex input data
+ * @param[in] plan The FFT batch plan to use for the transforms
+ * @note
+ * The input and output sequences must be distinct.
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALCOMPLEX8VectorSequenceFFT() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the input and output data
+ * sequences are the same.
+ * - [\c XLAL_EBADLEN] The input or output sequence is too short for the
+ * plan layout.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * .
+ */
+int XLALCOMPLEX8VectorSequenceFFT( COMPLEX8VectorSequence * _LAL_RESTRICT_ output, const COMPLEX8VectorSequence * _LAL_RESTRICT_ input, const COMPLEX8FFTBatchPlan *plan );
+
+/**
+ * Returns a new COMPLEX16FFTBatchPlan; see XLALCreateCOMPLEX8FFTBatchPlan().
+ */
+COMPLEX16FFTBatchPlan * XLALCreateCOMPLEX16FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, int measurelvl );
+
+/**
+ * Returns a new COMPLEX16FFTBatchPlan for forward transforms;
+ * equivalent to XLALCreateCOMPLEX16FFTBatchPlan() with \c fwdflg set to 1.
+ */
+COMPLEX16FFTBatchPlan * XLALCreateForwardCOMPLEX16FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+
+/**
+ * Returns a new COMPLEX16FFTBatchPlan for reverse transforms;
+ * equivalent to XLALCreateCOMPLEX16FFTBatchPlan() with \c fwdflg set to 0.
+ */
+COMPLEX16FFTBatchPlan * XLALCreateReverseCOMPLEX16FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+
+/**
+ * Destroys a COMPLEX16FFTBatchPlan
+ * @param[in] plan A pointer to the COMPLEX16FFTBatchPlan to be destroyed.
+ * @return None.
+ */
+void XLALDestroyCOMPLEX16FFTBatchPlan( COMPLEX16FFTBatchPlan *plan );
+
+/**
+ * Perform a batch of COMPLEX16 FFTs; see XLALCOMPLEX8VectorSequenceFFT().
+ */
+int XLALCOMPLEX16VectorSequenceFFT( COMPLEX16VectorSequence * _LAL_RESTRICT_ output, const COMPLEX16VectorSequence * _LAL_RESTRICT_ input, const COMPLEX16FFTBatchPlan *plan );
+
+
 /** @} */
 
 #if 0
@@ -21,11 +21,22 @@
 #define DESTROY_PLAN_FUNCTION		CONCAT2(XLALDestroy,PLAN_TYPE)
 #define VECTOR_FFT_FUNCTION		CONCAT3(XLAL,COMPLEX_VECTOR_TYPE,FFT)
 
+#define BATCH_PLAN_TYPE			CONCAT2(COMPLEX_TYPE,FFTBatchPlan)
+#define COMPLEX_SEQUENCE_TYPE		CONCAT2(COMPLEX_TYPE,VectorSequence)
+
+#define CREATE_BATCH_PLAN_FUNCTION		CONCAT2(XLALCreate,BATCH_PLAN_TYPE)
+#define CREATE_FORWARD_BATCH_PLAN_FUNCTION	CONCAT2(XLALCreateForward,BATCH_PLAN_TYPE)
+#define CREATE_REVERSE_BATCH_PLAN_FUNCTION	CONCAT2(XLALCreateReverse,BATCH_PLAN_TYPE)
+#define DESTROY_BATCH_PLAN_FUNCTION		CONCAT2(XLALDestroy,BATCH_PLAN_TYPE)
+#define SEQUENCE_FFT_FUNCTION			CONCAT3(XLAL,COMPLEX_SEQUENCE_TYPE,FFT)
+#define BATCH_EXTENT_FUNCTION			CONCAT2(BATCH_PLAN_TYPE,Extent)
+
 #define FFTWX				CONCAT2(fftw,TYPESUFFIX)
 #define FFTWX_COMPLEX			CONCAT2(FFTWX,_complex)
 #define FFTWX_PLAN_DFT_1D		CONCAT2(FFTWX,_plan_dft_1d)
 #define FFTWX_DESTROY_PLAN		CONCAT2(FFTWX,_destroy_plan)
 #define FFTWX_EXECUTE_DFT		CONCAT2(FFTWX,_execute_dft)
+#define FFTWX_PLAN_MANY_DFT		CONCAT2(FFTWX,_plan_many_dft)
 
 PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
 {
@@ -90,8 +101,11 @@ PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
     /* establish fftw mutex lock and create plan */
 
     LAL_FFTW_WISDOM_LOCK;
+    XLALFFTWImportWisdomCache();
+    XLALFFTWPlanWithNThreads(0);
     plan->plan =
         FFTWX_PLAN_DFT_1D(size, (FFTWX_COMPLEX *) tmp1, (FFTWX_COMPLEX *) tmp2, fwdflg ? FFTW_FORWARD : FFTW_BACKWARD, flags);
+    XLALFFTWPlanWithNThreads(1);
     LAL_FFTW_WISDOM_UNLOCK;
 
     /* free the temporary arrays */
@@ -209,6 +223,223 @@ int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPL
     return 0;
 }
 
+/*
+ *
+ * Batched transforms
+ *
+ */
+
+/* number of elements spanned by the data of a batch plan */
+static size_t BATCH_EXTENT_FUNCTION(const BATCH_PLAN_TYPE * plan)
+{
+    return (size_t) (plan->howmany - 1) * plan->dist + (size_t) (plan->size - 1) * plan->stride + 1;
+}
+
+BATCH_PLAN_TYPE *CREATE_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    COMPLEX_TYPE *tmp1;
+    COMPLEX_TYPE *tmp2;
+    size_t nbytes;
+    int n;
+    int flags;
+
+    if (!size || !howmany)
+        XLAL_ERROR_NULL(XLAL_EBADLEN);
+    if (!stride || (howmany > 1 && !dist))
+        XLAL_ERROR_NULL(XLAL_EINVAL);
+    if (BatchVectorsOverlap(size, howmany, stride, dist))
+        XLAL_ERROR_NULL(XLAL_EINVAL, "Data vectors of the batch overlap");
+
+    /* allocate memory for the plan */
+
+    plan = XLALMalloc(sizeof(*plan));
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    plan->size = size;
+    plan->howmany = howmany;
+    plan->stride = stride;
+    plan->dist = dist;
+    plan->sign = (fwdflg ? -1 : 1);
+
+    nbytes = BATCH_EXTENT_FUNCTION(plan) * sizeof(COMPLEX_TYPE);
+
+    /* set fftw3 flags to perform requested degree of measurement */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    flags = 0;
+#   else
+    flags = FFTW_UNALIGNED;
+#   endif
+
+    switch (measurelvl) {
+    case 0:    /* estimate */
+        flags |= FFTW_ESTIMATE;
+        break;
+    default:   /* exhaustive measurement */
+        flags |= FFTW_EXHAUSTIVE;
+        /* fall-through */
+    case 2:    /* lengthy measurement */
+        flags |= FFTW_PATIENT;
+        /* fall-through */
+    case 1:    /* measure the best plan */
+        flags |= FFTW_MEASURE;
+        break;
+    }
+
+    /* allocate memory for the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmp1 = XLALMallocAligned(nbytes);
+    tmp2 = XLALMallocAligned(nbytes);
+    if (!tmp1 || !tmp2) {
+        XLALFreeAligned(tmp1);
+        XLALFreeAligned(tmp2);
+        XLALFree(plan);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   else
+    tmp1 = XLALMalloc(nbytes);
+    tmp2 = XLALMalloc(nbytes);
+    if (!tmp1 || !tmp2) {
+        XLALFree(tmp1);
+        XLALFree(tmp2);
+        XLALFree(plan);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   endif
+
+    /* establish fftw mutex lock and create plan */
+
+    n = size;
+    LAL_FFTW_WISDOM_LOCK;
+    XLALFFTWImportWisdomCache();
+    XLALFFTWPlanWithNThreads(0);
+    plan->plan =
+        FFTWX_PLAN_MANY_DFT(1, &n, howmany, (FFTWX_COMPLEX *) tmp1, NULL, stride, dist, (FFTWX_COMPLEX *) tmp2, NULL,
+        stride, dist, fwdflg ? FFTW_FORWARD : FFTW_BACKWARD, flags);
+    XLALFFTWPlanWithNThreads(1);
+    LAL_FFTW_WISDOM_UNLOCK;
+
+    /* free the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    XLALFreeAligned(tmp1);
+    XLALFreeAligned(tmp2);
+#   else
+    XLALFree(tmp1);
+    XLALFree(tmp2);
+#   endif
+
+    /* check to see success of plan creation */
+
+    if (!plan->plan) {
+        XLALFree(plan);
+        XLAL_ERROR_NULL(XLAL_EFAILED);
+    }
+
+    return plan;
+}
+
+BATCH_PLAN_TYPE *CREATE_FORWARD_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    plan = CREATE_BATCH_PLAN_FUNCTION(size, howmany, stride, dist, 1, measurelvl);
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    return plan;
+}
+
+BATCH_PLAN_TYPE *CREATE_REVERSE_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    plan = CREATE_BATCH_PLAN_FUNCTION(size, howmany, stride, dist, 0, measurelvl);
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    return plan;
+}
+
+void DESTROY_BATCH_PLAN_FUNCTION(BATCH_PLAN_TYPE * plan)
+{
+    if (plan) {
+        if (plan->plan) {
+            LAL_FFTW_WISDOM_LOCK;
+            FFTWX_DESTROY_PLAN(plan->plan);
+            LAL_FFTW_WISDOM_UNLOCK;
+        }
+        memset(plan, 0, sizeof(*plan));
+        XLALFree(plan);
+    }
+}
+
+int SEQUENCE_FFT_FUNCTION(COMPLEX_SEQUENCE_TYPE * _LAL_RESTRICT_ output, const COMPLEX_SEQUENCE_TYPE * _LAL_RESTRICT_ input,
+    const BATCH_PLAN_TYPE * plan)
+{
+    COMPLEX_TYPE *input_data;
+    COMPLEX_TYPE *output_data;
+    size_t nbytes;
+
+    /* sanity check on arguments */
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data || output->data == input->data)
+        XLAL_ERROR(XLAL_EINVAL);        /* note: must be out-of-place */
+    if ((size_t) input->length * input->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+    if ((size_t) output->length * output->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+
+    input_data = input->data;
+    output_data = output->data;
+    nbytes = BATCH_EXTENT_FUNCTION(plan) * sizeof(COMPLEX_TYPE);
+
+    /* if memory alignment is required, check memory alignment and create
+     * temporary space if necessary */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (!LAL_IS_MEMORY_ALIGNED(input_data)) {
+        input_data = XLALMallocAligned(nbytes);
+        if (!input_data)
+            XLAL_ERROR(XLAL_ENOMEM);
+        memcpy(input_data, input->data, nbytes);
+    }
+    if (!LAL_IS_MEMORY_ALIGNED(output_data)) {
+        /* copy the existing output so that elements between strided
+         * vectors are preserved when the data is copied back */
+        output_data = XLALMallocAligned(nbytes);
+        if (!output_data) {
+            if (input_data != input->data)
+                XLALFreeAligned(input_data);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+        memcpy(output_data, output->data, nbytes);
+    }
+#   else
+    (void) nbytes;
+#   endif
+
+    /* perform all the ffts */
+
+    FFTWX_EXECUTE_DFT(plan->plan, (FFTWX_COMPLEX *)input_data, (FFTWX_COMPLEX *)output_data);
+
+    /* cleanup aligned memory space if memory alignment is required;
+     * copy data from temporary space to output sequence */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (input_data != input->data)
+        XLALFreeAligned(input_data);
+    if (output_data != output->data) {
+        memcpy(output->data, output_data, nbytes);
+        XLALFreeAligned(output_data);
+    }
+#   endif
+
+    return 0;
+}
+
 #undef CONCAT2x
 #undef CONCAT2
 #undef CONCAT3x
@@ -227,8 +458,19 @@ int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPL
 #undef DESTROY_PLAN_FUNCTION
 #undef VECTOR_FFT_FUNCTION
 
+#undef BATCH_PLAN_TYPE
+#undef COMPLEX_SEQUENCE_TYPE
+
+#undef CREATE_BATCH_PLAN_FUNCTION
+#undef CREATE_FORWARD_BATCH_PLAN_FUNCTION
+#undef CREATE_REVERSE_BATCH_PLAN_FUNCTION
+#undef DESTROY_BATCH_PLAN_FUNCTION
+#undef SEQUENCE_FFT_FUNCTION
+#undef BATCH_EXTENT_FUNCTION
+
 #undef FFTWX
 #undef FFTWX_COMPLEX
 #undef FFTWX_PLAN_DFT_1D
 #undef FFTWX_DESTROY_PLAN
 #undef FFTWX_EXECUTE_DFT
+#undef FFTWX_PLAN_MANY_DFT
@@ -0,0 +1,259 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/*
+ * Batched FFT plans for the CUDA backend.  These are implemented by
+ * gathering each vector of the batch into a contiguous vector and calling
+ * the single-vector routines, so that code using the batched interface
+ * continues to work with this backend.
+ */
+
+#include <string.h>
+
+#include <lal/LALDatatypes.h>
+#include <lal/LALMalloc.h>
+#include <lal/AVFactories.h>
+#include <lal/RealFFT.h>
+#include <lal/ComplexFFT.h>
+#include <lal/XLALError.h>
+
+#include "FFTBatchPlan.h"
+
+#define BATCH_PLAN_FIELDS \
+  INT4       sign;    /* sign in transform exponential, -1 for forward, +1 for reverse */ \
+  UINT4      size;    /* length of each data vector for this plan */ \
+  UINT4      howmany; /* number of transforms performed by this plan */ \
+  UINT4      stride;  /* stride between successive elements of each data vector */ \
+  UINT4      dist;    /* distance between the first elements of successive data vectors */
+
+struct tagREAL4FFTBatchPlan { BATCH_PLAN_FIELDS REAL4FFTPlan *plan; };
+struct tagREAL8FFTBatchPlan { BATCH_PLAN_FIELDS REAL8FFTPlan *plan; };
+struct tagCOMPLEX8FFTBatchPlan { BATCH_PLAN_FIELDS COMPLEX8FFTPlan *plan; };
+struct tagCOMPLEX16FFTBatchPlan { BATCH_PLAN_FIELDS COMPLEX16FFTPlan *plan; };
+
+#define EXTENT(plan) ((size_t) ((plan)->howmany - 1) * (plan)->dist + (size_t) ((plan)->size - 1) * (plan)->stride + 1)
+
+/* CHECK_OVERLAP is non-zero for complex plans, whose output vectors must not overlap;
+ * for real plans, only the real output vectors of reverse plans must not overlap */
+#define DEFINE_BATCH_PLAN(PLAN, SINGLE, CHECK_OVERLAP) \
+PLAN##FFTBatchPlan * XLALCreate##PLAN##FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, int measurelvl ) \
+{ \
+  PLAN##FFTBatchPlan *plan; \
+  if ( ! size || ! howmany ) \
+    XLAL_ERROR_NULL( XLAL_EBADLEN ); \
+  if ( ! stride || ( howmany > 1 && ! dist ) ) \
+    XLAL_ERROR_NULL( XLAL_EINVAL ); \
+  if ( ( CHECK_OVERLAP || ! fwdflg ) && BatchVectorsOverlap( size, howmany, stride, dist ) ) \
+    XLAL_ERROR_NULL( XLAL_EINVAL, "Data vectors of the batch overlap" ); \
+  plan = XLALMalloc( sizeof( *plan ) ); \
+  if ( ! plan ) \
+    XLAL_ERROR_NULL( XLAL_ENOMEM ); \
+  plan->plan = XLALCreate##SINGLE##FFTPlan( size, fwdflg, measurelvl ); \
+  if ( ! plan->plan ) \
+  { \
+    XLALFree( plan ); \
+    XLAL_ERROR_NULL( XLAL_EFUNC ); \
+  } \
+  plan->sign = ( fwdflg ? -1 : 1 ); \
+  plan->size = size; \
+  plan->howmany = howmany; \
+  plan->stride = stride; \
+  plan->dist = dist; \
+  return plan; \
+} \
+PLAN##FFTBatchPlan * XLALCreateForward##PLAN##FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl ) \
+{ \
+  PLAN##FFTBatchPlan *plan; \
+  plan = XLALCreate##PLAN##FFTBatchPlan( size, howmany, stride, dist, 1, measurelvl ); \
+  if ( ! plan ) \
+    XLAL_ERROR_NULL( XLAL_EFUNC ); \
+  return plan; \
+} \
+PLAN##FFTBatchPlan * XLALCreateReverse##PLAN##FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl ) \
+{ \
+  PLAN##FFTBatchPlan *plan; \
+  plan = XLALCreate##PLAN##FFTBatchPlan( size, howmany, stride, dist, 0, measurelvl ); \
+  if ( ! plan ) \
+    XLAL_ERROR_NULL( XLAL_EFUNC ); \
+  return plan; \
+} \
+void XLALDestroy##PLAN##FFTBatchPlan( PLAN##FFTBatchPlan *plan ) \
+{ \
+  if ( plan ) \
+  { \
+    XLALDestroy##SINGLE##FFTPlan( plan->plan ); \
+    XLALFree( plan ); \
+  } \
+}
+
+DEFINE_BATCH_PLAN(REAL4, REAL4, 0)
+DEFINE_BATCH_PLAN(REAL8, REAL8, 0)
+DEFINE_BATCH_PLAN(COMPLEX8, COMPLEX8, 1)
+DEFINE_BATCH_PLAN(COMPLEX16, COMPLEX16, 1)
+
+/*
+ * Real transforms: gather each real vector, transform it, and store the
+ * result in the corresponding vector of the complex (or spectrum) sequence.
+ */
+
+#define DEFINE_REAL_BATCH_TRANSFORMS(R, C) \
+int XLAL##R##VectorSequenceForwardFFT( C##VectorSequence *output, const R##VectorSequence *input, const R##FFTBatchPlan *plan ) \
+{ \
+  R##Vector *in; \
+  C##Vector out; \
+  UINT4 i, j; \
+  if ( ! output || ! input || ! plan ) \
+    XLAL_ERROR( XLAL_EFAULT ); \
+  if ( ! plan->plan || plan->sign != -1 || ! output->data || ! input->data ) \
+    XLAL_ERROR( XLAL_EINVAL ); \
+  if ( (size_t) input->length * input->vectorLength < EXTENT( plan ) ) \
+    XLAL_ERROR( XLAL_EBADLEN ); \
+  if ( output->length != plan->howmany || output->vectorLength != plan->size / 2 + 1 ) \
+    XLAL_ERROR( XLAL_EBADLEN ); \
+  in = XLALCreate##R##Vector( plan->size ); \
+  if ( ! in ) \
+    XLAL_ERROR( XLAL_EFUNC ); \
+  out.length = output->vectorLength; \
+  for ( i = 0; i < plan->howmany; ++i ) \
+  { \
+    for ( j = 0; j < plan->size; ++j ) \
+      in->data[j] = input->data[(size_t) i * plan->dist + (size_t) j * plan->stride]; \
+    out.data = output->data + (size_t) i * output->vectorLength; \
+    if ( XLAL##R##ForwardFFT( &out, in, plan->plan ) < 0 ) \
+    { \
+      XLALDestroy##R##Vector( in ); \
+      XLAL_ERROR( XLAL_EFUNC ); \
+    } \
+  } \
+  XLALDestroy##R##Vector( in ); \
+  return 0; \
+} \
+int XLAL##R##VectorSequenceReverseFFT( R##VectorSequence *output, const C##VectorSequence *input, const R##FFTBatchPlan *plan ) \
+{ \
+  R##Vector *out; \
+  C##Vector in; \
+  UINT4 i, j; \
+  if ( ! output || ! input || ! plan ) \
+    XLAL_ERROR( XLAL_EFAULT ); \
+  if ( ! plan->plan || plan->sign != 1 || ! output->data || ! input->data ) \
+    XLAL_ERROR( XLAL_EINVAL ); \
+  if ( (size_t) output->length * output->vectorLength < EXTENT( plan ) ) \
+    XLAL_ERROR( XLAL_EBADLEN ); \
+  if ( input->length != plan->howmany || input->vectorLength != plan->size / 2 + 1 ) \
+    XLAL_ERROR( XLAL_EBADLEN ); \
+  out = XLALCreate##R##Vector( plan->size ); \
+  if ( ! out ) \
+    XLAL_ERROR( XLAL_EFUNC ); \
+  in.length = input->vectorLength; \
+  for ( i = 0; i < plan->howmany; ++i ) \
+  { \
+    in.data = input->data + (size_t) i * input->vectorLength; \
+    if ( XLAL##R##ReverseFFT( out, &in, plan->plan ) < 0 ) \
+    { \
+      XLALDestroy##R##Vector( out ); \
+      XLAL_ERROR( XLAL_EFUNC ); \
+    } \
+    for ( j = 0; j < plan->size; ++j ) \
+      output->data[(size_t) i * plan->dist + (size_t) j * plan->stride] = out->data[j]; \
+  } \
+  XLALDestroy##R##Vector( out ); \
+  return 0; \
+} \
+int XLAL##R##VectorSequencePowerSpectrum( R##VectorSequence *spec, const R##VectorSequence *data, const R##FFTBatchPlan *plan ) \
+{ \
+  R##Vector *in; \
+  R##Vector out; \
+  UINT4 i, j; \
+  if ( ! spec || ! data || ! plan ) \
+    XLAL_ERROR( XLAL_EFAULT ); \
+  if ( ! plan->plan || plan->sign != -1 || ! spec->data || ! data->data ) \
+    XLAL_ERROR( XLAL_EINVAL ); \
+  if ( (size_t) data->length * data->vectorLength < EXTENT( plan ) ) \
+    XLAL_ERROR( XLAL_EBADLEN ); \
+  if ( spec->length != plan->howmany || spec->vectorLength != plan->size / 2 + 1 ) \
+    XLAL_ERROR( XLAL_EBADLEN ); \
+  in = XLALCreate##R##Vector( plan->size ); \
+  if ( ! in ) \
+    XLAL_ERROR( XLAL_EFUNC ); \
+  out.length = spec->vectorLength; \
+  for ( i = 0; i < plan->howmany; ++i ) \
+  { \
+    for ( j = 0; j < plan->size; ++j ) \
+      in->data[j] = data->data[(size_t) i * plan->dist + (size_t) j * plan->stride]; \
+    out.data = spec->data + (size_t) i * spec->vectorLength; \
+    if ( XLAL##R##PowerSpectrum( &out, in, plan->plan ) < 0 ) \
+    { \
+      XLALDestroy##R##Vector( in ); \
+      XLAL_ERROR( XLAL_EFUNC ); \
+    } \
+  } \
+  XLALDestroy##R##Vector( in ); \
+  return 0; \
+}
+
+DEFINE_REAL_BATCH_TRANSFORMS(REAL4, COMPLEX8)
+DEFINE_REAL_BATCH_TRANSFORMS(REAL8, COMPLEX16)
+
+/*
+ * Complex transforms: gather each input vector, transform it, and scatter
+ * the result into the output sequence with the same layout.
+ */
+
+#define DEFINE_COMPLEX_BATCH_TRANSFORM(C) \
+int XLAL##C##VectorSequenceFFT( C##VectorSequence * _LAL_RESTRICT_ output, const C##VectorSequence * _LAL_RESTRICT_ input, const C##FFTBatchPlan *plan ) \
+{ \
+  C##Vector *in; \
+  C##Vector *out; \
+  UINT4 i, j; \
+  if ( ! output || ! input || ! plan ) \
+    XLAL_ERROR( XLAL_EFAULT ); \
+  if ( ! plan->plan || ! output->data || ! input->data || output->data == input->data ) \
+    XLAL_ERROR( XLAL_EINVAL ); \
+  if ( (size_t) input->length * input->vectorLength < EXTENT( plan ) ) \
+    XLAL_ERROR( XLAL_EBADLEN ); \
+  if ( (size_t) output->length * output->vectorLength < EXTENT( plan ) ) \
+    XLAL_ERROR( XLAL_EBADLEN ); \
+  in = XLALCreate##C##Vector( plan->size ); \
+  out = XLALCreate##C##Vector( plan->size ); \
+  if ( ! in || ! out ) \
+  { \
+    XLALDestroy##C##Vector( in ); \
+    XLALDestroy##C##Vector( out ); \
+    XLAL_ERROR( XLAL_EFUNC ); \
+  } \
+  for ( i = 0; i < plan->howmany; ++i ) \
+  { \
+    for ( j = 0; j < plan->size; ++j ) \
+      in->data[j] = input->data[(size_t) i * plan->dist + (size_t) j * plan->stride]; \
+    if ( XLAL##C##VectorFFT( out, in, plan->plan ) < 0 ) \
+    { \
+      XLALDestroy##C##Vector( in ); \
+      XLALDestroy##C##Vector( out ); \
+      XLAL_ERROR( XLAL_EFUNC ); \
+    } \
+    for ( j = 0; j < plan->size; ++j ) \
+      output->data[(size_t) i * plan->dist + (size_t) j * plan->stride] = out->data[j]; \
+  } \
+  XLALDestroy##C##Vector( in ); \
+  XLALDestroy##C##Vector( out ); \
+  return 0; \
+}
+
+DEFINE_COMPLEX_BATCH_TRANSFORM(COMPLEX8)
+DEFINE_COMPLEX_BATCH_TRANSFORM(COMPLEX16)
@@ -0,0 +1,59 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/*
+ * Internal helpers shared by the batch FFT plans of the FFTW, MKL and CUDA
+ * backends.  This header is not installed.
+ */
+
+#ifndef _FFTBATCHPLAN_H
+#define _FFTBATCHPLAN_H
+
+#include <lal/LALAtomicDatatypes.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Returns non-zero if elements i * dist + j * stride of two different data
+ * vectors of a batch plan (i < howmany, j < size) can be the same element.
+ * The smallest non-trivial solution of di * dist == dj * stride is
+ * di = stride / g, dj = dist / g, where g is the greatest common divisor of
+ * stride and dist.
+ */
+static inline int BatchVectorsOverlap(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist)
+{
+    UINT4 g = stride;
+    UINT4 r = dist;
+    if (howmany < 2)
+        return 0;
+    while (r) {
+        UINT4 t = g % r;
+        g = r;
+        r = t;
+    }
+    return stride / g < howmany && dist / g < size;
+}
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* _FFTBATCHPLAN_H */
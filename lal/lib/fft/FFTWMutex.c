@@ -17,6 +17,8 @@
 *  MA  02110-1301  USA
 */
 
+#include <stdlib.h>
+#include <lal/XLALError.h>
 #include <lal/FFTWMutex.h>
 
 #if defined(LAL_PTHREAD_LOCK) && defined(LAL_FFTW3_ENABLED)
@@ -24,6 +26,27 @@
 static pthread_mutex_t lalFFTWMutex = PTHREAD_MUTEX_INITIALIZER;
 #endif
 
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+#include <fftw3.h>
+#endif
+
+/* number of threads used by new FFT plans; 0 means not yet determined */
+static UINT4 lalFFTThreads = 0;
+
+/* default number of FFT threads, taken from LAL_FFT_THREADS if set */
+static UINT4 FFTThreadsDefault(void)
+{
+    const char *env = getenv("LAL_FFT_THREADS");
+    if (env && *env) {
+        char *end;
+        unsigned long n = strtoul(env, &end, 10);
+        if (*end == '\0' && n > 0 && n <= 1024)
+            return (UINT4) n;
+        XLALPrintWarning("WARNING: ignoring invalid value LAL_FFT_THREADS='%s'\n", env);
+    }
+    return 1;
+}
+
 
 /**
  * Aquire LAL's FFTW wisdom lock.  This lock must be held when creating or
@@ -55,3 +78,92 @@ void XLALFFTWWisdomUnlock(void)
     pthread_mutex_unlock( &lalFFTWMutex );
 #endif
 }
+
+
+/**
+ * Set the number of threads used by FFT plans created after this call.
+ * Plans that already exist keep the number of threads they were created
+ * with.  A value of 0 restores the default, which is taken from the
+ * environment variable <tt>LAL_FFT_THREADS</tt> if it is set, and is 1
+ * (single-threaded transforms) otherwise.
+ *
+ * Threaded transforms require LAL to be compiled with the FFTW threads
+ * libraries; otherwise the setting is recorded but all transforms remain
+ * single-threaded.
+ *
+ * See also:  XLALGetFFTThreads(), XLALFFTWPlanWithNThreads()
+ */
+
+int XLALSetFFTThreads(UINT4 nthreads)
+{
+    LAL_FFTW_WISDOM_LOCK;
+    lalFFTThreads = nthreads > 0 ? nthreads : FFTThreadsDefault();
+    LAL_FFTW_WISDOM_UNLOCK;
+#if !defined(LAL_FFTW3_THREADS_ENABLED)
+    if (nthreads > 1)
+        XLALPrintWarning("WARNING: LAL was compiled without FFTW threads support; FFTs will be single-threaded\n");
+#endif
+    return XLAL_SUCCESS;
+}
+
+
+/**
+ * Return the number of threads used by newly created FFT plans.
+ *
+ * See also:  XLALSetFFTThreads()
+ */
+
+UINT4 XLALGetFFTThreads(void)
+{
+    UINT4 nthreads;
+    LAL_FFTW_WISDOM_LOCK;
+    if (lalFFTThreads == 0)
+        lalFFTThreads = FFTThreadsDefault();
+    nthreads = lalFFTThreads;
+    LAL_FFTW_WISDOM_UNLOCK;
+    return nthreads;
+}
+
+
+/**
+ * Tell the FFTW planner how many threads the next plan should use.  If
+ * \a nthreads is 0, the value set by XLALSetFFTThreads() is used.  The
+ * FFTW threads library is only initialised once a plan with more than one
+ * thread is requested, so single-threaded programs are unaffected.
+ *
+ * This function must be called with LAL's FFTW wisdom lock held, i.e.
+ * between XLALFFTWWisdomLock() and XLALFFTWWisdomUnlock(), immediately
+ * before the FFTW planner is called.  The planner setting is process-wide,
+ * so it should be reset with XLALFFTWPlanWithNThreads(1) right after the
+ * plan is created, before the lock is released; code which calls the FFTW
+ * planner directly then still gets single-threaded plans.  It is a no-op
+ * if LAL has been compiled without the FFTW threads libraries.
+ */
+
+void XLALFFTWPlanWithNThreads(UINT4 nthreads)
+{
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+    static int initialized = 0;
+    if (nthreads == 0) {
+        if (lalFFTThreads == 0)
+            lalFFTThreads = FFTThreadsDefault();
+        nthreads = lalFFTThreads;
+    }
+    if (initialized == 0) {
+        if (nthreads <= 1)
+            return;
+        if (fftw_init_threads() && fftwf_init_threads())
+            initialized = 1;
+        else {
+            XLALPrintWarning("WARNING: could not initialise FFTW threads; FFTs will be single-threaded\n");
+            initialized = -1;
+        }
+    }
+    if (initialized > 0) {
+        fftw_plan_with_nthreads((int) nthreads);
+        fftwf_plan_with_nthreads((int) nthreads);
+    }
+#else
+    (void)nthreads;
+#endif
+}
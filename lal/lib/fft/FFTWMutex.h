@@ -21,6 +21,7 @@
 #define _FFTWMUTEX_H
 
 #include <lal/LALConfig.h>
+#include <lal/LALAtomicDatatypes.h>
 
 #ifdef  __cplusplus
 extern "C" {
@@ -29,6 +30,13 @@ extern "C" {
 void XLALFFTWWisdomLock(void);
 void XLALFFTWWisdomUnlock(void);
 
+int XLALSetFFTThreads(UINT4 nthreads);
+UINT4 XLALGetFFTThreads(void);
+void XLALFFTWPlanWithNThreads(UINT4 nthreads);
+
+void XLALFFTWImportWisdomCache(void);
+int XLALFFTWExportWisdomCache(void);
+
 #if defined(LAL_PTHREAD_LOCK) && defined(LAL_FFTW3_ENABLED)
 # define LAL_FFTW_WISDOM_LOCK XLALFFTWWisdomLock()
 # define LAL_FFTW_WISDOM_UNLOCK XLALFFTWWisdomUnlock()
@@ -0,0 +1,287 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <config.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#ifdef LAL_FFTW3_ENABLED
+#include <fftw3.h>
+#endif
+
+#include <lal/LALStdlib.h>
+#include <lal/LALSIMD.h>
+#include <lal/LALHashFunc.h>
+#include <lal/FFTWMutex.h>
+
+#if defined(HAVE_UNISTD_H) && defined(HAVE_FCNTL_H)
+#define WISDOM_FILE_LOCKING 1
+#endif
+
+/*
+ * The wisdom cache keeps one file per precision, since FFTW keeps separate
+ * wisdom for its double- and single-precision planners.  Index 0 holds the
+ * double-precision (fftw) state, index 1 the single-precision (fftwf) state.
+ * These are process-lifetime objects, so they are allocated with the system
+ * allocator rather than LALMalloc() in order not to be reported as leaks.
+ */
+
+#ifdef LAL_FFTW3_ENABLED
+
+/* 0: not yet loaded; 1: loaded; -1: disabled */
+static int wisdomCacheState = 0;
+static char wisdomCacheFile[2][FILENAME_MAX];
+static char *wisdomCacheLoaded[2];
+
+static char *WisdomToString(int k)
+{
+    return k == 0 ? fftw_export_wisdom_to_string() : fftwf_export_wisdom_to_string();
+}
+
+static int WisdomFromFile(int k, FILE *fp)
+{
+    return k == 0 ? fftw_import_wisdom_from_file(fp) : fftwf_import_wisdom_from_file(fp);
+}
+
+static void WisdomToFile(int k, FILE *fp)
+{
+    if (k == 0)
+        fftw_export_wisdom_to_file(fp);
+    else
+        fftwf_export_wisdom_to_file(fp);
+}
+
+/* place an advisory lock on the whole of an open file; blocks until granted */
+static int WisdomFileLock(FILE *fp, int exclusive)
+{
+#ifdef WISDOM_FILE_LOCKING
+    struct flock fl;
+    memset(&fl, 0, sizeof(fl));
+    fl.l_type = exclusive ? F_WRLCK : F_RDLCK;
+    fl.l_whence = SEEK_SET;
+    while (fcntl(fileno(fp), F_SETLKW, &fl) == -1)
+        if (errno != EINTR)
+            return -1;
+#else
+    (void)fp;
+    (void)exclusive;
+#endif
+    return 0;
+}
+
+/*
+ * Wisdom is only valid on the machine and FFTW build it was measured with,
+ * so the cache file name contains a hash of the CPU model, the available
+ * SIMD instruction sets, and the FFTW library versions.
+ */
+static UINT8 WisdomCacheKey(void)
+{
+    char key[2048] = "";
+    FILE *fp;
+    int iset;
+
+    fp = fopen("/proc/cpuinfo", "r");
+    if (fp) {
+        char line[512];
+        while (fgets(line, sizeof(line), fp))
+            if (strncmp(line, "model name", 10) == 0) {
+                strncat(key, line, sizeof(key) - strlen(key) - 1);
+                break;
+            }
+        fclose(fp);
+    }
+    for (iset = 0; iset < LAL_SIMD_ISET_MAX; ++iset)
+        if (XLALHaveSIMDInstructionSet(iset)) {
+            strncat(key, XLALSIMDInstructionSetName(iset), sizeof(key) - strlen(key) - 1);
+            strncat(key, ",", sizeof(key) - strlen(key) - 1);
+        }
+    strncat(key, fftw_version, sizeof(key) - strlen(key) - 1);
+    strncat(key, fftwf_version, sizeof(key) - strlen(key) - 1);
+
+    return XLALCityHash64(key, strlen(key));
+}
+
+/* merge the wisdom in the cache file with ours and write the result back */
+static int WisdomCacheWrite(int k)
+{
+    FILE *fp;
+    int errnum = 0;
+#ifdef WISDOM_FILE_LOCKING
+    int fd = open(wisdomCacheFile[k], O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+        return -1;
+    fp = fdopen(fd, "r+");
+    if (!fp) {
+        close(fd);
+        return -1;
+    }
+    if (WisdomFileLock(fp, 1) < 0) {
+        fclose(fp);
+        return -1;
+    }
+    /* an empty or corrupt file is simply overwritten */
+    WisdomFromFile(k, fp);
+    rewind(fp);
+    if (ftruncate(fileno(fp), 0) < 0)
+        errnum = errno;
+#else
+    fp = fopen(wisdomCacheFile[k], "w");
+    if (!fp)
+        return -1;
+#endif
+    if (!errnum) {
+        WisdomToFile(k, fp);
+        if (fflush(fp) != 0)
+            errnum = errno;
+    }
+    /* closing the file releases the lock */
+    if (fclose(fp) != 0 && !errnum)
+        errnum = errno;
+    return errnum ? -1 : 0;
+}
+
+/* export all wisdom which has changed since it was last loaded or saved */
+static int WisdomCacheSave(void)
+{
+    int failed = 0;
+    int k;
+    if (wisdomCacheState <= 0)
+        return 0;
+    for (k = 0; k < 2; ++k) {
+        char *wisdom = WisdomToString(k);
+        if (wisdom && wisdomCacheLoaded[k] && strcmp(wisdom, wisdomCacheLoaded[k]) == 0) {
+            free(wisdom);
+            continue;
+        }
+        free(wisdom);
+        if (WisdomCacheWrite(k) < 0)
+            failed = 1;
+        free(wisdomCacheLoaded[k]);
+        wisdomCacheLoaded[k] = WisdomToString(k);
+    }
+    return failed;
+}
+
+static void WisdomCacheAtExit(void)
+{
+    int failed;
+    LAL_FFTW_WISDOM_LOCK;
+    failed = WisdomCacheSave();
+    LAL_FFTW_WISDOM_UNLOCK;
+    if (failed)
+        XLALPrintWarning("WARNING: could not save FFTW wisdom to cache directory '%s'\n", getenv("LAL_FFTW_WISDOM_DIR"));
+}
+
+#endif /* LAL_FFTW3_ENABLED */
+
+
+/**
+ * Load LAL's persistent FFTW wisdom cache.  The cache is enabled by setting
+ * the environment variable <tt>LAL_FFTW_WISDOM_DIR</tt> to a directory
+ * shared between jobs; it is disabled otherwise.  Wisdom is stored in one
+ * file per precision whose name depends on the CPU model and the FFTW
+ * version, so a directory can be shared between heterogeneous machines.
+ *
+ * The cache is read only once per process, the first time this function is
+ * called; subsequent calls do nothing.  LAL calls this function before
+ * creating every FFTW plan, so that plans measured by earlier processes
+ * (with \c measurelvl greater than 0) are created without re-measuring.
+ * On exit any new wisdom is merged into the cache files.  Access to the
+ * cache files is serialised between processes with advisory file locks.
+ *
+ * This function must be called with LAL's FFTW wisdom lock held, i.e.
+ * between XLALFFTWWisdomLock() and XLALFFTWWisdomUnlock().  It is a no-op
+ * if LAL has been compiled with an FFT backend other than FFTW.
+ *
+ * See also:  XLALFFTWExportWisdomCache()
+ */
+
+void XLALFFTWImportWisdomCache(void)
+{
+#ifdef LAL_FFTW3_ENABLED
+    const char *dir;
+    unsigned long long key;
+    int k;
+
+    if (wisdomCacheState != 0)
+        return;
+    wisdomCacheState = -1;
+
+    dir = getenv("LAL_FFTW_WISDOM_DIR");
+    if (!dir || !*dir)
+        return;
+
+    key = WisdomCacheKey();
+    for (k = 0; k < 2; ++k) {
+        FILE *fp;
+        int n = snprintf(wisdomCacheFile[k], sizeof(wisdomCacheFile[k]), "%s/lal-fftw%s-%016llx.wisdom", dir, k == 0 ? "" : "f", key);
+        if (n < 0 || n >= (int) sizeof(wisdomCacheFile[k])) {
+            XLALPrintWarning("WARNING: FFTW wisdom cache directory name '%s' is too long\n", dir);
+            return;
+        }
+        fp = fopen(wisdomCacheFile[k], "r");
+        if (fp) {
+            if (WisdomFileLock(fp, 0) < 0 || !WisdomFromFile(k, fp))
+                XLALPrintWarning("WARNING: could not import FFTW wisdom from '%s'\n", wisdomCacheFile[k]);
+            else
+                XLALPrintInfo("INFO: imported FFTW wisdom from '%s'\n", wisdomCacheFile[k]);
+            fclose(fp);
+        }
+        wisdomCacheLoaded[k] = WisdomToString(k);
+    }
+
+    wisdomCacheState = 1;
+    if (atexit(WisdomCacheAtExit) != 0)
+        XLALPrintWarning("WARNING: FFTW wisdom will not be saved at exit\n");
+#endif
+}
+
+
+/**
+ * Save any new FFTW wisdom to LAL's persistent wisdom cache now, rather
+ * than waiting for the process to exit; this is useful for long-running
+ * programs which may not exit normally.  This function does nothing if the
+ * cache is disabled or has not yet been loaded.  The FFTW wisdom lock is
+ * acquired by this function and must not be held by the caller.
+ *
+ * See also:  XLALFFTWImportWisdomCache()
+ */
+
+int XLALFFTWExportWisdomCache(void)
+{
+#ifdef LAL_FFTW3_ENABLED
+    int failed;
+    LAL_FFTW_WISDOM_LOCK;
+    failed = WisdomCacheSave();
+    LAL_FFTW_WISDOM_UNLOCK;
+    if (failed)
+        XLAL_ERROR(XLAL_EIO, "Could not save FFTW wisdom to cache directory '%s'", getenv("LAL_FFTW_WISDOM_DIR"));
+#endif
+    return XLAL_SUCCESS;
+}
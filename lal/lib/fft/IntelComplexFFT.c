@@ -27,6 +27,8 @@
 #include <lal/LALMalloc.h>
 #include <lal/XLALError.h>
 
+#include "FFTBatchPlan.h"
+
 /** \cond DONT_DOXYGEN */
 
 
@@ -77,6 +79,34 @@ tagCOMPLEX16FFTPlan
   DFTI_DESCRIPTOR *plan; /* the MKL plan */
 };
 
+/*
+ * Plan to perform a batch of FFTs of COMPLEX8 data.
+ */
+struct
+tagCOMPLEX8FFTBatchPlan
+{
+  INT4       sign;    /* sign in transform exponential, -1 for forward, +1 for reverse */
+  UINT4      size;    /* length of each complex data vector for this plan */
+  UINT4      howmany; /* number of transforms performed by this plan */
+  UINT4      stride;  /* stride between successive elements of each data vector */
+  UINT4      dist;    /* distance between the first elements of successive data vectors */
+  DFTI_DESCRIPTOR *plan; /* the MKL plan */
+};
+
+/*
+ * Plan to perform a batch of FFTs of COMPLEX16 data.
+ */
+struct
+tagCOMPLEX16FFTBatchPlan
+{
+  INT4       sign;    /* sign in transform exponential, -1 for forward, +1 for reverse */
+  UINT4      size;    /* length of each complex data vector for this plan */
+  UINT4      howmany; /* number of transforms performed by this plan */
+  UINT4      stride;  /* stride between successive elements of each data vector */
+  UINT4      dist;    /* distance between the first elements of successive data vectors */
+  DFTI_DESCRIPTOR *plan; /* the MKL plan */
+};
+
 /* single- and double-precision routines */
 
 #define SINGLE_PRECISION
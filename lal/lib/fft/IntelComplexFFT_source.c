@@ -23,6 +23,16 @@
 #define DESTROY_PLAN_FUNCTION		CONCAT2(XLALDestroy,PLAN_TYPE)
 #define VECTOR_FFT_FUNCTION		CONCAT3(XLAL,COMPLEX_VECTOR_TYPE,FFT)
 
+#define BATCH_PLAN_TYPE			CONCAT2(COMPLEX_TYPE,FFTBatchPlan)
+#define COMPLEX_SEQUENCE_TYPE		CONCAT2(COMPLEX_TYPE,VectorSequence)
+
+#define CREATE_BATCH_PLAN_FUNCTION		CONCAT2(XLALCreate,BATCH_PLAN_TYPE)
+#define CREATE_FORWARD_BATCH_PLAN_FUNCTION	CONCAT2(XLALCreateForward,BATCH_PLAN_TYPE)
+#define CREATE_REVERSE_BATCH_PLAN_FUNCTION	CONCAT2(XLALCreateReverse,BATCH_PLAN_TYPE)
+#define DESTROY_BATCH_PLAN_FUNCTION		CONCAT2(XLALDestroy,BATCH_PLAN_TYPE)
+#define SEQUENCE_FFT_FUNCTION			CONCAT3(XLAL,COMPLEX_SEQUENCE_TYPE,FFT)
+#define BATCH_EXTENT_FUNCTION			CONCAT2(BATCH_PLAN_TYPE,Extent)
+
 #define FFTWX				CONCAT2(fftw,TYPESUFFIX)
 #define FFTWX_COMPLEX			CONCAT2(FFTWX,_complex)
 #define FFTWX_PLAN_DFT_1D		CONCAT2(FFTWX,_plan_dft_1d)
@@ -134,6 +144,141 @@ int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPL
     return 0;
 }
 
+/*
+ *
+ * Batched transforms
+ *
+ */
+
+/* number of elements spanned by the data of a batch plan */
+static size_t BATCH_EXTENT_FUNCTION(const BATCH_PLAN_TYPE * plan)
+{
+    return (size_t) (plan->howmany - 1) * plan->dist + (size_t) (plan->size - 1) * plan->stride + 1;
+}
+
+BATCH_PLAN_TYPE *CREATE_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, __attribute__ ((unused)) int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    MKL_LONG strides[2] = {0, stride};
+    INT8  fftStat;
+
+    if (!size || !howmany)
+        XLAL_ERROR_NULL( XLAL_EBADLEN );
+    if (!stride || (howmany > 1 && !dist))
+        XLAL_ERROR_NULL( XLAL_EINVAL );
+    if (BatchVectorsOverlap(size, howmany, stride, dist))
+        XLAL_ERROR_NULL( XLAL_EINVAL, "Data vectors of the batch overlap" );
+
+    /* allocate memory for the plan */
+    plan = XLALMalloc( sizeof( *plan ) );
+
+    if (!plan)
+        XLAL_ERROR_NULL( XLAL_ENOMEM );
+
+    /* make the intel fft descriptor */
+    fftStat = DftiCreateDescriptor( &(plan->plan),
+        DFTI_TYPE, DFTI_COMPLEX, 1, size);
+    CHECKINTELFFTSTATUS_NULL( fftStat );
+
+    /* configure intel fft descriptor */
+    fftStat = DftiSetValue( plan->plan, DFTI_PLACEMENT,
+        DFTI_NOT_INPLACE );
+    CHECKINTELFFTSTATUS_NULL( fftStat );
+    fftStat = DftiSetValue( plan->plan, DFTI_NUMBER_OF_TRANSFORMS,
+        (MKL_LONG) howmany );
+    CHECKINTELFFTSTATUS_NULL( fftStat );
+    fftStat = DftiSetValue( plan->plan, DFTI_INPUT_STRIDES, strides );
+    CHECKINTELFFTSTATUS_NULL( fftStat );
+    fftStat = DftiSetValue( plan->plan, DFTI_OUTPUT_STRIDES, strides );
+    CHECKINTELFFTSTATUS_NULL( fftStat );
+    fftStat = DftiSetValue( plan->plan, DFTI_INPUT_DISTANCE, (MKL_LONG) dist );
+    CHECKINTELFFTSTATUS_NULL( fftStat );
+    fftStat = DftiSetValue( plan->plan, DFTI_OUTPUT_DISTANCE, (MKL_LONG) dist );
+    CHECKINTELFFTSTATUS_NULL( fftStat );
+
+    /* commit the intel fft descriptor */
+    fftStat = DftiCommitDescriptor( plan->plan );
+    CHECKINTELFFTSTATUS_NULL( fftStat );
+
+    /* now set remaining plan fields */
+    plan->size = size;
+    plan->howmany = howmany;
+    plan->stride = stride;
+    plan->dist = dist;
+    plan->sign = ( fwdflg ? -1 : 1 );
+
+    return plan;
+}
+
+BATCH_PLAN_TYPE *CREATE_FORWARD_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    plan = CREATE_BATCH_PLAN_FUNCTION(size, howmany, stride, dist, 1, measurelvl);
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    return plan;
+}
+
+BATCH_PLAN_TYPE *CREATE_REVERSE_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    plan = CREATE_BATCH_PLAN_FUNCTION(size, howmany, stride, dist, 0, measurelvl);
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    return plan;
+}
+
+void DESTROY_BATCH_PLAN_FUNCTION(BATCH_PLAN_TYPE * plan)
+{
+    INT8  fftStat;
+
+    if (!plan)
+        XLAL_ERROR_VOID(XLAL_EFAULT);
+
+    /* destroy intel fft descriptor */
+    fftStat = DftiFreeDescriptor( &(plan->plan) );
+    CHECKINTELFFTSTATUS_VOID( fftStat );
+
+    XLALFree( plan );
+}
+
+int SEQUENCE_FFT_FUNCTION(COMPLEX_SEQUENCE_TYPE * _LAL_RESTRICT_ output, const COMPLEX_SEQUENCE_TYPE * _LAL_RESTRICT_ input,
+    const BATCH_PLAN_TYPE * plan)
+{
+    INT8  fftStat;
+
+    /* sanity check on arguments */
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data || output->data == input->data)
+        XLAL_ERROR(XLAL_EINVAL);        /* note: must be out-of-place */
+    if ((size_t) input->length * input->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+    if ((size_t) output->length * output->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+
+    /* complex intel fft */
+    if ( plan->sign == -1 )
+    {
+        fftStat = DftiComputeForward( plan->plan, input->data, output->data );
+        CHECKINTELFFTSTATUS( fftStat );
+    }
+    else if ( plan->sign == 1 )
+    {
+        fftStat = DftiComputeBackward( plan->plan, input->data, output->data );
+        CHECKINTELFFTSTATUS( fftStat );
+    }
+    else
+    {
+        XLAL_ERROR( XLAL_EINVAL );
+    }
+
+    return 0;
+}
+
 #undef CONCAT2x
 #undef CONCAT2
 #undef CONCAT3x
@@ -153,6 +298,16 @@ int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPL
 #undef DESTROY_PLAN_FUNCTION
 #undef VECTOR_FFT_FUNCTION
 
+#undef BATCH_PLAN_TYPE
+#undef COMPLEX_SEQUENCE_TYPE
+
+#undef CREATE_BATCH_PLAN_FUNCTION
+#undef CREATE_FORWARD_BATCH_PLAN_FUNCTION
+#undef CREATE_REVERSE_BATCH_PLAN_FUNCTION
+#undef DESTROY_BATCH_PLAN_FUNCTION
+#undef SEQUENCE_FFT_FUNCTION
+#undef BATCH_EXTENT_FUNCTION
+
 #undef FFTWX
 #undef FFTWX_COMPLEX
 #undef FFTWX_PLAN_DFT_1D
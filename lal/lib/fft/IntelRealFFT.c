@@ -28,6 +28,8 @@
 #include <lal/LALMalloc.h>
 #include <lal/XLALError.h>
 
+#include "FFTBatchPlan.h"
+
 /** \cond DONT_DOXYGEN */
 
 
@@ -79,6 +81,36 @@ tagREAL8FFTPlan
   REAL8     *tmp;
 };
 
+/*
+ * Plan to perform a batch of FFTs of REAL4 data.
+ */
+struct
+tagREAL4FFTBatchPlan
+{
+  INT4       sign;    /* sign in transform exponential, -1 for forward, +1 for reverse */
+  UINT4      size;    /* length of each real data vector for this plan */
+  UINT4      howmany; /* number of transforms performed by this plan */
+  UINT4      stride;  /* stride between successive elements of each real data vector */
+  UINT4      dist;    /* distance between the first elements of successive real data vectors */
+  DFTI_DESCRIPTOR *plan; /* the MKL plan */
+  REAL4     *tmp;
+};
+
+/*
+ * Plan to perform a batch of FFTs of REAL8 data.
+ */
+struct
+tagREAL8FFTBatchPlan
+{
+  INT4       sign;    /* sign in transform exponential, -1 for forward, +1 for reverse */
+  UINT4      size;    /* length of each real data vector for this plan */
+  UINT4      howmany; /* number of transforms performed by this plan */
+  UINT4      stride;  /* stride between successive elements of each real data vector */
+  UINT4      dist;    /* distance between the first elements of successive real data vectors */
+  DFTI_DESCRIPTOR *plan; /* the MKL plan */
+  REAL8     *tmp;
+};
+
 
 
 /* single- and double-precision routines */
@@ -29,6 +29,19 @@
 #define VECTOR_FFT_FUNCTION		CONCAT3(XLAL,REAL_VECTOR_TYPE,FFT)
 #define POWER_SPECTRUM_FUNCTION		CONCAT3(XLAL,REAL_TYPE,PowerSpectrum)
 
+#define BATCH_PLAN_TYPE			CONCAT2(REAL_TYPE,FFTBatchPlan)
+#define REAL_SEQUENCE_TYPE		CONCAT2(REAL_TYPE,VectorSequence)
+#define COMPLEX_SEQUENCE_TYPE		CONCAT2(COMPLEX_TYPE,VectorSequence)
+
+#define CREATE_BATCH_PLAN_FUNCTION		CONCAT2(XLALCreate,BATCH_PLAN_TYPE)
+#define CREATE_FORWARD_BATCH_PLAN_FUNCTION	CONCAT2(XLALCreateForward,BATCH_PLAN_TYPE)
+#define CREATE_REVERSE_BATCH_PLAN_FUNCTION	CONCAT2(XLALCreateReverse,BATCH_PLAN_TYPE)
+#define DESTROY_BATCH_PLAN_FUNCTION		CONCAT2(XLALDestroy,BATCH_PLAN_TYPE)
+#define SEQUENCE_FORWARD_FFT_FUNCTION		CONCAT3(XLAL,REAL_SEQUENCE_TYPE,ForwardFFT)
+#define SEQUENCE_REVERSE_FFT_FUNCTION		CONCAT3(XLAL,REAL_SEQUENCE_TYPE,ReverseFFT)
+#define SEQUENCE_POWER_SPECTRUM_FUNCTION	CONCAT3(XLAL,REAL_SEQUENCE_TYPE,PowerSpectrum)
+#define BATCH_EXTENT_FUNCTION			CONCAT2(BATCH_PLAN_TYPE,Extent)
+
 #define CREALX				CONCAT2(creal,TYPESUFFIX)
 #define CIMAGX				CONCAT2(cimag,TYPESUFFIX)
 #define FFTWX				CONCAT2(fftw,TYPESUFFIX)
@@ -305,6 +318,277 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
     return 0;
 }
 
+/*
+ *
+ * Batched transforms
+ *
+ */
+
+/* number of elements spanned by the real data of a batch plan */
+static size_t BATCH_EXTENT_FUNCTION(const BATCH_PLAN_TYPE * plan)
+{
+    return (size_t) (plan->howmany - 1) * plan->dist + (size_t) (plan->size - 1) * plan->stride + 1;
+}
+
+BATCH_PLAN_TYPE *CREATE_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, __attribute__ ((unused)) int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    MKL_LONG real_strides[2] = {0, stride};
+    MKL_LONG packed_strides[2] = {0, 1};
+    INT8  fftStat;
+
+    if (!size || !howmany)
+        XLAL_ERROR_NULL(XLAL_EBADLEN);
+    if (!stride || (howmany > 1 && !dist))
+        XLAL_ERROR_NULL(XLAL_EINVAL);
+    if (!fwdflg && BatchVectorsOverlap(size, howmany, stride, dist))
+        XLAL_ERROR_NULL(XLAL_EINVAL, "Real output vectors of the batch overlap");
+
+    /* allocate memory for the plan */
+    plan = XLALMalloc(sizeof( *plan));
+
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+
+    /* make the intel fft descriptor */
+    fftStat = DftiCreateDescriptor(&(plan->plan),
+        DFTI_TYPE, DFTI_REAL, 1, size);
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+
+    /* configure intel fft descriptor */
+    fftStat = DftiSetValue(plan->plan, DFTI_PLACEMENT,
+        DFTI_NOT_INPLACE);
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+    fftStat = DftiSetValue(plan->plan, DFTI_PACKED_FORMAT,
+        DFTI_PACK_FORMAT);
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+    fftStat = DftiSetValue(plan->plan, DFTI_NUMBER_OF_TRANSFORMS,
+        (MKL_LONG) howmany);
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+
+    /* real data has the user-supplied layout; packed data is stored
+     * contiguously, one transform after another */
+    fftStat = DftiSetValue(plan->plan, DFTI_INPUT_STRIDES,
+        fwdflg ? real_strides : packed_strides);
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+    fftStat = DftiSetValue(plan->plan, DFTI_OUTPUT_STRIDES,
+        fwdflg ? packed_strides : real_strides);
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+    fftStat = DftiSetValue(plan->plan, DFTI_INPUT_DISTANCE,
+        (MKL_LONG) (fwdflg ? dist : size));
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+    fftStat = DftiSetValue(plan->plan, DFTI_OUTPUT_DISTANCE,
+        (MKL_LONG) (fwdflg ? size : dist));
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+
+    /* commit the intel fft descriptor */
+    fftStat = DftiCommitDescriptor(plan->plan);
+    CHECKINTELFFTSTATUS_NULL(fftStat);
+
+    /* create workspace to do the ffts into */
+    plan->tmp = XLALMalloc((size_t) howmany * size * sizeof(REAL_TYPE));
+    if (!plan->tmp)
+    {
+      DftiFreeDescriptor(&(plan->plan));
+      XLALFree(plan);
+      XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    /* set remaining plan fields */
+
+    plan->size = size;
+    plan->howmany = howmany;
+    plan->stride = stride;
+    plan->dist = dist;
+    plan->sign = (fwdflg ? -1 : 1);
+
+    return plan;
+}
+
+BATCH_PLAN_TYPE *CREATE_FORWARD_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    plan = CREATE_BATCH_PLAN_FUNCTION(size, howmany, stride, dist, 1, measurelvl);
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    return plan;
+}
+
+BATCH_PLAN_TYPE *CREATE_REVERSE_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    plan = CREATE_BATCH_PLAN_FUNCTION(size, howmany, stride, dist, 0, measurelvl);
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    return plan;
+}
+
+void DESTROY_BATCH_PLAN_FUNCTION(BATCH_PLAN_TYPE * plan)
+{
+    INT8  fftStat;
+
+    if (!plan)
+        XLAL_ERROR_VOID( XLAL_EFAULT );
+
+    /* destroy intel fft descriptor */
+    fftStat = DftiFreeDescriptor(&(plan->plan));
+    CHECKINTELFFTSTATUS_VOID(fftStat);
+
+    XLALFree(plan->tmp);
+    XLALFree(plan);
+
+    return;
+}
+
+int SEQUENCE_FORWARD_FFT_FUNCTION(COMPLEX_SEQUENCE_TYPE * output, const REAL_SEQUENCE_TYPE * input, const BATCH_PLAN_TYPE * plan)
+{
+    INT8  fftStat;
+    UINT4 n,i,k;
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size || plan->sign != -1)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data)
+        XLAL_ERROR(XLAL_EINVAL);
+    if ((size_t) input->length * input->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (output->length != plan->howmany || output->vectorLength != plan->size/2 + 1)
+        XLAL_ERROR(XLAL_EBADLEN);
+
+    n = plan->size;
+
+    /* execute intel fft */
+    fftStat = DftiComputeForward(plan->plan, input->data, plan->tmp);
+    CHECKINTELFFTSTATUS(fftStat);
+
+    /* now unpack the results into the output sequence */
+    for (i = 0; i < plan->howmany; ++i)
+    {
+        const REAL_TYPE *tmp = plan->tmp + (size_t) i * n;
+        COMPLEX_TYPE *out = output->data + (size_t) i * output->vectorLength;
+
+        /* dc component */
+        out[0] = tmp[0] + 0.0 * _Complex_I;
+
+        /* other components */
+        for (k = 1; k < (n + 1) / 2; ++k) /* k < n/2 rounded up */
+        {
+            out[k] = tmp[2 * k - 1] + (tmp[2 * k] * _Complex_I);
+        }
+
+        /* Nyquist frequency */
+        if (n % 2 == 0) /* n is even */
+        {
+            out[n / 2] = tmp[n - 1] + 0.0 * _Complex_I;
+        }
+    }
+
+    return 0;
+}
+
+int SEQUENCE_REVERSE_FFT_FUNCTION(REAL_SEQUENCE_TYPE * output, const COMPLEX_SEQUENCE_TYPE * input, const BATCH_PLAN_TYPE * plan)
+{
+    INT8  fftStat;
+    UINT4 n,i,k;
+
+    /* sanity checks on arguments */
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size || plan->sign != 1)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data)
+        XLAL_ERROR(XLAL_EINVAL);
+    if ((size_t) output->length * output->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (input->length != plan->howmany || input->vectorLength != plan->size / 2 + 1)
+        XLAL_ERROR(XLAL_EBADLEN);
+
+    n = plan->size;
+
+    for (i = 0; i < plan->howmany; ++i)
+    {
+        const COMPLEX_TYPE *in = input->data + (size_t) i * input->vectorLength;
+        REAL_TYPE *tmp = plan->tmp + (size_t) i * n;
+
+        if (CIMAGX(in[0]) != 0.0)
+            XLAL_ERROR(XLAL_EDOM);  /* imaginary part of DC must be zero */
+        if (n % 2 == 0 && CIMAGX(in[n / 2]) != 0.0)
+            XLAL_ERROR(XLAL_EDOM);  /* imaginary part of Nyquist must be zero */
+
+        /* dc component */
+        tmp[0] = CREALX(in[0]);
+
+        /* other components */
+        for ( k = 1; k < ( n + 1 ) / 2; ++k ) /* k < n / 2 rounded up */
+        {
+            tmp[2 * k - 1] = CREALX(in[k]);
+            tmp[2 * k]     = CIMAGX(in[k]);
+        }
+
+        /* Nyquist component */
+        if ( n % 2 == 0 ) /* n is even */
+        {
+            tmp[n - 1] = CREALX(in[n / 2]);
+        }
+    }
+
+    /* execute intel fft */
+    fftStat = DftiComputeBackward( plan->plan, plan->tmp, output->data );
+    CHECKINTELFFTSTATUS( fftStat );
+
+    return 0;
+}
+
+int SEQUENCE_POWER_SPECTRUM_FUNCTION(REAL_SEQUENCE_TYPE * spec, const REAL_SEQUENCE_TYPE * data, const BATCH_PLAN_TYPE * plan)
+{
+    INT8  fftStat;
+    UINT4 n,i,k;
+
+    /* sanity check on arguments */
+    if (!spec || !data || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size || plan->sign != -1)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!spec->data || !data->data)
+        XLAL_ERROR(XLAL_EINVAL);
+    if ((size_t) data->length * data->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (spec->length != plan->howmany || spec->vectorLength != plan->size / 2 + 1)
+        XLAL_ERROR(XLAL_EBADLEN);
+
+    n = plan->size;
+
+    /* execute intel fft */
+    fftStat = DftiComputeForward( plan->plan, data->data, plan->tmp );
+    CHECKINTELFFTSTATUS( fftStat );
+
+    for (i = 0; i < plan->howmany; ++i)
+    {
+        const REAL_TYPE *tmp = plan->tmp + (size_t) i * n;
+        REAL_TYPE *out = spec->data + (size_t) i * spec->vectorLength;
+
+        /* dc component */
+        out[0] = tmp[0] * tmp[0];
+
+        /* other components */
+        for (k = 1; k < (n + 1)/2; ++k) /* k < n/2 rounded up */
+        {
+            REAL_TYPE re = tmp[2 * k - 1];
+            REAL_TYPE im = tmp[2 * k];
+            out[k] = re * re + im * im;
+            out[k] *= 2.0;  /* accounts for negative frequency part */
+        }
+
+        /* Nyquist frequency */
+        if (n % 2 == 0) /* n is even */
+            out[n / 2] = tmp[n - 1] * tmp[n - 1];
+    }
+
+    return 0;
+}
+
 #undef CONCAT2x
 #undef CONCAT2
 #undef CONCAT3x
@@ -329,6 +613,19 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
 #undef VECTOR_FFT_FUNCTION
 #undef POWER_SPECTRUM_FUNCTION
 
+#undef BATCH_PLAN_TYPE
+#undef REAL_SEQUENCE_TYPE
+#undef COMPLEX_SEQUENCE_TYPE
+
+#undef CREATE_BATCH_PLAN_FUNCTION
+#undef CREATE_FORWARD_BATCH_PLAN_FUNCTION
+#undef CREATE_REVERSE_BATCH_PLAN_FUNCTION
+#undef DESTROY_BATCH_PLAN_FUNCTION
+#undef SEQUENCE_FORWARD_FFT_FUNCTION
+#undef SEQUENCE_REVERSE_FFT_FUNCTION
+#undef SEQUENCE_POWER_SPECTRUM_FUNCTION
+#undef BATCH_EXTENT_FUNCTION
+
 #undef CREALX
 #undef CIMAGX
 #undef FFTWX
@@ -31,6 +31,8 @@
 #include <lal/SeqFactories.h>
 #include <lal/XLALError.h>
 
+#include "FFTBatchPlan.h"
+
 /**
  * \addtogroup RealFFT_h
  *
@@ -168,6 +170,34 @@ tagREAL8FFTPlan
   fftw_plan  plan; /**< the FFTW plan */
 };
 
+/**
+ * \brief Plan to perform a batch of FFTs of REAL4 data.
+ */
+struct
+tagREAL4FFTBatchPlan
+{
+  INT4       sign;    /**< sign in transform exponential, -1 for forward, +1 for reverse */
+  UINT4      size;    /**< length of each real data vector for this plan */
+  UINT4      howmany; /**< number of transforms performed by this plan */
+  UINT4      stride;  /**< stride between successive elements of each real data vector */
+  UINT4      dist;    /**< distance between the first elements of successive real data vectors */
+  fftwf_plan plan;    /**< the FFTW plan */
+};
+
+/**
+ * \brief Plan to perform a batch of FFTs of REAL8 data.
+ */
+struct
+tagREAL8FFTBatchPlan
+{
+  INT4       sign;    /**< sign in transform exponential, -1 for forward, +1 for reverse */
+  UINT4      size;    /**< length of each real data vector for this plan */
+  UINT4      howmany; /**< number of transforms performed by this plan */
+  UINT4      stride;  /**< stride between successive elements of each real data vector */
+  UINT4      dist;    /**< distance between the first elements of successive real data vectors */
+  fftw_plan  plan;    /**< the FFTW plan */
+};
+
 
 
 /* single- and double-precision routines */
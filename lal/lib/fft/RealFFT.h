@@ -69,6 +69,14 @@ extern "C" {
  * int XLALREAL8ReverseFFT( REAL8Vector *output, COMPLEX16Vector *input, REAL8FFTPlan *plan );
  * int XLALREAL8VectorFFT( REAL8Vector *output, REAL8Vector *input, REAL8FFTPlan *plan );
  * int XLALREAL8PowerSpectrum( REAL8Vector *spec, REAL8Vector *data, REAL8FFTPlan *plan );
+ *
+ * REAL4FFTBatchPlan * XLALCreateForwardREAL4FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+ * REAL4FFTBatchPlan * XLALCreateReverseREAL4FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+ * void XLALDestroyREAL4FFTBatchPlan( REAL4FFTBatchPlan *plan );
+ *
+ * int XLALREAL4VectorSequenceForwardFFT( COMPLEX8VectorSequence *output, const REAL4VectorSequence *input, const REAL4FFTBatchPlan *plan );
+ * int XLALREAL4VectorSequenceReverseFFT( REAL4VectorSequence *output, const COMPLEX8VectorSequence *input, const REAL4FFTBatchPlan *plan );
+ * int XLALREAL4VectorSequencePowerSpectrum( REAL4VectorSequence *spec, const REAL4VectorSequence *data, const REAL4FFTBatchPlan *plan );
  * \endcode
  *
  * ### Description ###
@@ -153,6 +161,38 @@ extern "C" {
  * As before, the \c REAL8 versions of these routines behave the
  * same way but for double-precision transforms.
  *
+ * ### Batched Transforms ###
+ *
+ * A REAL4FFTBatchPlan performs \c howmany transforms of length \c size
+ * with a single call into the FFT library, which avoids the per-call
+ * overhead of looping over XLALREAL4ForwardFFT() when many segments of
+ * the same length must be transformed, e.g. when averaging spectra.
+ * Element \c j of real data vector \c i is located at index
+ * <tt>i * dist + j * stride</tt> of the data array of the real
+ * VectorSequence; the common case of a sequence of \c howmany contiguous
+ * vectors of length \c size corresponds to <tt>stride = 1</tt> and
+ * <tt>dist = size</tt>.  The complex (or power spectrum) data is always a
+ * VectorSequence of \c howmany vectors of length <tt>size / 2 + 1</tt>.
+ *
+ * ### Threaded Transforms ###
+ *
+ * By default all transforms are single-threaded.  When LAL is compiled
+ * with the FFTW threads libraries, plans created after a call to
+ * <tt>XLALSetFFTThreads(n)</tt> (declared in <tt>FFTWMutex.h</tt>), or while
+ * the environment variable <tt>LAL_FFT_THREADS</tt> is set to \c n, will
+ * execute each transform using \c n threads.  This only pays off for
+ * long transforms (roughly \f$2^{16}\f$ points and above); existing
+ * plans keep the number of threads they were created with.
+ *
+ * ### Wisdom Cache ###
+ *
+ * Plans created with \c measurelvl greater than 0 are expensive to
+ * create.  If the environment variable <tt>LAL_FFTW_WISDOM_DIR</tt> names
+ * a directory, the FFTW wisdom gathered while creating plans is saved there
+ * when the process exits and is loaded again when the next process creates
+ * its first plan, so that the measurement is only paid for once per machine
+ * type.  See XLALFFTWImportWisdomCache() for details.
+ *
  */
 /** @{ */
 
@@ -193,12 +233,20 @@ typedef struct tagREAL4FFTPlan REAL4FFTPlan;
 typedef struct tagREAL8FFTPlan REAL8FFTPlan;
 #define tagRealFFTPlan tagREAL4FFTPlan
 #define RealFFTPlan REAL4FFTPlan
+/** Plan to perform a batch of FFTs of REAL4 data */
+typedef struct tagREAL4FFTBatchPlan REAL4FFTBatchPlan;
+/** Plan to perform a batch of FFTs of REAL8 data */
+typedef struct tagREAL8FFTBatchPlan REAL8FFTBatchPlan;
 
 #ifdef SWIG /* SWIG interface directives */
 SWIGLAL(VIEWIN_ARRAYS(REAL4Vector, output, spec));
 SWIGLAL(VIEWIN_ARRAYS(REAL8Vector, output, spec));
 SWIGLAL(VIEWIN_ARRAYS(COMPLEX8Vector, output));
 SWIGLAL(VIEWIN_ARRAYS(COMPLEX16Vector, output));
+SWIGLAL(VIEWIN_ARRAYS(REAL4VectorSequence, output, spec));
+SWIGLAL(VIEWIN_ARRAYS(REAL8VectorSequence, output, spec));
+SWIGLAL(VIEWIN_ARRAYS(COMPLEX8VectorSequence, output));
+SWIGLAL(VIEWIN_ARRAYS(COMPLEX16VectorSequence, output));
 #endif /* SWIG */
 
 /*
@@ -428,6 +476,135 @@ int XLALREAL4VectorFFT( REAL4Vector * _LAL_RESTRICT_ output, const REAL4Vector *
  */
 int XLALREAL4PowerSpectrum( REAL4Vector * _LAL_RESTRICT_ spec, const REAL4Vector * _LAL_RESTRICT_ data, const REAL4FFTPlan *plan );
 
+/*
+ *
+ * XLAL REAL4 batched functions
+ *
+ */
+
+/**
+ * Returns a new REAL4FFTBatchPlan
+ *
+ * A REAL4FFTBatchPlan performs \c howmany FFTs of real data vectors of
+ * length \c size at once.  Element \c j of real data vector \c i is
+ * stored at index <tt>i * dist + j * stride</tt> of the real data array.
+ * For reverse plans, the real output vectors must not overlap.
+ *
+ * @param[in] size The number of points in each real data vector.
+ * @param[in] howmany The number of transforms performed by the plan.
+ * @param[in] stride The stride between successive elements of each real
+ * data vector.
+ * @param[in] dist The distance between the first elements of successive
+ * real data vectors.
+ * @param[in] fwdflg Set non-zero for a forward FFT plan;
+ * otherwise create a reverse plan
+ * @param[in] measurelvl Measurement level for plan creation, as for
+ * XLALCreateREAL4FFTPlan().
+ * @return A pointer to an allocated \c REAL4FFTBatchPlan structure is
+ * returned upon successful completion.  Otherwise, a \c NULL pointer is
+ * returned and \c xlalErrno is set to indicate the error.
+ * @par Errors:
+ * The \c XLALCreateREAL4FFTBatchPlan() function shall fail if:
+ * - [\c XLAL_EBADLEN] The size or number of transforms of the requested plan is 0.
+ * - [\c XLAL_EINVAL] The stride is 0, the distance is 0 for more than one
+ * transform, or the real output vectors of a reverse plan overlap.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * - [\c XLAL_EFAILED] The call to the underlying FFTW routine failed.
+ * .
+ */
+REAL4FFTBatchPlan * XLALCreateREAL4FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, int measurelvl );
+
+/**
+ * Returns a new REAL4FFTBatchPlan for forward transforms;
+ * equivalent to XLALCreateREAL4FFTBatchPlan() with \c fwdflg set to 1.
+ */
+REAL4FFTBatchPlan * XLALCreateForwardREAL4FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+
+/**
+ * Returns a new REAL4FFTBatchPlan for reverse transforms;
+ * equivalent to XLALCreateREAL4FFTBatchPlan() with \c fwdflg set to 0.
+ */
+REAL4FFTBatchPlan * XLALCreateReverseREAL4FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+
+/**
+ * Destroys a REAL4FFTBatchPlan
+ * @param[in] plan A pointer to the REAL4FFTBatchPlan to be destroyed.
+ * @return None.
+ */
+void XLALDestroyREAL4FFTBatchPlan( REAL4FFTBatchPlan *plan );
+
+/**
+ * Performs a batch of forward FFTs of REAL4 data
+ *
+ * Each real data vector in \c input, laid out as described by the plan,
+ * is transformed as by XLALREAL4ForwardFFT() and the result is stored in
+ * the corresponding vector of \c output.
+ *
+ * @param[out] output The complex data sequence of \c howmany vectors of
+ * length [N/2] + 1 that results from the transforms
+ * @param[in] input The real data to be transformed
+ * @param[in] plan The forward FFT batch plan to use for the transforms
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALREAL4VectorSequenceForwardFFT() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the plan is for a
+ * reverse transform.
+ * - [\c XLAL_EBADLEN] The input sequence is too short for the plan layout,
+ * or the output sequence and plan are incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * .
+ */
+int XLALREAL4VectorSequenceForwardFFT( COMPLEX8VectorSequence *output, const REAL4VectorSequence *input, const REAL4FFTBatchPlan *plan );
+
+/**
+ * Performs a batch of reverse FFTs of REAL4 data
+ *
+ * Each vector of \c input is transformed as by XLALREAL4ReverseFFT() and
+ * the result is stored in \c output, laid out as described by the plan.
+ *
+ * @param[out] output The real data that results from the transforms
+ * @param[in] input The complex data sequence of \c howmany vectors of
+ * length [N/2] + 1 to be transformed
+ * @param[in] plan The reverse FFT batch plan to use for the transforms
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALREAL4VectorSequenceReverseFFT() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the plan is for a
+ * forward transform.
+ * - [\c XLAL_EBADLEN] The output sequence is too short for the plan layout,
+ * or the input sequence and plan are incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * - [\c XLAL_EDOM] The DC component, or the Nyquist component for even N,
+ * of an input vector is not purely real.
+ * .
+ */
+int XLALREAL4VectorSequenceReverseFFT( REAL4VectorSequence *output, const COMPLEX8VectorSequence *input, const REAL4FFTBatchPlan *plan );
+
+/**
+ * Computes a batch of power spectra of REAL4 data
+ *
+ * Each real data vector in \c data, laid out as described by the plan,
+ * is processed as by XLALREAL4PowerSpectrum().
+ *
+ * @param[out] spec The real power spectra, a sequence of \c howmany
+ * vectors of length [N/2] + 1
+ * @param[in] data The input real data
+ * @param[in] plan The forward FFT batch plan to use for the transforms
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALREAL4VectorSequencePowerSpectrum() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the plan is for a
+ * reverse transform.
+ * - [\c XLAL_EBADLEN] The input sequence is too short for the plan layout,
+ * or the output sequence and plan are incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * .
+ */
+int XLALREAL4VectorSequencePowerSpectrum( REAL4VectorSequence *spec, const REAL4VectorSequence *data, const REAL4FFTBatchPlan *plan );
+
 /*
  *
  * XLAL REAL8 functions
@@ -660,6 +837,55 @@ int XLALREAL8VectorFFT( REAL8Vector *output, const REAL8Vector *input,
 int XLALREAL8PowerSpectrum( REAL8Vector *spec, const REAL8Vector *data,
     const REAL8FFTPlan *plan );
 
+/*
+ *
+ * XLAL REAL8 batched functions
+ *
+ */
+
+/**
+ * Returns a new REAL8FFTBatchPlan; see XLALCreateREAL4FFTBatchPlan().
+ */
+REAL8FFTBatchPlan * XLALCreateREAL8FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, int measurelvl );
+
+/**
+ * Returns a new REAL8FFTBatchPlan for forward transforms;
+ * equivalent to XLALCreateREAL8FFTBatchPlan() with \c fwdflg set to 1.
+ */
+REAL8FFTBatchPlan * XLALCreateForwardREAL8FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+
+/**
+ * Returns a new REAL8FFTBatchPlan for reverse transforms;
+ * equivalent to XLALCreateREAL8FFTBatchPlan() with \c fwdflg set to 0.
+ */
+REAL8FFTBatchPlan * XLALCreateReverseREAL8FFTBatchPlan( UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl );
+
+/**
+ * Destroys a REAL8FFTBatchPlan
+ * @param[in] plan A pointer to the REAL8FFTBatchPlan to be destroyed.
+ * @return None.
+ */
+void XLALDestroyREAL8FFTBatchPlan( REAL8FFTBatchPlan *plan );
+
+/**
+ * Performs a batch of forward FFTs of REAL8 data;
+ * see XLALREAL4VectorSequenceForwardFFT().
+ */
+int XLALREAL8VectorSequenceForwardFFT( COMPLEX16VectorSequence *output, const REAL8VectorSequence *input, const REAL8FFTBatchPlan *plan );
+
+/**
+ * Performs a batch of reverse FFTs of REAL8 data;
+ * see XLALREAL4VectorSequenceReverseFFT().
+ */
+int XLALREAL8VectorSequenceReverseFFT( REAL8VectorSequence *output, const COMPLEX16VectorSequence *input, const REAL8FFTBatchPlan *plan );
+
+/**
+ * Computes a batch of power spectra of REAL8 data;
+ * see XLALREAL4VectorSequencePowerSpectrum().
+ */
+int XLALREAL8VectorSequencePowerSpectrum( REAL8VectorSequence *spec, const REAL8VectorSequence *data, const REAL8FFTBatchPlan *plan );
+
+
 /** @} */
 
 #if 0
@@ -27,12 +27,27 @@
 #define VECTOR_FFT_FUNCTION		CONCAT3(XLAL,REAL_VECTOR_TYPE,FFT)
 #define POWER_SPECTRUM_FUNCTION		CONCAT3(XLAL,REAL_TYPE,PowerSpectrum)
 
+#define BATCH_PLAN_TYPE			CONCAT2(REAL_TYPE,FFTBatchPlan)
+#define REAL_SEQUENCE_TYPE		CONCAT2(REAL_TYPE,VectorSequence)
+#define COMPLEX_SEQUENCE_TYPE		CONCAT2(COMPLEX_TYPE,VectorSequence)
+
+#define CREATE_BATCH_PLAN_FUNCTION		CONCAT2(XLALCreate,BATCH_PLAN_TYPE)
+#define CREATE_FORWARD_BATCH_PLAN_FUNCTION	CONCAT2(XLALCreateForward,BATCH_PLAN_TYPE)
+#define CREATE_REVERSE_BATCH_PLAN_FUNCTION	CONCAT2(XLALCreateReverse,BATCH_PLAN_TYPE)
+#define DESTROY_BATCH_PLAN_FUNCTION		CONCAT2(XLALDestroy,BATCH_PLAN_TYPE)
+#define SEQUENCE_FORWARD_FFT_FUNCTION		CONCAT3(XLAL,REAL_SEQUENCE_TYPE,ForwardFFT)
+#define SEQUENCE_REVERSE_FFT_FUNCTION		CONCAT3(XLAL,REAL_SEQUENCE_TYPE,ReverseFFT)
+#define SEQUENCE_POWER_SPECTRUM_FUNCTION	CONCAT3(XLAL,REAL_SEQUENCE_TYPE,PowerSpectrum)
+#define BATCH_EXTENT_FUNCTION			CONCAT2(BATCH_PLAN_TYPE,Extent)
+
 #define CREALX				CONCAT2(creal,TYPESUFFIX)
 #define CIMAGX				CONCAT2(cimag,TYPESUFFIX)
 #define FFTWX				CONCAT2(fftw,TYPESUFFIX)
 #define FFTWX_PLAN_R2R_1D		CONCAT2(FFTWX,_plan_r2r_1d)
 #define FFTWX_DESTROY_PLAN		CONCAT2(FFTWX,_destroy_plan)
 #define FFTWX_EXECUTE_R2R		CONCAT2(FFTWX,_execute_r2r)
+#define FFTWX_PLAN_MANY_R2R		CONCAT2(FFTWX,_plan_many_r2r)
+#define FFTWX_R2R_KIND			CONCAT2(FFTWX,_r2r_kind)
 
 PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
 {
@@ -97,10 +112,13 @@ PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
     /* establish fftw mutex lock and create plan */
 
     LAL_FFTW_WISDOM_LOCK;
+    XLALFFTWImportWisdomCache();
+    XLALFFTWPlanWithNThreads(0);
     if (fwdflg) /* forward */
         plan->plan = FFTWX_PLAN_R2R_1D(size, tmp1, tmp2, FFTW_R2HC, flags);
     else        /* reverse */
         plan->plan = FFTWX_PLAN_R2R_1D(size, tmp1, tmp2, FFTW_HC2R, flags);
+    XLALFFTWPlanWithNThreads(1);
     LAL_FFTW_WISDOM_UNLOCK;
 
     /* free the temporary arrays */
@@ -453,6 +471,432 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
     return 0;
 }
 
+/*
+ *
+ * Batched transforms
+ *
+ */
+
+/* number of elements spanned by the real data of a batch plan */
+static size_t BATCH_EXTENT_FUNCTION(const BATCH_PLAN_TYPE * plan)
+{
+    return (size_t) (plan->howmany - 1) * plan->dist + (size_t) (plan->size - 1) * plan->stride + 1;
+}
+
+BATCH_PLAN_TYPE *CREATE_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int fwdflg, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    REAL_TYPE *tmp1;
+    REAL_TYPE *tmp2;
+    size_t nbytes1;
+    size_t nbytes2;
+    int n;
+    FFTWX_R2R_KIND kind;
+    int flags;
+
+    if (!size || !howmany)
+        XLAL_ERROR_NULL(XLAL_EBADLEN);
+    if (!stride || (howmany > 1 && !dist))
+        XLAL_ERROR_NULL(XLAL_EINVAL);
+    if (!fwdflg && BatchVectorsOverlap(size, howmany, stride, dist))
+        XLAL_ERROR_NULL(XLAL_EINVAL, "Real output vectors of the batch overlap");
+
+    /* allocate memory for the plan */
+
+    plan = XLALMalloc(sizeof(*plan));
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    plan->size = size;
+    plan->howmany = howmany;
+    plan->stride = stride;
+    plan->dist = dist;
+    plan->sign = (fwdflg ? -1 : 1);
+
+    /* real data has the user-supplied layout; half-complex data is
+     * stored contiguously, one transform after another */
+
+    nbytes1 = BATCH_EXTENT_FUNCTION(plan) * sizeof(REAL_TYPE);
+    nbytes2 = (size_t) howmany * size * sizeof(REAL_TYPE);
+
+    /* set fftw3 flags to perform requested degree of measurement */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    flags = 0;
+#   else
+    flags = FFTW_UNALIGNED;
+#   endif
+
+    switch (measurelvl) {
+    case 0:    /* estimate */
+        flags |= FFTW_ESTIMATE;
+        break;
+    default:   /* exhaustive measurement */
+        flags |= FFTW_EXHAUSTIVE;
+        /* fall-through */
+    case 2:    /* lengthy measurement */
+        flags |= FFTW_PATIENT;
+        /* fall-through */
+    case 1:    /* measure the best plan */
+        flags |= FFTW_MEASURE;
+        break;
+    }
+
+    /* allocate memory for the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmp1 = XLALMallocAligned(nbytes1);
+    tmp2 = XLALMallocAligned(nbytes2);
+    if (!tmp1 || !tmp2) {
+        XLALFreeAligned(tmp1);
+        XLALFreeAligned(tmp2);
+        XLALFree(plan);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   else
+    tmp1 = XLALMalloc(nbytes1);
+    tmp2 = XLALMalloc(nbytes2);
+    if (!tmp1 || !tmp2) {
+        XLALFree(tmp1);
+        XLALFree(tmp2);
+        XLALFree(plan);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   endif
+
+    /* establish fftw mutex lock and create plan */
+
+    n = size;
+    LAL_FFTW_WISDOM_LOCK;
+    XLALFFTWImportWisdomCache();
+    XLALFFTWPlanWithNThreads(0);
+    if (fwdflg) { /* forward: strided real data to contiguous half-complex */
+        kind = FFTW_R2HC;
+        plan->plan = FFTWX_PLAN_MANY_R2R(1, &n, howmany, tmp1, NULL, stride, dist, tmp2, NULL, 1, size, &kind, flags);
+    } else {      /* reverse: contiguous half-complex to strided real data */
+        kind = FFTW_HC2R;
+        plan->plan = FFTWX_PLAN_MANY_R2R(1, &n, howmany, tmp2, NULL, 1, size, tmp1, NULL, stride, dist, &kind, flags);
+    }
+    XLALFFTWPlanWithNThreads(1);
+    LAL_FFTW_WISDOM_UNLOCK;
+
+    /* free the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    XLALFreeAligned(tmp1);
+    XLALFreeAligned(tmp2);
+#   else
+    XLALFree(tmp1);
+    XLALFree(tmp2);
+#   endif
+
+    /* check to see success of plan creation */
+
+    if (!plan->plan) {
+        XLALFree(plan);
+        XLAL_ERROR_NULL(XLAL_EFAILED);
+    }
+
+    return plan;
+}
+
+BATCH_PLAN_TYPE *CREATE_FORWARD_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    plan = CREATE_BATCH_PLAN_FUNCTION(size, howmany, stride, dist, 1, measurelvl);
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    return plan;
+}
+
+BATCH_PLAN_TYPE *CREATE_REVERSE_BATCH_PLAN_FUNCTION(UINT4 size, UINT4 howmany, UINT4 stride, UINT4 dist, int measurelvl)
+{
+    BATCH_PLAN_TYPE *plan;
+    plan = CREATE_BATCH_PLAN_FUNCTION(size, howmany, stride, dist, 0, measurelvl);
+    if (!plan)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    return plan;
+}
+
+void DESTROY_BATCH_PLAN_FUNCTION(BATCH_PLAN_TYPE * plan)
+{
+    if (plan) {
+        if (plan->plan) {
+            LAL_FFTW_WISDOM_LOCK;
+            FFTWX_DESTROY_PLAN(plan->plan);
+            LAL_FFTW_WISDOM_UNLOCK;
+        }
+        memset(plan, 0, sizeof(*plan));
+        XLALFree(plan);
+    }
+}
+
+int SEQUENCE_FORWARD_FFT_FUNCTION(COMPLEX_SEQUENCE_TYPE * output, const REAL_SEQUENCE_TYPE * input, const BATCH_PLAN_TYPE * plan)
+{
+    REAL_TYPE *input_data;
+    REAL_TYPE *tmp;
+    UINT4 i;
+    UINT4 k;
+    size_t nbytes;
+
+    /* sanity checks on arguments */
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size || plan->sign != -1)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data)
+        XLAL_ERROR(XLAL_EINVAL);
+    if ((size_t) input->length * input->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (output->length != plan->howmany || output->vectorLength != plan->size / 2 + 1)
+        XLAL_ERROR(XLAL_EBADLEN);
+
+    nbytes = (size_t) plan->howmany * plan->size * sizeof(REAL_TYPE);
+    input_data = input->data;
+
+    /* create temporary storage space; make sure that input data is
+     * aligned, if memory alignment is required */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmp = XLALMallocAligned(nbytes);
+    if (!tmp)
+        XLAL_ERROR(XLAL_ENOMEM);
+    if (!LAL_IS_MEMORY_ALIGNED(input_data)) {
+        /* need to create temporary aligned space for input data */
+        size_t nbytes_in = BATCH_EXTENT_FUNCTION(plan) * sizeof(REAL_TYPE);
+        input_data = XLALMallocAligned(nbytes_in);
+        if (!input_data) {
+            XLALFreeAligned(tmp);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+        memcpy(input_data, input->data, nbytes_in);
+    }
+#   else
+    tmp = XLALMalloc(nbytes);
+    if (!tmp)
+        XLAL_ERROR(XLAL_ENOMEM);
+#   endif
+
+    /* perform all the ffts */
+
+    FFTWX_EXECUTE_R2R(plan->plan, input_data, tmp);
+
+    /* unpack the results into the output sequence */
+
+    for (i = 0; i < plan->howmany; ++i) {
+        const REAL_TYPE *hc = tmp + (size_t) i * plan->size;
+        COMPLEX_TYPE *out = output->data + (size_t) i * output->vectorLength;
+
+        /* dc component */
+        out[0] = hc[0];
+
+        /* other components */
+        for (k = 1; k < (plan->size + 1) / 2; ++k)      /* k < size/2 rounded up */
+            out[k] = hc[k] + I * hc[plan->size - k];
+
+        /* Nyquist frequency */
+        if (plan->size % 2 == 0)        /* n is even */
+            out[plan->size / 2] = hc[plan->size / 2];
+    }
+
+    /* cleanup and return */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (input_data != input->data)
+        XLALFreeAligned(input_data);
+    XLALFreeAligned(tmp);
+#   else
+    XLALFree(tmp);
+#   endif
+
+    return 0;
+}
+
+int SEQUENCE_REVERSE_FFT_FUNCTION(REAL_SEQUENCE_TYPE * output, const COMPLEX_SEQUENCE_TYPE * input, const BATCH_PLAN_TYPE * plan)
+{
+    REAL_TYPE *output_data;
+    REAL_TYPE *tmp;
+    UINT4 i;
+    UINT4 k;
+    size_t nbytes;
+
+    /* sanity checks on arguments */
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size || plan->sign != 1)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data)
+        XLAL_ERROR(XLAL_EINVAL);
+    if ((size_t) output->length * output->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (input->length != plan->howmany || input->vectorLength != plan->size / 2 + 1)
+        XLAL_ERROR(XLAL_EBADLEN);
+    for (i = 0; i < plan->howmany; ++i) {
+        const COMPLEX_TYPE *in = input->data + (size_t) i * input->vectorLength;
+        if (CIMAGX(in[0]) != 0.0)
+            XLAL_ERROR(XLAL_EDOM);      /* imaginary part of DC must be zero */
+        if (plan->size % 2 == 0 && CIMAGX(in[plan->size / 2]) != 0.0)
+            XLAL_ERROR(XLAL_EDOM);      /* imaginary part of Nyquist must be zero */
+    }
+
+    output_data = output->data;
+    nbytes = (size_t) plan->howmany * plan->size * sizeof(REAL_TYPE);
+
+    /* create temporary storage space; make sure that output data is
+     * aligned, if memory alignment is required */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmp = XLALMallocAligned(nbytes);
+    if (!tmp)
+        XLAL_ERROR(XLAL_ENOMEM);
+    if (!LAL_IS_MEMORY_ALIGNED(output_data)) {
+        /* copy the existing output so that elements between strided
+         * vectors are preserved when the data is copied back */
+        output_data = XLALMallocAligned(BATCH_EXTENT_FUNCTION(plan) * sizeof(REAL_TYPE));
+        if (!output_data) {
+            XLALFreeAligned(tmp);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+        memcpy(output_data, output->data, BATCH_EXTENT_FUNCTION(plan) * sizeof(REAL_TYPE));
+    }
+#   else
+    tmp = XLALMalloc(nbytes);
+    if (!tmp)
+        XLAL_ERROR(XLAL_ENOMEM);
+#   endif
+
+    /* pack input into temporary array */
+
+    for (i = 0; i < plan->howmany; ++i) {
+        const COMPLEX_TYPE *in = input->data + (size_t) i * input->vectorLength;
+        REAL_TYPE *hc = tmp + (size_t) i * plan->size;
+
+        /* dc component */
+        hc[0] = CREALX(in[0]);
+
+        /* other components */
+        for (k = 1; k < (plan->size + 1) / 2; ++k) {    /* k < size/2 rounded up */
+            hc[k] = CREALX(in[k]);
+            hc[plan->size - k] = CIMAGX(in[k]);
+        }
+
+        /* Nyquist component */
+        if (plan->size % 2 == 0)        /* n is even */
+            hc[plan->size / 2] = CREALX(in[plan->size / 2]);
+    }
+
+    /* perform all the ffts */
+
+    FFTWX_EXECUTE_R2R(plan->plan, tmp, output_data);
+
+    /* if temporary space for output data was created, copy data into
+     * the output sequence and free the temporary space */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (output_data != output->data) {
+        memcpy(output->data, output_data, BATCH_EXTENT_FUNCTION(plan) * sizeof(REAL_TYPE));
+        XLALFreeAligned(output_data);
+    }
+#   endif
+
+    /* cleanup and return */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    XLALFreeAligned(tmp);
+#   else
+    XLALFree(tmp);
+#   endif
+
+    return 0;
+}
+
+int SEQUENCE_POWER_SPECTRUM_FUNCTION(REAL_SEQUENCE_TYPE * spec, const REAL_SEQUENCE_TYPE * data, const BATCH_PLAN_TYPE * plan)
+{
+    REAL_TYPE *input_data;
+    REAL_TYPE *tmp;
+    UINT4 i;
+    UINT4 k;
+    size_t nbytes;
+
+    /* sanity check on arguments */
+
+    if (!spec || !data || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size || plan->sign != -1)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!spec->data || !data->data)
+        XLAL_ERROR(XLAL_EINVAL);
+    if ((size_t) data->length * data->vectorLength < BATCH_EXTENT_FUNCTION(plan))
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (spec->length != plan->howmany || spec->vectorLength != plan->size / 2 + 1)
+        XLAL_ERROR(XLAL_EBADLEN);
+
+    nbytes = (size_t) plan->howmany * plan->size * sizeof(REAL_TYPE);
+    input_data = data->data;
+
+    /* create temporary storage space; make sure that input data is
+     * aligned, if memory alignment is required */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmp = XLALMallocAligned(nbytes);
+    if (!tmp)
+        XLAL_ERROR(XLAL_ENOMEM);
+    if (!LAL_IS_MEMORY_ALIGNED(input_data)) {
+        /* need to create temporary aligned space for input data */
+        size_t nbytes_in = BATCH_EXTENT_FUNCTION(plan) * sizeof(REAL_TYPE);
+        input_data = XLALMallocAligned(nbytes_in);
+        if (!input_data) {
+            XLALFreeAligned(tmp);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+        memcpy(input_data, data->data, nbytes_in);
+    }
+#   else
+    tmp = XLALMalloc(nbytes);
+    if (!tmp)
+        XLAL_ERROR(XLAL_ENOMEM);
+#   endif
+
+    /* perform all the ffts */
+
+    FFTWX_EXECUTE_R2R(plan->plan, input_data, tmp);
+
+    /* compute spectra from the ffts of the data */
+
+    for (i = 0; i < plan->howmany; ++i) {
+        const REAL_TYPE *hc = tmp + (size_t) i * plan->size;
+        REAL_TYPE *out = spec->data + (size_t) i * spec->vectorLength;
+
+        /* dc component */
+        out[0] = hc[0] * hc[0];
+
+        /* other components */
+        for (k = 1; k < (plan->size + 1) / 2; ++k) {    /* k < size/2 rounded up */
+            REAL_TYPE re = hc[k];
+            REAL_TYPE im = hc[plan->size - k];
+            out[k] = re * re + im * im;
+            out[k] *= 2.0;      /* accounts for negative frequency part */
+        }
+
+        /* Nyquist frequency */
+        if (plan->size % 2 == 0)        /* size is even */
+            out[plan->size / 2] = hc[plan->size / 2] * hc[plan->size / 2];
+    }
+
+    /* cleanup and return */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (input_data != data->data)
+        XLALFreeAligned(input_data);
+    XLALFreeAligned(tmp);
+#   else
+    XLALFree(tmp);
+#   endif
+
+    return 0;
+}
+
 #undef CONCAT2x
 #undef CONCAT2
 #undef CONCAT3x
@@ -476,9 +920,24 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
 #undef VECTOR_FFT_FUNCTION
 #undef POWER_SPECTRUM_FUNCTION
 
+#undef BATCH_PLAN_TYPE
+#undef REAL_SEQUENCE_TYPE
+#undef COMPLEX_SEQUENCE_TYPE
+
+#undef CREATE_BATCH_PLAN_FUNCTION
+#undef CREATE_FORWARD_BATCH_PLAN_FUNCTION
+#undef CREATE_REVERSE_BATCH_PLAN_FUNCTION
+#undef DESTROY_BATCH_PLAN_FUNCTION
+#undef SEQUENCE_FORWARD_FFT_FUNCTION
+#undef SEQUENCE_REVERSE_FFT_FUNCTION
+#undef SEQUENCE_POWER_SPECTRUM_FUNCTION
+#undef BATCH_EXTENT_FUNCTION
+
 #undef CREALX
 #undef CIMAGX
 #undef FFTWX
 #undef FFTWX_PLAN_R2R_1D
 #undef FFTWX_DESTROY_PLAN
 #undef FFTWX_EXECUTE_R2R
+#undef FFTWX_PLAN_MANY_R2R
+#undef FFTWX_R2R_KIND
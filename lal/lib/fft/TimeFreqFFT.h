@@ -186,6 +186,16 @@ tagLALPSDRegressor
 }
 LALPSDRegressor;
 
+/** Averaging methods used by a LALPSDStream */
+typedef enum tagLALPSDStreamMethod {
+  LAL_PSD_STREAM_WELCH,		/**< mean of the segment periodograms */
+  LAL_PSD_STREAM_MEDIAN,	/**< bias-corrected median of the segment periodograms */
+  LAL_PSD_STREAM_MEDIAN_MEAN	/**< mean of the bias-corrected medians of the even and odd segment periodograms */
+} LALPSDStreamMethod;
+
+/** Incremental PSD estimator; see XLALPSDStreamNew() */
+typedef struct tagLALPSDStream LALPSDStream;
+
 /*
  *
  * XLAL Functions
@@ -410,6 +420,36 @@ XLALPSDRegressorSetPSD(
     unsigned weight
 );
 
+LALPSDStream *XLALPSDStreamNew(
+    UINT4                        seglen,
+    UINT4                        stride,
+    UINT4                        nsegments,
+    LALPSDStreamMethod           method,
+    const REAL8Window           *window,
+    const REAL8FFTPlan          *plan
+    );
+
+void XLALPSDStreamFree(
+    LALPSDStream *s
+    );
+
+void XLALPSDStreamReset(
+    LALPSDStream *s
+    );
+
+UINT4 XLALPSDStreamGetNSegments(
+    const LALPSDStream *s
+    );
+
+int XLALPSDStreamAddData(
+    LALPSDStream *s,
+    const REAL8TimeSeries *tseries
+    );
+
+REAL8FrequencySeries *XLALPSDStreamGetPSD(
+    const LALPSDStream *s
+    );
+
 
 /** @} */
 
@@ -18,6 +18,7 @@
 *  MA  02110-1301  USA
 */
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -207,6 +208,260 @@ void XLALFreeAligned(void *ptr)
 
 #endif /* LAL_FFTW3_MEMALIGN_ENABLED */
 
+/*
+ * Arena allocator.
+ */
+
+/* Round up to a multiple of the arena alignment */
+#define ARENA_ROUNDUP(n) (((n) + LAL_ARENA_ALIGNMENT - 1) & ~((size_t)(LAL_ARENA_ALIGNMENT - 1)))
+
+/* Default size of an arena block */
+#define ARENA_DEFAULT_BLOCKSIZE ((size_t)1 << 20)
+
+/* Maximum number of free arena blocks kept by each thread */
+#define ARENA_CACHE_MAX 4
+
+/* Arena blocks are allocated with LALMalloc() when memory debugging is on,
+ * so that a leaked arena is reported and overruns past the end of a block
+ * are caught; otherwise they are allocated with malloc() and recycled
+ * through a per-thread cache */
+#if defined NDEBUG
+#define ARENA_TRACKED 0
+#else
+#define ARENA_TRACKED (lalDebugLevel & LALMEMDBGBIT)
+#endif
+
+typedef struct tagLALArenaBlock {
+    struct tagLALArenaBlock *next;	/* next block in arena */
+    size_t size;			/* usable size of block */
+    size_t offset;			/* offset of first free byte in block */
+    int tracked;			/* whether block was allocated by LALMalloc() */
+    char *data;				/* aligned start of usable memory */
+} LALArenaBlock;
+
+struct tagLALArena {
+    size_t blocksize;			/* minimum size of new blocks */
+    size_t used;			/* bytes allocated since last reset */
+    LALArenaBlock *block;		/* current block, followed by full blocks */
+};
+
+typedef struct tagLALArenaCache {
+    int n;
+    LALArenaBlock *blocks[ARENA_CACHE_MAX];
+} LALArenaCache;
+
+#ifdef LAL_PTHREAD_LOCK
+
+#include <pthread.h>
+
+static pthread_key_t arenaCacheKey;
+static pthread_once_t arenaCacheKeyOnce = PTHREAD_ONCE_INIT;
+
+/* Free the arena block cache of an exiting thread */
+static void ArenaCacheDestroy(void *ptr)
+{
+    LALArenaCache *cache = ptr;
+    for (int i = 0; i < cache->n; ++i) {
+        free(cache->blocks[i]);
+    }
+    free(cache);
+}
+
+static void ArenaCacheCreateKey(void)
+{
+    pthread_key_create(&arenaCacheKey, ArenaCacheDestroy);
+}
+
+/* Return the arena block cache of this thread, or NULL if unavailable */
+static LALArenaCache *ArenaCacheGet(void)
+{
+    LALArenaCache *cache;
+    pthread_once(&arenaCacheKeyOnce, ArenaCacheCreateKey);
+    cache = pthread_getspecific(arenaCacheKey);
+    if (cache == NULL) {
+        /* use calloc() so that the cache is not reported as a leak */
+        cache = calloc(1, sizeof(*cache));
+        if (cache != NULL && pthread_setspecific(arenaCacheKey, cache) != 0) {
+            free(cache);
+            cache = NULL;
+        }
+    }
+    return cache;
+}
+
+#else
+
+static LALArenaCache arenaCache;
+
+static LALArenaCache *ArenaCacheGet(void)
+{
+    return &arenaCache;
+}
+
+#endif /* LAL_PTHREAD_LOCK */
+
+/* Allocate an empty arena block with at least 'size' usable bytes */
+static LALArenaBlock *ArenaBlockAlloc(size_t size)
+{
+    LALArenaBlock *block = NULL;
+    const int tracked = ARENA_TRACKED ? 1 : 0;
+    if (!tracked) {
+        /* take the first cached block which is large enough */
+        LALArenaCache *cache = ArenaCacheGet();
+        for (int i = 0; cache != NULL && i < cache->n; ++i) {
+            if (cache->blocks[i]->size >= size) {
+                block = cache->blocks[i];
+                cache->blocks[i] = cache->blocks[--cache->n];
+                break;
+            }
+        }
+    }
+    if (block == NULL) {
+        const size_t n = sizeof(*block) + LAL_ARENA_ALIGNMENT - 1 + size;
+        block = tracked ? LALMalloc(n) : malloc(n);
+        if (block == NULL) {
+            return NULL;
+        }
+        block->size = size;
+        block->tracked = tracked;
+        block->data = (char *) ARENA_ROUNDUP((uintptr_t) (block + 1));
+    }
+    block->next = NULL;
+    block->offset = 0;
+    return block;
+}
+
+/* Free an arena block, keeping it in the cache of this thread if possible */
+static void ArenaBlockFree(LALArenaBlock *block)
+{
+    if (block->tracked) {
+        LALFree(block);
+    } else {
+        LALArenaCache *cache = ArenaCacheGet();
+        if (cache != NULL && cache->n < ARENA_CACHE_MAX) {
+            cache->blocks[cache->n++] = block;
+        } else {
+            free(block);
+        }
+    }
+}
+
+/**
+ * Create an arena allocator, which allocates memory in blocks of at least
+ * 'blocksize' bytes (or a default size if zero). Memory is allocated from the
+ * arena with XLALArenaAlloc(), and is reclaimed all at once for reuse by
+ * XLALArenaReset(), or freed by XLALArenaDestroy().
+ */
+LALArena *XLALArenaCreate(size_t blocksize)
+{
+    LALArena *arena;
+    XLAL_CHECK_NULL(blocksize <= SIZE_MAX / 2, XLAL_ESIZE);
+    arena = XLALMalloc(sizeof(*arena));
+    XLAL_CHECK_NULL(arena != NULL, XLAL_ENOMEM);
+    arena->blocksize = (blocksize > 0) ? ARENA_ROUNDUP(blocksize) : ARENA_DEFAULT_BLOCKSIZE;
+    arena->used = 0;
+    arena->block = NULL;
+    return arena;
+}
+
+/**
+ * Destroy an arena allocator, and free all memory allocated from it.
+ */
+void XLALArenaDestroy(LALArena *arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+    while (arena->block != NULL) {
+        LALArenaBlock *next = arena->block->next;
+        ArenaBlockFree(arena->block);
+        arena->block = next;
+    }
+    XLALFree(arena);
+}
+
+/**
+ * Invalidate all memory allocated from an arena allocator, so that it may be
+ * reused by subsequent calls to XLALArenaAlloc(). A reset does not return
+ * memory to the system: the arena keeps its block, and if the allocations
+ * since the last reset needed more than one block, they are replaced by a
+ * single block large enough to hold all of them, so that a repeated sequence
+ * of allocations is eventually served from one block. The replaced blocks are
+ * freed, or kept in the per-thread block cache if memory debugging is off.
+ * Use XLALArenaDestroy() to free the memory held by an arena.
+ */
+void XLALArenaReset(LALArena *arena)
+{
+    if (arena == NULL || arena->block == NULL) {
+        return;
+    }
+    if (arena->block->next != NULL) {
+        size_t total = 0;
+        while (arena->block != NULL) {
+            LALArenaBlock *next = arena->block->next;
+            total += arena->block->size;
+            ArenaBlockFree(arena->block);
+            arena->block = next;
+        }
+        /* if this fails, XLALArenaAlloc() will try again */
+        arena->block = ArenaBlockAlloc(total);
+    } else {
+        arena->block->offset = 0;
+    }
+    arena->used = 0;
+}
+
+/**
+ * Allocate 'n' bytes from an arena allocator. The memory is aligned to
+ * #LAL_ARENA_ALIGNMENT bytes, and must not be passed to XLALFree().
+ */
+void *XLALArenaAlloc(LALArena *arena, size_t n)
+{
+    LALArenaBlock *block;
+    void *p;
+    XLAL_CHECK_NULL(arena != NULL, XLAL_EFAULT);
+    XLAL_CHECK_NULL(n <= SIZE_MAX / 2, XLAL_ESIZE);
+    n = (n > 0) ? ARENA_ROUNDUP(n) : LAL_ARENA_ALIGNMENT;
+    block = arena->block;
+    if (block == NULL || block->size - block->offset < n) {
+        block = ArenaBlockAlloc((n > arena->blocksize) ? n : arena->blocksize);
+        XLAL_CHECK_NULL(block != NULL, XLAL_ENOMEM);
+        if (arena->block != NULL && n > arena->blocksize) {
+            /* keep allocating from the current block after an oversized allocation */
+            block->next = arena->block->next;
+            arena->block->next = block;
+        } else {
+            block->next = arena->block;
+            arena->block = block;
+        }
+    }
+    p = block->data + block->offset;
+    block->offset += n;
+    arena->used += n;
+    return p;
+}
+
+/**
+ * Allocate and zero an array of 'm' elements of 'n' bytes from an arena allocator.
+ */
+void *XLALArenaCalloc(LALArena *arena, size_t m, size_t n)
+{
+    void *p;
+    XLAL_CHECK_NULL(n == 0 || m <= SIZE_MAX / n, XLAL_ESIZE);
+    p = XLALArenaAlloc(arena, m * n);
+    XLAL_CHECK_NULL(p != NULL, XLAL_EFUNC);
+    return memset(p, 0, m * n);
+}
+
+/**
+ * Return the number of bytes allocated from an arena allocator since it was
+ * created or last reset, including alignment padding.
+ */
+size_t XLALArenaUsed(const LALArena *arena)
+{
+    return (arena != NULL) ? arena->used : 0;
+}
+
 /*
  *
  * LAL Routines... only if compiled with debugging enabled.
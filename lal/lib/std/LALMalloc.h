@@ -67,6 +67,21 @@ void XLALFreeAligned(void *ptr);
 #endif /* LAL_FFTW3_MEMALIGN_ENABLED */
 /** @} */
 
+/** \addtogroup LALMalloc_h */ /** @{ */
+#ifndef SWIG    /* exclude from SWIG interface */
+/** Alignment of memory allocated by XLALArenaAlloc() */
+#define LAL_ARENA_ALIGNMENT 0x40
+/** Opaque arena allocator; see XLALArenaCreate() */
+typedef struct tagLALArena LALArena;
+LALArena *XLALArenaCreate(size_t blocksize);
+void XLALArenaDestroy(LALArena *arena);
+void XLALArenaReset(LALArena *arena);
+void *XLALArenaAlloc(LALArena *arena, size_t n);
+void *XLALArenaCalloc(LALArena *arena, size_t m, size_t n);
+size_t XLALArenaUsed(const LALArena *arena);
+#endif /* SWIG */
+/** @} */
+
 #if defined NDEBUG
 
 #ifndef SWIG    /* exclude from SWIG interface */
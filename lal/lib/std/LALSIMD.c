@@ -87,6 +87,7 @@ static const char *const iset_names[LAL_SIMD_ISET_MAX] = {
   [LAL_SIMD_ISET_SSE4_2]	= "SSE4.2",
   [LAL_SIMD_ISET_AVX]		= "AVX",
   [LAL_SIMD_ISET_AVX2]		= "AVX2",
+  [LAL_SIMD_ISET_AVX512F]	= "AVX512F",
 };
 
 /* pthread locking to make SIMD detection thread-safe */
@@ -233,6 +234,17 @@ static LAL_SIMD_ISET detect_instruction_set(void) {
 #endif
   iset = LAL_SIMD_ISET_AVX2;				/* AVX2 detected */
 
+  cpuid(abcd, 1);					/* call cpuid function 1 for feature flags */
+  if ((abcd[2] & (1 << 12)) == 0) return iset;		/* no FMA */
+  if ((xgetbv(0) & 0xe6) != 0xe6) return iset;		/* AVX-512 not enabled in O.S. */
+#if HAVE_X86 && defined(__GNUC__) && (__GNUC__ >= 5)
+  if (!__builtin_cpu_supports("avx512f")) return iset;	/* no AVX-512F */
+#else
+  cpuid(abcd, 7);					/* call cpuid function 7 for feature flags */
+  if ((abcd[1] & (1 << 16)) == 0) return iset;		/* no AVX-512F */
+#endif
+  iset = LAL_SIMD_ISET_AVX512F;				/* AVX-512F detected */
+
   return iset;
 
 }
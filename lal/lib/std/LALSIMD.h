@@ -55,6 +55,7 @@ typedef enum tagLAL_SIMD_ISET {
   LAL_SIMD_ISET_SSE4_2,		/**< SSE version 4.2 */
   LAL_SIMD_ISET_AVX,		/**< AVX (Advanced Vector Extensions) */
   LAL_SIMD_ISET_AVX2,		/**< AVX version 2 */
+  LAL_SIMD_ISET_AVX512F,	/**< AVX-512 Foundation, with FMA (Fused Multiply-Add) */
 
   LAL_SIMD_ISET_MAX
 } LAL_SIMD_ISET;
@@ -79,6 +80,7 @@ const char *XLALSIMDInstructionSetName(LAL_SIMD_ISET iset);
 #define LAL_HAVE_SSE4_2_RUNTIME()	(XLALHaveSIMDInstructionSet(LAL_SIMD_ISET_SSE4_2))
 #define LAL_HAVE_AVX_RUNTIME()		(XLALHaveSIMDInstructionSet(LAL_SIMD_ISET_AVX))
 #define LAL_HAVE_AVX2_RUNTIME()		(XLALHaveSIMDInstructionSet(LAL_SIMD_ISET_AVX2))
+#define LAL_HAVE_AVX512F_RUNTIME()	(XLALHaveSIMDInstructionSet(LAL_SIMD_ISET_AVX512F))
 /** @} */
 
 /** @} */
@@ -113,6 +113,19 @@ typedef union tagLALH5Generic {
 	LALH5Dataset *dset;    /**< Pointer to a ::LALH5Dataset dataset */
 } LALH5Generic;
 
+struct tagLALH5TimeSeriesIter;
+/**
+ * @brief Incomplete type for an iterator over a HDF5 time series dataset.
+ * @details
+ * The ::LALH5TimeSeriesIter is a structure that is used to read a time
+ * series dataset block by block.
+ *
+ * Allocate ::LALH5TimeSeriesIter structures using XLALH5TimeSeriesIterOpen().
+ *
+ * Deallocate ::LALH5TimeSeriesIter structures using XLALH5TimeSeriesIterClose().
+ */
+typedef struct tagLALH5TimeSeriesIter LALH5TimeSeriesIter;
+
 void XLALH5FileClose(LALH5File *file);
 LALH5File * XLALH5FileOpen(const char *path, const char *mode);
 LALH5File * XLALH5GroupOpen(LALH5File *file, const char *name);
@@ -133,7 +146,9 @@ void XLALH5DatasetFree(LALH5Dataset *dset);
 
 LALH5Dataset * XLALH5DatasetAlloc(LALH5File *file, const char *name, LALTYPECODE dtype, UINT4Vector *dimLength);
 LALH5Dataset * XLALH5DatasetAlloc1D(LALH5File *file, const char *name, LALTYPECODE dtype, size_t length);
+LALH5Dataset * XLALH5DatasetAllocChunked(LALH5File *file, const char *name, LALTYPECODE dtype, UINT4Vector *dimLength, UINT4Vector *chunkLength, int compress);
 int XLALH5DatasetWrite(LALH5Dataset *dset, void *data);
+int XLALH5DatasetWriteHyperslab(LALH5Dataset *dset, const size_t *offset, const size_t *count, const size_t *stride, const void *data);
 
 /* these routines are deprecated */
 int XLALH5FileGetDatasetNames(LALH5File *file, char *** names, UINT4 *N);
@@ -155,6 +170,10 @@ LALTYPECODE XLALH5DatasetQueryType(LALH5Dataset *dset);
 int XLALH5DatasetQueryNDim(LALH5Dataset *dset);
 UINT4Vector * XLALH5DatasetQueryDims(LALH5Dataset *dset);
 int XLALH5DatasetQueryData(void *data, LALH5Dataset *dset);
+int XLALH5DatasetQueryHyperslab(void *data, LALH5Dataset *dset, const size_t *offset, const size_t *count, const size_t *stride);
+int XLALH5DatasetCheckMappable(LALH5Dataset *dset);
+const void * XLALH5DatasetMapData(LALH5Dataset *dset);
+int XLALH5DatasetUnmapData(const void *data);
 
 /* these routines are deprecated */
 int XLALH5DatasetAddScalarAttribute(LALH5Dataset *dset, const char *key, const void *value, LALTYPECODE dtype);
@@ -260,6 +279,18 @@ REAL8Vector *XLALH5DatasetReadREAL8Vector(LALH5Dataset *dset);
 COMPLEX8Vector *XLALH5DatasetReadCOMPLEX8Vector(LALH5Dataset *dset);
 COMPLEX16Vector *XLALH5DatasetReadCOMPLEX16Vector(LALH5Dataset *dset);
 
+CHARVector *XLALH5DatasetReadCHARVectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+INT2Vector *XLALH5DatasetReadINT2VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+INT4Vector *XLALH5DatasetReadINT4VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+INT8Vector *XLALH5DatasetReadINT8VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+UINT2Vector *XLALH5DatasetReadUINT2VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+UINT4Vector *XLALH5DatasetReadUINT4VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+UINT8Vector *XLALH5DatasetReadUINT8VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+REAL4Vector *XLALH5DatasetReadREAL4VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+REAL8Vector *XLALH5DatasetReadREAL8VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+COMPLEX8Vector *XLALH5DatasetReadCOMPLEX8VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+COMPLEX16Vector *XLALH5DatasetReadCOMPLEX16VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride);
+
 INT2Array *XLALH5DatasetReadINT2Array(LALH5Dataset *dset);
 INT4Array *XLALH5DatasetReadINT4Array(LALH5Dataset *dset);
 INT8Array *XLALH5DatasetReadINT8Array(LALH5Dataset *dset);
@@ -324,6 +355,18 @@ REAL8Vector *XLALH5FileReadREAL8Vector(LALH5File *file, const char *name);
 COMPLEX8Vector *XLALH5FileReadCOMPLEX8Vector(LALH5File *file, const char *name);
 COMPLEX16Vector *XLALH5FileReadCOMPLEX16Vector(LALH5File *file, const char *name);
 
+CHARVector *XLALH5FileReadCHARVectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+INT2Vector *XLALH5FileReadINT2VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+INT4Vector *XLALH5FileReadINT4VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+INT8Vector *XLALH5FileReadINT8VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+UINT2Vector *XLALH5FileReadUINT2VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+UINT4Vector *XLALH5FileReadUINT4VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+UINT8Vector *XLALH5FileReadUINT8VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+REAL4Vector *XLALH5FileReadREAL4VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+REAL8Vector *XLALH5FileReadREAL8VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+COMPLEX8Vector *XLALH5FileReadCOMPLEX8VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+COMPLEX16Vector *XLALH5FileReadCOMPLEX16VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride);
+
 INT2Array *XLALH5FileReadINT2Array(LALH5File *file, const char *name);
 INT4Array *XLALH5FileReadINT4Array(LALH5File *file, const char *name);
 INT8Array *XLALH5FileReadINT8Array(LALH5File *file, const char *name);
@@ -346,6 +389,21 @@ REAL8TimeSeries *XLALH5FileReadREAL8TimeSeries(LALH5File *file, const char *name
 COMPLEX8TimeSeries *XLALH5FileReadCOMPLEX8TimeSeries(LALH5File *file, const char *name);
 COMPLEX16TimeSeries *XLALH5FileReadCOMPLEX16TimeSeries(LALH5File *file, const char *name);
 
+LALH5TimeSeriesIter *XLALH5TimeSeriesIterOpen(LALH5File *file, const char *name);
+void XLALH5TimeSeriesIterClose(LALH5TimeSeriesIter *iter);
+size_t XLALH5TimeSeriesIterQueryLength(const LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterSeek(LALH5TimeSeriesIter *iter, size_t sample);
+int XLALH5TimeSeriesIterNextINT2TimeSeries(UINT8 *count, INT2TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextINT4TimeSeries(UINT8 *count, INT4TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextINT8TimeSeries(UINT8 *count, INT8TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextUINT2TimeSeries(UINT8 *count, UINT2TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextUINT4TimeSeries(UINT8 *count, UINT4TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextUINT8TimeSeries(UINT8 *count, UINT8TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextREAL4TimeSeries(UINT8 *count, REAL4TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextREAL8TimeSeries(UINT8 *count, REAL8TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextCOMPLEX8TimeSeries(UINT8 *count, COMPLEX8TimeSeries *block, LALH5TimeSeriesIter *iter);
+int XLALH5TimeSeriesIterNextCOMPLEX16TimeSeries(UINT8 *count, COMPLEX16TimeSeries *block, LALH5TimeSeriesIter *iter);
+
 REAL4FrequencySeries *XLALH5FileReadREAL4FrequencySeries(LALH5File *file, const char *name);
 REAL8FrequencySeries *XLALH5FileReadREAL8FrequencySeries(LALH5File *file, const char *name);
 COMPLEX8FrequencySeries *XLALH5FileReadCOMPLEX8FrequencySeries(LALH5File *file, const char *name);
@@ -1,8 +1,22 @@
+#include <string.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALString.h>
+#include <lal/Date.h>
 #include <lal/Units.h>
 #include <lal/H5FileIO.h>
 
+struct tagLALH5TimeSeriesIter {
+	LALH5Dataset *dset;
+	LALTYPECODE type;
+	size_t length; /* number of samples in the dataset */
+	size_t next; /* index of the next sample to be read */
+	CHAR name[LALNameLength];
+	LIGOTimeGPS epoch;
+	REAL8 deltaT;
+	REAL8 f0;
+	LALUnit sampleUnits;
+};
+
 #define TYPECODE CHAR
 #define TYPE CHAR
 #include "H5FileIOVectorHL_source.c"
@@ -499,6 +513,83 @@
 
 /** @} */
 
+/**
+ * @name Routines to Read Vector Slices from HDF5 Files
+ * @{
+ */
+
+/**
+ * @fn CHARVector *XLALH5FileReadCHARVectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @brief Reads part of a vector from a #LALH5File
+ * @details
+ * Reads @p length points of data, starting at point @p offset and
+ * separated by @p stride points, from a one-dimensional dataset named
+ * @p name in an HDF5 file associated with the #LALH5File @p file.
+ * Only the requested points are read from the file.
+ *
+ * The #LALH5File @p file passed to this routine must be a file
+ * opened for reading.
+ * @param file Pointer to a #LALH5File to be read.
+ * @param name Pointer to a string with the name of the dataset to read.
+ * @param offset Index of the first point to read.
+ * @param length Number of points to read.
+ * @param stride Separation between the points to read.
+ * @returns Pointer to a vector containing the requested data.
+ * @retval NULL Failure.
+ */
+
+/**
+ * @fn INT2Vector *XLALH5FileReadINT2VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn INT4Vector *XLALH5FileReadINT4VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn INT8Vector *XLALH5FileReadINT8VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn UINT2Vector *XLALH5FileReadUINT2VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn UINT4Vector *XLALH5FileReadUINT4VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn UINT8Vector *XLALH5FileReadUINT8VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn REAL4Vector *XLALH5FileReadREAL4VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn REAL8Vector *XLALH5FileReadREAL8VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn COMPLEX8Vector *XLALH5FileReadCOMPLEX8VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/**
+ * @fn COMPLEX16Vector *XLALH5FileReadCOMPLEX16VectorSlice(LALH5File *file, const char *name, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5FileReadCHARVectorSlice()
+ */
+
+/** @} */
+
 /**
  * @name Routines to Read Time Series from HDF5 Files
  * @{
@@ -566,6 +657,226 @@
 
 /** @} */
 
+/**
+ * @name Routines to Stream Time Series from HDF5 Files
+ * @details
+ * These routines read a time series dataset written by one of the
+ * XLALH5FileWriteINT2TimeSeries() family of routines block by block
+ * into a time series supplied by the caller, so that arbitrarily long
+ * time series can be processed without reading the entire dataset
+ * into memory.  The following example processes a REAL8 time series
+ * in blocks of 16384 samples.
+ * @code
+ * LALH5File *file = XLALH5FileOpen("strain.h5", "r");
+ * LALH5TimeSeriesIter *iter = XLALH5TimeSeriesIterOpen(file, "H1:STRAIN");
+ * REAL8TimeSeries *block = XLALCreateREAL8TimeSeries("", &epoch, 0.0, 1.0, &lalDimensionlessUnit, 16384);
+ * UINT8 n;
+ * while (XLALH5TimeSeriesIterNextREAL8TimeSeries(&n, block, iter) == 0 && n > 0) {
+ *         // process the first n samples of block
+ * }
+ * XLALH5TimeSeriesIterClose(iter);
+ * XLALH5FileClose(file);
+ * @endcode
+ * @{
+ */
+
+/**
+ * @brief Opens a time series dataset in a #LALH5File for streaming
+ * @details
+ * Opens the one-dimensional dataset named @p name in an HDF5 file
+ * associated with the #LALH5File @p file, reads the time series
+ * metadata, and positions the iterator at the first sample.
+ *
+ * The #LALH5File @p file passed to this routine must be a file
+ * opened for reading, and must remain open until the iterator is
+ * closed with XLALH5TimeSeriesIterClose().
+ * @param file Pointer to a #LALH5File to be read.
+ * @param name Pointer to a string with the name of the dataset to read.
+ * @returns Pointer to a new #LALH5TimeSeriesIter.
+ * @retval NULL Failure.
+ */
+LALH5TimeSeriesIter *XLALH5TimeSeriesIterOpen(LALH5File *file, const char *name)
+{
+	char sampleUnits[LALUnitTextSize];
+	LALH5TimeSeriesIter *iter;
+	int n;
+
+	if (!file || !name)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+
+	iter = XLALCalloc(1, sizeof(*iter));
+	if (!iter)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+
+	iter->dset = XLALH5DatasetRead(file, name);
+	if (!iter->dset) {
+		XLALFree(iter);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	if (XLALH5DatasetQueryNDim(iter->dset) != 1) {
+		XLALH5TimeSeriesIterClose(iter);
+		XLAL_ERROR_NULL(XLAL_EDIMS, "Dataset `%s' is not one-dimensional", name);
+	}
+
+	iter->type = XLALH5DatasetQueryType(iter->dset);
+	iter->length = XLALH5DatasetQueryNPoints(iter->dset);
+	if ((int)iter->type < 0 || iter->length == (size_t)(-1)) {
+		XLALH5TimeSeriesIterClose(iter);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	/* read metadata */
+
+	n = XLALH5AttributeQueryStringValue(iter->name, sizeof(iter->name), (LALH5Generic)iter->dset, "name");
+	if (n < 0) {
+		XLALH5TimeSeriesIterClose(iter);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	if ((size_t)n >= sizeof(iter->name))
+		XLAL_PRINT_WARNING("Name of time series was truncated");
+
+	n = XLALH5AttributeQueryStringValue(sampleUnits, sizeof(sampleUnits), (LALH5Generic)iter->dset, "sampleUnits");
+	if (n < 0) {
+		XLALH5TimeSeriesIterClose(iter);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	/* note: treat failure to parse sample unit string as a warning */
+	if ((size_t)n >= sizeof(sampleUnits) || XLALParseUnitString(&iter->sampleUnits, sampleUnits) == NULL) {
+		XLAL_PRINT_WARNING("Could not parse unit string `%s'", sampleUnits);
+		iter->sampleUnits = lalDimensionlessUnit;
+	}
+
+	if (XLALH5AttributeQueryLIGOTimeGPSValue(&iter->epoch, (LALH5Generic)iter->dset, "epoch") == NULL) {
+		XLALH5TimeSeriesIterClose(iter);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	iter->deltaT = XLALH5DatasetQueryREAL8AttributeValue(iter->dset, "deltaT");
+	iter->f0 = XLALH5DatasetQueryREAL8AttributeValue(iter->dset, "f0");
+	if (XLAL_IS_REAL8_FAIL_NAN(iter->deltaT) || XLAL_IS_REAL8_FAIL_NAN(iter->f0)) {
+		XLALH5TimeSeriesIterClose(iter);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	return iter;
+}
+
+/**
+ * @brief Closes a #LALH5TimeSeriesIter
+ * @param iter Pointer to the #LALH5TimeSeriesIter to be closed.
+ */
+void XLALH5TimeSeriesIterClose(LALH5TimeSeriesIter *iter)
+{
+	if (iter) {
+		XLALH5DatasetFree(iter->dset);
+		XLALFree(iter);
+	}
+	return;
+}
+
+/**
+ * @brief Gets the total number of samples in a streamed time series
+ * @param iter Pointer to the #LALH5TimeSeriesIter to be queried.
+ * @returns The number of samples in the time series dataset.
+ * @retval (size_t)(-1) Failure.
+ */
+size_t XLALH5TimeSeriesIterQueryLength(const LALH5TimeSeriesIter *iter)
+{
+	if (!iter)
+		XLAL_ERROR(XLAL_EFAULT);
+	return iter->length;
+}
+
+/**
+ * @brief Repositions a #LALH5TimeSeriesIter
+ * @details
+ * Sets the iterator @p iter so that the next block read starts at
+ * sample @p sample of the time series, where the first sample is
+ * sample 0.  Seeking to the end of the time series is allowed, after
+ * which no more samples are read.
+ * @param iter Pointer to the #LALH5TimeSeriesIter to be repositioned.
+ * @param sample Index of the next sample to be read.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5TimeSeriesIterSeek(LALH5TimeSeriesIter *iter, size_t sample)
+{
+	if (!iter)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (sample > iter->length)
+		XLAL_ERROR(XLAL_EDOM, "Sample %zu is beyond the end of the time series", sample);
+	iter->next = sample;
+	return 0;
+}
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextINT2TimeSeries(UINT8 *count, INT2TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @brief Reads the next block of a streamed time series
+ * @details
+ * Reads up to @p block->data->length samples, starting at the current
+ * position of the iterator @p iter, into the existing data vector of
+ * the time series @p block, and advances the iterator.  The metadata of
+ * @p block are set to those of the time series dataset, with the epoch
+ * set to the time of the first sample read.  If fewer samples remain
+ * than fit in @p block, the trailing samples of @p block are not
+ * modified.
+ * @param[out] count Pointer to a variable that receives the number of
+ * samples read, which is 0 once the end of the time series has been
+ * reached.
+ * @param block Pointer to a time series to receive the data.
+ * @param iter Pointer to the #LALH5TimeSeriesIter to be read.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextINT4TimeSeries(UINT8 *count, INT4TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextINT8TimeSeries(UINT8 *count, INT8TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextUINT2TimeSeries(UINT8 *count, UINT2TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextUINT4TimeSeries(UINT8 *count, UINT4TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextUINT8TimeSeries(UINT8 *count, UINT8TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextREAL4TimeSeries(UINT8 *count, REAL4TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextREAL8TimeSeries(UINT8 *count, REAL8TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextCOMPLEX8TimeSeries(UINT8 *count, COMPLEX8TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/**
+ * @fn int XLALH5TimeSeriesIterNextCOMPLEX16TimeSeries(UINT8 *count, COMPLEX16TimeSeries *block, LALH5TimeSeriesIter *iter)
+ * @copydoc XLALH5TimeSeriesIterNextINT2TimeSeries()
+ */
+
+/** @} */
+
 /**
  * @name Routines to Read Frequency Series from HDF5 Files
  * @{
@@ -16,6 +16,15 @@
 #include <lal/AVFactories.h>
 #include <lal/H5FileIO.h>
 
+#if defined(HAVE_HDF5) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_UNISTD_H) && defined(HAVE_FCNTL_H)
+#define LAL_H5_MMAP_ENABLED
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 /* INTERNAL */
 
 #ifdef __GNUC__
@@ -337,6 +346,222 @@ static LALH5File * XLALH5FileOpenRead(const char *path)
 	return file;
 }
 
+/* selects a hyperslab of a dataset; use H5Sclose() to free the returned dataspaces */
+static int XLALH5DatasetSelectHyperslab(hid_t *filespace_id, hid_t *memspace_id, const LALH5Dataset *dset, const size_t *offset, const size_t *count, const size_t *stride)
+{
+	hsize_t dims[H5S_MAX_RANK];
+	hsize_t start[H5S_MAX_RANK];
+	hsize_t block[H5S_MAX_RANK];
+	hsize_t step[H5S_MAX_RANK];
+	int rank;
+	int dim;
+
+	rank = threadsafe_H5Sget_simple_extent_dims(dset->space_id, dims, NULL);
+	if (rank < 0)
+		XLAL_ERROR(XLAL_EIO, "Could not read dimensions of dataspace");
+	if (rank == 0)
+		XLAL_ERROR(XLAL_EINVAL, "Cannot select a hyperslab of scalar dataset `%s'", dset->name);
+
+	/* check that the hyperslab lies within the dataspace */
+	for (dim = 0; dim < rank; ++dim) {
+		start[dim] = offset[dim];
+		block[dim] = count[dim];
+		step[dim] = stride ? stride[dim] : 1;
+		if (block[dim] == 0 || step[dim] == 0)
+			XLAL_ERROR(XLAL_EINVAL, "Hyperslab count and stride must be positive");
+		if (start[dim] >= dims[dim] || (block[dim] - 1) * step[dim] >= dims[dim] - start[dim])
+			XLAL_ERROR(XLAL_EDOM, "Hyperslab exceeds dimension %d of dataset `%s'", dim, dset->name);
+	}
+
+	*filespace_id = threadsafe_H5Scopy(dset->space_id);
+	if (*filespace_id < 0)
+		XLAL_ERROR(XLAL_EIO, "Could not copy dataspace of dataset `%s'", dset->name);
+	if (threadsafe_H5Sselect_hyperslab(*filespace_id, H5S_SELECT_SET, start, step, block, NULL) < 0) {
+		threadsafe_H5Sclose(*filespace_id);
+		XLAL_ERROR(XLAL_EIO, "Could not select hyperslab of dataset `%s'", dset->name);
+	}
+
+	/* data in memory is contiguous with the shape of the hyperslab */
+	*memspace_id = threadsafe_H5Screate_simple(rank, block, NULL);
+	if (*memspace_id < 0) {
+		threadsafe_H5Sclose(*filespace_id);
+		XLAL_ERROR(XLAL_EIO, "Could not create memory dataspace");
+	}
+
+	return 0;
+}
+
+#ifdef LAL_H5_MMAP_ENABLED
+
+/* nanoseconds of the modification time of a file, if available */
+#if defined(HAVE_STRUCT_STAT_ST_MTIM)
+#define LAL_H5_MTIME_NSEC(st) ((st).st_mtim.tv_nsec)
+#elif defined(HAVE_STRUCT_STAT_ST_MTIMESPEC)
+#define LAL_H5_MTIME_NSEC(st) ((st).st_mtimespec.tv_nsec)
+#else
+#define LAL_H5_MTIME_NSEC(st) 0L
+#endif
+
+/* process-wide list of read-only file mappings; a mapping is unmapped and
+ * its entry evicted when its last user releases it.  An entry whose file
+ * has since been modified is stale: it is no longer reused, but remains
+ * mapped until it is released */
+struct tagLALH5MappedFile {
+	dev_t dev;
+	ino_t ino;
+	off_t size;
+	time_t mtime;
+	long mtime_nsec;
+	const char *base;
+	size_t nref;
+	int stale;
+	struct tagLALH5MappedFile *next;
+};
+static struct tagLALH5MappedFile *lalH5MappedFiles = NULL;
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_mutex_t lalH5MappedFilesMutex = PTHREAD_MUTEX_INITIALIZER;
+#define LAL_H5_MAP_LOCK pthread_mutex_lock(&lalH5MappedFilesMutex)
+#define LAL_H5_MAP_UNLOCK pthread_mutex_unlock(&lalH5MappedFilesMutex)
+#else
+#define LAL_H5_MAP_LOCK ((void)0)
+#define LAL_H5_MAP_UNLOCK ((void)0)
+#endif
+
+/* maps a file read-only into memory, reusing any existing mapping of the same unmodified file */
+static const char *XLALH5MapFile(const char *path, size_t *size)
+{
+	struct tagLALH5MappedFile *mf;
+	struct stat st;
+	void *base;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not open file `%s'", path);
+	if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+		close(fd);
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not stat file `%s'", path);
+	}
+
+	LAL_H5_MAP_LOCK;
+	for (mf = lalH5MappedFiles; mf; mf = mf->next) {
+		if (mf->stale || mf->dev != st.st_dev || mf->ino != st.st_ino)
+			continue;
+		if (mf->size == st.st_size && mf->mtime == st.st_mtime && mf->mtime_nsec == LAL_H5_MTIME_NSEC(st))
+			break;
+		mf->stale = 1;	/* file has been modified since it was mapped */
+	}
+	if (!mf) {
+		/* note: use system malloc since the mapping may outlive LAL memory checking */
+		mf = malloc(sizeof(*mf));
+		if (!mf) {
+			LAL_H5_MAP_UNLOCK;
+			close(fd);
+			XLAL_ERROR_NULL(XLAL_ENOMEM);
+		}
+		base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (base == MAP_FAILED) {
+			LAL_H5_MAP_UNLOCK;
+			free(mf);
+			close(fd);
+			XLAL_ERROR_NULL(XLAL_ESYS, "Could not map file `%s' into memory", path);
+		}
+		mf->dev = st.st_dev;
+		mf->ino = st.st_ino;
+		mf->size = st.st_size;
+		mf->mtime = st.st_mtime;
+		mf->mtime_nsec = LAL_H5_MTIME_NSEC(st);
+		mf->base = base;
+		mf->nref = 0;
+		mf->stale = 0;
+		mf->next = lalH5MappedFiles;
+		lalH5MappedFiles = mf;
+	}
+	++mf->nref;
+	LAL_H5_MAP_UNLOCK;
+
+	/* the mapping remains valid after the file is closed */
+	close(fd);
+	*size = mf->size;
+	return mf->base;
+}
+
+/* releases a mapping containing ptr, unmapping it if it is no longer used */
+static int XLALH5UnmapFile(const void *ptr)
+{
+	struct tagLALH5MappedFile **pmf;
+	struct tagLALH5MappedFile *mf;
+	const char *p = ptr;
+
+	LAL_H5_MAP_LOCK;
+	for (pmf = &lalH5MappedFiles; (mf = *pmf) != NULL; pmf = &mf->next)
+		if (p >= mf->base && p < mf->base + mf->size)
+			break;
+	if (!mf) {
+		LAL_H5_MAP_UNLOCK;
+		XLAL_ERROR(XLAL_EINVAL, "Pointer is not within a mapped file");
+	}
+	if (--mf->nref == 0) {
+		*pmf = mf->next;	/* evict entry */
+		munmap((void *)(intptr_t)mf->base, mf->size);
+		free(mf);
+	}
+	LAL_H5_MAP_UNLOCK;
+
+	return 0;
+}
+
+#endif /* LAL_H5_MMAP_ENABLED */
+
+/* gets the file offset of the data of a dataset that can be mapped directly
+ * into memory; returns 1 if it can be mapped, 0 if not, and -1 on failure */
+static int XLALH5DatasetQueryMapOffset(size_t *offset, LALH5Dataset *dset)
+{
+#ifndef LAL_H5_MMAP_ENABLED
+	(void)offset;
+	(void)dset;
+	return 0;
+#else
+	hid_t dtype_id;
+	haddr_t addr;
+	htri_t equal;
+	size_t nbytes;
+
+	/* only contiguous, allocated datasets in the file itself have an offset */
+	addr = threadsafe_H5Dget_offset(dset->dataset_id);
+	if (addr == HADDR_UNDEF)
+		return 0;
+
+	/* the data must be stored uncompressed */
+	nbytes = XLALH5DatasetQueryNBytes(dset);
+	if (nbytes == (size_t)(-1))
+		XLAL_ERROR(XLAL_EFUNC);
+	if (nbytes == 0 || threadsafe_H5Dget_storage_size(dset->dataset_id) != nbytes)
+		return 0;
+
+	/* the data must be stored with the in-memory type and byte order */
+	dtype_id = threadsafe_H5Dget_type(dset->dataset_id);
+	if (dtype_id < 0)
+		XLAL_ERROR(XLAL_EIO, "Could not read datatype of dataset `%s'", dset->name);
+	equal = threadsafe_H5Tequal(dtype_id, dset->dtype_id);
+	threadsafe_H5Tclose(dtype_id);
+	if (equal < 0)
+		XLAL_ERROR(XLAL_EIO, "Could not compare datatypes of dataset `%s'", dset->name);
+	if (!equal)
+		return 0;
+
+	/* the mapping is page aligned, so the data must be stored at an
+	 * offset that is suitably aligned for the numeric types it holds */
+	if (addr % sizeof(double) != 0)
+		return 0;
+
+	*offset = addr;
+	return 1;
+#endif
+}
+
 #if 0
 static hid_t XLALGetObjectIdentifier(const void *ptr)
 {
@@ -1084,6 +1309,125 @@ LALH5Dataset * XLALH5DatasetAlloc1D(LALH5File UNUSED *file, const char UNUSED *n
 #endif
 }
 
+/**
+ * @brief Allocates a multi-dimensional chunked ::LALH5Dataset
+ * @details
+ * Creates a new HDF5 dataset with name @p name within a HDF5 file
+ * associated with the ::LALH5File @p file structure and allocates a
+ * ::LALH5Dataset structure associated with the dataset, as with
+ * XLALH5DatasetAlloc().  The dataset is stored in chunks with
+ * dimensions given by the UINT4Vector @p chunkLength, which must have
+ * the same rank as @p dimLength and no chunk dimension may exceed
+ * the corresponding dataset dimension.
+ *
+ * If @p compress is between 1 and 9, the chunks are compressed with the
+ * deflate (gzip) filter at that compression level, preceded by the
+ * byte-shuffle filter; if @p compress is 0 the chunks are not compressed.
+ *
+ * Partial reads and writes with XLALH5DatasetQueryHyperslab() and
+ * XLALH5DatasetWriteHyperslab() only touch the chunks that intersect
+ * the hyperslab, so the chunk dimensions should match the typical
+ * access pattern.
+ *
+ * The ::LALH5File @p file passed to this routine must be a file
+ * opened for writing.
+ *
+ * @param file Pointer to a ::LALH5File structure in which to create the dataset.
+ * @param name Pointer to a string with the name of the dataset to create.
+ * @param dtype \c LALTYPECODE value specifying the data type.
+ * @param dimLength Pointer to a UINT4Vector specifying the dataspace
+ * dimensions.
+ * @param chunkLength Pointer to a UINT4Vector specifying the chunk
+ * dimensions.
+ * @param compress Deflate compression level from 1 to 9, or 0 for none.
+ * @returns A pointer to a ::LALH5Dataset structure associated with the
+ * specified dataset within a HDF5 file.
+ * @retval NULL An error occurred creating the dataset.
+ */
+LALH5Dataset * XLALH5DatasetAllocChunked(LALH5File UNUSED *file, const char UNUSED *name, LALTYPECODE UNUSED dtype, UINT4Vector UNUSED *dimLength, UINT4Vector UNUSED *chunkLength, int UNUSED compress)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR_NULL(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	LALH5Dataset *dset;
+	hsize_t dims[H5S_MAX_RANK];
+	hsize_t chunks[H5S_MAX_RANK];
+	hid_t dcpl_id;
+	UINT4 dim;
+	size_t namelen;
+
+	if (name == NULL || file == NULL || dimLength == NULL || chunkLength == NULL)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if (file->mode != LAL_H5_FILE_MODE_WRITE)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Attempting to write to a read-only HDF5 file");
+	if (dimLength->length == 0 || dimLength->length > H5S_MAX_RANK)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Invalid rank %u of dataset `%s'", dimLength->length, name);
+	if (chunkLength->length != dimLength->length)
+		XLAL_ERROR_NULL(XLAL_EBADLEN, "Chunk rank does not match dataset rank");
+	if (compress < 0 || compress > 9)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Compression level must be between 0 and 9");
+
+	/* copy dimensions to HDF5 type */
+	for (dim = 0; dim < dimLength->length; ++dim) {
+		dims[dim] = dimLength->data[dim];
+		chunks[dim] = chunkLength->data[dim];
+		if (chunks[dim] == 0 || chunks[dim] > dims[dim])
+			XLAL_ERROR_NULL(XLAL_EINVAL, "Invalid chunk dimension %u for dataset `%s'", dim, name);
+	}
+
+	/* create dataset creation property list */
+	dcpl_id = threadsafe_H5Pcreate(H5P_DATASET_CREATE);
+	if (dcpl_id < 0)
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not create property list for dataset `%s'", name);
+	if (threadsafe_H5Pset_chunk(dcpl_id, dimLength->length, chunks) < 0
+	    || (compress > 0 && threadsafe_H5Pset_shuffle(dcpl_id) < 0)
+	    || (compress > 0 && threadsafe_H5Pset_deflate(dcpl_id, compress) < 0)) {
+		threadsafe_H5Pclose(dcpl_id);
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not set chunking for dataset `%s'", name);
+	}
+
+	namelen = strlen(name);
+	dset = LALCalloc(1, sizeof(*dset) + namelen + 1);  /* use flexible array member to record name */
+	if (!dset) {
+		threadsafe_H5Pclose(dcpl_id);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+
+	/* create datatype */
+	dset->dtype_id = XLALH5TypeFromLALType(dtype);
+	if (dset->dtype_id < 0) {
+		threadsafe_H5Pclose(dcpl_id);
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	/* create dataspace */
+	dset->space_id = threadsafe_H5Screate_simple(dimLength->length, dims, NULL);
+	if (dset->space_id < 0) {
+		threadsafe_H5Pclose(dcpl_id);
+		threadsafe_H5Tclose(dset->dtype_id);
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not create dataspace for dataset `%s'", name);
+	}
+
+	/* create dataset */
+	dset->dataset_id = threadsafe_H5Dcreate2(file->file_id, name, dset->dtype_id, dset->space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+	threadsafe_H5Pclose(dcpl_id);
+	if (dset->dataset_id < 0) {
+		threadsafe_H5Tclose(dset->dtype_id);
+		threadsafe_H5Sclose(dset->space_id);
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not create dataset `%s'", name);
+	}
+
+	/* record name of dataset and parent id */
+	snprintf(dset->name, namelen + 1, "%s", name);
+	dset->parent_id = file->file_id;
+
+	return dset;
+#endif
+}
+
 /**
  * @brief Writes data to a ::LALH5Dataset
  * @details
@@ -1107,6 +1451,46 @@ int XLALH5DatasetWrite(LALH5Dataset UNUSED *dset, void UNUSED *data)
 #endif
 }
 
+/**
+ * @brief Writes data to a hyperslab of a ::LALH5Dataset
+ * @details
+ * Writes the data contained in @p data to a hyperslab of a HDF5 dataset
+ * associated with the ::LALH5Dataset @p dset structure.  The hyperslab
+ * starts at the element with indices @p offset and comprises @p count
+ * elements along each dimension, separated by @p stride elements; if
+ * @p stride is \c NULL then a stride of 1 is used along each dimension.
+ * The arrays @p offset, @p count, and @p stride must have as many
+ * elements as the rank of the dataset.  The buffer @p data holds the
+ * elements of the hyperslab contiguously in row-major order.
+ * @param dset Pointer to a ::LALH5Dataset structure to which to write the data.
+ * @param offset Pointer to an array of the starting indices of the hyperslab.
+ * @param count Pointer to an array of the number of elements in the hyperslab.
+ * @param stride Pointer to an array of the hyperslab strides, or \c NULL.
+ * @param data Pointer to the data buffer to be written.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5DatasetWriteHyperslab(LALH5Dataset UNUSED *dset, const size_t UNUSED *offset, const size_t UNUSED *count, const size_t UNUSED *stride, const void UNUSED *data)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	hid_t filespace_id;
+	hid_t memspace_id;
+	herr_t status;
+	if (dset == NULL || offset == NULL || count == NULL || data == NULL)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (XLALH5DatasetSelectHyperslab(&filespace_id, &memspace_id, dset, offset, count, stride) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	status = threadsafe_H5Dwrite(dset->dataset_id, dset->dtype_id, memspace_id, filespace_id, H5P_DEFAULT, data);
+	threadsafe_H5Sclose(memspace_id);
+	threadsafe_H5Sclose(filespace_id);
+	if (status < 0)
+		XLAL_ERROR(XLAL_EIO, "Could not write data to dataset");
+	return 0;
+#endif
+}
+
 /**
  * @brief Reads a ::LALH5Dataset
  * @details
@@ -1343,6 +1727,191 @@ int XLALH5DatasetQueryData(void UNUSED *data, LALH5Dataset UNUSED *dset)
 #endif
 }
 
+/**
+ * @brief Gets the data contained in a hyperslab of a ::LALH5Dataset
+ * @details
+ * This routine reads data from a hyperslab of a HDF5 dataset associated
+ * with the ::LALH5Dataset @p dset and stores the data in the buffer
+ * @p data.  The hyperslab starts at the element with indices @p offset
+ * and comprises @p count elements along each dimension, separated by
+ * @p stride elements; if @p stride is \c NULL then a stride of 1 is
+ * used along each dimension.  The arrays @p offset, @p count, and
+ * @p stride must have as many elements as the rank of the dataset.
+ *
+ * The elements of the hyperslab are stored contiguously in @p data in
+ * row-major order, so this buffer should be sufficiently large to hold
+ * the product of the elements of @p count times the size of each
+ * element.  Only the parts of the dataset that lie within the hyperslab
+ * are read from the file.
+ *
+ * The following example reads every second sample of the 1000 samples
+ * starting at sample 4096 of a one-dimensional dataset.
+ * @code
+ * REAL8 data[500];
+ * size_t offset = 4096;
+ * size_t count = 500;
+ * size_t stride = 2;
+ * LALH5File *file = XLALH5FileOpen("example.h5", "r");
+ * LALH5Dataset *dset = XLALH5DatasetRead(file, "strain");
+ * XLALH5DatasetQueryHyperslab(data, dset, &offset, &count, &stride);
+ * @endcode
+ *
+ * @param data Pointer to a memory in which to store the data.
+ * @param dset Pointer to a ::LALH5Dataset from which to extract the data.
+ * @param offset Pointer to an array of the starting indices of the hyperslab.
+ * @param count Pointer to an array of the number of elements in the hyperslab.
+ * @param stride Pointer to an array of the hyperslab strides, or \c NULL.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5DatasetQueryHyperslab(void UNUSED *data, LALH5Dataset UNUSED *dset, const size_t UNUSED *offset, const size_t UNUSED *count, const size_t UNUSED *stride)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	hid_t filespace_id;
+	hid_t memspace_id;
+	herr_t status;
+	if (data == NULL || dset == NULL || offset == NULL || count == NULL)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (XLALH5DatasetSelectHyperslab(&filespace_id, &memspace_id, dset, offset, count, stride) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	status = threadsafe_H5Dread(dset->dataset_id, dset->dtype_id, memspace_id, filespace_id, H5P_DEFAULT, data);
+	threadsafe_H5Sclose(memspace_id);
+	threadsafe_H5Sclose(filespace_id);
+	if (status < 0)
+		XLAL_ERROR(XLAL_EIO, "Could not read data from dataset");
+	return 0;
+#endif
+}
+
+/**
+ * @brief Checks if the data in a ::LALH5Dataset can be mapped into memory
+ * @details
+ * Checks if the data of the HDF5 dataset associated with the
+ * ::LALH5Dataset @p dset can be mapped directly into memory with
+ * XLALH5DatasetMapData().  This requires that the dataset is stored
+ * contiguously and uncompressed within the file, in the native data
+ * type and byte order, at a file offset that is a multiple of
+ * <tt>sizeof(double)</tt>, and that the system supports memory mapping.
+ *
+ * Datasets that are chunked or compressed can be converted to a
+ * mappable layout with, e.g., <tt>h5repack -l CONTI</tt>.
+ *
+ * @param dset Pointer to a ::LALH5Dataset to be checked.
+ * @retval 1 The dataset can be mapped into memory.
+ * @retval 0 The dataset cannot be mapped into memory, or failure.
+ */
+int XLALH5DatasetCheckMappable(LALH5Dataset UNUSED *dset)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR_VAL(0, XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	size_t offset;
+	int retval;
+	if (dset == NULL)
+		XLAL_ERROR_VAL(0, XLAL_EFAULT);
+	retval = XLALH5DatasetQueryMapOffset(&offset, dset);
+	if (retval < 0)
+		XLAL_ERROR_VAL(0, XLAL_EFUNC);
+	return retval;
+#endif
+}
+
+/**
+ * @brief Maps the data contained in a ::LALH5Dataset into memory
+ * @details
+ * This routine returns a pointer to the data of a HDF5 dataset
+ * associated with the ::LALH5Dataset @p dset, which is mapped read-only
+ * into memory directly from the file rather than read into a buffer.
+ * The dataset must satisfy XLALH5DatasetCheckMappable().
+ *
+ * Each file is mapped at most once per process, and all processes that
+ * map the same file share the same physical memory through the system
+ * page cache.  Pages of data are only read from the file when they are
+ * first accessed, so only those parts of a large dataset that are
+ * actually used are ever loaded.  A file which has been modified since
+ * it was mapped, as determined by its size and modification time, is
+ * mapped anew.
+ *
+ * The mapping remains valid after @p dset and its file are closed, until
+ * the data is released with XLALH5DatasetUnmapData(); the file is
+ * unmapped once all data mapped from it has been released.  The data must
+ * not be modified.
+ *
+ * @param dset Pointer to a ::LALH5Dataset whose data is to be mapped.
+ * @returns Pointer to XLALH5DatasetQueryNBytes() bytes of read-only data.
+ * @retval NULL Failure.
+ */
+const void * XLALH5DatasetMapData(LALH5Dataset UNUSED *dset)
+{
+#if !defined(HAVE_HDF5)
+	XLAL_ERROR_NULL(XLAL_EFAILED, "HDF5 support not implemented");
+#elif !defined(LAL_H5_MMAP_ENABLED)
+	XLAL_ERROR_NULL(XLAL_EFAILED, "Memory mapping not supported");
+#else
+	char fname[FILENAME_MAX];
+	const char *base;
+	size_t offset;
+	size_t nbytes;
+	size_t size;
+	ssize_t namelen;
+	int retval;
+
+	if (dset == NULL)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+
+	retval = XLALH5DatasetQueryMapOffset(&offset, dset);
+	if (retval < 0)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	if (retval == 0)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Dataset `%s' cannot be mapped into memory", dset->name);
+	nbytes = XLALH5DatasetQueryNBytes(dset);
+	if (nbytes == (size_t)(-1))
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	namelen = threadsafe_H5Fget_name(dset->dataset_id, fname, sizeof(fname));
+	if (namelen < 0 || (size_t)namelen >= sizeof(fname))
+		XLAL_ERROR_NULL(XLAL_EIO, "Could not get name of file containing dataset `%s'", dset->name);
+
+	base = XLALH5MapFile(fname, &size);
+	if (base == NULL)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	if (offset > size || nbytes > size - offset) {
+		XLALH5UnmapFile(base);
+		XLAL_ERROR_NULL(XLAL_EIO, "Dataset `%s' extends beyond end of file `%s'", dset->name, fname);
+	}
+
+	return base + offset;
+#endif
+}
+
+/**
+ * @brief Releases data mapped into memory by XLALH5DatasetMapData()
+ * @details
+ * This routine releases data returned by XLALH5DatasetMapData().  The
+ * file from which the data was mapped is unmapped once all data mapped
+ * from it has been released, after which the data must not be accessed.
+ *
+ * @param data Pointer returned by XLALH5DatasetMapData().
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5DatasetUnmapData(const void UNUSED *data)
+{
+#if !defined(HAVE_HDF5)
+	XLAL_ERROR(XLAL_EFAILED, "HDF5 support not implemented");
+#elif !defined(LAL_H5_MMAP_ENABLED)
+	XLAL_ERROR(XLAL_EFAILED, "Memory mapping not supported");
+#else
+	if (data == NULL)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (XLALH5UnmapFile(data) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	return 0;
+#endif
+}
+
 /** @} */
 
 /**
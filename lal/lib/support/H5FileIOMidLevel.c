@@ -1,4 +1,5 @@
 #include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
 #include <lal/AVFactories.h>
 #include <lal/H5FileIO.h>
 
@@ -488,6 +489,78 @@
 
 /** @} */
 
+/**
+ * @name Routines to Read Vector Dataset Slices
+ * @{
+ */
+
+/**
+ * @fn CHARVector *XLALH5DatasetReadCHARVectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @brief Reads part of a #LALH5Dataset
+ * @details
+ * Reads @p length points of a one-dimensional dataset, starting at
+ * point @p offset and separated by @p stride points.  Only the
+ * requested points are read from the file.
+ * @param dset Pointer to a #LALH5Dataset to be read.
+ * @param offset Index of the first point to read.
+ * @param length Number of points to read.
+ * @param stride Separation between the points to read.
+ * @returns Pointer to a vector containing the requested data.
+ * @retval NULL Failure.
+ */
+
+/**
+ * @fn INT2Vector *XLALH5DatasetReadINT2VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn INT4Vector *XLALH5DatasetReadINT4VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn INT8Vector *XLALH5DatasetReadINT8VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn UINT2Vector *XLALH5DatasetReadUINT2VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn UINT4Vector *XLALH5DatasetReadUINT4VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn UINT8Vector *XLALH5DatasetReadUINT8VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn REAL4Vector *XLALH5DatasetReadREAL4VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn REAL8Vector *XLALH5DatasetReadREAL8VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn COMPLEX8Vector *XLALH5DatasetReadCOMPLEX8VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/**
+ * @fn COMPLEX16Vector *XLALH5DatasetReadCOMPLEX16VectorSlice(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+ * @copydoc XLALH5DatasetReadCHARVectorSlice()
+ */
+
+/** @} */
+
 /**
  * @name Routines to Read Array Datasets
  * @{
@@ -1,11 +1,16 @@
 #define CONCAT2x(a,b) a##b
 #define CONCAT2(a,b) CONCAT2x(a,b)
 
+#define CONCAT3x(a,b,c) a##b##c
+#define CONCAT3(a,b,c) CONCAT3x(a,b,c)
+
 #define VTYPE CONCAT2(TYPE,Vector)
 #define STYPE CONCAT2(TYPE,TimeSeries)
+#define TCODE CONCAT3(LAL_,TYPECODE,_TYPE_CODE)
 
 #define FILEWRITEFUNC CONCAT2(XLALH5FileWrite,STYPE)
 #define FILEREADFUNC CONCAT2(XLALH5FileRead,STYPE)
+#define ITERNEXTFUNC CONCAT2(XLALH5TimeSeriesIterNext,STYPE)
 
 #define DSETALLOCFUNC CONCAT2(XLALH5DatasetAlloc,VTYPE)
 #define DSETREADFUNC CONCAT2(XLALH5DatasetRead,VTYPE)
@@ -123,14 +128,51 @@ STYPE *FILEREADFUNC(LALH5File *file, const char *name)
 	return series;
 }
 
+int ITERNEXTFUNC(UINT8 *count, STYPE *block, LALH5TimeSeriesIter *iter)
+{
+	size_t n;
+
+	if (!count || !block || !iter)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (!block->data || !block->data->length || !block->data->data)
+		XLAL_ERROR(XLAL_EINVAL);
+	if (iter->type != TCODE)
+		XLAL_ERROR(XLAL_ETYPE);
+
+	*count = 0;
+	n = iter->length - iter->next;
+	if (n > block->data->length)
+		n = block->data->length;
+	if (n == 0)
+		return 0;
+
+	if (XLALH5DatasetQueryHyperslab(block->data->data, iter->dset, &iter->next, &n, NULL) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	memcpy(block->name, iter->name, sizeof(block->name));
+	block->epoch = iter->epoch;
+	XLALGPSAdd(&block->epoch, iter->next * iter->deltaT);
+	block->deltaT = iter->deltaT;
+	block->f0 = iter->f0;
+	block->sampleUnits = iter->sampleUnits;
+
+	iter->next += n;
+	*count = n;
+	return 0;
+}
+
 #undef CONCAT2x
 #undef CONCAT2
+#undef CONCAT3x
+#undef CONCAT3
 
 #undef VTYPE
 #undef STYPE
+#undef TCODE
 
 #undef FILEWRITEFUNC
 #undef FILEREADFUNC
+#undef ITERNEXTFUNC
 
 #undef DSETALLOCFUNC
 #undef DSETREADFUNC
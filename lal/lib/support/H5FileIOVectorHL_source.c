@@ -1,5 +1,7 @@
 #define CONCAT2x(a,b) a##b
 #define CONCAT2(a,b) CONCAT2x(a,b)
+#define CONCAT3x(a,b,c) a##b##c
+#define CONCAT3(a,b,c) CONCAT3x(a,b,c)
 
 #define VTYPE CONCAT2(TYPE,Vector)
 
@@ -7,6 +9,8 @@
 #define READFUNC CONCAT2(XLALH5FileRead,VTYPE)
 #define DSETALLOCFUNC CONCAT2(XLALH5DatasetAlloc,VTYPE)
 #define DSETREADFUNC CONCAT2(XLALH5DatasetRead,VTYPE)
+#define SLICEFUNC CONCAT3(XLALH5FileRead,VTYPE,Slice)
+#define DSETSLICEFUNC CONCAT3(XLALH5DatasetRead,VTYPE,Slice)
 
 int WRITEFUNC(LALH5File *file, const char *name, VTYPE *vector)
 {
@@ -38,12 +42,32 @@ VTYPE *READFUNC(LALH5File *file, const char *dset)
 	return vector;
 }
 
+VTYPE *SLICEFUNC(LALH5File *file, const char *dset, size_t offset, size_t length, size_t stride)
+{
+	VTYPE *vector;
+	LALH5Dataset *dataset;
+	if (!file || !dset)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	dataset = XLALH5DatasetRead(file, dset);
+	if (!dataset)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	vector = DSETSLICEFUNC(dataset, offset, length, stride);
+	XLALH5DatasetFree(dataset);
+	if (!vector)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	return vector;
+}
+
 #undef WRITEFUNC
 #undef READFUNC
 #undef DSETALLOCFUNC
 #undef DSETREADFUNC
+#undef SLICEFUNC
+#undef DSETSLICEFUNC
 
 #undef CONCAT2x
 #undef CONCAT2
+#undef CONCAT3x
+#undef CONCAT3
 
 #undef VTYPE
@@ -8,6 +8,7 @@
 
 #define ALLOCFUNC CONCAT2(XLALH5DatasetAlloc,VTYPE)
 #define READFUNC CONCAT2(XLALH5DatasetRead,VTYPE)
+#define SLICEFUNC CONCAT3(XLALH5DatasetRead,VTYPE,Slice)
 
 #define CREATEFUNC CONCAT2(XLALCreate,VTYPE)
 #define DESTROYFUNC CONCAT2(XLALDestroy,VTYPE)
@@ -65,6 +66,49 @@ VTYPE *READFUNC(LALH5Dataset *dset)
 	return vector;
 }
 
+VTYPE *SLICEFUNC(LALH5Dataset *dset, size_t offset, size_t length, size_t stride)
+{
+	VTYPE *vector;
+	LALTYPECODE type;
+	size_t npoints;
+	int ndim;
+
+	/* error checking */
+
+	if (!dset)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if (!length || !stride)
+		XLAL_ERROR_NULL(XLAL_EINVAL);
+	if (length > LAL_UINT4_MAX)
+		XLAL_ERROR_NULL(XLAL_EINVAL);
+
+	ndim = XLALH5DatasetQueryNDim(dset);
+	if (ndim != 1)
+		XLAL_ERROR_NULL(XLAL_EDIMS);
+
+	type = XLALH5DatasetQueryType(dset);
+	if (type != TCODE)
+		XLAL_ERROR_NULL(XLAL_ETYPE);
+
+	/* last element of the slice, offset + (length - 1) * stride, must be within the dataset */
+	npoints = XLALH5DatasetQueryNPoints(dset);
+	if (npoints == (size_t)(-1))
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	if (offset >= npoints || (length - 1) > (npoints - 1 - offset) / stride)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Slice extends beyond end of dataset");
+
+	vector = CREATEFUNC(length);
+	if (!vector)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+
+	if (XLALH5DatasetQueryHyperslab(vector->data, dset, &offset, &length, &stride) == -1) {
+		DESTROYFUNC(vector);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	return vector;
+}
+
 #undef CONCAT2x
 #undef CONCAT2
 #undef CONCAT3x
@@ -75,6 +119,7 @@ VTYPE *READFUNC(LALH5Dataset *dset)
 
 #undef ALLOCFUNC
 #undef READFUNC
+#undef SLICEFUNC
 
 #undef CREATEFUNC
 #undef DESTROYFUNC
@@ -107,6 +107,14 @@ static inline hid_t threadsafe_H5Dcreate2(hid_t loc_id, const char *name, hid_t
 	return retval;
 }
 
+static inline haddr_t threadsafe_H5Dget_offset(hid_t dset_id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	haddr_t retval = H5Dget_offset(dset_id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline hid_t threadsafe_H5Dget_space(hid_t dset_id)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -115,6 +123,14 @@ static inline hid_t threadsafe_H5Dget_space(hid_t dset_id)
 	return retval;
 }
 
+static inline hsize_t threadsafe_H5Dget_storage_size(hid_t dset_id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	hsize_t retval = H5Dget_storage_size(dset_id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline hid_t threadsafe_H5Dget_type(hid_t dset_id)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -323,6 +339,14 @@ static inline hid_t threadsafe_H5Pcreate(hid_t cls_id)
 	return retval;
 }
 
+static inline herr_t threadsafe_H5Pset_chunk(hid_t plist_id, int ndims, const hsize_t dim[])
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_chunk(plist_id, ndims, dim);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5Pset_create_intermediate_group(hid_t plist_id, unsigned crt_intmd)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -331,6 +355,22 @@ static inline herr_t threadsafe_H5Pset_create_intermediate_group(hid_t plist_id,
 	return retval;
 }
 
+static inline herr_t threadsafe_H5Pset_deflate(hid_t plist_id, unsigned aggression)
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_deflate(plist_id, aggression);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
+static inline herr_t threadsafe_H5Pset_shuffle(hid_t plist_id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_shuffle(plist_id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5Sclose(hid_t space_id)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -339,6 +379,14 @@ static inline herr_t threadsafe_H5Sclose(hid_t space_id)
 	return retval;
 }
 
+static inline hid_t threadsafe_H5Scopy(hid_t space_id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	hid_t retval = H5Scopy(space_id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline hid_t threadsafe_H5Screate(H5S_class_t type)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -379,6 +427,14 @@ static inline hssize_t threadsafe_H5Sget_simple_extent_npoints(hid_t space_id)
 	return retval;
 }
 
+static inline herr_t threadsafe_H5Sselect_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t start[], const hsize_t stride[], const hsize_t count[], const hsize_t block[])
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Sselect_hyperslab(space_id, op, start, stride, count, block);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5TBappend_records(hid_t loc_id, const char *dset_name, hsize_t nrecords, size_t type_size, const size_t *field_offset, const size_t *dst_sizes, const void *buf)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -483,6 +539,14 @@ static inline herr_t threadsafe_H5Tenum_insert(hid_t type, const char *name, con
 	return retval;
 }
 
+static inline htri_t threadsafe_H5Tequal(hid_t type1_id, hid_t type2_id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	htri_t retval = H5Tequal(type1_id, type2_id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline int threadsafe_H5Tget_array_dims2(hid_t type_id, hsize_t dims[])
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -638,7 +702,9 @@ static inline herr_t threadsafe_H5open(void)
 #define threadsafe_H5Awrite H5Awrite
 #define threadsafe_H5Dclose H5Dclose
 #define threadsafe_H5Dcreate2 H5Dcreate2
+#define threadsafe_H5Dget_offset H5Dget_offset
 #define threadsafe_H5Dget_space H5Dget_space
+#define threadsafe_H5Dget_storage_size H5Dget_storage_size
 #define threadsafe_H5Dget_type H5Dget_type
 #define threadsafe_H5Dopen2 H5Dopen2
 #define threadsafe_H5Dread H5Dread
@@ -665,13 +731,18 @@ static inline herr_t threadsafe_H5open(void)
 #define threadsafe_H5Oopen_by_addr H5Oopen_by_addr
 #define threadsafe_H5Pclose H5Pclose
 #define threadsafe_H5Pcreate H5Pcreate
+#define threadsafe_H5Pset_chunk H5Pset_chunk
 #define threadsafe_H5Pset_create_intermediate_group H5Pset_create_intermediate_group
+#define threadsafe_H5Pset_deflate H5Pset_deflate
+#define threadsafe_H5Pset_shuffle H5Pset_shuffle
 #define threadsafe_H5Sclose H5Sclose
+#define threadsafe_H5Scopy H5Scopy
 #define threadsafe_H5Screate H5Screate
 #define threadsafe_H5Screate_simple H5Screate_simple
 #define threadsafe_H5Sget_simple_extent_dims H5Sget_simple_extent_dims
 #define threadsafe_H5Sget_simple_extent_ndims H5Sget_simple_extent_ndims
 #define threadsafe_H5Sget_simple_extent_npoints H5Sget_simple_extent_npoints
+#define threadsafe_H5Sselect_hyperslab H5Sselect_hyperslab
 #define threadsafe_H5TBappend_records H5TBappend_records
 #define threadsafe_H5TBget_field_info H5TBget_field_info
 #define threadsafe_H5TBget_table_info H5TBget_table_info
@@ -685,6 +756,7 @@ static inline herr_t threadsafe_H5open(void)
 #define threadsafe_H5Tcreate H5Tcreate
 #define threadsafe_H5Tenum_create H5Tenum_create
 #define threadsafe_H5Tenum_insert H5Tenum_insert
+#define threadsafe_H5Tequal H5Tequal
 #define threadsafe_H5Tget_array_dims2 H5Tget_array_dims2
 #define threadsafe_H5Tget_array_ndims H5Tget_array_ndims
 #define threadsafe_H5Tget_class H5Tget_class
@@ -106,6 +106,8 @@ int XLALHighPassCOMPLEX8TimeSeries( COMPLEX8TimeSeries *series,
     REAL8 frequency, REAL8 amplitude, INT4 filtorder );
 int XLALHighPassCOMPLEX16TimeSeries( COMPLEX16TimeSeries *series,
     REAL8 frequency, REAL8 amplitude, INT4 filtorder );
+REAL8SOSFilter *XLALCreateButterworthREAL8SOSFilter( PassBandParamStruc *params,
+    REAL8 deltaT, UINT4 numChannels );
 
 
 
@@ -21,6 +21,7 @@
 #include <lal/LALStdlib.h>
 #include <lal/LALConstants.h>
 #include <lal/AVFactories.h>
+#include <lal/SeqFactories.h>
 #include <math.h>
 #include <lal/IIRFilter.h>
 #include <lal/BandPassTimeSeries.h>
@@ -207,6 +208,15 @@
  * in the time-reversed sense.  This gives the full attenuation with very
  * little frequency-dependent phase shift.
  *
+ * The routine <tt>XLALCreateButterworthREAL8SOSFilter()</tt> returns the
+ * same sequence of low-order filters as a single cascade of second-order
+ * sections (see \ref SOSFilter_c), which may be applied to several
+ * channels at once, or to a continuous data stream.  As above, the filter
+ * has the square root of the desired amplitude response, and should be
+ * applied with <tt>XLALSOSFilterZeroPhaseREAL8Vector()</tt> or
+ * <tt>XLALSOSFilterZeroPhaseREAL8VectorSequence()</tt> to achieve the full
+ * attenuation.
+ *
  */
 /** @{ */
 
@@ -217,6 +227,12 @@ XLALParsePassBandParamStruc( PassBandParamStruc *params,
 			 REAL8              *wc,
 			 REAL8              deltaT );
 
+/* Prototype for a local routine which creates the z-plane ZPG filter for
+   the pair of poles i,j (or the single pole i if i==j) of an order n
+   Butterworth filter. */
+static COMPLEX16ZPGFilter *
+XLALCreateButterworthSectionZPG( INT4 type, REAL8 wc, INT4 n, INT4 i, INT4 j );
+
 
 #undef COMPLEX_DATA
 #undef SINGLE_PRECISION
@@ -232,6 +248,65 @@ XLALParsePassBandParamStruc( PassBandParamStruc *params,
 #undef SINGLE_PRECISION
 #include "ButterworthTimeSeries_source.c"
 
+/**
+ * Creates the cascade of second-order sections applied by
+ * XLALButterworthREAL8TimeSeries() to data sampled at intervals of
+ * \c deltaT, for \c numChannels data channels.
+ */
+REAL8SOSFilter *XLALCreateButterworthREAL8SOSFilter( PassBandParamStruc *params, REAL8 deltaT, UINT4 numChannels )
+{
+  INT4 n;    /* The filter order. */
+  INT4 type; /* The pass-band type: high, low, or undeterminable. */
+  INT4 i;    /* An index. */
+  INT4 j;    /* Another index. */
+  INT4 k;    /* The section index. */
+  REAL8 wc;  /* The filter's transformed frequency. */
+  REAL8VectorSequence *sos = NULL;
+  REAL8SOSFilter *filter = NULL;
+
+  if ( ! params )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+  if ( deltaT <= 0 )
+    XLAL_ERROR_NULL( XLAL_EINVAL );
+
+  type=XLALParsePassBandParamStruc(params,&n,&wc,deltaT);
+  if(type<0)
+    XLAL_ERROR_NULL( XLAL_EINVAL );
+
+  sos = XLALCreateREAL8VectorSequence( (n+1)/2, 6 );
+  if ( ! sos )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+
+  /* Compute the coefficients of each section in turn, so that each
+     carries its own share of the overall gain. */
+  for(i=0,j=n-1,k=0;i<=j;i++,j--,k++){
+    COMPLEX16ZPGFilter *zpgFilter = XLALCreateButterworthSectionZPG(type,wc,n,i,j);
+    REAL8SOSFilter *section = zpgFilter ? XLALCreateREAL8SOSFilterFromZPG(zpgFilter,1) : NULL;
+    XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
+    if ( ! section || section->numSections != 1 )
+    {
+      XLALDestroyREAL8SOSFilter(section);
+      XLALDestroyREAL8VectorSequence(sos);
+      XLAL_ERROR_NULL( XLAL_EFUNC );
+    }
+    sos->data[6*k]   = section->coef->data[0];
+    sos->data[6*k+1] = section->coef->data[1];
+    sos->data[6*k+2] = section->coef->data[2];
+    sos->data[6*k+3] = 1.0;
+    sos->data[6*k+4] = section->coef->data[3];
+    sos->data[6*k+5] = section->coef->data[4];
+    XLALDestroyREAL8SOSFilter(section);
+  }
+
+  filter = XLALCreateREAL8SOSFilter( sos, numChannels );
+  XLALDestroyREAL8VectorSequence( sos );
+  if ( ! filter )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  filter->deltaT = deltaT;
+
+  return filter;
+}
+
 /**
  * Deprecated.
  * \deprecated Use XLALButterworthREAL4TimeSeries() instead.
@@ -577,3 +652,62 @@ XLALParsePassBandParamStruc( PassBandParamStruc *params,
   }
 }
 /** @} */
+
+
+static COMPLEX16ZPGFilter *
+XLALCreateButterworthSectionZPG( INT4 type, REAL8 wc, INT4 n, INT4 i, INT4 j )
+     /* This local function generates the filter in the w-plane for
+        either the pair of poles i,j symmetric across the imaginary
+        axis, or (if i==j) the unpaired pole on the imaginary w axis,
+        and transforms it to the z-plane.  The argument type is 2 for a
+        high-pass filter and 1 for a low-pass filter. */
+{
+  COMPLEX16ZPGFilter *zpgFilter=NULL;
+
+  if(i<j){
+    REAL8 theta=LAL_PI*(i+0.5)/n;
+    REAL8 ar=wc*cos(theta);
+    REAL8 ai=wc*sin(theta);
+
+    if(type==2){
+      zpgFilter = XLALCreateCOMPLEX16ZPGFilter(2,2);
+      if ( ! zpgFilter )
+        XLAL_ERROR_NULL( XLAL_EFUNC );
+      zpgFilter->zeros->data[0]=0.0;
+      zpgFilter->zeros->data[1]=0.0;
+      zpgFilter->gain=1.0;
+    }else{
+      zpgFilter = XLALCreateCOMPLEX16ZPGFilter(0,2);
+      if ( ! zpgFilter )
+        XLAL_ERROR_NULL( XLAL_EFUNC );
+      zpgFilter->gain=-wc*wc;
+    }
+    zpgFilter->poles->data[0]=ar;
+    zpgFilter->poles->data[0]+=ai*I;
+    zpgFilter->poles->data[1]=-ar;
+    zpgFilter->poles->data[1]+=ai*I;
+  }else{
+    if(type==2){
+      zpgFilter=XLALCreateCOMPLEX16ZPGFilter(1,1);
+      if(!zpgFilter)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+      *zpgFilter->zeros->data=0.0;
+      zpgFilter->gain=1.0;
+    }else{
+      zpgFilter=XLALCreateCOMPLEX16ZPGFilter(0,1);
+      if(!zpgFilter)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+      zpgFilter->gain=-wc*I;
+    }
+    *zpgFilter->poles->data=wc*I;
+  }
+
+  /* Transform to the z-plane. */
+  if (XLALWToZCOMPLEX16ZPGFilter(zpgFilter)<0)
+  {
+    XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+
+  return zpgFilter;
+}
@@ -55,40 +55,16 @@ int BFUNC(SERIESTYPE *series, PassBandParamStruc *params)
      semicircle in the upper complex w-plane.  By pairing up poles
      symmetric across the imaginary axis, the filter gan be decomposed
      into [n/2] filters of order 2, plus perhaps an additional order 1
-     filter.  The following loop pairs up poles and applies the
-     filters with order 2. */
-  for(i=0,j=n-1;i<j;i++,j--){
-    REAL8 theta=LAL_PI*(i+0.5)/n;
-    REAL8 ar=wc*cos(theta);
-    REAL8 ai=wc*sin(theta);
+     filter corresponding to an unpaired pole on the imaginary w axis.
+     The following loop generates and applies each of these filters. */
+  for(i=0,j=n-1;i<=j;i++,j--){
     FILTERTYPE *iirFilter=NULL;
     COMPLEX16ZPGFilter *zpgFilter=NULL;
 
-    /* Generate the filter in the w-plane. */
-    if(type==2){
-      zpgFilter = XLALCreateCOMPLEX16ZPGFilter(2,2);
-      if ( ! zpgFilter )
-        XLAL_ERROR( XLAL_EFUNC );
-      zpgFilter->zeros->data[0]=0.0;
-      zpgFilter->zeros->data[1]=0.0;
-      zpgFilter->gain=1.0;
-    }else{
-      zpgFilter = XLALCreateCOMPLEX16ZPGFilter(0,2);
-      if ( ! zpgFilter )
-        XLAL_ERROR( XLAL_EFUNC );
-      zpgFilter->gain=-wc*wc;
-    }
-    zpgFilter->poles->data[0]=ar;
-    zpgFilter->poles->data[0]+=ai*I;
-    zpgFilter->poles->data[1]=-ar;
-    zpgFilter->poles->data[1]+=ai*I;
-
-    /* Transform to the z-plane and create the IIR filter. */
-    if (XLALWToZCOMPLEX16ZPGFilter(zpgFilter)<0)
-    {
-      XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
+    /* Generate the filter in the z-plane and create the IIR filter. */
+    zpgFilter = XLALCreateButterworthSectionZPG(type,wc,n,i,j);
+    if ( ! zpgFilter )
       XLAL_ERROR( XLAL_EFUNC );
-    }
     iirFilter = CFUNC(zpgFilter);
     if (!iirFilter)
     {
@@ -110,54 +86,6 @@ int BFUNC(SERIESTYPE *series, PassBandParamStruc *params)
     DFUNC(iirFilter);
   }
 
-  /* Next, this conditional applies the possible order 1 filter
-     corresponding to an unpaired pole on the imaginary w axis. */
-  if(i==j){
-    FILTERTYPE *iirFilter=NULL;
-    COMPLEX16ZPGFilter *zpgFilter=NULL;
-
-    /* Generate the filter in the w-plane. */
-    if(type==2){
-      zpgFilter=XLALCreateCOMPLEX16ZPGFilter(1,1);
-      if(!zpgFilter)
-        XLAL_ERROR(XLAL_EFUNC);
-      *zpgFilter->zeros->data=0.0;
-      zpgFilter->gain=1.0;
-    }else{
-      zpgFilter=XLALCreateCOMPLEX16ZPGFilter(0,1);
-      if(!zpgFilter)
-        XLAL_ERROR(XLAL_EFUNC);
-      zpgFilter->gain=-wc*I;
-    }
-    *zpgFilter->poles->data=wc*I;
-
-    /* Transform to the z-plane and create the IIR filter. */
-    if (XLALWToZCOMPLEX16ZPGFilter(zpgFilter)<0)
-    {
-      XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
-      XLAL_ERROR(XLAL_EFUNC);
-    }
-    iirFilter=CFUNC(zpgFilter);
-    if (!iirFilter)
-    {
-      XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
-      XLAL_ERROR(XLAL_EFUNC);
-    }
-
-    /* Filter the data, once each way. */
-    if (FFUNC(series->data,iirFilter)<0
-        || RFUNC(series->data,iirFilter)<0)
-    {
-      XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
-      DFUNC(iirFilter);
-      XLAL_ERROR( XLAL_EFUNC );
-    }
-
-    /* Free the filters. */
-    XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
-    DFUNC(iirFilter);
-  }
-
   return 0;
 }
 
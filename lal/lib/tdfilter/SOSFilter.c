@@ -0,0 +1,455 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <complex.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/SeqFactories.h>
+#include <lal/IIRFilter.h>
+
+/**
+ * \addtogroup SOSFilter_c
+ *
+ * \brief Creates and applies IIR filters as cascades of second-order sections.
+ *
+ * ### Description ###
+ *
+ * An object of type \c REAL8SOSFilter represents an IIR filter as a
+ * cascade of second-order sections (biquads), each with transfer function
+ * \f[
+ * T_s(z) = \frac{b_0 + b_1 z^{-1} + b_2 z^{-2}}{1 + a_1 z^{-1} + a_2 z^{-2}} \; .
+ * \f]
+ * Note that the sign convention of the recursive coefficients differs from
+ * that of the \c IIRFilter structures.  Factorising a high-order filter into
+ * second-order sections is much less sensitive to roundoff than expanding
+ * its transfer function into a single polynomial ratio.
+ *
+ * <tt>XLALCreateREAL8SOSFilter()</tt> takes the coefficients as a sequence
+ * of \c numSections vectors \f$(b_0,b_1,b_2,a_0,a_1,a_2)\f$ of length 6, and
+ * normalises them by \f$a_0\f$.
+ * <tt>XLALCreateREAL8SOSFilterFromZPG()</tt> pairs up the zeros and poles of
+ * a filter given in the \f$z\f$-plane into sections, subject to the same
+ * constraints as <tt>XLALCreateREAL8IIRFilter()</tt>; the gain is applied
+ * to the first section.
+ *
+ * Each filter keeps a separate state for each of \c numChannels data
+ * channels.  <tt>XLALSOSFilterREAL8Vector()</tt> filters a single channel,
+ * and <tt>XLALSOSFilterREAL8VectorSequence()</tt> filters each vector of a
+ * sequence of \c numChannels vectors as a separate channel.  In both cases
+ * the state is carried over between calls, so that a continuous data stream
+ * may be filtered in blocks of arbitrary length; the result is identical to
+ * filtering the whole stream at once.  <tt>XLALResetREAL8SOSFilter()</tt>
+ * zeroes the state.
+ *
+ * <tt>XLALSOSFilterZeroPhaseREAL8Vector()</tt> and
+ * <tt>XLALSOSFilterZeroPhaseREAL8VectorSequence()</tt> apply the filter
+ * once forwards and once backwards in time, each time starting from a
+ * zero state, which squares the magnitude response and cancels the phase
+ * response.  These functions do not use or modify the state of the filter.
+ *
+ * ### Algorithm ###
+ *
+ * Each section is implemented in transposed direct form II, which needs two
+ * state variables per section and channel.  The data is filtered in blocks
+ * which fit in cache, and each block is passed through all sections in turn,
+ * so that the coefficients and state of a section are held in registers
+ * while it is applied.
+ *
+ * Multiple channels are filtered in groups of up to 8.  Each block of a
+ * group is transposed into a buffer in which the samples of the channels at
+ * the same time are adjacent, and the recursions of the channels are then
+ * evaluated together; since they are independent, the compiler can evaluate
+ * them with SIMD instructions, which hides the latency of the recursion.
+ *
+ */
+/** @{ */
+
+/* Number of coefficients stored per section */
+#define SOS_NUM_COEF 5
+
+/* Number of samples in each block of data */
+#define SOS_BLOCK_LENGTH 1024
+
+/* Number of channels filtered together */
+#define SOS_CHANNEL_BLOCK 8
+
+/* Number of samples in each block of a multichannel buffer */
+#define SOS_CHANNEL_BLOCK_LENGTH 256
+
+/* Allocate a filter with zeroed coefficients and state */
+static REAL8SOSFilter *CreateSOSFilter( UINT4 numSections, UINT4 numChannels )
+{
+  REAL8SOSFilter *filter;
+  XLAL_CHECK_NULL( numSections > 0, XLAL_EINVAL, "Number of sections must be positive" );
+  XLAL_CHECK_NULL( numChannels > 0, XLAL_EINVAL, "Number of channels must be positive" );
+  filter = XLALCalloc( 1, sizeof( *filter ) );
+  XLAL_CHECK_NULL( filter != NULL, XLAL_ENOMEM );
+  filter->numSections = numSections;
+  filter->numChannels = numChannels;
+  filter->coef = XLALCreateREAL8Vector( SOS_NUM_COEF * numSections );
+  filter->history = XLALCreateREAL8Vector( 2 * numSections * numChannels );
+  if ( ! filter->coef || ! filter->history ) {
+    XLALDestroyREAL8SOSFilter( filter );
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+  memset( filter->coef->data, 0, filter->coef->length * sizeof( REAL8 ) );
+  memset( filter->history->data, 0, filter->history->length * sizeof( REAL8 ) );
+  return filter;
+}
+
+/** Creates a filter from the coefficients \f$(b_0,b_1,b_2,a_0,a_1,a_2)\f$ of each section. */
+REAL8SOSFilter *XLALCreateREAL8SOSFilter( const REAL8VectorSequence *sos, UINT4 numChannels )
+{
+  REAL8SOSFilter *filter;
+  UINT4 s;
+
+  XLAL_CHECK_NULL( sos != NULL && sos->data != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( sos->vectorLength == 6, XLAL_EBADLEN, "Sections must have 6 coefficients, not %u", sos->vectorLength );
+  for ( s = 0; s < sos->length; ++s )
+    XLAL_CHECK_NULL( sos->data[6*s+3] != 0, XLAL_EDOM, "Section %u has a0 = 0", s );
+
+  filter = CreateSOSFilter( sos->length, numChannels );
+  XLAL_CHECK_NULL( filter != NULL, XLAL_EFUNC );
+
+  for ( s = 0; s < sos->length; ++s ) {
+    const REAL8 *in = sos->data + 6*s;
+    REAL8 *coef = filter->coef->data + SOS_NUM_COEF*s;
+    coef[0] = in[0] / in[3];
+    coef[1] = in[1] / in[3];
+    coef[2] = in[2] / in[3];
+    coef[3] = in[4] / in[3];
+    coef[4] = in[5] / in[3];
+  }
+
+  return filter;
+}
+
+/*
+ * Collect the zeros or poles of a z-plane ZPG filter into quadratic
+ * factors 1 + c[0] z^{-1} + c[1] z^{-2}, using only the real and
+ * positive-imaginary roots as in XLALCreateREAL8IIRFilter().  Complex
+ * roots come first, then pairs of real roots, and finally any remaining
+ * single real root.  Returns the number of factors, or -1 if the roots are
+ * not paired up.
+ */
+static INT4 SOSQuadraticFactors( REAL8 *c, INT4 *degree, const COMPLEX16Vector *roots )
+{
+  INT4 i, num = 0, numFactors = 0, numReal = 0;
+  REAL8 real = 0;
+
+  for ( i = 0; i < (INT4)roots->length; ++i ) {
+    const COMPLEX16 r = roots->data[i];
+    if ( cimag( r ) > 0.0 ) {
+      c[2*numFactors] = -2.0 * creal( r );
+      c[2*numFactors+1] = creal( r ) * creal( r ) + cimag( r ) * cimag( r );
+      degree[numFactors++] = 2;
+      num += 2;
+    }
+  }
+  for ( i = 0; i < (INT4)roots->length; ++i ) {
+    const COMPLEX16 r = roots->data[i];
+    if ( cimag( r ) == 0.0 ) {
+      if ( numReal++ % 2 == 0 ) {
+        real = creal( r );
+      } else {
+        c[2*numFactors] = -( real + creal( r ) );
+        c[2*numFactors+1] = real * creal( r );
+        degree[numFactors++] = 2;
+      }
+      num += 1;
+    }
+  }
+  if ( numReal % 2 ) {
+    c[2*numFactors] = -real;
+    c[2*numFactors+1] = 0.0;
+    degree[numFactors++] = 1;
+  }
+
+  return num == (INT4)roots->length ? numFactors : -1;
+}
+
+/**
+ * Creates a filter from the zeros, poles and gain of a filter in the
+ * \f$z\f$-plane, by pairing them up into second-order sections.
+ */
+REAL8SOSFilter *XLALCreateREAL8SOSFilterFromZPG( const COMPLEX16ZPGFilter *input, UINT4 numChannels )
+{
+  REAL8SOSFilter *filter = NULL;
+  REAL8 *zc = NULL, *pc = NULL;
+  INT4 *zdeg = NULL, *pdeg = NULL;
+  INT4 numZeroFactors, numPoleFactors, numSections, s;
+
+  XLAL_CHECK_NULL( input != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( input->zeros != NULL && input->poles != NULL && input->zeros->data != NULL && input->poles->data != NULL, XLAL_EINVAL );
+
+  zc = XLALCalloc( 2 * input->zeros->length + 2, sizeof( *zc ) );
+  pc = XLALCalloc( 2 * input->poles->length + 2, sizeof( *pc ) );
+  zdeg = XLALCalloc( input->zeros->length + 1, sizeof( *zdeg ) );
+  pdeg = XLALCalloc( input->poles->length + 1, sizeof( *pdeg ) );
+  if ( ! zc || ! pc || ! zdeg || ! pdeg ) {
+    XLALFree( zc ); XLALFree( pc ); XLALFree( zdeg ); XLALFree( pdeg );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+
+  numZeroFactors = SOSQuadraticFactors( zc, zdeg, input->zeros );
+  numPoleFactors = SOSQuadraticFactors( pc, pdeg, input->poles );
+  if ( numZeroFactors < 0 || numPoleFactors < 0 ) {
+    XLALFree( zc ); XLALFree( pc ); XLALFree( zdeg ); XLALFree( pdeg );
+    XLAL_ERROR_NULL( XLAL_EINVAL, "Input has unpaired nonreal poles or zeros" );
+  }
+
+  numSections = numZeroFactors > numPoleFactors ? numZeroFactors : numPoleFactors;
+  if ( numSections == 0 )
+    numSections = 1;
+
+  filter = CreateSOSFilter( numSections, numChannels );
+  if ( ! filter ) {
+    XLALFree( zc ); XLALFree( pc ); XLALFree( zdeg ); XLALFree( pdeg );
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+  filter->deltaT = input->deltaT;
+
+  /* Each section has transfer function N(z)/D(z), where N and D have
+     the zeros and poles of the section as roots.  Multiplying N and D
+     by z^{-d}, where d is the larger of their degrees, gives the
+     coefficients in powers of z^{-1}.  If a section has more zeros than
+     poles, the missing poles are placed at z=0, which delays the filter
+     response so that it is causal, as in XLALCreateREAL8IIRFilter(). */
+  for ( s = 0; s < numSections; ++s ) {
+    REAL8 *coef = filter->coef->data + SOS_NUM_COEF*s;
+    const INT4 nz = s < numZeroFactors ? zdeg[s] : 0;
+    const INT4 np = s < numPoleFactors ? pdeg[s] : 0;
+    const INT4 shift = ( nz > np ? nz : np ) - nz;
+    REAL8 b[3] = { 1.0, 0.0, 0.0 };
+    INT4 k;
+    if ( s < numZeroFactors ) {
+      b[1] = zc[2*s];
+      b[2] = zc[2*s+1];
+    }
+    for ( k = 2; k >= 0; --k )
+      coef[k] = k >= shift ? b[k - shift] : 0.0;
+    if ( s < numPoleFactors ) {
+      coef[3] = pc[2*s];
+      coef[4] = pc[2*s+1];
+    }
+  }
+
+  /* Apply the gain to the first section. */
+  for ( s = 0; s < 3; ++s )
+    filter->coef->data[s] *= creal( input->gain );
+
+  XLALFree( zc );
+  XLALFree( pc );
+  XLALFree( zdeg );
+  XLALFree( pdeg );
+
+  return filter;
+}
+
+/** Destroys a filter created by <tt>XLALCreateREAL8SOSFilter()</tt> or <tt>XLALCreateREAL8SOSFilterFromZPG()</tt>. */
+void XLALDestroyREAL8SOSFilter( REAL8SOSFilter *filter )
+{
+  if ( filter ) {
+    XLALDestroyREAL8Vector( filter->coef );
+    XLALDestroyREAL8Vector( filter->history );
+    XLALFree( filter );
+  }
+}
+
+/** Zeroes the state of all channels of a filter. */
+int XLALResetREAL8SOSFilter( REAL8SOSFilter *filter )
+{
+  XLAL_CHECK( filter != NULL && filter->history != NULL && filter->history->data != NULL, XLAL_EFAULT );
+  memset( filter->history->data, 0, filter->history->length * sizeof( REAL8 ) );
+  return XLAL_SUCCESS;
+}
+
+/*
+ * Apply all sections to n samples of a single channel, starting at x and
+ * advancing by step samples.  The state of section s is stored in
+ * state[2*s] and state[2*s+1].
+ */
+static void SOSFilterBlock( REAL8 *x, size_t n, ptrdiff_t step, const REAL8 *coef, REAL8 *state, UINT4 numSections )
+{
+  UINT4 s;
+  for ( s = 0; s < numSections; ++s, coef += SOS_NUM_COEF ) {
+    const REAL8 b0 = coef[0], b1 = coef[1], b2 = coef[2], a1 = coef[3], a2 = coef[4];
+    REAL8 s1 = state[2*s], s2 = state[2*s+1];
+    REAL8 *p = x;
+    size_t i;
+    for ( i = 0; i < n; ++i, p += step ) {
+      const REAL8 xi = *p;
+      const REAL8 yi = b0 * xi + s1;
+      s1 = b1 * xi - a1 * yi + s2;
+      s2 = b2 * xi - a2 * yi;
+      *p = yi;
+    }
+    state[2*s] = s1;
+    state[2*s+1] = s2;
+  }
+}
+
+/* Filter a single channel forwards (reverse = 0) or backwards in time. */
+static void SOSFilterChannel( REAL8 *data, size_t length, int reverse, const REAL8 *coef, REAL8 *state, UINT4 numSections )
+{
+  size_t i;
+  for ( i = 0; i < length; i += SOS_BLOCK_LENGTH ) {
+    const size_t n = length - i < SOS_BLOCK_LENGTH ? length - i : SOS_BLOCK_LENGTH;
+    if ( reverse )
+      SOSFilterBlock( data + length - 1 - i, n, -1, coef, state, numSections );
+    else
+      SOSFilterBlock( data + i, n, 1, coef, state, numSections );
+  }
+}
+
+/*
+ * Apply all sections to a buffer of n samples of SOS_CHANNEL_BLOCK
+ * channels, with the samples at the same time adjacent.  The state of
+ * section s for channel c is stored in state[2*s*w + c] and
+ * state[(2*s+1)*w + c], where only the first w channels are in use.
+ */
+static void SOSFilterChannelBlock( REAL8 *buf, size_t n, UINT4 w, const REAL8 *coef, REAL8 *state, UINT4 numSections )
+{
+  UINT4 s, c;
+  for ( s = 0; s < numSections; ++s, coef += SOS_NUM_COEF ) {
+    const REAL8 b0 = coef[0], b1 = coef[1], b2 = coef[2], a1 = coef[3], a2 = coef[4];
+    REAL8 s1[SOS_CHANNEL_BLOCK], s2[SOS_CHANNEL_BLOCK];
+    size_t i;
+    for ( c = 0; c < SOS_CHANNEL_BLOCK; ++c ) {
+      s1[c] = c < w ? state[2*s*w + c] : 0.0;
+      s2[c] = c < w ? state[(2*s+1)*w + c] : 0.0;
+    }
+    for ( i = 0; i < n; ++i ) {
+      REAL8 *x = buf + SOS_CHANNEL_BLOCK*i;
+      for ( c = 0; c < SOS_CHANNEL_BLOCK; ++c ) {
+        const REAL8 xc = x[c];
+        const REAL8 yc = b0 * xc + s1[c];
+        s1[c] = b1 * xc - a1 * yc + s2[c];
+        s2[c] = b2 * xc - a2 * yc;
+        x[c] = yc;
+      }
+    }
+    for ( c = 0; c < w; ++c ) {
+      state[2*s*w + c] = s1[c];
+      state[(2*s+1)*w + c] = s2[c];
+    }
+  }
+}
+
+/*
+ * Filter each of the w channels starting at data, with the samples of each
+ * channel stored contiguously and successive channels length samples
+ * apart, forwards (reverse = 0) or backwards in time.
+ */
+static void SOSFilterChannels( REAL8 *data, size_t length, UINT4 w, int reverse, const REAL8 *coef, REAL8 *state, UINT4 numSections )
+{
+  REAL8 buf[SOS_CHANNEL_BLOCK * SOS_CHANNEL_BLOCK_LENGTH];
+  size_t i, j;
+  UINT4 c;
+
+  if ( w == 1 ) {
+    SOSFilterChannel( data, length, reverse, coef, state, numSections );
+    return;
+  }
+
+  memset( buf, 0, sizeof( buf ) );
+  for ( i = 0; i < length; i += SOS_CHANNEL_BLOCK_LENGTH ) {
+    const size_t n = length - i < SOS_CHANNEL_BLOCK_LENGTH ? length - i : SOS_CHANNEL_BLOCK_LENGTH;
+    for ( c = 0; c < w; ++c ) {
+      const REAL8 *x = data + c*length;
+      for ( j = 0; j < n; ++j )
+        buf[SOS_CHANNEL_BLOCK*j + c] = x[reverse ? length - 1 - i - j : i + j];
+    }
+    SOSFilterChannelBlock( buf, n, w, coef, state, numSections );
+    for ( c = 0; c < w; ++c ) {
+      REAL8 *x = data + c*length;
+      for ( j = 0; j < n; ++j )
+        x[reverse ? length - 1 - i - j : i + j] = buf[SOS_CHANNEL_BLOCK*j + c];
+    }
+  }
+}
+
+/* Filter all channels of a sequence, in groups of SOS_CHANNEL_BLOCK channels. */
+static void SOSFilterSequence( REAL8VectorSequence *channels, int reverse, const REAL8 *coef, REAL8 *history, UINT4 numSections )
+{
+  UINT4 c;
+  for ( c = 0; c < channels->length; c += SOS_CHANNEL_BLOCK ) {
+    const UINT4 w = channels->length - c < SOS_CHANNEL_BLOCK ? channels->length - c : SOS_CHANNEL_BLOCK;
+    SOSFilterChannels( channels->data + (size_t)c * channels->vectorLength, channels->vectorLength, w, reverse, coef, history + 2 * numSections * c, numSections );
+  }
+}
+
+/** Filters a single channel in place, updating the filter state. */
+int XLALSOSFilterREAL8Vector( REAL8Vector *vector, REAL8SOSFilter *filter )
+{
+  XLAL_CHECK( vector != NULL && filter != NULL, XLAL_EFAULT );
+  XLAL_CHECK( vector->data != NULL, XLAL_EINVAL );
+  XLAL_CHECK( filter->coef != NULL && filter->history != NULL, XLAL_EINVAL );
+  XLAL_CHECK( filter->numChannels == 1, XLAL_EINVAL, "Filter has %u channels, expected 1", filter->numChannels );
+  SOSFilterChannel( vector->data, vector->length, 0, filter->coef->data, filter->history->data, filter->numSections );
+  return XLAL_SUCCESS;
+}
+
+/** Filters each vector of a sequence in place as a separate channel, updating the filter state. */
+int XLALSOSFilterREAL8VectorSequence( REAL8VectorSequence *channels, REAL8SOSFilter *filter )
+{
+  XLAL_CHECK( channels != NULL && filter != NULL, XLAL_EFAULT );
+  XLAL_CHECK( channels->data != NULL, XLAL_EINVAL );
+  XLAL_CHECK( filter->coef != NULL && filter->history != NULL, XLAL_EINVAL );
+  XLAL_CHECK( channels->length == filter->numChannels, XLAL_EBADLEN, "Sequence has %u channels, filter has %u", channels->length, filter->numChannels );
+  SOSFilterSequence( channels, 0, filter->coef->data, filter->history->data, filter->numSections );
+  return XLAL_SUCCESS;
+}
+
+/** Filters a single channel in place forwards and backwards in time, without using the filter state. */
+int XLALSOSFilterZeroPhaseREAL8Vector( REAL8Vector *vector, const REAL8SOSFilter *filter )
+{
+  REAL8 *state;
+  XLAL_CHECK( vector != NULL && filter != NULL, XLAL_EFAULT );
+  XLAL_CHECK( vector->data != NULL, XLAL_EINVAL );
+  XLAL_CHECK( filter->coef != NULL, XLAL_EINVAL );
+  state = XLALCalloc( 2 * filter->numSections, sizeof( *state ) );
+  XLAL_CHECK( state != NULL, XLAL_ENOMEM );
+  SOSFilterChannel( vector->data, vector->length, 0, filter->coef->data, state, filter->numSections );
+  memset( state, 0, 2 * filter->numSections * sizeof( *state ) );
+  SOSFilterChannel( vector->data, vector->length, 1, filter->coef->data, state, filter->numSections );
+  XLALFree( state );
+  return XLAL_SUCCESS;
+}
+
+/** Filters each vector of a sequence in place forwards and backwards in time, without using the filter state. */
+int XLALSOSFilterZeroPhaseREAL8VectorSequence( REAL8VectorSequence *channels, const REAL8SOSFilter *filter )
+{
+  REAL8 *state;
+  size_t stateLength;
+  XLAL_CHECK( channels != NULL && filter != NULL, XLAL_EFAULT );
+  XLAL_CHECK( channels->data != NULL, XLAL_EINVAL );
+  XLAL_CHECK( filter->coef != NULL, XLAL_EINVAL );
+  stateLength = 2 * (size_t)filter->numSections * channels->length;
+  state = XLALCalloc( stateLength, sizeof( *state ) );
+  XLAL_CHECK( state != NULL, XLAL_ENOMEM );
+  SOSFilterSequence( channels, 0, filter->coef->data, state, filter->numSections );
+  memset( state, 0, stateLength * sizeof( *state ) );
+  SOSFilterSequence( channels, 1, filter->coef->data, state, filter->numSections );
+  XLALFree( state );
+  return XLAL_SUCCESS;
+}
+
+/** @} */
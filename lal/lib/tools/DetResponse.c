@@ -29,6 +29,7 @@
 #include <lal/SkyCoordinates.h>
 #include <lal/DetResponse.h>
 #include <lal/TimeSeries.h>
+#include <lal/VectorMath.h>
 #include <lal/XLALError.h>
 
 /**
@@ -92,6 +93,137 @@ void XLALComputeDetAMResponse(
 }
 
 
+/* number of sky positions processed at a time by XLALComputeDetAMResponseArrays() */
+#define DETRESPONSE_BLOCK 256
+
+/**
+ * Computes F+, Fx, and the time delay from the geocentre, for several
+ * detectors and many sky positions at once.
+ *
+ * The sky positions are given as separate arrays of right ascension,
+ * declination, polarization angle, and Greenwich mean sidereal time (all in
+ * radians), each of length \c len.  The outputs are arrays of length
+ * <tt>numDetectors * len</tt>, with the value for detector \c d and sky
+ * position \c i stored at index <tt>d * len + i</tt>.  Any of \c fplus,
+ * \c fcross and \c delay may be \c NULL if that output is not required;
+ * \c psi may be \c NULL if neither \c fplus nor \c fcross is required.
+ *
+ * The results agree with XLALComputeDetAMResponse() and
+ * XLALTimeDelayFromEarthCenter() to within rounding.  The trigonometric
+ * functions and the polarization tensors of each sky position are computed
+ * once, with XLALVectorSinCosREAL8(), and shared by all detectors; the
+ * response tensor and location of each detector are converted to double
+ * precision once, so that the per-detector work is a short sum of products
+ * which the compiler can vectorise.
+ */
+int XLALComputeDetAMResponseArrays(
+	REAL8 *fplus,		/**< [out] F+, numDetectors * len (may be NULL) */
+	REAL8 *fcross,		/**< [out] Fx, numDetectors * len (may be NULL) */
+	REAL8 *delay,		/**< [out] time delay from geocentre (s), numDetectors * len (may be NULL) */
+	const LALDetector *const *detectors,	/**< [in] detectors */
+	const UINT4 numDetectors,	/**< [in] number of detectors */
+	const REAL8 *ra,	/**< [in] right ascension of sources (radians) */
+	const REAL8 *dec,	/**< [in] declination of sources (radians) */
+	const REAL8 *psi,	/**< [in] polarization angle of sources (radians) */
+	const REAL8 *gmst,	/**< [in] Greenwich mean sidereal time (radians) */
+	const UINT4 len		/**< [in] number of sky positions */
+)
+{
+	/* buffers for one block of sky positions */
+	REAL8 gha[DETRESPONSE_BLOCK], singha[DETRESPONSE_BLOCK], cosgha[DETRESPONSE_BLOCK];
+	REAL8 sindec[DETRESPONSE_BLOCK], cosdec[DETRESPONSE_BLOCK];
+	REAL8 sinpsi[DETRESPONSE_BLOCK], cospsi[DETRESPONSE_BLOCK];
+	REAL8 eplus[6][DETRESPONSE_BLOCK], ecross[6][DETRESPONSE_BLOCK];
+	REAL8 ehat[3][DETRESPONSE_BLOCK];
+	const int response = fplus || fcross;
+	UINT4 i0, d;
+
+	XLAL_CHECK(detectors != NULL || numDetectors == 0, XLAL_EFAULT);
+	XLAL_CHECK(ra && dec && gmst, XLAL_EFAULT);
+	XLAL_CHECK(psi || !response, XLAL_EFAULT);
+	for(d = 0; d < numDetectors; d++)
+		XLAL_CHECK(detectors[d] != NULL, XLAL_EFAULT);
+
+	for(i0 = 0; i0 < len; i0 += DETRESPONSE_BLOCK) {
+		const UINT4 n = (len - i0 < DETRESPONSE_BLOCK) ? len - i0 : DETRESPONSE_BLOCK;
+		UINT4 i;
+
+		/* Greenwich hour angle of sources (radians), and trig functions */
+		for(i = 0; i < n; i++)
+			gha[i] = gmst[i0 + i] - ra[i0 + i];
+		XLAL_CHECK(XLALVectorSinCosREAL8(singha, cosgha, gha, n) == XLAL_SUCCESS, XLAL_EFUNC);
+		XLAL_CHECK(XLALVectorSinCosREAL8(sindec, cosdec, dec + i0, n) == XLAL_SUCCESS, XLAL_EFUNC);
+		if(response)
+			XLAL_CHECK(XLALVectorSinCosREAL8(sinpsi, cospsi, psi + i0, n) == XLAL_SUCCESS, XLAL_EFUNC);
+
+		/* unit vector pointing from the geocentre to the source */
+		for(i = 0; i < n; i++) {
+			ehat[0][i] = cosdec[i] * cosgha[i];
+			ehat[1][i] = -cosdec[i] * singha[i];
+			ehat[2][i] = sindec[i];
+		}
+
+		/* Eqs. (B4) and (B5) of [ABCF], and the symmetric tensors
+		 * X X - Y Y and X Y + Y X, stored as their xx, yy, zz, xy,
+		 * xz, yz components */
+		if(response)
+			for(i = 0; i < n; i++) {
+				const double X0 = -cospsi[i] * singha[i] - sinpsi[i] * cosgha[i] * sindec[i];
+				const double X1 = -cospsi[i] * cosgha[i] + sinpsi[i] * singha[i] * sindec[i];
+				const double X2 =  sinpsi[i] * cosdec[i];
+				const double Y0 =  sinpsi[i] * singha[i] - cospsi[i] * cosgha[i] * sindec[i];
+				const double Y1 =  sinpsi[i] * cosgha[i] + cospsi[i] * singha[i] * sindec[i];
+				const double Y2 =  cospsi[i] * cosdec[i];
+				eplus[0][i] = X0 * X0 - Y0 * Y0;
+				eplus[1][i] = X1 * X1 - Y1 * Y1;
+				eplus[2][i] = X2 * X2 - Y2 * Y2;
+				eplus[3][i] = X0 * X1 - Y0 * Y1;
+				eplus[4][i] = X0 * X2 - Y0 * Y2;
+				eplus[5][i] = X1 * X2 - Y1 * Y2;
+				ecross[0][i] = 2 * X0 * Y0;
+				ecross[1][i] = 2 * X1 * Y1;
+				ecross[2][i] = 2 * X2 * Y2;
+				ecross[3][i] = X0 * Y1 + Y0 * X1;
+				ecross[4][i] = X0 * Y2 + Y0 * X2;
+				ecross[5][i] = X1 * Y2 + Y1 * X2;
+			}
+
+		for(d = 0; d < numDetectors; d++) {
+			const LALDetector *det = detectors[d];
+			const REAL4 (*D)[3] = det->response;
+			/* Eq. (B7) of [ABCF]: since the polarization tensors are
+			 * symmetric, only the sums of the off-diagonal components
+			 * of the response tensor are needed */
+			const double c[6] = {
+				D[0][0], D[1][1], D[2][2],
+				(double) D[0][1] + D[1][0], (double) D[0][2] + D[2][0], (double) D[1][2] + D[2][1]
+			};
+			const double loc[3] = {
+				-det->location[0] / LAL_C_SI, -det->location[1] / LAL_C_SI, -det->location[2] / LAL_C_SI
+			};
+
+			if(fplus) {
+				REAL8 *out = fplus + (size_t) d * len + i0;
+				for(i = 0; i < n; i++)
+					out[i] = c[0] * eplus[0][i] + c[1] * eplus[1][i] + c[2] * eplus[2][i] + c[3] * eplus[3][i] + c[4] * eplus[4][i] + c[5] * eplus[5][i];
+			}
+			if(fcross) {
+				REAL8 *out = fcross + (size_t) d * len + i0;
+				for(i = 0; i < n; i++)
+					out[i] = c[0] * ecross[0][i] + c[1] * ecross[1][i] + c[2] * ecross[2][i] + c[3] * ecross[3][i] + c[4] * ecross[4][i] + c[5] * ecross[5][i];
+			}
+			if(delay) {
+				REAL8 *out = delay + (size_t) d * len + i0;
+				for(i = 0; i < n; i++)
+					out[i] = loc[0] * ehat[0][i] + loc[1] * ehat[1][i] + loc[2] * ehat[2][i];
+			}
+		}
+	}
+
+	return XLAL_SUCCESS;
+}
+
+
 /**
  *
  * An implementation of the detector response for all six tensor, vector and
@@ -54,6 +54,9 @@ extern "C"
  * types.  <tt>XLALComputeDetAMResponse()</tt> computes the response at one
  * instance in time, and <tt>XLALComputeDetAMResponseSeries()</tt> computes a
  * vector of response for some length of time.
+ * <tt>XLALComputeDetAMResponseArrays()</tt> computes the response, and the
+ * time delay from the geocentre, of several detectors for many sky positions
+ * at once, e.g.\ when scanning the sky for the origin of a trigger.
  *
  * ### Algorithm ###
  *
@@ -193,6 +196,22 @@ void XLALComputeDetAMResponse(
 );
 
 
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALComputeDetAMResponseArrays(
+	REAL8 *fplus,
+	REAL8 *fcross,
+	REAL8 *delay,
+	const LALDetector *const *detectors,
+	const UINT4 numDetectors,
+	const REAL8 *ra,
+	const REAL8 *dec,
+	const REAL8 *psi,
+	const REAL8 *gmst,
+	const UINT4 len
+);
+#endif /* SWIG */
+
+
 void XLALComputeDetAMResponseExtraModes(
   double *fplus,
   double *fcross,
@@ -24,6 +24,7 @@
 
 #include <stddef.h>
 #include <lal/LALDatatypes.h>
+#include <lal/LALMalloc.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -84,6 +85,40 @@ UINT4FrequencySeries *XLALCreateUINT4FrequencySeries ( const CHAR *name, const L
 UINT8FrequencySeries *XLALCreateUINT8FrequencySeries ( const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
 /** @} */
 
+/**
+ * \name Arena Creation Functions
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/FrequencySeries.h>
+ *
+ * XLALArenaCreate<frequencyseriestype>()
+ * \endcode
+ *
+ * ### Description ###
+ *
+ * These functions create LAL frequency series like their XLALCreate
+ * counterparts, but allocate the series and its data from the arena
+ * allocator \c arena (see \ref LALMalloc_h).  The series must not be
+ * destroyed, resized or shrunk; its memory is released by XLALArenaReset()
+ * or XLALArenaDestroy().
+ */
+/** @{ */
+#ifndef SWIG   /* exclude from SWIG interface */
+COMPLEX8FrequencySeries *XLALArenaCreateCOMPLEX8FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+COMPLEX16FrequencySeries *XLALArenaCreateCOMPLEX16FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+REAL4FrequencySeries *XLALArenaCreateREAL4FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+REAL8FrequencySeries *XLALArenaCreateREAL8FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+INT2FrequencySeries *XLALArenaCreateINT2FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+INT4FrequencySeries *XLALArenaCreateINT4FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+INT8FrequencySeries *XLALArenaCreateINT8FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+UINT2FrequencySeries *XLALArenaCreateUINT2FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+UINT4FrequencySeries *XLALArenaCreateUINT4FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+UINT8FrequencySeries *XLALArenaCreateUINT8FrequencySeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+#endif   /* SWIG */
+/** @} */
+
 /**
  * \name Destruction Functions
  *
@@ -6,6 +6,8 @@
 
 #define DSERIES CONCAT2(XLALDestroy,SERIESTYPE)
 #define CSERIES CONCAT2(XLALCreate,SERIESTYPE)
+#define ACSERIES CONCAT2(XLALArenaCreate,SERIESTYPE)
+#define ISERIES CONCAT2(Init,SERIESTYPE)
 #define XSERIES CONCAT2(XLALCut,SERIESTYPE)
 #define RSERIES CONCAT2(XLALResize,SERIESTYPE)
 #define SSERIES CONCAT2(XLALShrink,SERIESTYPE)
@@ -14,6 +16,7 @@
 
 #define DSEQUENCE CONCAT2(XLALDestroy,SEQUENCETYPE)
 #define CSEQUENCE CONCAT2(XLALCreate,SEQUENCETYPE)
+#define ACSEQUENCE CONCAT2(XLALArenaCreate,CONCAT2(DATATYPE,Vector))
 #define XSEQUENCE CONCAT2(XLALCut,SEQUENCETYPE)
 #define RSEQUENCE CONCAT2(XLALResize,SEQUENCETYPE)
 
@@ -27,26 +30,16 @@ void DSERIES (
 }
 
 
-SERIESTYPE *CSERIES (
+static SERIESTYPE *ISERIES (
+	SERIESTYPE *new,
 	const CHAR *name,
 	const LIGOTimeGPS *epoch,
 	REAL8 f0,
 	REAL8 deltaF,
 	const LALUnit *sampleUnits,
-	size_t length
+	SEQUENCETYPE *sequence
 )
 {
-	SERIESTYPE *new;
-	SEQUENCETYPE *sequence;
-
-	new = XLALMalloc(sizeof(*new));
-	sequence = CSEQUENCE (length);
-	if(!new || !sequence) {
-		XLALFree(new);
-		DSEQUENCE (sequence);
-		XLAL_ERROR_NULL(XLAL_EFUNC);
-	}
-
 	if(name) {
 		strncpy(new->name, name, LALNameLength - 1);
 		new->name[LALNameLength - 1] = '\0';
@@ -72,6 +65,53 @@ SERIESTYPE *CSERIES (
 }
 
 
+SERIESTYPE *CSERIES (
+	const CHAR *name,
+	const LIGOTimeGPS *epoch,
+	REAL8 f0,
+	REAL8 deltaF,
+	const LALUnit *sampleUnits,
+	size_t length
+)
+{
+	SERIESTYPE *new;
+	SEQUENCETYPE *sequence;
+
+	new = XLALMalloc(sizeof(*new));
+	sequence = CSEQUENCE (length);
+	if(!new || !sequence) {
+		XLALFree(new);
+		DSEQUENCE (sequence);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	return ISERIES (new, name, epoch, f0, deltaF, sampleUnits, sequence);
+}
+
+
+SERIESTYPE *ACSERIES (
+	LALArena *arena,
+	const CHAR *name,
+	const LIGOTimeGPS *epoch,
+	REAL8 f0,
+	REAL8 deltaF,
+	const LALUnit *sampleUnits,
+	size_t length
+)
+{
+	SERIESTYPE *new;
+	SEQUENCETYPE *sequence;
+
+	XLAL_CHECK_NULL(length <= LAL_UINT4_MAX, XLAL_EBADLEN);
+	new = XLALArenaAlloc(arena, sizeof(*new));
+	sequence = ACSEQUENCE (arena, length);
+	if(!new || !sequence)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	return ISERIES (new, name, epoch, f0, deltaF, sampleUnits, sequence);
+}
+
+
 SERIESTYPE *XSERIES (
 	const SERIESTYPE *series,
 	size_t first,
@@ -241,6 +281,8 @@ SERIESTYPE *MSERIES (
 
 #undef DSERIES
 #undef CSERIES
+#undef ACSERIES
+#undef ISERIES
 #undef XSERIES
 #undef RSERIES
 #undef SSERIES
@@ -249,5 +291,6 @@ SERIESTYPE *MSERIES (
 
 #undef DSEQUENCE
 #undef CSEQUENCE
+#undef ACSEQUENCE
 #undef XSEQUENCE
 #undef RSEQUENCE
@@ -18,11 +18,21 @@
 */
 
 /*
- * Dictionary is implemented as a hash search with algorithm adopted
- * from "The C Programming Language" by Kernighan and Ritchie, 2nd ed.
- * section 6.6.
+ * Dictionary is implemented as an open-addressing hash table with linear
+ * probing, which is resized to keep it at most half full.  Each slot holds
+ * a pointer to an interned key and a value; values of up to
+ * LAL_DICT_INLINE_SIZE bytes (i.e. all scalar types and short strings) are
+ * stored inline in the slot, and longer values are allocated separately.
+ *
+ * Keys are interned in a global table, so that each distinct key name is
+ * represented by a unique LALDictKey; lookups through a key handle returned
+ * by XLALDictKeyHandle() therefore need only compare pointers.  Interned
+ * keys live for the lifetime of the process (only tests may free them with
+ * XLALClearDictKeyTable()); they are allocated with the system allocator
+ * rather than LALMalloc() in order not to be reported as leaks.
  */
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -30,38 +40,191 @@
 
 #include <lal/LALStdio.h>
 #include <lal/LALStdlib.h>
+#include <lal/LALHashFunc.h>
 #include <lal/LALDict.h>
+#include "LALDict_private.h"
 #include "LALValue_private.h"
 
-#define LAL_DICT_HASHSIZE 101
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_mutex_t lalDictKeyMutex = PTHREAD_MUTEX_INITIALIZER;
+#define LAL_DICT_KEY_LOCK pthread_mutex_lock(&lalDictKeyMutex)
+#define LAL_DICT_KEY_UNLOCK pthread_mutex_unlock(&lalDictKeyMutex)
+#else
+#define LAL_DICT_KEY_LOCK
+#define LAL_DICT_KEY_UNLOCK
+#endif
+
+#define LAL_DICT_MINSIZE 16
+#define LAL_DICT_INLINE_SIZE 16
+
+struct tagLALDictKey {
+	UINT8 hash;
+	char name[LAL_KEYNAME_MAX + 1];
+};
 
+/* each entry is followed by storage for an inline value */
 struct tagLALDictEntry {
-        struct tagLALDictEntry *next;
-        char key[LAL_KEYNAME_MAX + 1];
-	LALValue value;
+	const LALDictKey *key;	/* NULL for an empty slot */
+	LALValue *value;	/* either INLINE_VALUE(entry) or allocated */
 };
 
+#define INLINE_VALUE(entry) ((LALValue *)((entry) + 1))
+
+/* slot size in units of LALDictEntry */
+#define SLOT_STRIDE ((sizeof(LALDictEntry) + sizeof(LALValue) + LAL_DICT_INLINE_SIZE + sizeof(LALDictEntry) - 1) / sizeof(LALDictEntry))
+
 struct tagLALDict {
-	size_t size;
-	struct tagLALDictEntry *hashes[];
+	size_t size;	/* number of slots; a power of two */
+	size_t count;	/* number of occupied slots */
+	LALDictEntry *slots;
 };
 
-static size_t hash(const char *s)
+#define SLOT(dict, i) ((dict)->slots + (i) * SLOT_STRIDE)
+
+static UINT8 hash(const char *s)
+{
+	return XLALCityHash64(s, strlen(s));
+}
+
+/* KEY INTERNING ROUTINES */
+
+/* global table of interned keys; also open-addressing with linear probing */
+static size_t keyTableSize = 0;
+static size_t keyTableCount = 0;
+static LALDictKey **keyTable = NULL;
+
+/* must be called with the key lock held; returns NULL on allocation failure */
+static const LALDictKey * DictKeyIntern(const char *name, UINT8 h)
+{
+	LALDictKey *key;
+	size_t i;
+
+	if (keyTableSize > 0)
+		for (i = h & (keyTableSize - 1); keyTable[i] != NULL; i = (i + 1) & (keyTableSize - 1))
+			if (keyTable[i]->hash == h && strcmp(keyTable[i]->name, name) == 0)
+				return keyTable[i];
+
+	/* not found: grow table if necessary, then add new key */
+	if (2 * (keyTableCount + 1) > keyTableSize) {
+		size_t newsize = keyTableSize > 0 ? 2 * keyTableSize : 256;
+		LALDictKey **newtable = calloc(newsize, sizeof(*newtable));
+		if (!newtable)
+			return NULL;
+		for (i = 0; i < keyTableSize; ++i)
+			if (keyTable[i]) {
+				size_t j;
+				for (j = keyTable[i]->hash & (newsize - 1); newtable[j] != NULL; j = (j + 1) & (newsize - 1))
+					;
+				newtable[j] = keyTable[i];
+			}
+		free(keyTable);
+		keyTable = newtable;
+		keyTableSize = newsize;
+	}
+	key = malloc(sizeof(*key));
+	if (!key)
+		return NULL;
+	key->hash = h;
+	strcpy(key->name, name);
+	for (i = h & (keyTableSize - 1); keyTable[i] != NULL; i = (i + 1) & (keyTableSize - 1))
+		;
+	keyTable[i] = key;
+	++keyTableCount;
+	return key;
+}
+
+/* as XLALDictKeyHandle() but with the hash of key already computed */
+static const LALDictKey * DictKeyHandle(const char *key, UINT8 h)
+{
+	const LALDictKey *handle;
+	if (strlen(key) > LAL_KEYNAME_MAX)
+		XLAL_ERROR_NULL(XLAL_ENAME, "Key name `%s' too long (max %d characters)", key, LAL_KEYNAME_MAX);
+	LAL_DICT_KEY_LOCK;
+	handle = DictKeyIntern(key, h);
+	LAL_DICT_KEY_UNLOCK;
+	if (!handle)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	return handle;
+}
+
+const LALDictKey * XLALDictKeyHandle(const char *key)
+{
+	XLAL_CHECK_NULL(key != NULL, XLAL_EFAULT);
+	return DictKeyHandle(key, hash(key));
+}
+
+const char * XLALDictKeyGetName(const LALDictKey *key)
+{
+	if (key == NULL)
+		return NULL;
+	return key->name;
+}
+
+void XLALClearDictKeyTable(void)
 {
-	size_t hashval;
-	for (hashval = 0; *s != '\0'; ++s)
-		hashval = *s + 31 * hashval;
-	return hashval;
+	size_t i;
+	LAL_DICT_KEY_LOCK;
+	for (i = 0; i < keyTableSize; ++i)
+		free(keyTable[i]);
+	free(keyTable);
+	keyTable = NULL;
+	keyTableSize = 0;
+	keyTableCount = 0;
+	LAL_DICT_KEY_UNLOCK;
 }
 
 /* DICT ENTRY ROUTINES */
 
-void XLALDictEntryFree(LALDictEntry *list)
+/* set the value of a dictionary entry, storing it inline if it fits; on error the entry is unchanged */
+static LALDictEntry * DictEntrySetValue(LALDictEntry *entry, const void *data, size_t size, LALTYPECODE type)
+{
+	LALValue *value = entry->value;
+	size_t oldsize = value->size;
+	if (size <= LAL_DICT_INLINE_SIZE)
+		value = INLINE_VALUE(entry);
+	else if (value == INLINE_VALUE(entry) || value->size != size) {
+		value = XLALValueAlloc(size);
+		if (!value)
+			XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	value->size = size;
+	if (XLALValueSet(value, data, size, type) == NULL) {
+		if (value == entry->value)
+			value->size = oldsize;
+		else if (value != INLINE_VALUE(entry))
+			LALFree(value);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+	if (value != entry->value && entry->value != INLINE_VALUE(entry))
+		LALFree(entry->value);
+	entry->value = value;
+	return entry;
+}
+
+/* copy an entry between slots, keeping inline values inline */
+static void DictEntryMove(LALDictEntry *dst, LALDictEntry *src)
 {
-	while (list) {
-		LALDictEntry *next = list->next;
-		LALFree(list);
-		list = next;
+	if (src->value == INLINE_VALUE(src)) {
+		memcpy(dst, src, SLOT_STRIDE * sizeof(*dst));
+		dst->value = INLINE_VALUE(dst);
+	} else
+		*dst = *src;
+	src->key = NULL;
+	src->value = INLINE_VALUE(src);
+}
+
+/*
+ * The following routines manage entries outside of any dictionary; entries
+ * in a dictionary are owned by it, and must not be passed to them.
+ */
+
+void XLALDictEntryFree(LALDictEntry *entry)
+{
+	if (entry) {
+		if (entry->value != INLINE_VALUE(entry))
+			LALFree(entry->value);
+		LALFree(entry);
 	}
 	return;
 }
@@ -69,10 +232,12 @@ void XLALDictEntryFree(LALDictEntry *list)
 LALDictEntry * XLALDictEntryAlloc(size_t size)
 {
 	LALDictEntry *entry;
-	entry = XLALMalloc(sizeof(*entry) + size);
+	entry = XLALMalloc(sizeof(*entry) + sizeof(LALValue) + size);
 	if (!entry)
 		XLAL_ERROR_NULL(XLAL_ENOMEM);
-	entry->value.size = size;
+	entry->key = NULL;
+	entry->value = INLINE_VALUE(entry);
+	entry->value->size = size;
 	return entry;
 }
 
@@ -80,25 +245,32 @@ LALDictEntry * XLALDictEntryRealloc(LALDictEntry *entry, size_t size)
 {
 	if (entry == NULL)
 		return XLALDictEntryAlloc(size);
-	if (entry->value.size == size)
+	if (entry->value->size == size)
 		return entry;
-	entry = XLALRealloc(entry, sizeof(*entry) + size);
+	if (entry->value != INLINE_VALUE(entry)) {
+		LALFree(entry->value);
+		entry->value = INLINE_VALUE(entry);
+	}
+	entry = XLALRealloc(entry, sizeof(*entry) + sizeof(LALValue) + size);
 	if (!entry)
 		XLAL_ERROR_NULL(XLAL_ENOMEM);
-	entry->value.size = size;
+	entry->value = INLINE_VALUE(entry);
+	entry->value->size = size;
 	return entry;
 }
 
 LALDictEntry * XLALDictEntrySetKey(LALDictEntry *entry, const char *key)
 {
-	if ((size_t)snprintf(entry->key, sizeof(entry->key), "%s", key) >= sizeof(entry->key))
-		XLAL_ERROR_NULL(XLAL_ENAME, "Key name `%s' too long (max %d characters)", key, LAL_KEYNAME_MAX);
+	const LALDictKey *handle = XLALDictKeyHandle(key);
+	if (!handle)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	entry->key = handle;
 	return entry;
 }
 
 LALDictEntry * XLALDictEntrySetValue(LALDictEntry *entry, const void *data, size_t size, LALTYPECODE type)
 {
-	if (XLALValueSet(&entry->value, data, size, type) == NULL)
+	if (XLALValueSet(entry->value, data, size, type) == NULL)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	return entry;
 }
@@ -106,21 +278,27 @@ LALDictEntry * XLALDictEntrySetValue(LALDictEntry *entry, const void *data, size
 /* warning: shallow pointer */
 const char * XLALDictEntryGetKey(const LALDictEntry *entry)
 {
-	return entry->key;
+	if (entry->key == NULL)
+		return NULL;
+	return entry->key->name;
 }
 
 /* warning: shallow pointer */
 const LALValue * XLALDictEntryGetValue(const LALDictEntry *entry)
 {
-	return &entry->value;
+	return entry->value;
 }
 
 void XLALDestroyDict(LALDict *dict)
 {
 	if (dict) {
 		size_t i;
-		for (i = 0; i < dict->size; ++i)
-			XLALDictEntryFree(dict->hashes[i]);
+		for (i = 0; i < dict->size; ++i) {
+			LALDictEntry *entry = SLOT(dict, i);
+			if (entry->key && entry->value != INLINE_VALUE(entry))
+				LALFree(entry->value);
+		}
+		LALFree(dict->slots);
 		LALFree(dict);
 	}
 	return;
@@ -128,13 +306,44 @@ void XLALDestroyDict(LALDict *dict)
 
 /* DICT ROUTINES */
 
+static int DictResize(LALDict *dict, size_t size)
+{
+	LALDictEntry *oldslots = dict->slots;
+	size_t oldsize = dict->size;
+	size_t i;
+	dict->slots = XLALMalloc(size * SLOT_STRIDE * sizeof(*dict->slots));
+	if (!dict->slots) {
+		dict->slots = oldslots;
+		XLAL_ERROR(XLAL_ENOMEM);
+	}
+	dict->size = size;
+	for (i = 0; i < size; ++i) {
+		SLOT(dict, i)->key = NULL;
+		SLOT(dict, i)->value = INLINE_VALUE(SLOT(dict, i));
+	}
+	for (i = 0; i < oldsize; ++i) {
+		LALDictEntry *entry = oldslots + i * SLOT_STRIDE;
+		if (entry->key) {
+			size_t j;
+			for (j = entry->key->hash & (size - 1); SLOT(dict, j)->key != NULL; j = (j + 1) & (size - 1))
+				;
+			DictEntryMove(SLOT(dict, j), entry);
+		}
+	}
+	LALFree(oldslots);
+	return 0;
+}
+
 LALDict * XLALCreateDict(void)
 {
 	LALDict *dict;
-	dict = XLALCalloc(1, sizeof(dict) + LAL_DICT_HASHSIZE * sizeof(*dict->hashes));
+	dict = XLALCalloc(1, sizeof(*dict));
 	if (!dict)
 		XLAL_ERROR_NULL(XLAL_ENOMEM);
-	dict->size = LAL_DICT_HASHSIZE;
+	if (DictResize(dict, LAL_DICT_MINSIZE) < 0) {
+		LALFree(dict);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
 	return dict;
 }
 
@@ -142,9 +351,9 @@ void XLALDictForeach(LALDict *dict, void (*func)(char *, LALValue *, void *), vo
 {
 	size_t i;
 	for (i = 0; i < dict->size; ++i) {
-		LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
-			func(entry->key, &entry->value, thunk);
+		LALDictEntry *entry = SLOT(dict, i);
+		if (entry->key)
+			func((char *)(intptr_t)entry->key->name, entry->value, thunk); /* cast away const for the legacy interface */
 	}
 	return;
 }
@@ -153,10 +362,9 @@ LALDictEntry * XLALDictFind(LALDict *dict, int (*func)(const char *, const LALVa
 {
 	size_t i;
 	for (i = 0; i < dict->size; ++i) {
-		LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
-			if (func(entry->key, &entry->value, thunk))
-				return entry;
+		LALDictEntry *entry = SLOT(dict, i);
+		if (entry->key && func(entry->key->name, entry->value, thunk))
+			return entry;
 	}
 	return NULL;
 }
@@ -171,36 +379,26 @@ void XLALDictIterInit(LALDictIter *iter, LALDict *dict)
 
 LALDictEntry * XLALDictIterNext(LALDictIter *iter)
 {
-	while (1) {
-
-		if (iter->next) {
-			LALDictEntry *entry = iter->next;
-			iter->next = entry->next;
+	while (iter->pos < iter->dict->size) {
+		LALDictEntry *entry = SLOT(iter->dict, iter->pos++);
+		if (entry->key)
 			return entry;
-		}
-
-		/* check end of iteration */
-		if (iter->pos >= iter->dict->size)
-			return NULL;
-
-		iter->next = iter->dict->hashes[iter->pos++];
 	}
 	return NULL;
 }
 
 LALDict * XLALDictDuplicate(LALDict *old)
 {
-    UINT4 i;
+    size_t i;
     int retcode;
     if(old==NULL) return NULL;
     LALDict *new = XLALCreateDict();
     if (!new)
         XLAL_ERROR_NULL(XLAL_ENOMEM);
     for (i = 0; i < old->size; ++i) {
-        const LALDictEntry *entry;
-        for (entry = old->hashes[i]; entry != NULL; entry = entry->next) {
-            const char *key = XLALDictEntryGetKey(entry);
-            XLAL_TRY(XLALDictInsertValue(new, key, XLALDictEntryGetValue(entry)), retcode);
+        const LALDictEntry *entry = SLOT(old, i);
+        if (entry->key) {
+            XLAL_TRY(XLALDictInsertValueByHandle(new, entry->key, XLALDictEntryGetValue(entry)), retcode);
             if(retcode!=XLAL_SUCCESS)
             {
                 XLALDestroyDict(new);
@@ -219,8 +417,8 @@ LALList * XLALDictKeys(const LALDict *dict)
 	if (!list)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next) {
+		const LALDictEntry *entry = SLOT(dict, i);
+		if (entry->key) {
 			const char *key = XLALDictEntryGetKey(entry);
 			if (XLALListAddStringValue(list, key) < 0) {
 				XLALDestroyList(list);
@@ -239,8 +437,8 @@ LALList * XLALDictValues(const LALDict *dict)
 	if (!list)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next) {
+		const LALDictEntry *entry = SLOT(dict, i);
+		if (entry->key) {
 			const LALValue *value = XLALDictEntryGetValue(entry);
 			if (XLALListAddValue(list, value) < 0) {
 				XLALDestroyList(list);
@@ -251,106 +449,135 @@ LALList * XLALDictValues(const LALDict *dict)
 	return list;
 }
 
+/* return the slot holding key, whose hash is h, or the empty slot which ends its probe sequence */
+static size_t DictProbeHash(const LALDict *dict, const char *key, UINT8 h)
+{
+	size_t mask = dict->size - 1;
+	size_t i;
+	for (i = h & mask; SLOT(dict, i)->key != NULL; i = (i + 1) & mask) {
+		const LALDictKey *k = SLOT(dict, i)->key;
+		if (k->hash == h && strcmp(k->name, key) == 0)
+			break;
+	}
+	return i;
+}
+
+static size_t DictProbe(const LALDict *dict, const char *key)
+{
+	return DictProbeHash(dict, key, hash(key));
+}
+
+/* as DictProbe() but for an interned key: compares pointers only */
+static size_t DictProbeHandle(const LALDict *dict, const LALDictKey *key)
+{
+	size_t mask = dict->size - 1;
+	size_t i;
+	for (i = key->hash & mask; SLOT(dict, i)->key != NULL; i = (i + 1) & mask)
+		if (SLOT(dict, i)->key == key)
+			break;
+	return i;
+}
+
 int XLALDictContains(const LALDict *dict, const char *key)
 {
-	const LALDictEntry *entry;
-	for (entry = dict->hashes[hash(key) % dict->size]; entry != NULL; entry = entry->next)
-		if (strcmp(key, entry->key) == 0)
-			return 1;
-	return 0;
+	return SLOT(dict, DictProbe(dict, key))->key != NULL;
+}
+
+int XLALDictContainsHandle(const LALDict *dict, const LALDictKey *key)
+{
+	return SLOT(dict, DictProbeHandle(dict, key))->key != NULL;
 }
 
 size_t XLALDictSize(const LALDict *dict)
 {
-	size_t size = 0;
-	size_t i;
-	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
-			++size;
-	}
-	return size;
+	return dict->count;
 }
 
 LALDictEntry *XLALDictLookup(LALDict *dict, const char *key)
 {
-	LALDictEntry *entry;
-	for (entry = dict->hashes[hash(key) % dict->size]; entry != NULL; entry = entry->next)
-		if (strcmp(key, entry->key) == 0)
-			return entry;
-	return NULL;
+	LALDictEntry *entry = SLOT(dict, DictProbe(dict, key));
+	return entry->key ? entry : NULL;
+}
+
+LALDictEntry *XLALDictLookupHandle(LALDict *dict, const LALDictKey *key)
+{
+	LALDictEntry *entry = SLOT(dict, DictProbeHandle(dict, key));
+	return entry->key ? entry : NULL;
 }
 
 int XLALDictRemove(LALDict *dict, const char *key)
 {
-	size_t hashidx = hash(key) % dict->size;
-	LALDictEntry *this = dict->hashes[hashidx];
-	LALDictEntry *prev = this;
-	while (this) {
-		if (strcmp(this->key, key) == 0) { /* found it! */
-			if (prev == this) /* head is removed */
-				dict->hashes[hashidx] = this->next;
-			else
-				prev->next = this->next;
-			LALFree(this);
-			return 0;
+	size_t mask = dict->size - 1;
+	size_t i = DictProbe(dict, key);
+	size_t j;
+	LALDictEntry *entry = SLOT(dict, i);
+	if (entry->key == NULL)
+		return -1; /* not found */
+	if (entry->value != INLINE_VALUE(entry))
+		LALFree(entry->value);
+	entry->key = NULL;
+	entry->value = INLINE_VALUE(entry);
+	--dict->count;
+
+	/* shift back any following entries whose probe sequence passes through the hole */
+	for (j = (i + 1) & mask; SLOT(dict, j)->key != NULL; j = (j + 1) & mask) {
+		size_t home = SLOT(dict, j)->key->hash & mask;
+		if (((j - home) & mask) >= ((j - i) & mask)) {
+			DictEntryMove(SLOT(dict, i), SLOT(dict, j));
+			i = j;
 		}
-		prev = this;
-		this = this->next;
 	}
-	return -1; /* not found */
+	return 0;
 }
 
-int XLALDictInsert(LALDict *dict, const char *key, const void *data, size_t size, LALTYPECODE type)
+static int DictInsertAt(LALDict *dict, size_t i, const LALDictKey *key, const void *data, size_t size, LALTYPECODE type)
 {
-	size_t hashidx = hash(key) % dict->size;
-	LALDictEntry *this = dict->hashes[hashidx];
-	LALDictEntry *prev = NULL;
-	LALDictEntry *entry;
+	LALDictEntry *entry = SLOT(dict, i);
 
-	/* see if entry already exists */
-	while (this) {
-		if (strcmp(this->key, key) == 0) { /* found it! */
-			entry = XLALDictEntryRealloc(this, size);
-			if (entry == NULL)
+	if (entry->key == NULL) {
+		/* not found: grow table if necessary, then create new entry */
+		if (2 * (dict->count + 1) > dict->size) {
+			if (DictResize(dict, 2 * dict->size) < 0)
 				XLAL_ERROR(XLAL_EFUNC);
-			if (entry != this) { /* relink */
-				if (prev == NULL) /* head is moved */
-					dict->hashes[hashidx] = entry;
-				else
-					prev->next = entry;
-			}
-			entry = XLALDictEntrySetValue(entry, data, size, type);
-
-			if (entry == NULL)
-				XLAL_ERROR(XLAL_EFUNC);
-
-			return 0;
+			i = DictProbeHandle(dict, key);
+			entry = SLOT(dict, i);
 		}
-		prev = this;
-		this = this->next;
+		if (DictEntrySetValue(entry, data, size, type) == NULL)
+			XLAL_ERROR(XLAL_EFUNC);
+		entry->key = key;
+		++dict->count;
+		return 0;
 	}
 
-	/* not found: create new entry */
-	entry = XLALDictEntryAlloc(size);
-	if (entry == NULL)
+	if (DictEntrySetValue(entry, data, size, type) == NULL)
 		XLAL_ERROR(XLAL_EFUNC);
+	return 0;
+}
 
-	entry = XLALDictEntrySetKey(entry, key);
-	if (entry == NULL) {
-		LALFree(entry);
-		XLAL_ERROR(XLAL_EFUNC);
+int XLALDictInsert(LALDict *dict, const char *key, const void *data, size_t size, LALTYPECODE type)
+{
+	UINT8 h = hash(key);
+	size_t i = DictProbeHash(dict, key, h);
+	const LALDictKey *handle = SLOT(dict, i)->key;
+	if (handle == NULL) {
+		handle = DictKeyHandle(key, h);
+		if (handle == NULL)
+			XLAL_ERROR(XLAL_EFUNC);
 	}
+	return DictInsertAt(dict, i, handle, data, size, type);
+}
 
-	entry = XLALDictEntrySetValue(entry, data, size, type);
-	if (entry == NULL) {
-		LALFree(entry);
-		XLAL_ERROR(XLAL_EFUNC);
-	}
+int XLALDictInsertByHandle(LALDict *dict, const LALDictKey *key, const void *data, size_t size, LALTYPECODE type)
+{
+	return DictInsertAt(dict, DictProbeHandle(dict, key), key, data, size, type);
+}
 
-	entry->next = dict->hashes[hashidx];
-	dict->hashes[hashidx] = entry;
-	return 0;
+int XLALDictInsertValueByHandle(LALDict *dict, const LALDictKey *key, const LALValue *value)
+{
+	LALTYPECODE type = XLALValueGetType(value);
+	size_t size = XLALValueGetSize(value);
+	const void * data = XLALValueGetDataPtr(value);
+	return XLALDictInsertByHandle(dict, key, data, size, type);
 }
 
 int XLALDictInsertValue(LALDict *dict, const char *key, const LALValue *value)
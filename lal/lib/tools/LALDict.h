@@ -39,6 +39,10 @@ typedef struct tagLALDictEntry LALDictEntry;
 struct tagLALDict;
 typedef struct tagLALDict LALDict;
 
+/* interned key: see XLALDictKeyHandle() */
+struct tagLALDictKey;
+typedef struct tagLALDictKey LALDictKey;
+
 struct tagLALDictIter {
 	/* private data */
 	struct tagLALDict *dict;
@@ -47,7 +51,21 @@ struct tagLALDictIter {
 };
 typedef struct tagLALDictIter LALDictIter;
 
-void XLALDictEntryFree(LALDictEntry *list);
+/*
+ * Return a handle to the interned key with the given name; the handle is
+ * valid for the lifetime of the process, and is the same for all calls with
+ * the same name.  Dictionary routines taking a key handle look up the key
+ * by comparing pointers, so code which repeatedly looks up the same key
+ * should obtain a handle to it once and use it thereafter.
+ */
+const LALDictKey * XLALDictKeyHandle(const char *key);
+/* warning: shallow pointer */
+const char * XLALDictKeyGetName(const LALDictKey *key);
+
+/* entries owned by a dictionary (e.g. returned by XLALDictLookup()) are
+ * invalidated by inserting new keys into or removing keys from it; the
+ * following entry routines are only for entries outside a dictionary */
+void XLALDictEntryFree(LALDictEntry *entry);
 LALDictEntry * XLALDictEntryAlloc(size_t size);
 LALDictEntry * XLALDictEntryRealloc(LALDictEntry *entry, size_t size);
 LALDictEntry * XLALDictEntrySetKey(LALDictEntry *entry, const char *key);
@@ -71,10 +89,13 @@ LALList * XLALDictKeys(const LALDict *dict);
 LALList * XLALDictValues(const LALDict *dict);
 
 int XLALDictContains(const LALDict *dict, const char *key);
+int XLALDictContainsHandle(const LALDict *dict, const LALDictKey *key);
 size_t XLALDictSize(const LALDict *dict);
 int XLALDictRemove(LALDict *dict, const char *key);
 int XLALDictInsert(LALDict *dict, const char *key, const void *data, size_t size, LALTYPECODE type);
 int XLALDictInsertValue(LALDict *dict, const char *key, const LALValue *value);
+int XLALDictInsertByHandle(LALDict *dict, const LALDictKey *key, const void *data, size_t size, LALTYPECODE type);
+int XLALDictInsertValueByHandle(LALDict *dict, const LALDictKey *key, const LALValue *value);
 int XLALDictInsertStringValue(LALDict *dict, const char *key, const char *value);
 int XLALDictInsertCHARValue(LALDict *dict, const char *key, CHAR value);
 int XLALDictInsertINT2Value(LALDict *dict, const char *key, INT2 value);
@@ -90,6 +111,7 @@ int XLALDictInsertCOMPLEX8Value(LALDict *dict, const char *key, COMPLEX8 value);
 int XLALDictInsertCOMPLEX16Value(LALDict *dict, const char *key, COMPLEX16 value);
 
 LALDictEntry *XLALDictLookup(LALDict *dict, const char *key);
+LALDictEntry *XLALDictLookupHandle(LALDict *dict, const LALDictKey *key);
 /* warning: shallow pointer */
 const char * XLALDictLookupStringValue(LALDict *dict, const char *key);
 CHAR XLALDictLookupCHARValue(LALDict *dict, const char *key);
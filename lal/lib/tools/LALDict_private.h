@@ -0,0 +1,29 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#ifndef _LAL_DICT_PRIVATE_H
+#define _LAL_DICT_PRIVATE_H
+/*
+ * Free all interned keys.  This invalidates every key handle, including
+ * those cached in static variables by library code, so it is not part of
+ * the public interface; it is only for tests, and must only be called when
+ * no dictionaries or key handles remain in use.
+ */
+void XLALClearDictKeyTable(void);
+#endif /* _LAL_DICT_PRIVATE_H */
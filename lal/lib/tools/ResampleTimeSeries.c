@@ -18,6 +18,7 @@
 */
 
 #include <math.h>
+#include <string.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALStdio.h>
 #include <lal/AVFactories.h>
@@ -25,6 +26,9 @@
 #include <lal/IIRFilter.h>
 #include <lal/BandPassTimeSeries.h>
 #include <lal/ResampleTimeSeries.h>
+#include <lal/Sequence.h>
+#include <lal/Window.h>
+#include <lal/VectorMath.h>
 
 #if __GNUC__
 #define UNUSED __attribute__ ((unused))
@@ -118,9 +122,334 @@
  * LDAS. See the LDAS dataconditioning API documentation for more information.
  * </ol>
  *
+ * ### Rational resampling ###
+ *
+ * XLALResampleREAL8TimeSeries() also resamples by factors which are not
+ * integer powers of two, including upsampling and non-integer ratios such as
+ * 16384 Hz to 3000 Hz, using a polyphase FIR resampler. The ratio of the
+ * output to the input sample rate is written as \f$L/M\f$ with coprime
+ * integers \f$L, M \le 65536\f$. Conceptually the input is upsampled by
+ * \f$L\f$ by inserting zeros, low pass filtered, and decimated by \f$M\f$;
+ * the polyphase form computes only the output samples which are kept, each
+ * as a dot product (using XLALVectorDotProductREAL8()) of the input with one
+ * of \f$L\f$ sub-filters, so the cost is proportional to the number of
+ * output samples times the sub-filter length.
+ *
+ * The low pass filter is a Kaiser-windowed sinc with 100 dB stopband
+ * attenuation, spanning \f$Z\f$ zero crossings on each side of the sinc
+ * at the lower of the input and output Nyquist frequencies; the stopband
+ * starts at that Nyquist frequency. XLALResampleREAL8TimeSeries() uses
+ * \f$Z = 32\f$, for which the transition band is the top \f$\sim 20\%\f$
+ * of the output band, and compensates for the delay of the filter so that
+ * <em>there is no time shift in the output time series</em>; the first and
+ * last \f$Z\f$ samples (at the lower sample rate) are corrupted.
+ *
+ * The polyphase resampler can also be used directly on a stream of data
+ * which arrives in blocks: create it with XLALREAL8PolyphaseResamplerCreate(),
+ * and pass each block of input to XLALREAL8PolyphaseResamplerApply(), which
+ * keeps the filter history and phase between calls, so that the output is the
+ * same as if all of the data were resampled at once.
+ * XLALREAL8PolyphaseResamplerOutputLength() gives the number of output samples
+ * produced by the next block. The output of the streaming resampler is
+ * causal, i.e. delayed by XLALREAL8PolyphaseResamplerDelay() input samples.
+ *
  */
 /** @{ */
 
+/* number of zero crossings on each side of the sinc used by XLALResampleREAL8TimeSeries() */
+#define POLYPHASE_ZERO_CROSSINGS 32
+
+/* stopband attenuation of the polyphase resampler low pass filter, in dB */
+#define POLYPHASE_ATTENUATION 100.0
+
+/* largest upsampling or downsampling factor of the polyphase resampler */
+#define POLYPHASE_MAX_FACTOR 65536
+
+struct tagLALREAL8PolyphaseResampler {
+  UINT4 up;		/* upsampling factor L */
+  UINT4 down;		/* downsampling factor M */
+  UINT4 delay;		/* delay of the filter, in samples at the upsampled rate */
+  UINT4 ntaps;		/* number of taps of each sub-filter */
+  REAL8 *taps;		/* L sub-filters of ntaps taps each, in time-reversed order */
+  UINT4 phase;		/* sub-filter of the next output sample */
+  size_t next;		/* index in buffer of the oldest input sample used by the next output sample */
+  REAL8 *buffer;	/* last ntaps - 1 input samples, followed by the current block of input */
+  size_t buflen;	/* allocated length of buffer */
+};
+
+static UINT4 gcd( UINT4 a, UINT4 b )
+{
+  while ( b ) {
+    UINT4 t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+/**
+ * Creates a polyphase FIR resampler which changes the sample rate of a
+ * stream of data by the rational factor \c up / \c down. The anti-aliasing
+ * (or, for upsampling, anti-imaging) low pass filter is a Kaiser-windowed
+ * sinc spanning \c zeroCrossings zero crossings on each side; larger values
+ * give a sharper filter at a proportionally higher cost. Free with
+ * XLALREAL8PolyphaseResamplerDestroy().
+ */
+LALREAL8PolyphaseResampler *XLALREAL8PolyphaseResamplerCreate( UINT4 up, UINT4 down, UINT4 zeroCrossings )
+{
+  LALREAL8PolyphaseResampler *resampler;
+  REAL8Window *window;
+  UINT4 maxFactor, length, g, p, k;
+  REAL8 beta, transition, fc, sum;
+
+  XLAL_CHECK_NULL( up > 0 && up <= POLYPHASE_MAX_FACTOR, XLAL_EINVAL, "Invalid upsampling factor %u", up );
+  XLAL_CHECK_NULL( down > 0 && down <= POLYPHASE_MAX_FACTOR, XLAL_EINVAL, "Invalid downsampling factor %u", down );
+  XLAL_CHECK_NULL( zeroCrossings > 0 && zeroCrossings <= 1024, XLAL_EINVAL, "Invalid number of zero crossings %u", zeroCrossings );
+
+  /* reduce the resampling ratio */
+  g = gcd( up, down );
+  up /= g;
+  down /= g;
+
+  /* design the prototype filter at the upsampled rate; its cutoff is
+   * placed such that the stopband starts at the lower of the input and
+   * output Nyquist frequencies, using the Kaiser window design formulae */
+  maxFactor = up > down ? up : down;
+  length = 2 * zeroCrossings * maxFactor + 1;
+  beta = 0.1102 * ( POLYPHASE_ATTENUATION - 8.7 );
+  transition = ( POLYPHASE_ATTENUATION - 8.0 ) / ( 2.285 * LAL_TWOPI * ( length - 1 ) );
+  fc = 0.5 / maxFactor - 0.5 * transition;
+  XLAL_CHECK_NULL( fc > 0, XLAL_EINVAL, "Too few zero crossings %u", zeroCrossings );
+
+  window = XLALCreateKaiserREAL8Window( length, beta );
+  XLAL_CHECK_NULL( window != NULL, XLAL_EFUNC );
+
+  resampler = XLALCalloc( 1, sizeof( *resampler ) );
+  if ( !resampler ) {
+    XLALDestroyREAL8Window( window );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+  resampler->up = up;
+  resampler->down = down;
+  resampler->delay = zeroCrossings * maxFactor;
+  resampler->ntaps = ( length + up - 1 ) / up;
+  resampler->taps = XLALCalloc( (size_t) up * resampler->ntaps, sizeof( *resampler->taps ) );
+  if ( !resampler->taps ) {
+    XLALDestroyREAL8Window( window );
+    XLALREAL8PolyphaseResamplerDestroy( resampler );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+
+  /* split the filter into sub-filters: the output sample at upsampled time
+   * t = p (mod L) is sum_k h[p + k L] x[(t - p) / L - k], so store sub-filter
+   * p in time-reversed order to give a dot product with contiguous input */
+  sum = 0;
+  for ( p = 0; p < up; ++p ) {
+    for ( k = 0; k < resampler->ntaps; ++k ) {
+      const UINT4 n = p + ( resampler->ntaps - 1 - k ) * up;
+      if ( n < length ) {
+        const REAL8 x = (REAL8) n - (REAL8) resampler->delay;
+        const REAL8 h = ( x == 0 ? 2.0 * fc : sin( LAL_TWOPI * fc * x ) / ( LAL_PI * x ) ) * window->data->data[n];
+        resampler->taps[p * resampler->ntaps + k] = h;
+        sum += h;
+      }
+    }
+  }
+  XLALDestroyREAL8Window( window );
+
+  /* normalise to unit gain at zero frequency, including the factor of L
+   * lost by zero-stuffing when upsampling */
+  for ( k = 0; k < up * resampler->ntaps; ++k ) {
+    resampler->taps[k] *= up / sum;
+  }
+
+  if ( XLALREAL8PolyphaseResamplerReset( resampler ) < 0 ) {
+    XLALREAL8PolyphaseResamplerDestroy( resampler );
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+
+  return resampler;
+}
+
+/** Frees a polyphase FIR resampler created by XLALREAL8PolyphaseResamplerCreate(). */
+void XLALREAL8PolyphaseResamplerDestroy( LALREAL8PolyphaseResampler *resampler )
+{
+  if ( resampler ) {
+    XLALFree( resampler->taps );
+    XLALFree( resampler->buffer );
+    XLALFree( resampler );
+  }
+}
+
+/**
+ * Resets a polyphase FIR resampler to its initial state, i.e. as if the
+ * stream were preceded by zeros, so that it can be used on a new stream.
+ */
+int XLALREAL8PolyphaseResamplerReset( LALREAL8PolyphaseResampler *resampler )
+{
+  XLAL_CHECK( resampler != NULL, XLAL_EFAULT );
+  resampler->phase = 0;
+  resampler->next = 0;
+  if ( resampler->buflen < resampler->ntaps - 1 ) {
+    XLALFree( resampler->buffer );
+    resampler->buflen = 0;
+    resampler->buffer = XLALMalloc( ( resampler->ntaps - 1 ) * sizeof( *resampler->buffer ) );
+    XLAL_CHECK( resampler->buffer != NULL || resampler->ntaps == 1, XLAL_ENOMEM );
+    resampler->buflen = resampler->ntaps - 1;
+  }
+  if ( resampler->ntaps > 1 ) {
+    memset( resampler->buffer, 0, ( resampler->ntaps - 1 ) * sizeof( *resampler->buffer ) );
+  }
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Returns the delay of the output of a polyphase FIR resampler, in units of
+ * input samples, i.e. the output sample at time \f$t\f$ is the resampled
+ * input at time \f$t - \text{delay} \times \Delta t_{\rm in}\f$.
+ */
+REAL8 XLALREAL8PolyphaseResamplerDelay( const LALREAL8PolyphaseResampler *resampler )
+{
+  XLAL_CHECK_REAL8( resampler != NULL, XLAL_EFAULT );
+  return (REAL8) resampler->delay / resampler->up;
+}
+
+/**
+ * Returns the number of output samples which XLALREAL8PolyphaseResamplerApply()
+ * will produce from the next \c length input samples.
+ */
+size_t XLALREAL8PolyphaseResamplerOutputLength( const LALREAL8PolyphaseResampler *resampler, size_t length )
+{
+  XLAL_CHECK_VAL( 0, resampler != NULL, XLAL_EFAULT );
+  /* output samples j = 0, 1, ... use input samples up to index
+   * next + (phase + j M) / L, which must be less than length */
+  if ( resampler->next >= length ) {
+    return 0;
+  }
+  return ( ( length - resampler->next ) * resampler->up - resampler->phase + resampler->down - 1 ) / resampler->down;
+}
+
+/**
+ * Resamples the next block of a stream of data. The length of \c output
+ * must equal XLALREAL8PolyphaseResamplerOutputLength() of the length of
+ * \c input. The resampler keeps the input samples and filter phase needed to
+ * continue with the next block, so that the blocks may be of any length.
+ */
+int XLALREAL8PolyphaseResamplerApply( LALREAL8PolyphaseResampler *resampler, REAL8Sequence *output, const REAL8Sequence *input )
+{
+  const UINT4 history = resampler ? resampler->ntaps - 1 : 0;
+  size_t j;
+
+  XLAL_CHECK( resampler != NULL, XLAL_EFAULT );
+  XLAL_CHECK( output != NULL && input != NULL, XLAL_EFAULT );
+  XLAL_CHECK( output->length == XLALREAL8PolyphaseResamplerOutputLength( resampler, input->length ), XLAL_EBADLEN, "Output length %u does not match expected length %zu", output->length, XLALREAL8PolyphaseResamplerOutputLength( resampler, input->length ) );
+
+  /* append the input to the history */
+  if ( resampler->buflen < history + input->length ) {
+    REAL8 *buffer = XLALRealloc( resampler->buffer, ( history + input->length ) * sizeof( *buffer ) );
+    XLAL_CHECK( buffer != NULL, XLAL_ENOMEM );
+    resampler->buffer = buffer;
+    resampler->buflen = history + input->length;
+  }
+  memcpy( resampler->buffer + history, input->data, input->length * sizeof( *input->data ) );
+
+  /* compute the output samples */
+  for ( j = 0; j < output->length; ++j ) {
+    XLAL_CHECK( XLALVectorDotProductREAL8( &output->data[j], resampler->taps + (size_t) resampler->phase * resampler->ntaps, resampler->buffer + resampler->next, resampler->ntaps ) == XLAL_SUCCESS, XLAL_EFUNC );
+    resampler->phase += resampler->down;
+    resampler->next += resampler->phase / resampler->up;
+    resampler->phase %= resampler->up;
+  }
+
+  /* keep the last ntaps - 1 input samples */
+  memmove( resampler->buffer, resampler->buffer + input->length, history * sizeof( *resampler->buffer ) );
+  resampler->next -= input->length;
+
+  return XLAL_SUCCESS;
+}
+
+/*
+ * Finds coprime integers up, down <= POLYPHASE_MAX_FACTOR such that
+ * up / down = ratio, using the continued fraction expansion of ratio
+ */
+static int PolyphaseRatio( UINT4 *up, UINT4 *down, REAL8 ratio )
+{
+  REAL8 h0 = 0, h1 = 1, k0 = 1, k1 = 0;
+  REAL8 y = ratio;
+  int i;
+
+  for ( i = 0; i < 64 && isfinite( y ); ++i ) {
+    const REAL8 a = floor( y );
+    const REAL8 h = a * h1 + h0;
+    const REAL8 k = a * k1 + k0;
+    if ( h > POLYPHASE_MAX_FACTOR || k > POLYPHASE_MAX_FACTOR )
+      break;
+    h0 = h1;
+    h1 = h;
+    k0 = k1;
+    k1 = k;
+    if ( h > 0 && fabs( h / k - ratio ) <= 1e-10 * ratio ) {
+      *up = h;
+      *down = k;
+      return 0;
+    }
+    y = 1.0 / ( y - a );
+  }
+
+  XLAL_ERROR( XLAL_EINVAL, "Resampling ratio %.15g is not a ratio of integers no larger than %d", ratio, POLYPHASE_MAX_FACTOR );
+}
+
+/*
+ * Resamples a time series in place by the factor up / down using the
+ * polyphase resampler, compensating for the delay of its filter
+ */
+static int ResampleREAL8TimeSeriesPolyphase( REAL8TimeSeries *series, UINT4 up, UINT4 down, REAL8 dt )
+{
+  LALREAL8PolyphaseResampler *resampler;
+  REAL8Sequence *input, *output;
+  size_t length, padding;
+
+  resampler = XLALREAL8PolyphaseResamplerCreate( up, down, POLYPHASE_ZERO_CROSSINGS );
+  XLAL_CHECK( resampler != NULL, XLAL_EFUNC );
+  up = resampler->up;
+  down = resampler->down;
+
+  /* start at the centre of the filter, so that the output is not delayed,
+   * and pad the input with zeros to compute the last output samples */
+  resampler->phase = resampler->delay % up;
+  resampler->next = resampler->delay / up;
+  padding = resampler->next + 1;
+  input = XLALCreateREAL8Sequence( series->data->length + padding );
+  if ( !input ) {
+    XLALREAL8PolyphaseResamplerDestroy( resampler );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+  memcpy( input->data, series->data->data, series->data->length * sizeof( *input->data ) );
+  memset( input->data + series->data->length, 0, padding * sizeof( *input->data ) );
+
+  /* output sample j is at time j M / L input samples, which must be less than the input length */
+  length = ( (size_t) series->data->length * up + down - 1 ) / down;
+  output = XLALCreateREAL8Sequence( XLALREAL8PolyphaseResamplerOutputLength( resampler, input->length ) );
+  if ( !output || output->length < length || XLALREAL8PolyphaseResamplerApply( resampler, output, input ) < 0 ) {
+    XLALDestroyREAL8Sequence( input );
+    XLALDestroyREAL8Sequence( output );
+    XLALREAL8PolyphaseResamplerDestroy( resampler );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+  XLALDestroyREAL8Sequence( input );
+  XLALREAL8PolyphaseResamplerDestroy( resampler );
+
+  if ( !XLALShrinkREAL8Sequence( output, 0, length ) ) {
+    XLALDestroyREAL8Sequence( output );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+  XLALDestroyREAL8Sequence( series->data );
+  series->data = output;
+  series->deltaT = dt;
+
+  return 0;
+}
+
 /** \see See \ref ResampleTimeSeries_c for documentation */
 int XLALResampleREAL4TimeSeries( REAL4TimeSeries *series, REAL8 dt )
 {
@@ -179,13 +508,23 @@ int XLALResampleREAL8TimeSeries( REAL8TimeSeries *series, REAL8 dt )
   REAL8 *dataPtr = NULL;
   UINT4 j;
 
+  XLAL_CHECK( series != NULL && series->data != NULL, XLAL_EFAULT );
+  XLAL_CHECK( dt > 0 && series->deltaT > 0, XLAL_EINVAL );
+
   resampleFactor = floor( dt / series->deltaT + 0.5 );
   newNyquistFrequency = 0.5 / dt;
 
-  /* check that the resampling factor is valid */
+  /* resample by a rational factor if not downsampling by an integer */
   if ( resampleFactor < 1 ||
       fabs( dt - resampleFactor * series->deltaT ) > 1e-3 * series->deltaT )
-    XLAL_ERROR( XLAL_EINVAL );
+  {
+    UINT4 up, down;
+    if ( PolyphaseRatio( &up, &down, series->deltaT / dt ) < 0 )
+      XLAL_ERROR( XLAL_EINVAL );
+    if ( ResampleREAL8TimeSeriesPolyphase( series, up, down, dt ) < 0 )
+      XLAL_ERROR( XLAL_EFUNC );
+    return 0;
+  }
 
   /* just return if no resampling is required */
   if ( resampleFactor == 1 )
@@ -194,9 +533,14 @@ int XLALResampleREAL8TimeSeries( REAL8TimeSeries *series, REAL8 dt )
     return 0;
   }
 
-  /* check that we are resampling by a power of two */
+  /* downsample by an integer factor which is not a power of two using
+   * the polyphase resampler */
   if ( resampleFactor & (resampleFactor - 1) )
-    XLAL_ERROR( XLAL_EINVAL );
+  {
+    if ( ResampleREAL8TimeSeriesPolyphase( series, 1, resampleFactor, dt ) < 0 )
+      XLAL_ERROR( XLAL_EFUNC );
+    return 0;
+  }
 
   if ( XLALLowPassREAL8TimeSeries( series, newNyquistFrequency,
         newNyquistAmplitude, filterOrder ) < 0 )
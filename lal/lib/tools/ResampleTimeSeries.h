@@ -36,7 +36,9 @@ extern "C" {
  *
  * \brief Provides routines to resample a time series.
  *
- * At present only integer downsampling of \c REAL4TimeSeries by a power of two is supported.
+ * Integer downsampling of \c REAL4TimeSeries by a power of two is supported, and
+ * \c REAL8TimeSeries may be resampled by any rational factor using a polyphase FIR resampler,
+ * which can also be applied to a stream of data in blocks.
  *
  * ### Synopsis ###
  *
@@ -129,6 +131,11 @@ tagResampleTSParams
 }
 ResampleTSParams;
 
+/**
+ * Opaque polyphase FIR resampler; see XLALREAL8PolyphaseResamplerCreate().
+ */
+typedef struct tagLALREAL8PolyphaseResampler LALREAL8PolyphaseResampler;
+
 /** @} */
 
 /* ---------- Function prototypes ---------- */
@@ -136,6 +143,13 @@ ResampleTSParams;
 int XLALResampleREAL4TimeSeries( REAL4TimeSeries *series, REAL8 dt );
 int XLALResampleREAL8TimeSeries( REAL8TimeSeries *series, REAL8 dt );
 
+LALREAL8PolyphaseResampler *XLALREAL8PolyphaseResamplerCreate( UINT4 up, UINT4 down, UINT4 zeroCrossings );
+void XLALREAL8PolyphaseResamplerDestroy( LALREAL8PolyphaseResampler *resampler );
+int XLALREAL8PolyphaseResamplerReset( LALREAL8PolyphaseResampler *resampler );
+REAL8 XLALREAL8PolyphaseResamplerDelay( const LALREAL8PolyphaseResampler *resampler );
+size_t XLALREAL8PolyphaseResamplerOutputLength( const LALREAL8PolyphaseResampler *resampler, size_t length );
+int XLALREAL8PolyphaseResamplerApply( LALREAL8PolyphaseResampler *resampler, REAL8Sequence *output, const REAL8Sequence *input );
+
 void
 LALResampleREAL4TimeSeries(
     LALStatus          *status,
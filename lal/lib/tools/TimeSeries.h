@@ -24,6 +24,7 @@
 
 #include <stddef.h>
 #include <lal/LALDatatypes.h>
+#include <lal/LALMalloc.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -83,6 +84,40 @@ UINT4TimeSeries *XLALCreateUINT4TimeSeries ( const CHAR *name, const LIGOTimeGPS
 UINT8TimeSeries *XLALCreateUINT8TimeSeries ( const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
 /** @} */
 
+/**
+ * \name Arena Creation Functions
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/TimeSeries.h>
+ *
+ * XLALArenaCreate<timeseriestype>()
+ * \endcode
+ *
+ * ### Description ###
+ *
+ * These functions create LAL time series like their XLALCreate
+ * counterparts, but allocate the series and its data from the arena
+ * allocator \c arena (see \ref LALMalloc_h).  The series must not be
+ * destroyed, resized or shrunk; its memory is released by XLALArenaReset()
+ * or XLALArenaDestroy().
+ */
+/** @{ */
+#ifndef SWIG   /* exclude from SWIG interface */
+COMPLEX8TimeSeries *XLALArenaCreateCOMPLEX8TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+COMPLEX16TimeSeries *XLALArenaCreateCOMPLEX16TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+REAL4TimeSeries *XLALArenaCreateREAL4TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+REAL8TimeSeries *XLALArenaCreateREAL8TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+INT2TimeSeries *XLALArenaCreateINT2TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+INT4TimeSeries *XLALArenaCreateINT4TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+INT8TimeSeries *XLALArenaCreateINT8TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+UINT2TimeSeries *XLALArenaCreateUINT2TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+UINT4TimeSeries *XLALArenaCreateUINT4TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+UINT8TimeSeries *XLALArenaCreateUINT8TimeSeries ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+#endif   /* SWIG */
+/** @} */
+
 /**
  * \name Destruction Functions
  *
@@ -17,6 +17,8 @@
 *  MA  02110-1301  USA
 */
 
+#include <math.h>
+#include <float.h>
 #include <lal/LALAdaptiveRungeKuttaIntegrator.h>
 
 #define XLAL_BEGINGSL \
@@ -401,6 +403,315 @@ int XLALAdaptiveRungeKutta4Hermite(LALAdaptiveRungeKuttaIntegrator * integrator,
     return outputlen;
 }
 
+/* Local function to grow the storage of a dense output to hold at least nsteps steps */
+static int growDenseOutput(LALAdaptiveRungeKuttaDenseOutput * dense, size_t nsteps)
+{
+    size_t dim = dense->dim, size = dense->size;
+    REAL8 *t, *y, *k1, *k6;
+
+    if (nsteps <= size)
+        return XLAL_SUCCESS;
+    while (size < nsteps)
+        size = size ? 2 * size : 64;
+
+    if (!(t = XLALRealloc(dense->t, (size + 1) * sizeof(REAL8))))
+        XLAL_ERROR(XLAL_ENOMEM);
+    dense->t = t;
+    if (!(y = XLALRealloc(dense->y, (size + 1) * dim * sizeof(REAL8))))
+        XLAL_ERROR(XLAL_ENOMEM);
+    dense->y = y;
+    if (!(k1 = XLALRealloc(dense->k1, size * dim * sizeof(REAL8))))
+        XLAL_ERROR(XLAL_ENOMEM);
+    dense->k1 = k1;
+    if (!(k6 = XLALRealloc(dense->k6, size * dim * sizeof(REAL8))))
+        XLAL_ERROR(XLAL_ENOMEM);
+    dense->k6 = k6;
+    dense->size = size;
+
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Fourth-order Runge-Kutta ODE integrator using Runge-Kutta-Fehlberg (RKF45)
+ * steps with adaptive step size control, which records a continuous
+ * extension of the solution instead of sampling it.
+ *
+ * The system is evolved exactly as by XLALAdaptiveRungeKutta4Hermite(), but
+ * for each integration step the states at either end of the step and the
+ * derivatives needed by the same "on-the-fly" interpolating polynomial are
+ * stored in \c dense.  The solution can then be evaluated at arbitrary times
+ * within the integration range with XLALAdaptiveRungeKuttaDenseOutputEval(),
+ * or sampled at any regular interval with
+ * XLALAdaptiveRungeKuttaDenseOutputEvalUniform(), without integrating the
+ * system again or setting up splines.  The integration steps themselves (the
+ * sparse output) are available in the \c t and \c y fields of \c dense.
+ *
+ * The integrator must have been created by XLALAdaptiveRungeKutta4Init().
+ * Returns the number of integration steps taken.
+ */
+int XLALAdaptiveRungeKutta4Dense(LALAdaptiveRungeKuttaIntegrator * integrator,  /**< struct holding dydt, stopping test, stepper, etc. */
+    void *params,                                                       /**< params struct used to compute dydt and stopping test */
+    REAL8 * yinit,                                                      /**< pass in initial values of all variables - overwritten to final values */
+    REAL8 tinit,                                                        /**< integration start time */
+    REAL8 tend_in,                                                      /**< maximum integration time */
+    REAL8 h0,                                                           /**< initial step size to be tried */
+    LALAdaptiveRungeKuttaDenseOutput ** dense                           /**< continuous extension of the solution */
+    )
+{
+    int errnum = 0;
+    int status;
+    size_t dim, retries, nsteps = 0;
+
+    LALAdaptiveRungeKuttaDenseOutput *output = NULL;
+
+    REAL8 t, h;
+
+    REAL8 tend = tend_in;
+
+    XLAL_CHECK(integrator != NULL, XLAL_EFAULT);
+    XLAL_CHECK(yinit != NULL, XLAL_EFAULT);
+    XLAL_CHECK(dense != NULL, XLAL_EFAULT);
+    XLAL_CHECK(integrator->step->type == gsl_odeiv_step_rkf45, XLAL_EINVAL, "Dense output requires a Runge-Kutta-Fehlberg (RKF45) integrator");
+    XLAL_CHECK((tend_in - tinit) * h0 > 0, XLAL_EINVAL, "(tend_in - tinit) and h0 must be nonzero and have the same sign");
+
+    XLAL_BEGINGSL;
+
+    /* If want to stop only on test, then tend = +/-infinity; otherwise
+     * tend_in */
+    if (integrator->stopontestonly) {
+        if (tend < tinit)
+            tend = -1.0 / 0.0;
+        else
+            tend = 1.0 / 0.0;
+    }
+
+    dim = integrator->sys->dimension;
+
+    if (!(output = XLALCalloc(1, sizeof(*output)))) {
+        errnum = XLAL_ENOMEM;
+        goto bail_out;
+    }
+    output->dim = dim;
+    if (growDenseOutput(output, 1) != XLAL_SUCCESS) {
+        errnum = XLAL_ENOMEM;
+        goto bail_out;
+    }
+
+    /* Setup. */
+    integrator->sys->params = params;
+    integrator->returncode = 0;
+    retries = integrator->retries;
+    t = tinit;
+    h = h0;
+
+    /* Copy over the initial state. */
+    output->t[0] = tinit;
+    memcpy(output->y, yinit, dim * sizeof(REAL8));
+
+    /* We are starting a fresh integration; clear GSL step and evolve
+     * objects. */
+    gsl_odeiv_step_reset(integrator->step);
+    gsl_odeiv_evolve_reset(integrator->evolve);
+
+    /* Enter evolution loop.  NOTE: we *always* take at least one
+     * step. */
+    while (1) {
+        status =
+            gsl_odeiv_evolve_apply(integrator->evolve, integrator->control, integrator->step, integrator->sys, &t, tend, &h,
+            yinit);
+
+        /* Check for failure, retry if haven't retried too many times
+         * already. */
+        if (status != GSL_SUCCESS) {
+            if (retries--) {
+                /* Retries to spare; reduce h, try again. */
+                h /= 10.0;
+                continue;
+            } else {
+                /* Out of retries, bail with status code. */
+                integrator->returncode = status;
+                break;
+            }
+        } else {
+            /* Successful step, reset retry counter. */
+            retries = integrator->retries;
+        }
+
+        /* Record the step, with the k's from the integrator state. */
+        if (growDenseOutput(output, nsteps + 1) != XLAL_SUCCESS) {
+            errnum = XLAL_ENOMEM;
+            goto bail_out;
+        }
+        {
+            rkf45_state_t *rkfState = integrator->step->state;
+            memcpy(&output->k1[nsteps * dim], rkfState->k1, dim * sizeof(REAL8));
+            memcpy(&output->k6[nsteps * dim], rkfState->k6, dim * sizeof(REAL8));
+        }
+        nsteps++;
+        output->t[nsteps] = t;
+        memcpy(&output->y[nsteps * dim], yinit, dim * sizeof(REAL8));
+        output->length = nsteps;
+
+        /* Check for termination criteria. */
+        if (!integrator->stopontestonly && t >= tend)
+            break;
+
+        /* If there is a stopping function in integrator, call it with the
+         * last value of y and dydt from the integrator. */
+        if (integrator->stop) {
+            if ((status = integrator->stop(t, yinit, integrator->evolve->dydt_out, params)) != GSL_SUCCESS) {
+                integrator->returncode = status;
+                break;
+            }
+        }
+    }
+
+  bail_out:
+
+    XLAL_ENDGSL;
+
+    if (errnum) {
+        XLALDestroyAdaptiveRungeKuttaDenseOutput(output);
+        *dense = NULL;
+        XLAL_ERROR(errnum);
+    }
+
+    *dense = output;
+    return nsteps;
+}
+
+/**
+ * Destroy a continuous extension created by XLALAdaptiveRungeKutta4Dense().
+ */
+void XLALDestroyAdaptiveRungeKuttaDenseOutput(LALAdaptiveRungeKuttaDenseOutput * dense)
+{
+    if (!dense)
+        return;
+
+    XLALFree(dense->t);
+    XLALFree(dense->y);
+    XLALFree(dense->k1);
+    XLALFree(dense->k6);
+    XLALFree(dense);
+
+    return;
+}
+
+/* Local function to evaluate the interpolating polynomial of step j at time t */
+static void evalDenseOutputStep(REAL8 * y, const LALAdaptiveRungeKuttaDenseOutput * dense, size_t j, REAL8 t)
+{
+    const size_t dim = dense->dim;
+    const REAL8 *y0 = &dense->y[j * dim];
+    const REAL8 *y1 = &dense->y[(j + 1) * dim];
+    const REAL8 *k1 = &dense->k1[j * dim];
+    const REAL8 *k6 = &dense->k6[j * dim];
+    size_t i;
+
+    /* t = t0 + h*theta, 0 <= theta <= 1; these are the interpolating
+     * coefficients used by XLALAdaptiveRungeKutta4Hermite() */
+    REAL8 h = dense->t[j + 1] - dense->t[j];
+    REAL8 theta = (t - dense->t[j]) / h;
+    REAL8 i0 = 1.0 + theta * theta * (3.0 - 4.0 * theta);
+    REAL8 i1 = -theta * (theta - 1.0);
+    REAL8 i6 = -4.0 * theta * theta * (theta - 1.0);
+    REAL8 iend = theta * theta * (4.0 * theta - 3.0);
+
+    for (i = 0; i < dim; i++) {
+        y[i] = i0 * y0[i] + iend * y1[i] + h * i1 * k1[i] + h * i6 * k6[i];
+    }
+}
+
+/* Local function to check if time t lies before the end of step j, in the direction of integration */
+static int beforeDenseOutputStepEnd(const LALAdaptiveRungeKuttaDenseOutput * dense, size_t j, REAL8 t)
+{
+    if (dense->t[dense->length] >= dense->t[0])
+        return t <= dense->t[j + 1];
+    else
+        return t >= dense->t[j + 1];
+}
+
+/**
+ * Evaluate the continuous extension of a solution computed by
+ * XLALAdaptiveRungeKutta4Dense() at the time \c t, which must lie within the
+ * integration range.  The \c dim values of the variables are stored in \c y.
+ */
+int XLALAdaptiveRungeKuttaDenseOutputEval(REAL8 * y, const LALAdaptiveRungeKuttaDenseOutput * dense, REAL8 t)
+{
+    size_t lo, hi;
+
+    XLAL_CHECK(y != NULL, XLAL_EFAULT);
+    XLAL_CHECK(dense != NULL, XLAL_EFAULT);
+    XLAL_CHECK(dense->length > 0, XLAL_EINVAL, "Dense output contains no integration steps");
+    XLAL_CHECK((t - dense->t[0]) * (t - dense->t[dense->length]) <= 0, XLAL_EDOM, "Time %g is outside of integration range [%g, %g]", t, dense->t[0], dense->t[dense->length]);
+
+    /* bisect to find the step containing t */
+    lo = 0;
+    hi = dense->length - 1;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (beforeDenseOutputStepEnd(dense, mid, t))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    evalDenseOutputStep(y, dense, lo, t);
+
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Sample the continuous extension of a solution computed by
+ * XLALAdaptiveRungeKutta4Dense() at \c length regular intervals \c deltat
+ * starting from the time \c tstart, all of which must lie within the
+ * integration range.  If \c length is zero, samples are taken up to the end of
+ * the integration range.  The output has the same format as returned by
+ * XLALAdaptiveRungeKutta4Hermite(): a (dim + 1) x length array holding the
+ * times, followed by the values of each variable.
+ */
+REAL8Array *XLALAdaptiveRungeKuttaDenseOutputEvalUniform(const LALAdaptiveRungeKuttaDenseOutput * dense, REAL8 tstart, REAL8 deltat, size_t length)
+{
+    REAL8Array *output;
+    REAL8 *ytemp;
+    size_t dim, i, j, k;
+
+    XLAL_CHECK_NULL(dense != NULL, XLAL_EFAULT);
+    XLAL_CHECK_NULL(dense->length > 0, XLAL_EINVAL, "Dense output contains no integration steps");
+    XLAL_CHECK_NULL((dense->t[dense->length] - dense->t[0]) * deltat > 0, XLAL_EINVAL, "deltat must be nonzero and in the direction of integration");
+    XLAL_CHECK_NULL((tstart - dense->t[0]) * (tstart - dense->t[dense->length]) <= 0, XLAL_EDOM, "Start time %g is outside of integration range [%g, %g]", tstart, dense->t[0], dense->t[dense->length]);
+
+    if (length == 0) {
+        length = ((size_t) ((dense->t[dense->length] - tstart) / deltat)) + 1;
+    } else {
+        REAL8 tstop = tstart + (length - 1) * deltat;
+        XLAL_CHECK_NULL((tstop - dense->t[0]) * (tstop - dense->t[dense->length]) <= 0, XLAL_EDOM, "End time %g is outside of integration range [%g, %g]", tstop, dense->t[0], dense->t[dense->length]);
+    }
+
+    dim = dense->dim;
+    output = XLALCreateREAL8ArrayL(2, dim + 1, length);
+    ytemp = XLALMalloc(dim * sizeof(REAL8));
+    if (!output || !ytemp) {
+        XLALDestroyREAL8Array(output);
+        XLALFree(ytemp);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    /* sample times increase monotonically, so walk through the steps */
+    for (j = 0, k = 0; j < length; j++) {
+        REAL8 t = tstart + j * deltat;
+        while (k + 1 < dense->length && !beforeDenseOutputStepEnd(dense, k, t))
+            k++;
+        evalDenseOutputStep(ytemp, dense, k, t);
+        output->data[j] = t;
+        for (i = 0; i < dim; i++)
+            output->data[(i + 1) * length + j] = ytemp[i];
+    }
+
+    XLALFree(ytemp);
+
+    return output;
+}
+
 int XLALAdaptiveRungeKutta4NoInterpolate(LALAdaptiveRungeKuttaIntegrator * integrator,
          void * params, REAL8 * yinit, REAL8 tinit, REAL8 tend, REAL8 deltat_or_h0, REAL8 min_deltat_or_h0,
 					 REAL8Array ** t_and_y_out, INT4 EOBversion)
@@ -1341,3 +1652,492 @@ int XLALAdaptiveRungeKutta4IrregularIntervals(LALAdaptiveRungeKuttaIntegrator *
     *yout = output;
     return outputlen;
 }
+
+/* Runge-Kutta-Fehlberg coefficients, as in GSL rkf45.c */
+static const double rkf45_ah[] = { 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0 };
+static const double rkf45_b3[] = { 3.0 / 32.0, 9.0 / 32.0 };
+static const double rkf45_b4[] = { 1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0 };
+static const double rkf45_b5[] = { 8341.0 / 4104.0, -32832.0 / 4104.0, 29440.0 / 4104.0, -845.0 / 4104.0 };
+static const double rkf45_b6[] = { -6080.0 / 20520.0, 41040.0 / 20520.0, -28352.0 / 20520.0, 9295.0 / 20520.0, -5643.0 / 20520.0 };
+static const double rkf45_c1 = 902880.0 / 7618050.0;
+static const double rkf45_c3 = 3953664.0 / 7618050.0;
+static const double rkf45_c4 = 3855735.0 / 7618050.0;
+static const double rkf45_c5 = -1371249.0 / 7618050.0;
+static const double rkf45_c6 = 277020.0 / 7618050.0;
+static const double rkf45_ec[] = { 0.0, 1.0 / 360.0, 0.0, -128.0 / 4275.0, -2197.0 / 75240.0, 1.0 / 50.0, 2.0 / 55.0 };
+
+/* number of REAL8 and int per-system workspace elements used by XLALAdaptiveRungeKutta4HermiteBatch() */
+#define BATCH_NUM_STATES 10
+#define BATCH_NUM_REAL8 6
+#define BATCH_NUM_INT 7
+
+/**
+ * Allocate an integrator for XLALAdaptiveRungeKutta4HermiteBatch(), which
+ * evolves \c nlanes independent systems of \c dim coupled first-order
+ * differential equations in lock-step.
+ *
+ * The derivative function \c dydt and stopping test \c stop are called once
+ * for all systems at a time.  State vectors are stored in structure-of-arrays
+ * layout, i.e. component \c i of system \c l is element <tt>i * nlanes + l</tt>
+ * of \c y and \c dydt, and \c t contains the time of each system.  Only the
+ * systems for which <tt>active[l]</tt> is nonzero need to be computed; for
+ * these systems, the functions must set <tt>status[l]</tt> to \c GSL_SUCCESS,
+ * or to an error code as returned by the functions used with
+ * XLALAdaptiveRungeKutta4Init(), and must not modify the other elements of
+ * \c status.  A nonzero return value from either function aborts the whole
+ * integration.
+ */
+LALAdaptiveRungeKuttaBatchIntegrator *XLALAdaptiveRungeKutta4BatchInit(int dim, size_t nlanes,
+    int (*dydt) (size_t nlanes, const double t[], const double y[], double dydt[], const int active[], int status[], void *params),
+    int (*stop) (size_t nlanes, const double t[], const double y[], const double dydt[], const int active[], int status[], void *params),
+    double eps_abs, double eps_rel)
+{
+    LALAdaptiveRungeKuttaBatchIntegrator *integrator;
+
+    XLAL_CHECK_NULL(dim > 0, XLAL_EINVAL);
+    XLAL_CHECK_NULL(nlanes > 0, XLAL_EINVAL);
+    XLAL_CHECK_NULL(dydt != NULL, XLAL_EFAULT);
+
+    /* allocate our custom integrator structure */
+    if (!(integrator = (LALAdaptiveRungeKuttaBatchIntegrator *) LALCalloc(1, sizeof(LALAdaptiveRungeKuttaBatchIntegrator)))) {
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    /* allocate the workspace */
+    integrator->work = LALCalloc((BATCH_NUM_STATES * dim + BATCH_NUM_REAL8) * nlanes + dim, sizeof(REAL8));
+    integrator->iwork = LALCalloc(BATCH_NUM_INT * nlanes, sizeof(int));
+    integrator->returncode = LALCalloc(nlanes, sizeof(int));
+
+    /* if something failed to be allocated, bail out */
+    if (!(integrator->work) || !(integrator->iwork) || !(integrator->returncode)) {
+        XLALAdaptiveRungeKuttaBatchFree(integrator);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    integrator->dim = dim;
+    integrator->nlanes = nlanes;
+
+    integrator->dydt = dydt;
+    integrator->stop = stop;
+
+    integrator->eps_abs = eps_abs;
+    integrator->eps_rel = eps_rel;
+
+    integrator->retries = 6;
+    integrator->stopontestonly = 0;
+
+    return integrator;
+}
+
+void XLALAdaptiveRungeKuttaBatchFree(LALAdaptiveRungeKuttaBatchIntegrator * integrator)
+{
+    if (!integrator)
+        return;
+
+    LALFree(integrator->work);
+    LALFree(integrator->iwork);
+    LALFree(integrator->returncode);
+    LALFree(integrator);
+
+    return;
+}
+
+/* Local function to evaluate the derivatives of all trying systems, and drop those which fail */
+static int batchEvalDerivs(LALAdaptiveRungeKuttaBatchIntegrator * integrator, const REAL8 * t, const REAL8 * y, REAL8 * dydt,
+    int *trying, int *status, void *params)
+{
+    size_t l;
+
+    if (integrator->dydt(integrator->nlanes, t, y, dydt, trying, status, params) != 0) {
+        return XLAL_EFUNC;
+    }
+    for (l = 0; l < integrator->nlanes; l++) {
+        if (trying[l] && status[l] != GSL_SUCCESS)
+            trying[l] = 0;
+    }
+
+    return GSL_SUCCESS;
+}
+
+/**
+ * Fourth-order Runge-Kutta ODE integrator using Runge-Kutta-Fehlberg (RKF45)
+ * steps with adaptive step size control, which evolves many independent
+ * systems in lock-step.  Intended for generating many time-domain waveforms
+ * at once, e.g. for template banks and injections.
+ *
+ * Each system is evolved exactly as by XLALAdaptiveRungeKutta4Hermite(), with
+ * its own step size control, retries and termination, and its output is
+ * interpolated at regular intervals \c deltat in-between integration steps.
+ * At every lock-step iteration, each system which has not yet terminated
+ * either takes a step or retries with a smaller step size.  The derivatives
+ * of all systems are computed with a single call to the integrator's
+ * derivative function, and the stages of the integration are computed over
+ * structure-of-arrays state vectors, with the loops over systems innermost so
+ * that they can be vectorised.  Systems which terminate early are masked out
+ * of subsequent calls to the derivative and stopping functions.
+ *
+ * The initial values \c yinit of all systems are in structure-of-arrays layout
+ * (see XLALAdaptiveRungeKutta4BatchInit()), and are overwritten with the final
+ * interpolated values.  On success, <tt>yout[l]</tt> holds the evenly sampled
+ * output of system \c l in the same format as returned by
+ * XLALAdaptiveRungeKutta4Hermite(), and the return code of the system is
+ * stored in <tt>integrator->returncode[l]</tt>.  A system whose step size
+ * would have to be decreased below the resolution of its current time, e.g.
+ * at a singularity, is terminated with return code #XLAL_EFAILED.
+ */
+int XLALAdaptiveRungeKutta4HermiteBatch(LALAdaptiveRungeKuttaBatchIntegrator * integrator,     /**< struct holding dydt, stopping test, workspace, etc. */
+    void *params,                                                       /**< params struct used to compute dydt and stopping test */
+    REAL8 * yinit,                                                      /**< pass in initial values of all variables of all systems - overwritten to final values */
+    REAL8 tinit,                                                        /**< integration start time */
+    REAL8 tend_in,                                                      /**< maximum integration time */
+    REAL8 deltat,                                                       /**< step size for evenly sampled output */
+    REAL8Array ** yout                                                  /**< array of nlanes arrays holding the evenly sampled output */
+    )
+{
+    int errnum = 0;
+    int status;
+    size_t dim, n, nactive, i, l;
+    int outputlen0;
+
+    REAL8 *y = yinit;
+    REAL8 *k1, *k2, *k3, *k4, *k5, *k6, *ytmp, *ynew, *yerr, *dydt_out;
+    REAL8 *t, *h, *h0, *told, *tintp, *tstage, *ytemp;
+    int *active, *trying, *lstatus, *retries, *count, *outputlen, *final;
+
+    REAL8 tend = tend_in;
+
+    XLAL_CHECK(integrator != NULL, XLAL_EFAULT);
+    XLAL_CHECK(yinit != NULL, XLAL_EFAULT);
+    XLAL_CHECK(yout != NULL, XLAL_EFAULT);
+
+    /* If want to stop only on test, then tend = +/-infinity; otherwise
+     * tend_in */
+    if (integrator->stopontestonly) {
+        if (tend < tinit)
+            tend = -1.0 / 0.0;
+        else
+            tend = 1.0 / 0.0;
+    }
+
+    dim = integrator->dim;
+    n = integrator->nlanes;
+
+    /* workspace aliases */
+    k1 = integrator->work;
+    k2 = k1 + dim * n;
+    k3 = k2 + dim * n;
+    k4 = k3 + dim * n;
+    k5 = k4 + dim * n;
+    k6 = k5 + dim * n;
+    ytmp = k6 + dim * n;
+    ynew = ytmp + dim * n;
+    yerr = ynew + dim * n;
+    dydt_out = yerr + dim * n;
+    t = dydt_out + dim * n;
+    h = t + n;
+    h0 = h + n;
+    told = h0 + n;
+    tintp = told + n;
+    tstage = tintp + n;
+    ytemp = tstage + n;
+    active = integrator->iwork;
+    trying = active + n;
+    lstatus = trying + n;
+    retries = lstatus + n;
+    count = retries + n;
+    outputlen = count + n;
+    final = outputlen + n;
+
+    for (l = 0; l < n; l++)
+        yout[l] = NULL;
+
+    outputlen0 = ((int)(tend_in - tinit) / deltat);
+    if (outputlen0 < 0) {
+        XLALPrintError
+            ("XLAL Error - %s: (tend_in - tinit) and deltat must have the same sign\ntend_in: %f, tinit: %f, deltat: %f\n",
+            __func__, tend_in, tinit, deltat);
+        errnum = XLAL_EINVAL;
+        goto bail_out;
+    }
+    outputlen0 += 2;
+
+    /* Setup, and copy over first step. */
+    for (l = 0; l < n; l++) {
+        yout[l] = XLALCreateREAL8ArrayL(2, (dim + 1), outputlen0);
+        if (!yout[l]) {
+            errnum = XLAL_ENOMEM;
+            goto bail_out;
+        }
+        yout[l]->data[0] = tinit;
+        for (i = 1; i <= dim; i++)
+            yout[l]->data[i * outputlen0] = y[(i - 1) * n + l];
+        outputlen[l] = outputlen0;
+        count[l] = 1;
+        t[l] = tinit;
+        tintp[l] = tinit;
+        h[l] = deltat;
+        retries[l] = integrator->retries;
+        active[l] = 1;
+        lstatus[l] = GSL_SUCCESS;
+        integrator->returncode[l] = 0;
+    }
+
+    /* compute derivatives at the initial time; these are then carried over
+     * from the end of each step to the start of the next */
+    if (batchEvalDerivs(integrator, t, y, k1, active, lstatus, params) != GSL_SUCCESS) {
+        errnum = XLAL_EFUNC;
+        goto bail_out;
+    }
+    nactive = 0;
+    for (l = 0; l < n; l++) {
+        if (!active[l])
+            integrator->returncode[l] = lstatus[l];
+        else
+            nactive++;
+    }
+
+    /* Enter evolution loop, which runs until all systems have terminated */
+    while (nactive > 0) {
+
+        /* Choose step sizes, not stepping beyond the final time; systems
+         * which have terminated take steps of zero size */
+        for (l = 0; l < n; l++) {
+            trying[l] = active[l];
+            final[l] = 0;
+            h0[l] = 0.0;
+            if (active[l]) {
+                REAL8 dt = tend - t[l];
+                h0[l] = h[l];
+                if ((dt >= 0.0 && h0[l] > dt) || (dt < 0.0 && h0[l] < dt)) {
+                    h0[l] = dt;
+                    final[l] = 1;
+                }
+            }
+        }
+
+        /* k2 step */
+        for (i = 0; i < dim * n; i += n)
+            for (l = 0; l < n; l++)
+                ytmp[i + l] = y[i + l] + rkf45_ah[0] * h0[l] * k1[i + l];
+        for (l = 0; l < n; l++)
+            tstage[l] = t[l] + rkf45_ah[0] * h0[l];
+        if (batchEvalDerivs(integrator, tstage, ytmp, k2, trying, lstatus, params) != GSL_SUCCESS) {
+            errnum = XLAL_EFUNC;
+            goto bail_out;
+        }
+
+        /* k3 step */
+        for (i = 0; i < dim * n; i += n)
+            for (l = 0; l < n; l++)
+                ytmp[i + l] = y[i + l] + h0[l] * (rkf45_b3[0] * k1[i + l] + rkf45_b3[1] * k2[i + l]);
+        for (l = 0; l < n; l++)
+            tstage[l] = t[l] + rkf45_ah[1] * h0[l];
+        if (batchEvalDerivs(integrator, tstage, ytmp, k3, trying, lstatus, params) != GSL_SUCCESS) {
+            errnum = XLAL_EFUNC;
+            goto bail_out;
+        }
+
+        /* k4 step */
+        for (i = 0; i < dim * n; i += n)
+            for (l = 0; l < n; l++)
+                ytmp[i + l] = y[i + l] + h0[l] * (rkf45_b4[0] * k1[i + l] + rkf45_b4[1] * k2[i + l] + rkf45_b4[2] * k3[i + l]);
+        for (l = 0; l < n; l++)
+            tstage[l] = t[l] + rkf45_ah[2] * h0[l];
+        if (batchEvalDerivs(integrator, tstage, ytmp, k4, trying, lstatus, params) != GSL_SUCCESS) {
+            errnum = XLAL_EFUNC;
+            goto bail_out;
+        }
+
+        /* k5 step */
+        for (i = 0; i < dim * n; i += n)
+            for (l = 0; l < n; l++)
+                ytmp[i + l] = y[i + l] + h0[l] * (rkf45_b5[0] * k1[i + l] + rkf45_b5[1] * k2[i + l] + rkf45_b5[2] * k3[i + l] + rkf45_b5[3] * k4[i + l]);
+        for (l = 0; l < n; l++)
+            tstage[l] = t[l] + rkf45_ah[3] * h0[l];
+        if (batchEvalDerivs(integrator, tstage, ytmp, k5, trying, lstatus, params) != GSL_SUCCESS) {
+            errnum = XLAL_EFUNC;
+            goto bail_out;
+        }
+
+        /* k6 step */
+        for (i = 0; i < dim * n; i += n)
+            for (l = 0; l < n; l++)
+                ytmp[i + l] = y[i + l] + h0[l] * (rkf45_b6[0] * k1[i + l] + rkf45_b6[1] * k2[i + l] + rkf45_b6[2] * k3[i + l] + rkf45_b6[3] * k4[i + l] + rkf45_b6[4] * k5[i + l]);
+        for (l = 0; l < n; l++)
+            tstage[l] = t[l] + rkf45_ah[4] * h0[l];
+        if (batchEvalDerivs(integrator, tstage, ytmp, k6, trying, lstatus, params) != GSL_SUCCESS) {
+            errnum = XLAL_EFUNC;
+            goto bail_out;
+        }
+
+        /* final sum, and derivatives at the end of the step */
+        for (i = 0; i < dim * n; i += n)
+            for (l = 0; l < n; l++)
+                ynew[i + l] = y[i + l] + h0[l] * (rkf45_c1 * k1[i + l] + rkf45_c3 * k3[i + l] + rkf45_c4 * k4[i + l] + rkf45_c5 * k5[i + l] + rkf45_c6 * k6[i + l]);
+        for (l = 0; l < n; l++)
+            tstage[l] = t[l] + h0[l];
+        if (batchEvalDerivs(integrator, tstage, ynew, dydt_out, trying, lstatus, params) != GSL_SUCCESS) {
+            errnum = XLAL_EFUNC;
+            goto bail_out;
+        }
+
+        /* difference between 4th and 5th order */
+        for (i = 0; i < dim * n; i += n)
+            for (l = 0; l < n; l++)
+                yerr[i + l] = h0[l] * (rkf45_ec[1] * k1[i + l] + rkf45_ec[3] * k3[i + l] + rkf45_ec[4] * k4[i + l] + rkf45_ec[5] * k5[i + l] + rkf45_ec[6] * k6[i + l]);
+
+        /* Accept or reject the step of each system */
+        for (l = 0; l < n; l++) {
+            REAL8 rmax = DBL_MIN;
+
+            if (!active[l])
+                continue;
+
+            /* Check for failure, retry if haven't retried too many times
+             * already. */
+            if (!trying[l]) {
+                if (retries[l]--) {
+                    /* Retries to spare; reduce h, try again. */
+                    h[l] = h0[l] / 10.0;
+                } else {
+                    /* Out of retries, terminate with status code. */
+                    integrator->returncode[l] = lstatus[l];
+                    active[l] = 0;
+                    nactive--;
+                }
+                continue;
+            }
+
+            /* Check error and attempt to adjust the step, as done by GSL's
+             * standard step size control for an order 5 method */
+            for (i = 0; i < dim * n; i += n) {
+                const REAL8 D0 = integrator->eps_rel * fabs(ynew[i + l]) + integrator->eps_abs;
+                const REAL8 r = fabs(yerr[i + l]) / fabs(D0);
+                if (r > rmax)
+                    rmax = r;
+            }
+            if (rmax > 1.1) {
+                /* decrease step, no more than factor of 5 */
+                REAL8 r = 0.9 / pow(rmax, 1.0 / 5.0);
+                if (r < 0.2)
+                    r = 0.2;
+                if (fabs(r * h0[l]) < fabs(h0[l])) {
+                    if (t[l] + r * h0[l] == t[l]) {
+                        /* Step is too small to change the time; give up
+                         * rather than retrying forever. */
+                        integrator->returncode[l] = XLAL_EFAILED;
+                        trying[l] = 0;
+                        active[l] = 0;
+                        nactive--;
+                        continue;
+                    }
+                    /* Step was decreased. Undo step, and try again. */
+                    h[l] = r * h0[l];
+                    trying[l] = 0;
+                    continue;
+                }
+                h[l] = h0[l];
+            } else if (rmax < 0.5) {
+                /* increase step, no more than factor of 5 */
+                REAL8 r = 0.9 / pow(rmax, 1.0 / 6.0);
+                if (r > 5.0)
+                    r = 5.0;
+                if (r < 1.0)
+                    r = 1.0;
+                h[l] = r * h0[l];
+            } else {
+                h[l] = h0[l];
+            }
+
+            /* Successful step, reset retry counter. */
+            retries[l] = integrator->retries;
+            told[l] = t[l];
+            t[l] = final[l] ? tend : t[l] + h0[l];
+
+            /* Now interpolate until we would go past the current integrator
+             * time, using the same interpolating coefficients as
+             * XLALAdaptiveRungeKutta4Hermite() */
+            while ((tintp[l] + deltat) * (tintp[l] + deltat) < t[l] * t[l]) {
+                REAL8 hUsed = t[l] - told[l];
+                REAL8 theta, i0, i1, i6, iend;
+
+                tintp[l] += deltat;
+                theta = (tintp[l] - told[l]) / hUsed;
+                i0 = 1.0 + theta * theta * (3.0 - 4.0 * theta);
+                i1 = -theta * (theta - 1.0);
+                i6 = -4.0 * theta * theta * (theta - 1.0);
+                iend = theta * theta * (4.0 * theta - 3.0);
+
+                for (i = 0; i < dim; i++) {
+                    ytemp[i] = i0 * y[i * n + l] + iend * ynew[i * n + l] + hUsed * i1 * k1[i * n + l] + hUsed * i6 * k6[i * n + l];
+                }
+
+                /* Store the interpolated value in the output array. */
+                count[l]++;
+                if ((status = storeStateInOutput(&yout[l], tintp[l], ytemp, dim, &outputlen[l], count[l])) == XLAL_ENOMEM) {
+                    errnum = XLAL_ENOMEM;
+                    goto bail_out;
+                }
+            }
+
+            /* Take the step, and carry over the derivatives */
+            for (i = 0; i < dim * n; i += n) {
+                y[i + l] = ynew[i + l];
+                k1[i + l] = dydt_out[i + l];
+            }
+
+            /* Now that we have recorded the last interpolated step that we
+             * could, check for termination criteria. */
+            if (!integrator->stopontestonly && t[l] >= tend) {
+                trying[l] = 0;
+                active[l] = 0;
+                nactive--;
+            }
+        }
+
+        /* If there is a stopping function in integrator, call it with the
+         * last value of y and dydt of each system that has just stepped. */
+        if (integrator->stop) {
+            if (integrator->stop(n, t, y, k1, trying, lstatus, params) != 0) {
+                errnum = XLAL_EFUNC;
+                goto bail_out;
+            }
+            for (l = 0; l < n; l++) {
+                if (trying[l] && lstatus[l] != GSL_SUCCESS) {
+                    integrator->returncode[l] = lstatus[l];
+                    active[l] = 0;
+                    nactive--;
+                }
+            }
+        }
+
+    }
+
+    /* Now that the interpolation is done, shrink the output arrays down
+     * to exactly count samples, and store the final *interpolated* sample
+     * of each system in yinit. */
+    for (l = 0; l < n; l++) {
+        if (shrinkOutput(&yout[l], &outputlen[l], count[l], dim) == XLAL_ENOMEM) {
+            errnum = XLAL_ENOMEM;
+            goto bail_out;
+        }
+        for (i = 0; i < dim; i++) {
+            y[i * n + l] = yout[l]->data[(i + 2) * outputlen[l] - 1];
+        }
+    }
+
+  bail_out:
+
+    /* If we have an error, then we should free allocated memory, and
+     * then return. */
+    if (errnum) {
+        for (l = 0; l < n; l++) {
+            if (yout[l])
+                XLALDestroyREAL8Array(yout[l]);
+            yout[l] = NULL;
+        }
+        XLAL_ERROR(errnum);
+    }
+
+    return XLAL_SUCCESS;
+}
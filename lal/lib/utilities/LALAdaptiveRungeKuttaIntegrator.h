@@ -119,6 +119,35 @@ int XLALAdaptiveRungeKutta4Hermite( LALAdaptiveRungeKuttaIntegrator *integrator,
                                     REAL8Array **yout
                                     );
 
+/**
+ * Continuous extension of the solution computed by
+ * XLALAdaptiveRungeKutta4Dense().  Holds the state at the ends of each of the
+ * \c length integration steps, and the derivatives needed to interpolate
+ * within each step.
+ */
+typedef struct tagLALAdaptiveRungeKuttaDenseOutput
+{
+  size_t dim;		/* dimension of the system */
+  size_t length;	/* number of integration steps */
+  size_t size;		/* number of integration steps allocated */
+  REAL8 *t;		/* times at the ends of the steps, length + 1 */
+  REAL8 *y;		/* states at the ends of the steps, (length + 1) x dim */
+  REAL8 *k1;		/* derivatives at the start of each step, length x dim */
+  REAL8 *k6;		/* last Runge-Kutta-Fehlberg stage of each step, length x dim */
+} LALAdaptiveRungeKuttaDenseOutput;
+
+int XLALAdaptiveRungeKutta4Dense( LALAdaptiveRungeKuttaIntegrator *integrator,
+                                  void *params,
+                                  REAL8 *yinit,
+                                  REAL8 tinit,
+                                  REAL8 tend_in,
+                                  REAL8 h0,
+                                  LALAdaptiveRungeKuttaDenseOutput **dense
+                                  );
+void XLALDestroyAdaptiveRungeKuttaDenseOutput( LALAdaptiveRungeKuttaDenseOutput *dense );
+int XLALAdaptiveRungeKuttaDenseOutputEval( REAL8 *y, const LALAdaptiveRungeKuttaDenseOutput *dense, REAL8 t );
+REAL8Array *XLALAdaptiveRungeKuttaDenseOutputEvalUniform( const LALAdaptiveRungeKuttaDenseOutput *dense, REAL8 tstart, REAL8 deltat, size_t length );
+
 /**
  * Fourth-order Runge-Kutta ODE integrator using Runge-Kutta-Fehlberg (RKF45)
  * steps with adaptive step size control.  Intended for use in Fourier domain
@@ -143,6 +172,48 @@ int XLALAdaptiveRungeKutta4IrregularIntervals( LALAdaptiveRungeKuttaIntegrator *
                                     REAL8Array **yout                   /**< array holding the unevenly sampled output */
                                     );
 
+/**
+ * Integration structure for evolving many independent systems in lock-step
+ * with XLALAdaptiveRungeKutta4HermiteBatch().  Created using
+ * XLALAdaptiveRungeKutta4BatchInit().
+ */
+typedef struct tagLALAdaptiveRungeKuttaBatchIntegrator
+{
+  size_t dim;		/* dimension of each system */
+  size_t nlanes;	/* number of systems */
+
+  int (* dydt) (size_t nlanes, const double t[], const double y[], double dydt[], const int active[], int status[], void * params);
+  int (* stop) (size_t nlanes, const double t[], const double y[], const double dydt[], const int active[], int status[], void * params);
+
+  double eps_abs;	/* absolute and relative error tolerances */
+  double eps_rel;
+
+  int retries;		/* retries with smaller step when derivatives encounter singularity */
+  int stopontestonly;	/* stop only on test, use tend to size buffers only */
+
+  int *returncode;	/* return code of each system */
+
+  double *work;		/* workspace */
+  int *iwork;
+} LALAdaptiveRungeKuttaBatchIntegrator;
+
+LALAdaptiveRungeKuttaBatchIntegrator *XLALAdaptiveRungeKutta4BatchInit( int dim, size_t nlanes,
+                             int (* dydt) (size_t nlanes, const double t[], const double y[], double dydt[], const int active[], int status[], void * params),
+                             int (* stop) (size_t nlanes, const double t[], const double y[], const double dydt[], const int active[], int status[], void * params),
+                             double eps_abs, double eps_rel
+                             );
+
+void XLALAdaptiveRungeKuttaBatchFree( LALAdaptiveRungeKuttaBatchIntegrator *integrator );
+
+int XLALAdaptiveRungeKutta4HermiteBatch( LALAdaptiveRungeKuttaBatchIntegrator *integrator,
+                                         void *params,
+                                         REAL8 *yinit,
+                                         REAL8 tinit,
+                                         REAL8 tend_in,
+                                         REAL8 deltat,
+                                         REAL8Array **yout
+                                         );
+
 /** @} */
 
 #if 0
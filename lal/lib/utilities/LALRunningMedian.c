@@ -19,12 +19,19 @@
 
 /* ---------- see LALRunningMedian.h for doxygen documentation ---------- */
 
+#include <config.h>
+
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 #include <lal/LALStdlib.h>
 #include <lal/AVFactories.h>
 #include <lal/LALRunningMedian.h>
 
+#include <simd_dispatch.h>
+
+#include <LALRunningMedian_internal.h>
+
 /*----------------------------------
   A structure to store values and indices
   of elements in an array
@@ -1499,3 +1506,80 @@ void LALSRunningMedian2( LALStatus *status,
   DETATCHSTATUSPTR( status );
   RETURN( status );
 }
+
+
+/* ---------- XLAL running median ---------- */
+
+/*
+ * Block sizes up to rngmed_small_max_REALn are handled by keeping the
+ * window sorted: each step costs a rank computation and a memmove of at most
+ * the block size, which is fast for small blocks and vectorises well.
+ * Larger blocks use a pair of heaps (a max-heap below the median and a
+ * min-heap above it) indexed from a ring buffer, costing O(log blocksize)
+ * per step.  The crossover block sizes were determined by benchmarking.
+ */
+
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
+#define RNGMED_MINCT(ct) (((ct) - 1) / 2)
+#define RNGMED_MAXCT(ct) ((ct) / 2)
+
+static void rngmed_rank_GEN_REAL4( const REAL4 *w, UINT4 n, REAL4 xold, REAL4 xnew, UINT4 *rold, UINT4 *rnew )
+{
+  UINT4 ro = 0, rn = 0;
+  for ( UINT4 j = 0; j < n; ++j )
+  {
+    ro += w[j] < xold;
+    rn += w[j] < xnew;
+  }
+  *rold = ro;
+  *rnew = rn;
+}
+
+static void rngmed_rank_GEN_REAL8( const REAL8 *w, UINT4 n, REAL8 xold, REAL8 xnew, UINT4 *rold, UINT4 *rnew )
+{
+  UINT4 ro = 0, rn = 0;
+  for ( UINT4 j = 0; j < n; ++j )
+  {
+    ro += w[j] < xold;
+    rn += w[j] < xnew;
+  }
+  *rold = ro;
+  *rnew = rn;
+}
+
+static void ( *rngmed_rank_REAL4 )( const REAL4 *, UINT4, REAL4, REAL4, UINT4 *, UINT4 * ) = NULL;
+static void ( *rngmed_rank_REAL8 )( const REAL8 *, UINT4, REAL8, REAL8, UINT4 *, UINT4 * ) = NULL;
+static UINT4 rngmed_small_max_REAL4 = 0;
+static UINT4 rngmed_small_max_REAL8 = 0;
+
+/* pthread locking to make kernel selection thread-safe */
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_once_t rngmedOnce = PTHREAD_ONCE_INIT;
+#define RNGMED_ONCE(init) pthread_once(&rngmedOnce, (init))
+#else
+static int rngmedOnce = 1;
+#define RNGMED_ONCE(init) (rngmedOnce ? (init)(), rngmedOnce = 0 : 0)
+#endif
+
+static void rngmed_init_kernels( void )
+{
+  DISPATCH_SELECT_BEGIN();
+  DISPATCH_SELECT_AVX2( rngmed_rank_REAL4 = XLALRunningMedianRankREAL4_AVX2, rngmed_small_max_REAL4 = 64,
+                        rngmed_rank_REAL8 = XLALRunningMedianRankREAL8_AVX2, rngmed_small_max_REAL8 = 48 );
+  DISPATCH_SELECT_END( rngmed_rank_REAL4 = rngmed_rank_GEN_REAL4, rngmed_small_max_REAL4 = 8,
+                       rngmed_rank_REAL8 = rngmed_rank_GEN_REAL8, rngmed_small_max_REAL8 = 8 );
+}
+
+static void rngmed_select_kernels( void )
+{
+  RNGMED_ONCE( rngmed_init_kernels );
+}
+
+#define SINGLE_PRECISION
+#include "LALRunningMedian_source.c"
+#undef SINGLE_PRECISION
+#include "LALRunningMedian_source.c"
@@ -54,12 +54,30 @@ extern "C" {
  * <tt>LALDRunningMedian()</tt>, but has proven to be a
  * little faster and more stable. Check if it works for you.
  *
+ * The XLAL functions <tt>XLALRunningMedianREAL8()</tt> and
+ * <tt>XLALRunningMedianREAL4()</tt> compute the same running medians and
+ * should be preferred in new code; they are considerably faster, in
+ * particular for large block sizes, and accept any block size \f$b \ge 1\f$.
+ * For even block sizes the median is the mean of the two central values.
+ * <tt>XLALRunningMedianREAL8VectorSequence()</tt> and
+ * <tt>XLALRunningMedianREAL4VectorSequence()</tt> compute the running medians
+ * of every vector in a sequence, e.g.\ of many SFT periodograms, reusing a
+ * single workspace; the median sequence must have the same number of vectors
+ * as the input, each of length \f$n-b+1\f$.  The input must not contain NaNs.
+ *
  * ### Algorithm ###
  *
  * For a detailed description of the algorithm see the
  * LIGO document T-030168-00-D, Somya D. Mohanty:
  * Efficient Algorithm for computing a Running Median
  *
+ * The XLAL functions keep the current block in sorted order for small block
+ * sizes, locating the outgoing and incoming values with a (SIMD) rank count
+ * and shifting the block with <tt>memmove()</tt>; for larger block sizes
+ * they maintain a max-heap of the values below the median and a min-heap of
+ * the values above it, indexed from a ring buffer, so that each step costs
+ * \f$O(\log b)\f$.
+ *
  */
 /** @{ */
 
@@ -137,6 +155,11 @@ LALSRunningMedian2( LALStatus *status,
 		    const REAL4Sequence *input,
 		    LALRunningMedianPar param);
 
+int XLALRunningMedianREAL8( REAL8Sequence *medians, const REAL8Sequence *input, UINT4 blocksize );
+int XLALRunningMedianREAL4( REAL4Sequence *medians, const REAL4Sequence *input, UINT4 blocksize );
+int XLALRunningMedianREAL8VectorSequence( REAL8VectorSequence *medians, const REAL8VectorSequence *input, UINT4 blocksize );
+int XLALRunningMedianREAL4VectorSequence( REAL4VectorSequence *medians, const REAL4VectorSequence *input, UINT4 blocksize );
+
 /** @} */
 
 #ifdef  __cplusplus
@@ -0,0 +1,94 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <config.h>
+
+#include <immintrin.h>
+
+#include <LALRunningMedian_internal.h>
+
+/* ---------- AVX2 rank kernels; compiled with AVX2_CFLAGS ---------- */
+
+void XLALRunningMedianRankREAL4_AVX2( const REAL4 *w, UINT4 n, REAL4 xold, REAL4 xnew, UINT4 *rold, UINT4 *rnew )
+{
+  const __m256 vold = _mm256_set1_ps( xold );
+  const __m256 vnew = _mm256_set1_ps( xnew );
+  __m256i cold = _mm256_setzero_si256();
+  __m256i cnew = _mm256_setzero_si256();
+  INT4 sold[8], snew[8];
+  UINT4 ro = 0, rn = 0;
+  UINT4 j = 0;
+
+  /* comparisons yield -1 in each lane where true, so subtract to count */
+  for ( ; j + 8 <= n; j += 8 )
+  {
+    const __m256 v = _mm256_loadu_ps( w + j );
+    cold = _mm256_sub_epi32( cold, _mm256_castps_si256( _mm256_cmp_ps( v, vold, _CMP_LT_OQ ) ) );
+    cnew = _mm256_sub_epi32( cnew, _mm256_castps_si256( _mm256_cmp_ps( v, vnew, _CMP_LT_OQ ) ) );
+  }
+  _mm256_storeu_si256( (__m256i *) sold, cold );
+  _mm256_storeu_si256( (__m256i *) snew, cnew );
+  for ( UINT4 k = 0; k < 8; ++k )
+  {
+    ro += sold[k];
+    rn += snew[k];
+  }
+  for ( ; j < n; ++j )
+  {
+    ro += w[j] < xold;
+    rn += w[j] < xnew;
+  }
+
+  *rold = ro;
+  *rnew = rn;
+}
+
+void XLALRunningMedianRankREAL8_AVX2( const REAL8 *w, UINT4 n, REAL8 xold, REAL8 xnew, UINT4 *rold, UINT4 *rnew )
+{
+  const __m256d vold = _mm256_set1_pd( xold );
+  const __m256d vnew = _mm256_set1_pd( xnew );
+  __m256i cold = _mm256_setzero_si256();
+  __m256i cnew = _mm256_setzero_si256();
+  INT8 sold[4], snew[4];
+  UINT4 ro = 0, rn = 0;
+  UINT4 j = 0;
+
+  /* comparisons yield -1 in each lane where true, so subtract to count */
+  for ( ; j + 4 <= n; j += 4 )
+  {
+    const __m256d v = _mm256_loadu_pd( w + j );
+    cold = _mm256_sub_epi64( cold, _mm256_castpd_si256( _mm256_cmp_pd( v, vold, _CMP_LT_OQ ) ) );
+    cnew = _mm256_sub_epi64( cnew, _mm256_castpd_si256( _mm256_cmp_pd( v, vnew, _CMP_LT_OQ ) ) );
+  }
+  _mm256_storeu_si256( (__m256i *) sold, cold );
+  _mm256_storeu_si256( (__m256i *) snew, cnew );
+  for ( UINT4 k = 0; k < 4; ++k )
+  {
+    ro += sold[k];
+    rn += snew[k];
+  }
+  for ( ; j < n; ++j )
+  {
+    ro += w[j] < xold;
+    rn += w[j] < xnew;
+  }
+
+  *rold = ro;
+  *rnew = rn;
+}
@@ -0,0 +1,271 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#define CONCAT2x(a,b) a##b
+#define CONCAT2(a,b) CONCAT2x(a,b)
+#define CONCAT3x(a,b,c) a##b##c
+#define CONCAT3(a,b,c) CONCAT3x(a,b,c)
+
+#ifdef SINGLE_PRECISION
+#define REAL_TYPE REAL4
+#else
+#define REAL_TYPE REAL8
+#endif
+
+#define SEQ_TYPE CONCAT2(REAL_TYPE,Sequence)
+#define VSEQ_TYPE CONCAT2(REAL_TYPE,VectorSequence)
+#define FUNC(f) CONCAT3(f,_,REAL_TYPE)
+#define XFUNC(f) CONCAT2(f,REAL_TYPE)
+
+/* ---------- double heap, for large block sizes ---------- */
+
+/* swap heap positions i and j if the value at i is less than that at j */
+static int FUNC(rngmed_cmp_exch)( const REAL_TYPE *v, INT4 *pos, INT4 *heap, INT4 i, INT4 j )
+{
+  INT4 t;
+  if ( ! ( v[heap[i]] < v[heap[j]] ) )
+    return 0;
+  t = heap[i];
+  heap[i] = heap[j];
+  heap[j] = t;
+  pos[heap[i]] = i;
+  pos[heap[j]] = j;
+  return 1;
+}
+
+/* restore min-heap order below position i/2 */
+static void FUNC(rngmed_min_sort_down)( const REAL_TYPE *v, INT4 *pos, INT4 *heap, INT4 ct, INT4 i )
+{
+  for ( ; i <= RNGMED_MINCT( ct ); i *= 2 )
+  {
+    if ( i > 1 && i < RNGMED_MINCT( ct ) && v[heap[i + 1]] < v[heap[i]] )
+      ++i;
+    if ( ! FUNC(rngmed_cmp_exch)( v, pos, heap, i, i / 2 ) )
+      break;
+  }
+}
+
+/* restore max-heap order below position i/2 (positions are negative) */
+static void FUNC(rngmed_max_sort_down)( const REAL_TYPE *v, INT4 *pos, INT4 *heap, INT4 ct, INT4 i )
+{
+  for ( ; i >= -RNGMED_MAXCT( ct ); i *= 2 )
+  {
+    if ( i < -1 && i > -RNGMED_MAXCT( ct ) && v[heap[i]] < v[heap[i - 1]] )
+      --i;
+    if ( ! FUNC(rngmed_cmp_exch)( v, pos, heap, i / 2, i ) )
+      break;
+  }
+}
+
+/* restore min-heap order above position i; returns true if i reached the median */
+static int FUNC(rngmed_min_sort_up)( const REAL_TYPE *v, INT4 *pos, INT4 *heap, INT4 i )
+{
+  while ( i > 0 && FUNC(rngmed_cmp_exch)( v, pos, heap, i, i / 2 ) )
+    i /= 2;
+  return i == 0;
+}
+
+/* restore max-heap order above position i; returns true if i reached the median */
+static int FUNC(rngmed_max_sort_up)( const REAL_TYPE *v, INT4 *pos, INT4 *heap, INT4 i )
+{
+  while ( i < 0 && FUNC(rngmed_cmp_exch)( v, pos, heap, i / 2, i ) )
+    i /= 2;
+  return i == 0;
+}
+
+/* fill pattern of the initially empty heap: median, max, min, max, ... */
+void XFUNC(XLALRunningMedianHeapInit)( INT4 *pos, INT4 *heap, UINT4 b )
+{
+  UINT4 i;
+  for ( i = 0; i < b; ++i )
+  {
+    pos[i] = ( (INT4) ( i + 1 ) / 2 ) * ( ( i & 1 ) ? -1 : 1 );
+    heap[pos[i]] = i;
+  }
+}
+
+/* replace ring buffer slot idx with x; ct includes the new value */
+void XFUNC(XLALRunningMedianHeapInsert)( REAL_TYPE *v, INT4 *pos, INT4 *heap, UINT4 idx, INT4 ct, int isnew, REAL_TYPE x )
+{
+  INT4 p = pos[idx];
+  REAL_TYPE old = v[idx];
+  v[idx] = x;
+  if ( p > 0 ) /* value is in the min-heap */
+  {
+    if ( ! isnew && old < x )
+      FUNC(rngmed_min_sort_down)( v, pos, heap, ct, p * 2 );
+    else if ( FUNC(rngmed_min_sort_up)( v, pos, heap, p ) )
+      FUNC(rngmed_max_sort_down)( v, pos, heap, ct, -1 );
+  }
+  else if ( p < 0 ) /* value is in the max-heap */
+  {
+    if ( ! isnew && x < old )
+      FUNC(rngmed_max_sort_down)( v, pos, heap, ct, p * 2 );
+    else if ( FUNC(rngmed_max_sort_up)( v, pos, heap, p ) )
+      FUNC(rngmed_min_sort_down)( v, pos, heap, ct, 1 );
+  }
+  else /* value is the median */
+  {
+    if ( RNGMED_MAXCT( ct ) )
+      FUNC(rngmed_max_sort_down)( v, pos, heap, ct, -1 );
+    if ( RNGMED_MINCT( ct ) )
+      FUNC(rngmed_min_sort_down)( v, pos, heap, ct, 1 );
+  }
+}
+
+static void FUNC(rngmed_heap)( REAL_TYPE *medians, const REAL_TYPE *input, UINT4 n, UINT4 b, REAL_TYPE *v, INT4 *pos, INT4 *heapbuf )
+{
+  INT4 *heap = heapbuf + b / 2;
+  UINT4 i, idx;
+
+  XFUNC(XLALRunningMedianHeapInit)( pos, heap, b );
+  for ( i = 0; i < b; ++i )
+    XFUNC(XLALRunningMedianHeapInsert)( v, pos, heap, i, i + 1, 1, input[i] );
+
+  idx = 0;
+  for ( i = b; ; ++i )
+  {
+    medians[i - b] = ( b & 1 ) ? v[heap[0]] : 0.5 * ( v[heap[0]] + v[heap[-1]] );
+    if ( i == n )
+      break;
+    XFUNC(XLALRunningMedianHeapInsert)( v, pos, heap, idx, b, 0, input[i] );
+    if ( ++idx == b )
+      idx = 0;
+  }
+}
+
+/* ---------- sorted window, for small block sizes ---------- */
+
+static void FUNC(rngmed_sorted)( REAL_TYPE *medians, const REAL_TYPE *input, UINT4 n, UINT4 b, REAL_TYPE *w )
+{
+  UINT4 i, j;
+
+  /* insertion sort of the first block */
+  for ( i = 0; i < b; ++i )
+  {
+    REAL_TYPE x = input[i];
+    for ( j = i; j > 0 && x < w[j - 1]; --j )
+      w[j] = w[j - 1];
+    w[j] = x;
+  }
+
+  for ( i = b; ; ++i )
+  {
+    UINT4 rold, rnew;
+    medians[i - b] = ( b & 1 ) ? w[b / 2] : 0.5 * ( w[b / 2 - 1] + w[b / 2] );
+    if ( i == n )
+      break;
+
+    /* rank of the outgoing value is its position in the window; rank of
+       the incoming value is where it goes once the outgoing one is removed */
+    FUNC(rngmed_rank)( w, b, input[i - b], input[i], &rold, &rnew );
+    if ( rnew < rold )
+    {
+      memmove( w + rnew + 1, w + rnew, ( rold - rnew ) * sizeof( *w ) );
+      w[rnew] = input[i];
+    }
+    else if ( rnew > rold + 1 )
+    {
+      memmove( w + rold, w + rold + 1, ( rnew - rold - 1 ) * sizeof( *w ) );
+      w[rnew - 1] = input[i];
+    }
+    else
+      w[rold] = input[i];
+  }
+}
+
+/* ---------- public API ---------- */
+
+/* workspace for block size b: REAL_TYPE[b] followed by INT4[2*b] */
+static void FUNC(rngmed_row)( REAL_TYPE *medians, const REAL_TYPE *input, UINT4 n, UINT4 b, void *work )
+{
+  REAL_TYPE *v = (REAL_TYPE *) work;
+  INT4 *ibuf = (INT4 *) ( v + b );
+  if ( b <= FUNC(rngmed_small_max) )
+    FUNC(rngmed_sorted)( medians, input, n, b, v );
+  else
+    FUNC(rngmed_heap)( medians, input, n, b, v, ibuf, ibuf + b );
+}
+
+int XFUNC(XLALRunningMedian)( SEQ_TYPE *medians, const SEQ_TYPE *input, UINT4 blocksize )
+{
+  void *work;
+
+  XLAL_CHECK( medians != NULL && input != NULL, XLAL_EFAULT );
+  XLAL_CHECK( medians->data != NULL && input->data != NULL, XLAL_EFAULT );
+  XLAL_CHECK( blocksize > 0, XLAL_EINVAL, "Block size must be > 0" );
+  XLAL_CHECK( blocksize <= input->length, XLAL_EBADLEN, "Block size %u larger than input length %u", blocksize, input->length );
+  XLAL_CHECK( medians->length == input->length - blocksize + 1, XLAL_EBADLEN, "Median length %u must be input length - block size + 1 = %u", medians->length, input->length - blocksize + 1 );
+
+  rngmed_select_kernels();
+
+  work = XLALMalloc( blocksize * ( sizeof( REAL_TYPE ) + 2 * sizeof( INT4 ) ) );
+  XLAL_CHECK( work != NULL, XLAL_ENOMEM );
+  FUNC(rngmed_row)( medians->data, input->data, input->length, blocksize, work );
+  XLALFree( work );
+
+  return XLAL_SUCCESS;
+}
+
+int CONCAT3(XLALRunningMedian,REAL_TYPE,VectorSequence)( VSEQ_TYPE *medians, const VSEQ_TYPE *input, UINT4 blocksize )
+{
+  int errnum = 0;
+
+  XLAL_CHECK( medians != NULL && input != NULL, XLAL_EFAULT );
+  XLAL_CHECK( medians->data != NULL && input->data != NULL, XLAL_EFAULT );
+  XLAL_CHECK( blocksize > 0, XLAL_EINVAL, "Block size must be > 0" );
+  XLAL_CHECK( medians->length == input->length, XLAL_EBADLEN, "Median and input sequences have different numbers of vectors: %u != %u", medians->length, input->length );
+  XLAL_CHECK( blocksize <= input->vectorLength, XLAL_EBADLEN, "Block size %u larger than input vector length %u", blocksize, input->vectorLength );
+  XLAL_CHECK( medians->vectorLength == input->vectorLength - blocksize + 1, XLAL_EBADLEN, "Median vector length %u must be input vector length - block size + 1 = %u", medians->vectorLength, input->vectorLength - blocksize + 1 );
+
+  rngmed_select_kernels();
+
+  /* rows are independent, so compute them in parallel, each thread with its own workspace */
+#pragma omp parallel
+  {
+    void *work = XLALMalloc( blocksize * ( sizeof( REAL_TYPE ) + 2 * sizeof( INT4 ) ) );
+    if ( work == NULL )
+    {
+      errnum = XLAL_ENOMEM;
+#pragma omp flush(errnum)
+    }
+#pragma omp for schedule(dynamic)
+    for ( UINT4 k = 0; k < input->length; ++k )
+    {
+#pragma omp flush(errnum)
+      if ( work == NULL || errnum )
+        continue;
+      FUNC(rngmed_row)( medians->data + (size_t) k * medians->vectorLength, input->data + (size_t) k * input->vectorLength, input->vectorLength, blocksize, work );
+    }
+    XLALFree( work );
+  }
+  XLAL_CHECK( errnum == 0, errnum );
+
+  return XLAL_SUCCESS;
+}
+
+#undef CONCAT2x
+#undef CONCAT2
+#undef CONCAT3x
+#undef CONCAT3
+#undef REAL_TYPE
+#undef SEQ_TYPE
+#undef VSEQ_TYPE
+#undef FUNC
+#undef XFUNC
@@ -0,0 +1,299 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Random.h>
+#include <lal/XLALError.h>
+
+/**
+ * \defgroup PhiloxRandom_c Module PhiloxRandom.c
+ * \ingroup Random_h
+ *
+ * \brief Counter-based random number streams.
+ *
+ * ### Description ###
+ *
+ * The routines in this module generate random deviates with the Philox4x32-10
+ * counter-based generator \cite salmon2011.  Unlike the generator in
+ * \ref Random_c, each deviate is a pure function of a key (derived from the
+ * seed), a stream number, and the index of the deviate within the stream; no
+ * other state is carried from one deviate to the next.  Consequently:
+ *
+ * - Any number of independent streams may be created from the same seed by
+ *   giving them different stream numbers.
+ * - A stream may be advanced by any number of deviates in constant time with
+ *   <tt>XLALPhiloxRandomJump()</tt>, or by setting the \c position member of
+ *   the ::PhiloxRandomParams structure directly.
+ * - A long sequence of deviates may be generated in pieces, e.g.\ by several
+ *   threads which each jump to the start of their own piece, and the result is
+ *   bitwise identical to generating the sequence in one call.
+ *
+ * The routine <tt>XLALCreatePhiloxRandomParams()</tt> creates a stream with
+ * the given seed and stream number, positioned at its first deviate.  Any
+ * value of the seed, including zero, is valid; the seed is not taken from the
+ * clock.  <tt>XLALResetPhiloxRandomParams()</tt> re-initialises an existing
+ * structure, which may also be declared on the stack.
+ *
+ * The routine <tt>XLALPhiloxUniformDeviates()</tt> fills a vector with
+ * deviates distributed uniformly in \f$[0,1)\f$, with 53 random bits each.
+ * The routine <tt>XLALPhiloxNormalDeviates()</tt> fills a vector with normal
+ * (Gaussian) deviates with zero mean and unit variance.  Both routines
+ * advance the stream by the length of the vector.  The routine
+ * <tt>XLALPhiloxRandomBlock()</tt> exposes the underlying bijection from a
+ * 128-bit counter to 128 random bits.
+ *
+ * ### Algorithm ###
+ *
+ * Each application of the Philox4x32-10 bijection to the counter
+ * \f$(b, s)\f$, where \f$b\f$ is a 64-bit block number and \f$s\f$ the
+ * 64-bit stream number, gives two 64-bit random words; deviates \f$2b\f$ and
+ * \f$2b+1\f$ of the stream are computed from block \f$b\f$.  A uniform
+ * deviate is formed from the top 53 bits of its word.  Normal deviates are
+ * generated in pairs with the Box-Muller transform, using both words of a
+ * block: \f$u_1 \in (0,1]\f$ and \f$u_2 \in [0,1)\f$ give the deviates
+ * \f$\sqrt{-2\ln u_1}\,\cos 2\pi u_2\f$ and
+ * \f$\sqrt{-2\ln u_1}\,\sin 2\pi u_2\f$.  Unlike rejection methods, this
+ * consumes a fixed number of random bits per deviate, which is what makes
+ * jumping ahead possible.
+ *
+ * Deviates are generated in chunks of 64 blocks, which always start at a
+ * multiple of 64 blocks within the stream; the Philox rounds are evaluated
+ * over a whole chunk at a time so that they can be vectorised by the
+ * compiler.  Since the chunks do not depend on where a call starts or ends,
+ * the value of each deviate does not depend on how the stream is split
+ * between calls.  The logarithms and trigonometric functions are evaluated
+ * with the C library rather than with the routines in \ref VectorMath_h,
+ * whose results may depend on the instruction set selected at run time; the
+ * deviates are therefore reproducible on any machine using the same C
+ * library.
+ *
+ */
+/** @{ */
+
+/* number of blocks in a chunk */
+#define PHILOX_CHUNK 64
+
+/* Philox4x32 multipliers and Weyl sequence constants */
+static const UINT4 philoxM0 = 0xD2511F53;
+static const UINT4 philoxM1 = 0xCD9E8D57;
+static const UINT4 philoxW0 = 0x9E3779B9;
+static const UINT4 philoxW1 = 0xBB67AE85;
+
+/* computes the random words of the chunk of blocks starting at block0 */
+static void PhiloxChunk( UINT4 w[4][PHILOX_CHUNK], const PhiloxRandomParams *params, UINT8 block0 )
+{
+  UINT4 k0 = params->key[0];
+  UINT4 k1 = params->key[1];
+  UINT4 i;
+  int r;
+
+  for ( i = 0; i < PHILOX_CHUNK; ++i )
+  {
+    w[0][i] = (UINT4)( block0 + i );
+    w[1][i] = (UINT4)( ( block0 + i ) >> 32 );
+    w[2][i] = (UINT4)( params->stream );
+    w[3][i] = (UINT4)( params->stream >> 32 );
+  }
+
+  for ( r = 0; r < 10; ++r )
+  {
+    if ( r > 0 )
+    {
+      k0 += philoxW0;
+      k1 += philoxW1;
+    }
+    for ( i = 0; i < PHILOX_CHUNK; ++i )
+    {
+      const UINT8 p0 = (UINT8)philoxM0 * w[0][i];
+      const UINT8 p1 = (UINT8)philoxM1 * w[2][i];
+      w[0][i] = (UINT4)( p1 >> 32 ) ^ w[1][i] ^ k0;
+      w[1][i] = (UINT4)p1;
+      w[2][i] = (UINT4)( p0 >> 32 ) ^ w[3][i] ^ k1;
+      w[3][i] = (UINT4)p0;
+    }
+  }
+}
+
+/* computes the 2*PHILOX_CHUNK uniform deviates of the chunk starting at block0 */
+static void PhiloxUniformChunk( REAL8 *out, const PhiloxRandomParams *params, UINT8 block0 )
+{
+  UINT4 w[4][PHILOX_CHUNK];
+  UINT4 i;
+
+  PhiloxChunk( w, params, block0 );
+  for ( i = 0; i < PHILOX_CHUNK; ++i )
+  {
+    const UINT8 x0 = ( (UINT8)w[1][i] << 32 ) | w[0][i];
+    const UINT8 x1 = ( (UINT8)w[3][i] << 32 ) | w[2][i];
+    out[2*i]     = ( x0 >> 11 ) * 0x1.0p-53;
+    out[2*i + 1] = ( x1 >> 11 ) * 0x1.0p-53;
+  }
+}
+
+/* computes the 2*PHILOX_CHUNK normal deviates of the chunk starting at block0 */
+static void PhiloxNormalChunk( REAL8 *out, const PhiloxRandomParams *params, UINT8 block0 )
+{
+  UINT4 w[4][PHILOX_CHUNK];
+  UINT4 i;
+
+  PhiloxChunk( w, params, block0 );
+  for ( i = 0; i < PHILOX_CHUNK; ++i )
+  {
+    const UINT8 x0 = ( (UINT8)w[1][i] << 32 ) | w[0][i];
+    const UINT8 x1 = ( (UINT8)w[3][i] << 32 ) | w[2][i];
+    const REAL8 u = ( ( x0 >> 11 ) + 1 ) * 0x1.0p-53;
+    const REAL8 phase = LAL_TWOPI * ( ( x1 >> 11 ) * 0x1.0p-53 );
+    const REAL8 rad = sqrt( -2.0 * log( u ) );
+    out[2*i]     = rad * cos( phase );
+    out[2*i + 1] = rad * sin( phase );
+  }
+}
+
+/* fills a vector with uniform or normal deviates, in whole chunks */
+static int PhiloxDeviates( REAL8Vector *deviates, PhiloxRandomParams *params, int normal )
+{
+  REAL8 buf[2*PHILOX_CHUNK];
+  REAL8 *out;
+  UINT8 pos;
+  UINT4 n;
+
+  XLAL_CHECK( deviates && deviates->data && params, XLAL_EFAULT );
+  XLAL_CHECK( deviates->length > 0, XLAL_EBADLEN );
+
+  out = deviates->data;
+  pos = params->position;
+  n = deviates->length;
+  while ( n > 0 )
+  {
+    const UINT8 block0 = ( pos / 2 ) - ( pos / 2 ) % PHILOX_CHUNK;
+    const UINT4 first = pos - 2 * block0;
+    const UINT4 m = ( 2*PHILOX_CHUNK - first < n ) ? 2*PHILOX_CHUNK - first : n;
+    if ( normal )
+      PhiloxNormalChunk( buf, params, block0 );
+    else
+      PhiloxUniformChunk( buf, params, block0 );
+    memcpy( out, buf + first, m * sizeof( *out ) );
+    out += m;
+    pos += m;
+    n -= m;
+  }
+
+  params->position = pos;
+  return XLAL_SUCCESS;
+}
+
+/*
+ *
+ * XLAL Routines.
+ *
+ */
+
+PhiloxRandomParams * XLALCreatePhiloxRandomParams( UINT8 seed, UINT8 stream )
+{
+  PhiloxRandomParams *params;
+
+  params = XLALMalloc( sizeof( *params ) );
+  if ( ! params )
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+
+  XLALResetPhiloxRandomParams( params, seed, stream );
+
+  return params;
+}
+
+
+void XLALResetPhiloxRandomParams( PhiloxRandomParams *params, UINT8 seed, UINT8 stream )
+{
+  if ( ! params )
+    XLAL_ERROR_VOID( XLAL_EFAULT );
+
+  params->key[0] = (UINT4)seed;
+  params->key[1] = (UINT4)( seed >> 32 );
+  params->stream = stream;
+  params->position = 0;
+}
+
+
+void XLALDestroyPhiloxRandomParams( PhiloxRandomParams *params )
+{
+  XLALFree( params );
+}
+
+
+int XLALPhiloxRandomJump( PhiloxRandomParams *params, UINT8 n )
+{
+  if ( ! params )
+    XLAL_ERROR( XLAL_EFAULT );
+
+  params->position += n;
+
+  return XLAL_SUCCESS;
+}
+
+
+void XLALPhiloxRandomBlock( UINT4 out[4], const UINT4 key[2], const UINT4 counter[4] )
+{
+  UINT4 k0 = key[0];
+  UINT4 k1 = key[1];
+  UINT4 c0 = counter[0];
+  UINT4 c1 = counter[1];
+  UINT4 c2 = counter[2];
+  UINT4 c3 = counter[3];
+  int r;
+
+  for ( r = 0; r < 10; ++r )
+  {
+    UINT8 p0, p1;
+    if ( r > 0 )
+    {
+      k0 += philoxW0;
+      k1 += philoxW1;
+    }
+    p0 = (UINT8)philoxM0 * c0;
+    p1 = (UINT8)philoxM1 * c2;
+    c0 = (UINT4)( p1 >> 32 ) ^ c1 ^ k0;
+    c1 = (UINT4)p1;
+    c2 = (UINT4)( p0 >> 32 ) ^ c3 ^ k1;
+    c3 = (UINT4)p0;
+  }
+
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+
+int XLALPhiloxUniformDeviates( REAL8Vector *deviates, PhiloxRandomParams *params )
+{
+  XLAL_CHECK( PhiloxDeviates( deviates, params, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+
+int XLALPhiloxNormalDeviates( REAL8Vector *deviates, PhiloxRandomParams *params )
+{
+  XLAL_CHECK( PhiloxDeviates( deviates, params, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+/** @} */
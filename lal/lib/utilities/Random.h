@@ -92,6 +92,23 @@ RandomParams;
 
 typedef struct tagMTRandomParams MTRandomParams;
 
+/**
+ * \ingroup PhiloxRandom_c
+ * \brief State of a counter-based Philox random number stream.
+ *
+ * A stream is identified by its \c seed and \c stream number; \c position
+ * is the index within the stream of the next deviate to be generated, and may
+ * be set freely to jump ahead or back in the stream.
+ */
+typedef struct
+tagPhiloxRandomParams
+{
+  UINT4 key[2];         /**< Philox key, derived from the seed */
+  UINT8 stream;         /**< Stream number */
+  UINT8 position;       /**< Index of the next deviate in the stream */
+}
+PhiloxRandomParams;
+
 
 INT4 XLALBasicRandom( INT4 i );
 RandomParams * XLALCreateRandomParams( INT4 seed );
@@ -101,6 +118,16 @@ REAL4 XLALUniformDeviate( RandomParams *params );
 int XLALNormalDeviates( REAL4Vector *deviates, RandomParams *params );
 REAL4 XLALNormalDeviate( RandomParams *params );
 
+PhiloxRandomParams * XLALCreatePhiloxRandomParams( UINT8 seed, UINT8 stream );
+void XLALResetPhiloxRandomParams( PhiloxRandomParams *params, UINT8 seed, UINT8 stream );
+void XLALDestroyPhiloxRandomParams( PhiloxRandomParams *params );
+int XLALPhiloxRandomJump( PhiloxRandomParams *params, UINT8 n );
+#ifndef SWIG /* exclude from SWIG interface */
+void XLALPhiloxRandomBlock( UINT4 out[4], const UINT4 key[2], const UINT4 counter[4] );
+#endif /* SWIG */
+int XLALPhiloxUniformDeviates( REAL8Vector *deviates, PhiloxRandomParams *params );
+int XLALPhiloxNormalDeviates( REAL8Vector *deviates, PhiloxRandomParams *params );
+
 void
 LALCreateRandomParams (
     LALStatus        *status,
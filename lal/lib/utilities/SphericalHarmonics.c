@@ -22,6 +22,8 @@
 #include <lal/LALError.h>
 #include <lal/XLALGSL.h>
 
+#include <string.h>
+
 #include <gsl/gsl_sf_legendre.h>
 #include <gsl/gsl_sf_gamma.h>
 
@@ -583,3 +585,212 @@ COMPLEX16 XLALWignerDMatrix(
 			XLALWignerdMatrix( l, mp, m, beta ) * 
 			cexp( -(1.0I)*m*gam );
 }
+
+/**
+ * Returns the index of the Wigner matrix element \f$ d^l_{m'm} \f$ in the
+ * output of XLALWignerdMatrixBatch(), i.e. the number of elements with
+ * smaller \f$ l \f$, plus \f$ (m'+l)(2l+1) + (m+l) \f$.
+ */
+int XLALWignerdMatrixIndex(
+                                   int l,        /**< mode number l */
+                                   int mp,       /**< mode number m' */
+                                   int m         /**< mode number m */
+    )
+{
+	return ( l * ( 2 * l - 1 ) * ( 2 * l + 1 ) ) / 3 + ( mp + l ) * ( 2 * l + 1 ) + ( m + l );
+}
+
+/*
+ * Computes the 'little' d Wigner matrix elements d^l_{mp,m}(beta) for
+ * l = max(|m|,|mp|), ..., lmax, for n angles beta, by upward recurrence in l.
+ * On return, the elements for each l are in work[l*n], ..., work[l*n + n-1].
+ * The arrays cb, sh, and ch hold cos(beta), sin(beta/2), and cos(beta/2).
+ */
+static void WignerdRecurrence( REAL8 *work, int lmax, int mp, int m, const REAL8 *cb, const REAL8 *sh, const REAL8 *ch, size_t n )
+{
+	const int l0 = abs(m) > abs(mp) ? abs(m) : abs(mp);
+	int a, b, lam, l, j;
+	REAL8 pref;
+	size_t k;
+
+	/* starting value at l = l0, from the closed form used by XLALWignerdMatrix() with k = 0 */
+	if( l0 + m == 0 ){
+		a = mp-m;
+		lam = mp-m;
+	} else if( l0 - m == 0 ) {
+		a = m-mp;
+		lam = 0;
+	} else if( l0 + mp == 0 ) {
+		a = m-mp;
+		lam = 0;
+	} else {
+		a = mp-m;
+		lam = mp-m;
+	}
+	b = 2*l0 - a;
+	pref = 1.0;
+	for( j = 1; j <= a; j++ ) pref *= (REAL8)( 2*l0 - a + j ) / j;
+	pref = sqrt( pref );
+	if( lam % 2 ) pref = -pref;
+	for( k = 0; k < n; k++ ){
+		REAL8 v = pref;
+		for( j = 0; j < a; j++ ) v *= sh[k];
+		for( j = 0; j < b; j++ ) v *= ch[k];
+		work[l0*n + k] = v;
+	}
+
+	/* three-term recurrence in l; the terms in d^{l-2} vanish for l = l0 + 1 */
+	for( l = l0 + 1; l <= lmax; l++ ){
+		REAL8 *dl = work + l*n;
+		const REAL8 *dl1 = dl - n;
+		const REAL8 *dl2 = dl - 2*n;
+		REAL8 denom, c0, c1, c2;
+		if( l == 1 ){
+			/* l0 = 0, so m = mp = 0: d^1_{00} = cos(beta) */
+			for( k = 0; k < n; k++ ) dl[k] = cb[k] * dl1[k];
+			continue;
+		}
+		denom = ( l - 1 ) * sqrt( (REAL8)( l*l - m*m ) * ( l*l - mp*mp ) );
+		c1 = ( 2*l - 1 ) * (REAL8)( l * ( l - 1 ) ) / denom;
+		c0 = -( 2*l - 1 ) * (REAL8)( m * mp ) / denom;
+		if( l - 2 >= l0 ){
+			c2 = l * sqrt( (REAL8)( (l-1)*(l-1) - m*m ) * ( (l-1)*(l-1) - mp*mp ) ) / denom;
+			for( k = 0; k < n; k++ ) dl[k] = ( c1 * cb[k] + c0 ) * dl1[k] - c2 * dl2[k];
+		} else {
+			for( k = 0; k < n; k++ ) dl[k] = ( c1 * cb[k] + c0 ) * dl1[k];
+		}
+	}
+}
+
+/**
+ * Computes the 'little' d Wigner matrix elements \f$ d^l_{m'm}(\beta) \f$ for
+ * all \f$ 0 \le l \le l_{\rm max} \f$ and \f$ -l \le m',m \le l \f$, for each
+ * of the \c n Euler angles \c beta, with the same conventions as
+ * XLALWignerdMatrix().
+ *
+ * Rather than evaluating each element separately, the elements are computed
+ * by the stable three-term recurrence in \f$ l \f$, starting from the closed
+ * form at \f$ l = \max(|m|,|m'|) \f$; the loops over angles are innermost so
+ * that they can be vectorised.
+ *
+ * The element \f$ d^l_{m'm}(\beta_k) \f$ is stored in
+ * <tt>d[XLALWignerdMatrixIndex(l, mp, m) * n + k]</tt>; \c d must therefore
+ * hold <tt>XLALWignerdMatrixIndex(lmax + 1, -lmax - 1, -lmax - 1) * n</tt>
+ * elements.
+ */
+int XLALWignerdMatrixBatch(
+                                   REAL8 *d,           /**< output matrix elements */
+                                   int lmax,           /**< maximum mode number l */
+                                   const REAL8 *beta,  /**< euler angles (rad) */
+                                   size_t n            /**< number of euler angles */
+    )
+{
+	REAL8 *work, *cb, *sh, *ch;
+	int l, mp, m;
+	size_t k;
+
+	XLAL_CHECK( d != NULL, XLAL_EFAULT );
+	XLAL_CHECK( beta != NULL, XLAL_EFAULT );
+	XLAL_CHECK( lmax >= 0, XLAL_EINVAL, "Invalid maximum mode number lmax=%d", lmax );
+
+	work = XLALMalloc( ( lmax + 4 ) * n * sizeof( *work ) );
+	XLAL_CHECK( work != NULL, XLAL_ENOMEM );
+	cb = work + ( lmax + 1 ) * n;
+	sh = cb + n;
+	ch = sh + n;
+	for( k = 0; k < n; k++ ){
+		cb[k] = cos( beta[k] );
+		sh[k] = sin( beta[k] / 2.0 );
+		ch[k] = cos( beta[k] / 2.0 );
+	}
+
+	for( mp = -lmax; mp <= lmax; mp++ ){
+		for( m = -lmax; m <= lmax; m++ ){
+			const int l0 = abs(m) > abs(mp) ? abs(m) : abs(mp);
+			WignerdRecurrence( work, lmax, mp, m, cb, sh, ch, n );
+			for( l = l0; l <= lmax; l++ ){
+				memcpy( d + XLALWignerdMatrixIndex( l, mp, m ) * n, work + l*n, n * sizeof( *d ) );
+			}
+		}
+	}
+
+	XLALFree( work );
+	return XLAL_SUCCESS;
+}
+
+/**
+ * Computes the spin-weighted spherical harmonics \f$ {}_{s}Y_{lm}(\theta,\phi) \f$
+ * for all \f$ 0 \le l \le l_{\rm max} \f$ and \f$ -l \le m \le l \f$, for each
+ * of the \c n pairs of angles \c theta and \c phi, with the same conventions as
+ * XLALSpinWeightedSphericalHarmonic(); harmonics with \f$ l < |s| \f$ are zero.
+ *
+ * The harmonics are computed from the Wigner matrix elements
+ * \f$ {}_{s}Y_{lm}(\theta,\phi) = (-1)^s \sqrt{(2l+1)/4\pi}\, d^l_{m,-s}(\theta) e^{im\phi} \f$,
+ * which are computed by recurrence as in XLALWignerdMatrixBatch(), so any
+ * spin weight and mode number is supported.
+ *
+ * The harmonic \f$ {}_{s}Y_{lm}(\theta_k,\phi_k) \f$ is stored in
+ * <tt>Y[(l*l + l + m) * n + k]</tt>; \c Y must therefore hold
+ * <tt>(lmax + 1) * (lmax + 1) * n</tt> elements.
+ */
+int XLALSpinWeightedSphericalHarmonicBatch(
+                                   COMPLEX16 *Y,        /**< output harmonics */
+                                   int s,               /**< spin weight */
+                                   int lmax,            /**< maximum mode number l */
+                                   const REAL8 *theta,  /**< polar angles (rad) */
+                                   const REAL8 *phi,    /**< azimuthal angles (rad) */
+                                   size_t n             /**< number of angles */
+    )
+{
+	REAL8 *work, *cb, *sh, *ch;
+	COMPLEX16 *eimphi;
+	int l, m;
+	size_t k;
+
+	XLAL_CHECK( Y != NULL, XLAL_EFAULT );
+	XLAL_CHECK( theta != NULL, XLAL_EFAULT );
+	XLAL_CHECK( phi != NULL, XLAL_EFAULT );
+	XLAL_CHECK( lmax >= 0, XLAL_EINVAL, "Invalid maximum mode number lmax=%d", lmax );
+
+	work = XLALMalloc( ( lmax + 4 ) * n * sizeof( *work ) );
+	eimphi = XLALMalloc( n * sizeof( *eimphi ) );
+	if( work == NULL || eimphi == NULL ){
+		XLALFree( work );
+		XLALFree( eimphi );
+		XLAL_ERROR( XLAL_ENOMEM );
+	}
+	cb = work + ( lmax + 1 ) * n;
+	sh = cb + n;
+	ch = sh + n;
+	for( k = 0; k < n; k++ ){
+		cb[k] = cos( theta[k] );
+		sh[k] = sin( theta[k] / 2.0 );
+		ch[k] = cos( theta[k] / 2.0 );
+	}
+
+	/* harmonics with l < |s| vanish */
+	for( l = 0; l < abs(s) && l <= lmax; l++ ){
+		memset( Y + l*l*n, 0, ( 2*l + 1 ) * n * sizeof( *Y ) );
+	}
+
+	for( m = -lmax; m <= lmax; m++ ){
+		const int l0 = abs(m) > abs(s) ? abs(m) : abs(s);
+		if( l0 > lmax ) continue;
+		WignerdRecurrence( work, lmax, m, -s, cb, sh, ch, n );
+		for( k = 0; k < n; k++ ){
+			eimphi[k] = m ? cpolar( 1.0, m*phi[k] ) : 1.0;
+		}
+		for( l = l0; l <= lmax; l++ ){
+			const REAL8 fac = ( s % 2 ? -1.0 : 1.0 ) * sqrt( ( 2*l + 1 ) / ( 4.0 * LAL_PI ) );
+			COMPLEX16 *Ylm = Y + ( l*l + l + m ) * n;
+			const REAL8 *dl = work + l*n;
+			for( k = 0; k < n; k++ ){
+				Ylm[k] = fac * dl[k] * eimphi[k];
+			}
+		}
+	}
+
+	XLALFree( work );
+	XLALFree( eimphi );
+	return XLAL_SUCCESS;
+}
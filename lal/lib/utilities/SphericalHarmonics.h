@@ -50,6 +50,9 @@ INT4 XLALSphHarm ( COMPLEX16 *out, UINT4   L, INT4 M, REAL4 theta, REAL4   phi )
 double XLALJacobiPolynomial( int n, int alpha, int beta, double x );
 double XLALWignerdMatrix( int l, int mp, int m, double beta );
 COMPLEX16 XLALWignerDMatrix( int l, int mp, int m, double alpha, double beta, double gam );
+int XLALWignerdMatrixIndex( int l, int mp, int m );
+int XLALWignerdMatrixBatch( REAL8 *d, int lmax, const REAL8 *beta, size_t n );
+int XLALSpinWeightedSphericalHarmonicBatch( COMPLEX16 *Y, int s, int lmax, const REAL8 *theta, const REAL8 *phi, size_t n );
 /** @} */
 
 
@@ -95,6 +95,7 @@ DEFINE_ALIGNED_VECT_API(COMPLEX16);
 // -------------------- export vector-operation functions --------------------
 
 /* Declare the function pointer, define the dispatch function, and export vector math function with supported instruction sets */
+/* ISET1..ISET4 are tried in that order, the first one supported at runtime is used, and GEN otherwise; unused slots are NONE */
 #define EXPORT_VECTORMATH_ANY(NAME, ARG_DEF, ARG_CALL, ISET1, ISET2, ISET3, ISET4) \
   \
   static int XLALVector##NAME##_DISPATCH ARG_DEF; \
@@ -133,7 +134,7 @@ EXPORT_VECTORMATH_S2I(INT4From, SSE2, NONE, NONE, NONE)
 
 EXPORT_VECTORMATH_S2S(Sin, AVX2, AVX, SSE2, NONE)
 EXPORT_VECTORMATH_S2S(Cos, AVX2, AVX, SSE2, NONE)
-EXPORT_VECTORMATH_S2S(Exp, AVX2, AVX, SSE2, NONE)
+EXPORT_VECTORMATH_S2S(Exp, AVX512F, AVX2, AVX, SSE2)
 EXPORT_VECTORMATH_S2S(Log, AVX2, AVX, SSE2, NONE)
 EXPORT_VECTORMATH_S2S(Round, AVX2, AVX, NONE, NONE)
 
@@ -142,7 +143,7 @@ EXPORT_VECTORMATH_S2S(Round, AVX2, AVX, NONE, NONE)
   EXPORT_VECTORMATH_ANY( NAME ## REAL4, (REAL4 *out1, REAL4 *out2, const REAL4 *in, const UINT4 len), (out1, out2, in, len), __VA_ARGS__ )
 
 EXPORT_VECTORMATH_S2SS(SinCos, AVX2, AVX, SSE2, NONE)
-EXPORT_VECTORMATH_S2SS(SinCos2Pi, AVX2, AVX, SSE2, NONE)
+EXPORT_VECTORMATH_S2SS(SinCos2Pi, AVX512F, AVX2, AVX, SSE2)
 
 // ---------- define exported vector math functions with 2 REAL4 vector inputs to 1 REAL4 vector output (SS2S) ----------
 #define EXPORT_VECTORMATH_SS2S(NAME, ...)                                    \
@@ -164,13 +165,13 @@ EXPORT_VECTORMATH_sS2S(Shift, AVX2, AVX, SSE2, NONE)
 #define EXPORT_VECTORMATH_SS2uU(NAME, ...)                            \
   EXPORT_VECTORMATH_ANY( NAME ## REAL4, ( UINT4* count, UINT4 *out, const REAL4 *in1, const REAL4 *in2, const UINT4 len ), (count, out, in1, in2, len), __VA_ARGS__ )
 
-EXPORT_VECTORMATH_SS2uU(FindVectorLessEqual, AVX2, SSSE3, NONE, NONE)
+EXPORT_VECTORMATH_SS2uU(FindVectorLessEqual, AVX512F, AVX2, SSSE3, NONE)
 
 // ---------- define exported vector math functions with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 scalar and 1 UINT4 vector output (sS2uU) ----------
 #define EXPORT_VECTORMATH_sS2uU(NAME, ...)                            \
   EXPORT_VECTORMATH_ANY( NAME ## REAL4, ( UINT4* count, UINT4 *out, REAL4 scalar, const REAL4 *in, const UINT4 len ), (count, out, scalar, in, len), __VA_ARGS__ )
 
-EXPORT_VECTORMATH_sS2uU(FindScalarLessEqual, AVX2, SSSE3, NONE, NONE)
+EXPORT_VECTORMATH_sS2uU(FindScalarLessEqual, AVX512F, AVX2, SSSE3, NONE)
 
 // ---------- define exported vector math functions with 1 REAL8 scalar, 1 REAL8 vector inputs to 1 REAL8 vector output (dD2D) ----------
 #define EXPORT_VECTORMATH_dD2D(NAME, ...)                                    \
@@ -192,7 +193,7 @@ EXPORT_VECTORMATH_DD2D(Max, AVX2, AVX, NONE, NONE)
 #define EXPORT_VECTORMATH_CC2C(NAME, ...)                                    \
   EXPORT_VECTORMATH_ANY( NAME ## COMPLEX8, (COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const UINT4 len), (out, in1, in2, len), __VA_ARGS__ )
 
-EXPORT_VECTORMATH_CC2C(Multiply, AVX2, AVX, SSE2, NONE)
+EXPORT_VECTORMATH_CC2C(Multiply, AVX512F, AVX2, AVX, SSE2)
 EXPORT_VECTORMATH_CC2C(Add, AVX2, AVX, SSE2, NONE)
 
 // ---------- define exported vector math functions with 1 COMPLEX8 scalar and 1 COMPLEX8 vector inputs to 1 COMPLEX8 vector output (cC2C) ----------
@@ -207,4 +208,50 @@ EXPORT_VECTORMATH_cC2C(Shift, AVX2, AVX, SSE2, NONE)
   EXPORT_VECTORMATH_ANY( NAME ## REAL8, (REAL8 *out, const REAL8 *in, const UINT4 len), (out, in, len), __VA_ARGS__ )
 
 EXPORT_VECTORMATH_D2D(Round, AVX2, AVX, NONE, NONE)
+EXPORT_VECTORMATH_D2D(Exp, AVX2, AVX, NONE, NONE)
+EXPORT_VECTORMATH_D2D(Log, AVX2, AVX, NONE, NONE)
+
+// ---------- define exported vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define EXPORT_VECTORMATH_D2DD(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## REAL8, (REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len), (out1, out2, in, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_D2DD(SinCos, AVX2, AVX, NONE, NONE)
+
+// ---------- define exported vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define EXPORT_VECTORMATH_ZZ2Z(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len), (out, in1, in2, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_ZZ2Z(Multiply, AVX2, AVX, SSE2, NONE)
+EXPORT_VECTORMATH_ZZ2Z(ConjugateMultiply, AVX2, AVX, SSE2, NONE)
+
+// ---------- define exported vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+#define EXPORT_VECTORMATH_zZ2Z(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len), (out, scalar, in, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_zZ2Z(Scale, AVX2, AVX, SSE2, NONE)
+
+// ---------- define exported vector math functions with 2 REAL8 vector inputs to 1 REAL8 scalar output (DD2d) ----------
+#define EXPORT_VECTORMATH_DD2d(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## REAL8, (REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len), (out, in1, in2, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_DD2d(DotProduct, AVX2, AVX, SSE2, NONE)
+
+// ---------- define exported vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 scalar output (ZZ2z) ----------
+#define EXPORT_VECTORMATH_ZZ2z(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len), (out, in1, in2, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_ZZ2z(DotProduct, AVX2, AVX, SSE2, NONE)
+EXPORT_VECTORMATH_ZZ2z(ConjugateDotProduct, AVX2, AVX, SSE2, NONE)
+
+// ---------- define exported vector math functions with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define EXPORT_VECTORMATH_ZZD2z(NAME, ...)                                   \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len), (out, in1, in2, weight, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_ZZD2z(WeightedInnerProduct, AVX2, AVX, SSE2, NONE)
+
+// ---------- define exported vector math functions with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output (CCS2c) ----------
+#define EXPORT_VECTORMATH_CCS2c(NAME, ...)                                   \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX8, (COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len), (out, in1, in2, weight, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_CCS2c(WeightedInnerProduct, AVX2, AVX, SSE2, NONE)
 
@@ -44,6 +44,26 @@ extern "C" {
  *
  * Neither input nor output vectors are \b required to have any particular memory alignment. Nevertheless, performance
  * \e may be improved if vectors are 16-byte aligned for SSE, and 32-byte aligned for AVX.
+ *
+ * ### Accuracy ###
+ *
+ * The REAL8 and COMPLEX16 functions are tested against the C99 math library. Unless otherwise noted they agree exactly
+ * with libm (vector arithmetic), or to within a few units in the last place (elementary functions):
+ * - XLALVectorSinCosREAL8(): absolute error \f$< 4\times 10^{-16}\f$ for \f$|\text{in}| \le 10^3\f$, growing linearly
+ *   with \f$|\text{in}|\f$; arguments should be reduced by the caller to \f$|\text{in}| < 2^{30}\f$
+ * - XLALVectorExpREAL8(): relative error \f$< 4\times 10^{-16}\f$; overflows to \f$+\infty\f$ and underflows to zero
+ *   as for libm
+ * - XLALVectorLogREAL8(): relative error \f$< 4\times 10^{-16}\f$ for positive normal and denormal arguments;
+ *   special values (zero, negative, infinite, NaN) are handled as for libm
+ * - XLALVectorMultiplyCOMPLEX16(), XLALVectorConjugateMultiplyCOMPLEX16(), XLALVectorScaleCOMPLEX16(): products are
+ *   computed using the textbook formula, and agree exactly with C99 complex multiplication for finite arguments
+ * - XLALVectorDotProductREAL8(), XLALVectorDotProductCOMPLEX16(), XLALVectorConjugateDotProductCOMPLEX16(): products are summed in several
+ *   independent partial sums, so the result may differ from a sequential sum by the usual floating-point summation
+ *   error, i.e. up to \f$\sim \text{len} \times 10^{-16} \times \sum |\text{in1}| |\text{in2}|\f$
+ * - XLALVectorWeightedInnerProductCOMPLEX16(), XLALVectorWeightedInnerProductCOMPLEX8(): terms are summed directly in
+ *   blocks of 128, and the block sums are then added pairwise, so the summation error grows only logarithmically with
+ *   \c len, i.e. up to \f$\sim (32 + \log_2 \text{len}) \times 10^{-16} \times \sum |\text{in1}| |\text{in2}| |\text{weight}|\f$;
+ *   the COMPLEX8 version is computed in double precision, and its result is correctly rounded in almost all cases
  */
 /** @{ */
 
@@ -156,12 +176,21 @@ int XLALVectorRoundREAL4 ( REAL4 *out, const REAL4 *in, const UINT4 len);
 /** Compute \f$\text{out} = round ( \text{in} )\f$ over REAL8 vectors \c out, \c in with \c len elements */
 int XLALVectorRoundREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len);
 
+/** Compute \f$\text{out} = \exp(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements */
+int XLALVectorExpREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \log(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements */
+int XLALVectorLogREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
 /** Compute \f$\text{out1} = \sin(\text{in}), \text{out2} = \cos(\text{in})\f$ over REAL4 vectors \c out1, \c out2, \c in with \c len elements */
 int XLALVectorSinCosREAL4 ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UINT4 len );
 
 /** Compute \f$\text{out1} = \sin(2\pi \text{in}), \text{out2} = \cos(2\pi \text{in})\f$ over REAL4 vectors \c out1, \c out2, \c in with \c len elements */
 int XLALVectorSinCos2PiREAL4 ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UINT4 len );
 
+/** Compute \f$\text{out1} = \sin(\text{in}), \text{out2} = \cos(\text{in})\f$ over REAL8 vectors \c out1, \c out2, \c in with \c len elements */
+int XLALVectorSinCosREAL8 ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len );
+
 /** @} */
 
 /** \name Vector by Vector Operations */
@@ -197,6 +226,35 @@ int XLALVectorMultiplyCOMPLEX8 (  COMPLEX8 *out, const COMPLEX8 *in1, const COMP
 /** Compute \f$\text{out} = \text{in1} + \text{in2}\f$ over COMPLEX8 vectors \c in1 and \c in2 with \c len elements */
 int XLALVectorAddCOMPLEX8 ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const UINT4 len);
 
+/** Compute \f$\text{out} = \text{in1} \times \text{in2}\f$ over COMPLEX16 vectors \c in1 and \c in2 with \c len elements */
+int XLALVectorMultiplyCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len );
+
+/** Compute \f$\text{out} = \text{in1} \times \text{in2}^*\f$ over COMPLEX16 vectors \c in1 and \c in2 with \c len elements */
+int XLALVectorConjugateMultiplyCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len );
+
+/** Compute \f$\text{out} = \sum_i \text{in1}_i \times \text{in2}_i\f$ over REAL8 vectors \c in1 and \c in2 with \c len elements */
+int XLALVectorDotProductREAL8 ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len );
+
+/** Compute \f$\text{out} = \sum_i \text{in1}_i \times \text{in2}_i\f$ over COMPLEX16 vectors \c in1 and \c in2 with \c len elements */
+int XLALVectorDotProductCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len );
+
+/** Compute \f$\text{out} = \sum_i \text{in1}_i \times \text{in2}_i^*\f$ over COMPLEX16 vectors \c in1 and \c in2 with \c len elements */
+int XLALVectorConjugateDotProductCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len );
+
+/**
+ * Compute the noise-weighted inner product \f$\text{out} = \sum_i \text{in1}_i^* \times \text{in2}_i \times \text{weight}_i\f$
+ * over COMPLEX16 vectors \c in1 and \c in2 and REAL8 vector \c weight with \c len elements. For a matched-filter
+ * overlap \f$\sum_i d_i^* h_i / S_i\f$, pass the inverse power spectral density \f$1/S_i\f$ as \c weight.
+ */
+int XLALVectorWeightedInnerProductCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len );
+
+/**
+ * Compute the noise-weighted inner product \f$\text{out} = \sum_i \text{in1}_i^* \times \text{in2}_i \times \text{weight}_i\f$
+ * over COMPLEX8 vectors \c in1 and \c in2 and REAL4 vector \c weight with \c len elements; the sum is accumulated in
+ * double precision. See XLALVectorWeightedInnerProductCOMPLEX16().
+ */
+int XLALVectorWeightedInnerProductCOMPLEX8 ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len );
+
 /** @} */
 
 /** \name Vector by Scalar Operations */
@@ -220,6 +278,9 @@ int XLALVectorScaleCOMPLEX8 ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in
 /** Compute \f$\text{out} = \text{scalar} + \text{in}\f$ over COMPLEX8 vector \c in with \c len elements */
 int XLALVectorShiftCOMPLEX8 ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in, const UINT4 len);
 
+/** Compute \f$\text{out} = \text{scalar} \times \text{in}\f$ over COMPLEX16 vector \c in with \c len elements */
+int XLALVectorScaleCOMPLEX16 ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len);
+
 /** @} */
 
 /** \name Vector Element Finding Operations */
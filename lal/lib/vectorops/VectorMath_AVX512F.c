@@ -0,0 +1,170 @@
+//
+// Copyright (C) 2021 Yiqi Xie
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// ---------- INCLUDES ----------
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <config.h>
+
+#include <lal/LALConstants.h>
+#include <lal/VectorMath.h>
+
+#include "VectorMath_internal.h"
+
+#if !defined(__AVX512F__) || !defined(__FMA__)
+#error "VectorMath_AVX512F.c requires SIMD instruction sets AVX512F and FMA"
+#endif
+
+#include "VectorMath_avx512_mathfun.h"
+
+// ---------- local operators and operator-wrappers ----------
+
+// in1: a0,b0,a1,b1,...,a7,b7 in2: c0,d0,c1,d1,...,c7,d7
+UNUSED static inline __m512
+local_cmul_ps ( __m512 in1, __m512 in2 )
+{
+  // c0,c0,c1,c1,... and d0,d0,d1,d1,...
+  __m512 re2 = _mm512_moveldup_ps(in2);
+  __m512 im2 = _mm512_movehdup_ps(in2);
+
+  // Switch the real and imaginary elements of in1
+  // b0,a0,b1,a1,...
+  __m512 sw1 = _mm512_permute_ps(in1, 0xb1);
+
+  // a0c0,b0c0,a1c1,b1c1,... and b0d0,a0d0,b1d1,a1d1,...
+  __m512 t1 = _mm512_mul_ps(in1, re2);
+  __m512 t2 = _mm512_mul_ps(sw1, im2);
+
+  // a0c0-b0d0, b0c0+a0d0, a1c1-b1d1, b1c1+a1d1, ...
+  // AVX-512F has no addsub instruction, so subtract in the even (real) elements only.
+  // Since this file is compiled with -mfma the compiler may contract the products into
+  // fused multiply-adds, so results can differ from the other instruction sets by rounding;
+  // VectorMathTest checks them against the generic implementation to abstol = reltol = 2e-7
+  return _mm512_mask_sub_ps(_mm512_add_ps(t1, t2), 0x5555, t1, t2);
+}
+
+// ========== internal generic AVX512F functions ==========
+
+// ---------- generic AVX512F operator with 1 REAL4 vector input to 1 REAL4 vector output (S2S) ----------
+static inline int
+XLALVectorMath_S2S_AVX512F ( REAL4 *out, const REAL4 *in, const UINT4 len, __m512 (*f)(__m512) )
+{
+
+  // walk through vector in blocks of 16
+  UINT4 i16Max = len - ( len % 16 );
+  for ( UINT4 i16 = 0; i16 < i16Max; i16 += 16 )
+    {
+      __m512 in16p = _mm512_loadu_ps(&in[i16]);
+      __m512 out16p = (*f)( in16p );
+      _mm512_storeu_ps(&out[i16], out16p);
+    }
+
+  // deal with the remaining (<=15) terms using masked loads and stores
+  if ( i16Max < len )
+    {
+      __mmask16 m = (__mmask16) ( ( 1u << ( len - i16Max ) ) - 1 );
+      __m512 in16p = _mm512_maskz_loadu_ps(m, &in[i16Max]);
+      __m512 out16p = (*f)( in16p );
+      _mm512_mask_storeu_ps(&out[i16Max], m, out16p);
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_S2S_AVX512F()
+
+// ---------- generic AVX512F operator with 1 REAL4 vector input to 2 REAL4 vector outputs (S2SS) ----------
+static inline int
+XLALVectorMath_S2SS_AVX512F ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UINT4 len, void (*f)(__m512, __m512*, __m512*) )
+{
+
+  // walk through vector in blocks of 16
+  UINT4 i16Max = len - ( len % 16 );
+  for ( UINT4 i16 = 0; i16 < i16Max; i16 += 16 )
+    {
+      __m512 in16p = _mm512_loadu_ps(&in[i16]);
+      __m512 out16p_1, out16p_2;
+      (*f) ( in16p, &out16p_1, &out16p_2 );
+      _mm512_storeu_ps(&out1[i16], out16p_1);
+      _mm512_storeu_ps(&out2[i16], out16p_2);
+    }
+
+  // deal with the remaining (<=15) terms using masked loads and stores
+  if ( i16Max < len )
+    {
+      __mmask16 m = (__mmask16) ( ( 1u << ( len - i16Max ) ) - 1 );
+      __m512 in16p = _mm512_maskz_loadu_ps(m, &in[i16Max]);
+      __m512 out16p_1, out16p_2;
+      (*f) ( in16p, &out16p_1, &out16p_2 );
+      _mm512_mask_storeu_ps(&out1[i16Max], m, out16p_1);
+      _mm512_mask_storeu_ps(&out2[i16Max], m, out16p_2);
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_S2SS_AVX512F()
+
+// ---------- generic AVX512F operator with 2 COMPLEX8 vector inputs to 1 COMPLEX8 vector output (CC2C) ----------
+static inline int
+XLALVectorMath_CC2C_AVX512F ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const UINT4 len, __m512 (*op)(__m512, __m512) )
+{
+
+  // walk through vector in blocks of 8
+  UINT4 i8Max = len - ( len % 8 );
+  for ( UINT4 i8 = 0; i8 < i8Max; i8 += 8 )
+    {
+      __m512 in16p_1 = _mm512_loadu_ps( (const REAL4*)&in1[i8] );
+      __m512 in16p_2 = _mm512_loadu_ps( (const REAL4*)&in2[i8] );
+      __m512 out16p = (*op) ( in16p_1, in16p_2 );
+      _mm512_storeu_ps( (REAL4*)&out[i8], out16p );
+    }
+
+  // deal with the remaining (<=7) terms using masked loads and stores
+  if ( i8Max < len )
+    {
+      __mmask16 m = (__mmask16) ( ( 1u << ( 2 * ( len - i8Max ) ) ) - 1 );
+      __m512 in16p_1 = _mm512_maskz_loadu_ps( m, (const REAL4*)&in1[i8Max] );
+      __m512 in16p_2 = _mm512_maskz_loadu_ps( m, (const REAL4*)&in2[i8Max] );
+      __m512 out16p = (*op) ( in16p_1, in16p_2 );
+      _mm512_mask_storeu_ps( (REAL4*)&out[i8Max], m, out16p );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_CC2C_AVX512F()
+
+// ========== internal AVX512F vector math functions ==========
+
+// ---------- define vector math functions with 1 REAL4 vector input to 1 REAL4 vector output (S2S) ----------
+#define DEFINE_VECTORMATH_S2S(NAME, AVX_OP)                             \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_S2S_AVX512F, NAME ## REAL4, ( REAL4 *out, const REAL4 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_S2S(Exp, exp512_ps)
+
+// ---------- define vector math functions with 1 REAL4 vector input to 2 REAL4 vector outputs (S2SS) ----------
+#define DEFINE_VECTORMATH_S2SS(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_S2SS_AVX512F, NAME ## REAL4, ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_S2SS(SinCos2Pi, sincos512_ps_2pi)
+
+// ---------- define vector math functions with 2 COMPLEX8 vector inputs to 1 COMPLEX8 vector output (CC2C) ----------
+#define DEFINE_VECTORMATH_CC2C(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_CC2C_AVX512F, NAME ## COMPLEX8, ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_CC2C(Multiply, local_cmul_ps)
@@ -0,0 +1,152 @@
+//
+// Copyright (C) 2021 Yiqi Xie
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// ---------- INCLUDES ----------
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <config.h>
+
+#include <lal/LALConstants.h>
+#include <lal/VectorMath.h>
+
+#include "VectorMath_internal.h"
+
+#include <immintrin.h>
+
+// ---------- local operators and operator-wrappers ----------
+UNUSED static inline __mmask16
+local_cmple_ps ( __m512 in1, __m512 in2 )
+{
+  return _mm512_cmp_ps_mask ( in1, in2, _CMP_LE_OQ );
+}
+
+// number of bits set in a 16-bit mask
+static inline UINT4
+local_popcount16 ( __mmask16 mask )
+{
+  UINT4 m = mask;
+  m = m - ( ( m >> 1 ) & 0x5555 );
+  m = ( m & 0x3333 ) + ( ( m >> 2 ) & 0x3333 );
+  m = ( m + ( m >> 4 ) ) & 0x0f0f;
+  return ( m + ( m >> 8 ) ) & 0x1f;
+}
+
+// ========== internal generic AVX512F functions ==========
+
+//
+// See VectorMath_SSSE3_Find.c for a description of the general idea behind the algorithm in the following functions.
+// AVX-512F provides a compress-store instruction, which writes only those elements selected by a mask to contiguous
+// memory, and so replaces the shuffle tables used by the SSSE3 and AVX2 implementations.
+//
+
+// ---------- generic AVX512F operator with 2 REAL4 vector inputs to 1 UINT4 scalar and 1 UINT4 vector output (SS2uU) ----------
+static inline int
+XLALVectorMath_SS2uU_AVX512F ( UINT4* count, UINT4 *out, const REAL4 *in1, const REAL4 *in2, const UINT4 len, __mmask16 (*pred)(__m512, __m512) )
+{
+  const __m512i idx0 = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+  *count = 0;
+
+  // walk through vector in blocks of 16
+  UINT4 i16Max = len - ( len % 16 );
+  for ( UINT4 i16 = 0; i16 < i16Max; i16 += 16 )
+    {
+      // load vector inputs
+      __m512 in16p_1 = _mm512_loadu_ps(&in1[i16]);
+      __m512 in16p_2 = _mm512_loadu_ps(&in2[i16]);
+      // 'pred' returns a bitmask, bits are set if 'pred' is satisfied
+      __mmask16 mask = (*pred)(in16p_1, in16p_2);
+      // create packed int of indexes to current vector inputs, i.e. idx = i16 + (15, ..., 1, 0)
+      __m512i idx = _mm512_add_epi32(_mm512_set1_epi32(i16), idx0);
+      // store indexes of items for which 'pred' is satisfied in output
+      _mm512_mask_compressstoreu_epi32((void *) &out[*count], mask, idx);
+      // increment count by number of items for which 'pred' is satisfied
+      *count += local_popcount16(mask);
+    }
+
+  // deal with the remaining (<=15) terms using masked loads
+  if ( i16Max < len )
+    {
+      __mmask16 m = (__mmask16) ( ( 1u << ( len - i16Max ) ) - 1 );
+      __m512 in16p_1 = _mm512_maskz_loadu_ps(m, &in1[i16Max]);
+      __m512 in16p_2 = _mm512_maskz_loadu_ps(m, &in2[i16Max]);
+      __mmask16 mask = (*pred)(in16p_1, in16p_2) & m;
+      __m512i idx = _mm512_add_epi32(_mm512_set1_epi32(i16Max), idx0);
+      _mm512_mask_compressstoreu_epi32((void *) &out[*count], mask, idx);
+      *count += local_popcount16(mask);
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_SS2uU_AVX512F()
+
+// ---------- generic AVX512F operator with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 scalar and 1 UINT4 vector output (sS2uU) ----------
+static inline int
+XLALVectorMath_sS2uU_AVX512F ( UINT4* count, UINT4 *out, REAL4 scalar, const REAL4 *in, const UINT4 len, __mmask16 (*pred)(__m512, __m512) )
+{
+  const __m512i idx0 = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  const __m512 scalar16 = _mm512_set1_ps(scalar);
+
+  *count = 0;
+
+  // walk through vector in blocks of 16
+  UINT4 i16Max = len - ( len % 16 );
+  for ( UINT4 i16 = 0; i16 < i16Max; i16 += 16 )
+    {
+      // load vector inputs
+      __m512 in16p = _mm512_loadu_ps(&in[i16]);
+      // 'pred' returns a bitmask, bits are set if 'pred' is satisfied
+      __mmask16 mask = (*pred)(scalar16, in16p);
+      // create packed int of indexes to current vector inputs, i.e. idx = i16 + (15, ..., 1, 0)
+      __m512i idx = _mm512_add_epi32(_mm512_set1_epi32(i16), idx0);
+      // store indexes of items for which 'pred' is satisfied in output
+      _mm512_mask_compressstoreu_epi32((void *) &out[*count], mask, idx);
+      // increment count by number of items for which 'pred' is satisfied
+      *count += local_popcount16(mask);
+    }
+
+  // deal with the remaining (<=15) terms using masked loads
+  if ( i16Max < len )
+    {
+      __mmask16 m = (__mmask16) ( ( 1u << ( len - i16Max ) ) - 1 );
+      __m512 in16p = _mm512_maskz_loadu_ps(m, &in[i16Max]);
+      __mmask16 mask = (*pred)(scalar16, in16p) & m;
+      __m512i idx = _mm512_add_epi32(_mm512_set1_epi32(i16Max), idx0);
+      _mm512_mask_compressstoreu_epi32((void *) &out[*count], mask, idx);
+      *count += local_popcount16(mask);
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_sS2uU_AVX512F()
+
+// ========== internal AVX512F vector math functions ==========
+
+// ---------- define vector math functions with 2 REAL4 vector inputs to 1 UINT4 scalar and 1 UINT4 vector output (SS2uU) ----------
+#define DEFINE_VECTORMATH_SS2uU(NAME, PRED)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_SS2uU_AVX512F, NAME ## REAL4, ( UINT4* count, UINT4 *out, const REAL4 *in1, const REAL4 *in2, const UINT4 len ), ( (count != NULL) && (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( count, out, in1, in2, len, PRED ) )
+
+DEFINE_VECTORMATH_SS2uU(FindVectorLessEqual, local_cmple_ps)
+
+// ---------- define vector math functions with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 scalar and 1 UINT4 vector output (sS2uU) ----------
+#define DEFINE_VECTORMATH_sS2uU(NAME, PRED)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_sS2uU_AVX512F, NAME ## REAL4, ( UINT4* count, UINT4 *out, REAL4 scalar, const REAL4 *in, const UINT4 len ), ( (count != NULL) && (out != NULL) && (in != NULL) ), ( count, out, scalar, in, len, PRED ) )
+
+DEFINE_VECTORMATH_sS2uU(FindScalarLessEqual, local_cmple_ps)
@@ -34,6 +34,7 @@
 #endif
 
 #include "VectorMath_avx_mathfun.h"
+#include "VectorMath_avx_mathfun_pd.h"
 
 // ---------- local operators and operator-wrappers ----------
 UNUSED static inline __m256
@@ -184,6 +185,144 @@ local_cmul_ps ( __m256 in1, __m256 in2 )
   return _mm256_permute_ps(in2, 0xd8);
 }
 
+// in1: a0,b0,a1,b1 in2: c0,d0,c1,d1
+UNUSED static inline __m256d
+local_cmul_pd ( __m256d in1, __m256d in2 )
+{
+  // c0,c0,c1,c1 and d0,d0,d1,d1
+  __m256d re2 = _mm256_movedup_pd(in2);
+  __m256d im2 = _mm256_permute_pd(in2, 0xf);
+
+  // Switch the real and imaginary elements of in1
+  // b0,a0,b1,a1
+  __m256d sw1 = _mm256_permute_pd(in1, 0x5);
+
+  // a0c0-b0d0, b0c0+a0d0, a1c1-b1d1, b1c1+a1d1
+  return _mm256_addsub_pd(_mm256_mul_pd(in1, re2), _mm256_mul_pd(sw1, im2));
+}
+
+// in1: a0,b0,a1,b1 in2: c0,d0,c1,d1
+UNUSED static inline __m256d
+local_cmulconj_pd ( __m256d in1, __m256d in2 )
+{
+  __m256d neg = _mm256_set1_pd(-0.0);
+
+  // c0,c0,c1,c1 and -d0,-d0,-d1,-d1
+  __m256d re2 = _mm256_movedup_pd(in2);
+  __m256d im2 = _mm256_xor_pd(_mm256_permute_pd(in2, 0xf), neg);
+
+  // Switch the real and imaginary elements of in1
+  // b0,a0,b1,a1
+  __m256d sw1 = _mm256_permute_pd(in1, 0x5);
+
+  // a0c0+b0d0, b0c0-a0d0, a1c1+b1d1, b1c1-a1d1
+  return _mm256_addsub_pd(_mm256_mul_pd(in1, re2), _mm256_mul_pd(sw1, im2));
+}
+
+// accumulate conj(in1) * in2 * weight, for in1: a0,b0,a1,b1 in2: c0,d0,c1,d1 weight: w0,w0,w1,w1
+// sum_re accumulates a0c0w0,b0d0w0,a1c1w1,b1d1w1 and sum_im accumulates a0d0w0,b0c0w0,a1d1w1,b1c1w1; see local_wip_sum_pd()
+UNUSED static inline void
+local_wip_pd ( __m256d *sum_re, __m256d *sum_im, __m256d in1, __m256d in2, __m256d weight )
+{
+  __m256d in2w = _mm256_mul_pd(in2, weight);
+  *sum_re = _mm256_add_pd(*sum_re, _mm256_mul_pd(in1, in2w));
+  *sum_im = _mm256_add_pd(*sum_im, _mm256_mul_pd(in1, _mm256_permute_pd(in2w, 0x5)));
+}
+
+// combine partial sums accumulated by local_wip_pd()
+UNUSED static inline COMPLEX16
+local_wip_sum_pd ( __m256d sum_re, __m256d sum_im )
+{
+  V4SD re4, im4;
+  re4.v = sum_re;
+  im4.v = sum_im;
+  return crect( ( re4.f[0] + re4.f[1] ) + ( re4.f[2] + re4.f[3] ), ( im4.f[0] - im4.f[1] ) + ( im4.f[2] - im4.f[3] ) );
+}
+
+// load 2 REAL8 weights as w0,w0,w1,w1
+UNUSED static inline __m256d
+local_load_w2_pd ( const REAL8 *weight )
+{
+  return _mm256_permute_pd(_mm256_broadcast_pd( (const __m128d*)weight ), 0xc);
+}
+
+// sum of conj(in1[i]) * in2[i] * weight[i] over a block, accumulating into 2 independent partial sums
+UNUSED static inline COMPLEX16
+local_zwip_block_pd ( const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len )
+{
+  __m256d sum_re_1 = _mm256_setzero_pd(), sum_im_1 = _mm256_setzero_pd();
+  __m256d sum_re_2 = _mm256_setzero_pd(), sum_im_2 = _mm256_setzero_pd();
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      local_wip_pd( &sum_re_1, &sum_im_1, _mm256_loadu_pd( (const REAL8*)&in1[i4] ), _mm256_loadu_pd( (const REAL8*)&in2[i4] ), local_load_w2_pd( &weight[i4] ) );
+      local_wip_pd( &sum_re_2, &sum_im_2, _mm256_loadu_pd( (const REAL8*)&in1[i4+2] ), _mm256_loadu_pd( (const REAL8*)&in2[i4+2] ), local_load_w2_pd( &weight[i4+2] ) );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  UINT4 i = i4Max;
+  if ( i + 2 <= len )
+    {
+      local_wip_pd( &sum_re_1, &sum_im_1, _mm256_loadu_pd( (const REAL8*)&in1[i] ), _mm256_loadu_pd( (const REAL8*)&in2[i] ), local_load_w2_pd( &weight[i] ) );
+      i += 2;
+    }
+  if ( i < len )
+    {
+      V4SD in4_1 = {.f={creal(in1[i]),cimag(in1[i]),0,0}};
+      V4SD in4_2 = {.f={creal(in2[i]),cimag(in2[i]),0,0}};
+      V4SD w4 = {.f={weight[i],weight[i],0,0}};
+      local_wip_pd( &sum_re_2, &sum_im_2, in4_1.v, in4_2.v, w4.v );
+    }
+
+  return local_wip_sum_pd( _mm256_add_pd( sum_re_1, sum_re_2 ), _mm256_add_pd( sum_im_1, sum_im_2 ) );
+}
+
+// load 2 COMPLEX8 into double precision
+UNUSED static inline __m256d
+local_load_c2_pd ( const COMPLEX8 *in )
+{
+  return _mm256_cvtps_pd( _mm_loadu_ps( (const REAL4*)in ) );
+}
+
+// load 2 REAL4 weights into double precision as w0,w0,w1,w1
+UNUSED static inline __m256d
+local_load_w2_ps_pd ( const REAL4 *weight )
+{
+  __m128 w = _mm_castpd_ps( _mm_load_sd( (const REAL8*)weight ) );
+  return _mm256_cvtps_pd( _mm_unpacklo_ps( w, w ) );
+}
+
+// COMPLEX8 version of local_zwip_block_pd(), computed in double precision
+UNUSED static inline COMPLEX16
+local_cwip_block_pd ( const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len )
+{
+  __m256d sum_re_1 = _mm256_setzero_pd(), sum_im_1 = _mm256_setzero_pd();
+  __m256d sum_re_2 = _mm256_setzero_pd(), sum_im_2 = _mm256_setzero_pd();
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      local_wip_pd( &sum_re_1, &sum_im_1, local_load_c2_pd( &in1[i4] ), local_load_c2_pd( &in2[i4] ), local_load_w2_ps_pd( &weight[i4] ) );
+      local_wip_pd( &sum_re_2, &sum_im_2, local_load_c2_pd( &in1[i4+2] ), local_load_c2_pd( &in2[i4+2] ), local_load_w2_ps_pd( &weight[i4+2] ) );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  UINT4 i = i4Max;
+  if ( i + 2 <= len )
+    {
+      local_wip_pd( &sum_re_1, &sum_im_1, local_load_c2_pd( &in1[i] ), local_load_c2_pd( &in2[i] ), local_load_w2_ps_pd( &weight[i] ) );
+      i += 2;
+    }
+  if ( i < len )
+    {
+      V4SD in4_1 = {.f={crealf(in1[i]),cimagf(in1[i]),0,0}};
+      V4SD in4_2 = {.f={crealf(in2[i]),cimagf(in2[i]),0,0}};
+      V4SD w4 = {.f={weight[i],weight[i],0,0}};
+      local_wip_pd( &sum_re_2, &sum_im_2, in4_1.v, in4_2.v, w4.v );
+    }
+
+  return local_wip_sum_pd( _mm256_add_pd( sum_re_1, sum_re_2 ), _mm256_add_pd( sum_im_1, sum_im_2 ) );
+}
+
 // ========== internal generic AVXx functions ==========
 
 // ---------- generic AVXx operator with 1 REAL4 vector input to 1 REAL4 vector output (S2S) ----------
@@ -468,6 +607,214 @@ XLALVectorMath_D2D_AVXx ( REAL8 *out, const REAL8 *in, const UINT4 len, __m256d
 
 } // XLALVectorMath_D2D_AVXx()
 
+// ---------- generic AVXx operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_AVXx ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*f)(__m256d, __m256d*, __m256d*) )
+{
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m256d in4p = _mm256_loadu_pd(&in[i4]);
+      __m256d out4p_1, out4p_2;
+      (*f) ( in4p, &out4p_1, &out4p_2 );
+      _mm256_storeu_pd(&out1[i4], out4p_1);
+      _mm256_storeu_pd(&out2[i4], out4p_2);
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V4SD in4 = {.f={0,0,0,0}}, out4_1, out4_2;
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    in4.f[j] = in[i];
+  }
+  (*f) ( in4.v, &out4_1.v, &out4_2.v );
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    out1[i] = out4_1.f[j];
+    out2[i] = out4_2.f[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2DD_AVXx()
+
+// ---------- generic AVXx operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+static inline int
+XLALVectorMath_ZZ2Z_AVXx ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, __m256d (*op)(__m256d, __m256d) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m256d in4p_1 = _mm256_loadu_pd( (const REAL8*)&in1[i2] );
+      __m256d in4p_2 = _mm256_loadu_pd( (const REAL8*)&in2[i2] );
+      __m256d out4p = (*op) ( in4p_1, in4p_2 );
+      _mm256_storeu_pd( (REAL8*)&out[i2], out4p );
+    }
+
+  // deal with the remaining (<=1) term separately
+  if ( i2Max < len )
+    {
+      V4SD in4_1 = {.f={creal(in1[i2Max]),cimag(in1[i2Max]),0,0}};
+      V4SD in4_2 = {.f={creal(in2[i2Max]),cimag(in2[i2Max]),0,0}};
+      V4SD out4;
+      out4.v = (*op) ( in4_1.v, in4_2.v );
+      out[i2Max] = crect( out4.f[0], out4.f[1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZ2Z_AVXx()
+
+// ---------- generic AVXx operator with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+static inline int
+XLALVectorMath_zZ2Z_AVXx ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len, __m256d (*op)(__m256d, __m256d) )
+{
+  const V4SD scalar4 = {.f={creal(scalar),cimag(scalar),creal(scalar),cimag(scalar)}};
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m256d in4p = _mm256_loadu_pd( (const REAL8*)&in[i2] );
+      __m256d out4p = (*op) ( scalar4.v, in4p );
+      _mm256_storeu_pd( (REAL8*)&out[i2], out4p );
+    }
+
+  // deal with the remaining (<=1) term separately
+  if ( i2Max < len )
+    {
+      V4SD in4 = {.f={creal(in[i2Max]),cimag(in[i2Max]),0,0}};
+      V4SD out4;
+      out4.v = (*op) ( scalar4.v, in4.v );
+      out[i2Max] = crect( out4.f[0], out4.f[1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_zZ2Z_AVXx()
+
+// ---------- generic AVXx operator with 2 REAL8 vector inputs to 1 REAL8 scalar output, summing the operator results (DD2d) ----------
+static inline int
+XLALVectorMath_DD2d_AVXx ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len, __m256d (*op)(__m256d, __m256d) )
+{
+
+  // walk through vector in blocks of 8, accumulating into 2 independent partial sums
+  __m256d sum4p_1 = _mm256_setzero_pd();
+  __m256d sum4p_2 = _mm256_setzero_pd();
+  UINT4 i8Max = len - ( len % 8 );
+  for ( UINT4 i8 = 0; i8 < i8Max; i8 += 8 )
+    {
+      sum4p_1 = _mm256_add_pd( sum4p_1, (*op) ( _mm256_loadu_pd( &in1[i8] ), _mm256_loadu_pd( &in2[i8] ) ) );
+      sum4p_2 = _mm256_add_pd( sum4p_2, (*op) ( _mm256_loadu_pd( &in1[i8+4] ), _mm256_loadu_pd( &in2[i8+4] ) ) );
+    }
+
+  // deal with the remaining (<=7) terms separately
+  UINT4 i = i8Max;
+  if ( i + 4 <= len )
+    {
+      sum4p_1 = _mm256_add_pd( sum4p_1, (*op) ( _mm256_loadu_pd( &in1[i] ), _mm256_loadu_pd( &in2[i] ) ) );
+      i += 4;
+    }
+  if ( i < len )
+    {
+      V4SD in4_1 = {.f={0,0,0,0}};
+      V4SD in4_2 = {.f={0,0,0,0}};
+      for ( UINT4 j = 0; i + j < len; j ++ )
+        {
+          in4_1.f[j] = in1[i+j];
+          in4_2.f[j] = in2[i+j];
+        }
+      sum4p_2 = _mm256_add_pd( sum4p_2, (*op) ( in4_1.v, in4_2.v ) );
+    }
+
+  // add partial sums
+  V4SD sum4;
+  sum4.v = _mm256_add_pd( sum4p_1, sum4p_2 );
+  *out = ( sum4.f[0] + sum4.f[2] ) + ( sum4.f[1] + sum4.f[3] );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_DD2d_AVXx()
+
+// ---------- generic AVXx operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 scalar output, summing the operator results (ZZ2z) ----------
+static inline int
+XLALVectorMath_ZZ2z_AVXx ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, __m256d (*op)(__m256d, __m256d) )
+{
+
+  // walk through vector in blocks of 4, accumulating into 2 independent partial sums
+  __m256d sum4p_1 = _mm256_setzero_pd();
+  __m256d sum4p_2 = _mm256_setzero_pd();
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      sum4p_1 = _mm256_add_pd( sum4p_1, (*op) ( _mm256_loadu_pd( (const REAL8*)&in1[i4] ), _mm256_loadu_pd( (const REAL8*)&in2[i4] ) ) );
+      sum4p_2 = _mm256_add_pd( sum4p_2, (*op) ( _mm256_loadu_pd( (const REAL8*)&in1[i4+2] ), _mm256_loadu_pd( (const REAL8*)&in2[i4+2] ) ) );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  UINT4 i = i4Max;
+  if ( i + 2 <= len )
+    {
+      sum4p_1 = _mm256_add_pd( sum4p_1, (*op) ( _mm256_loadu_pd( (const REAL8*)&in1[i] ), _mm256_loadu_pd( (const REAL8*)&in2[i] ) ) );
+      i += 2;
+    }
+  if ( i < len )
+    {
+      V4SD in4_1 = {.f={creal(in1[i]),cimag(in1[i]),0,0}};
+      V4SD in4_2 = {.f={creal(in2[i]),cimag(in2[i]),0,0}};
+      sum4p_2 = _mm256_add_pd( sum4p_2, (*op) ( in4_1.v, in4_2.v ) );
+    }
+
+  // add partial sums
+  V4SD sum4;
+  sum4.v = _mm256_add_pd( sum4p_1, sum4p_2 );
+  *out = crect( sum4.f[0] + sum4.f[2], sum4.f[1] + sum4.f[3] );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZ2z_AVXx()
+
+// ---------- generic AVXx operator with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output, summing blocks of operator results pairwise (ZZD2z) ----------
+static inline int
+XLALVectorMath_ZZD2z_AVXx ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, COMPLEX16 (*blockop)(const COMPLEX16*, const COMPLEX16*, const REAL8*, const UINT4) )
+{
+
+  // walk through vector in blocks of VECTORMATH_PAIRWISE_BLOCKLEN, summing block sums pairwise
+  VectorMathPairwiseSum sum = { .nblocks = 0 };
+  for ( UINT4 i = 0; i < len; )
+    {
+      const UINT4 blocklen = ( len - i < VECTORMATH_PAIRWISE_BLOCKLEN ) ? len - i : VECTORMATH_PAIRWISE_BLOCKLEN;
+      XLALVectorMathPairwiseAdd ( &sum, (*blockop) ( &in1[i], &in2[i], &weight[i], blocklen ) );
+      i += blocklen;
+    }
+  *out = XLALVectorMathPairwiseTotal ( &sum );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZD2z_AVXx()
+
+// ---------- generic AVXx operator with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output, summing blocks of operator results pairwise (CCS2c) ----------
+static inline int
+XLALVectorMath_CCS2c_AVXx ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len, COMPLEX16 (*blockop)(const COMPLEX8*, const COMPLEX8*, const REAL4*, const UINT4) )
+{
+
+  // walk through vector in blocks of VECTORMATH_PAIRWISE_BLOCKLEN, summing block sums pairwise
+  VectorMathPairwiseSum sum = { .nblocks = 0 };
+  for ( UINT4 i = 0; i < len; )
+    {
+      const UINT4 blocklen = ( len - i < VECTORMATH_PAIRWISE_BLOCKLEN ) ? len - i : VECTORMATH_PAIRWISE_BLOCKLEN;
+      XLALVectorMathPairwiseAdd ( &sum, (*blockop) ( &in1[i], &in2[i], &weight[i], blocklen ) );
+      i += blocklen;
+    }
+  const COMPLEX16 total = XLALVectorMathPairwiseTotal ( &sum );
+  *out = crectf( creal( total ), cimag( total ) );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_CCS2c_AVXx()
+
 // ========== internal AVXx vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 REAL4 vector output (S2S) ----------
@@ -538,3 +885,49 @@ DEFINE_VECTORMATH_cC2C(Shift, local_add_ps)
   DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_AVXx, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, AVX_OP ) )
 
 DEFINE_VECTORMATH_D2D(Round, local_round_pd)
+DEFINE_VECTORMATH_D2D(Exp, exp256_pd)
+DEFINE_VECTORMATH_D2D(Log, log256_pd)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_AVXx, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, sincos256_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define DEFINE_VECTORMATH_ZZ2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2Z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZ2Z(Multiply, local_cmul_pd)
+DEFINE_VECTORMATH_ZZ2Z(ConjugateMultiply, local_cmulconj_pd)
+
+// ---------- define vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+#define DEFINE_VECTORMATH_zZ2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_zZ2Z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, scalar, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_zZ2Z(Scale, local_cmul_pd)
+
+// ---------- define vector math functions with 2 REAL8 vector inputs to 1 REAL8 scalar output (DD2d) ----------
+#define DEFINE_VECTORMATH_DD2d(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_DD2d_AVXx, NAME ## REAL8, ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_DD2d(DotProduct, local_mul_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 scalar output (ZZ2z) ----------
+#define DEFINE_VECTORMATH_ZZ2z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZ2z(DotProduct, local_cmul_pd)
+DEFINE_VECTORMATH_ZZ2z(ConjugateDotProduct, local_cmulconj_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define DEFINE_VECTORMATH_ZZD2z(NAME, AVX_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZD2z(WeightedInnerProduct, local_zwip_block_pd)
+
+// ---------- define vector math functions with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output (CCS2c) ----------
+#define DEFINE_VECTORMATH_CCS2c(NAME, AVX_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_CCS2c_AVXx, NAME ## COMPLEX8, ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_CCS2c(WeightedInnerProduct, local_cwip_block_pd)
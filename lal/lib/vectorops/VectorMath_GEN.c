@@ -46,6 +46,11 @@ static inline void local_sincosf_2pi(REAL4 in, REAL4 *out1, REAL4 *out2) {
   *out2 = cosf ( (REAL4)LAL_TWOPI * in );
 }
 
+static inline void local_sincos(REAL8 in, REAL8 *out1, REAL8 *out2) {
+  *out1 = sin ( in );
+  *out2 = cos ( in );
+}
+
 static inline REAL4 local_addf ( REAL4 x, REAL4 y ) {
   return x + y;
 }
@@ -80,6 +85,42 @@ static inline COMPLEX8 local_caddf ( COMPLEX8 x, COMPLEX8 y )
   return x + y;
 }
 
+static inline COMPLEX16 local_cmul ( COMPLEX16 x, COMPLEX16 y )
+{
+  return x * y;
+}
+
+static inline COMPLEX16 local_cmulconj ( COMPLEX16 x, COMPLEX16 y )
+{
+  return x * conj ( y );
+}
+
+// sum of conj(in1[i]) * in2[i] * weight[i] over a block, using the textbook formula
+static inline COMPLEX16 local_zwip_block ( const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len )
+{
+  REAL8 re = 0, im = 0;
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      const REAL8 yr = weight[i] * creal ( in2[i] ), yi = weight[i] * cimag ( in2[i] );
+      re += creal ( in1[i] ) * yr + cimag ( in1[i] ) * yi;
+      im += creal ( in1[i] ) * yi - cimag ( in1[i] ) * yr;
+    }
+  return crect ( re, im );
+}
+
+// COMPLEX8 version of local_zwip_block(), computed in double precision
+static inline COMPLEX16 local_cwip_block ( const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len )
+{
+  REAL8 re = 0, im = 0;
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      const REAL8 yr = (REAL8)weight[i] * crealf ( in2[i] ), yi = (REAL8)weight[i] * cimagf ( in2[i] );
+      re += crealf ( in1[i] ) * yr + cimagf ( in1[i] ) * yi;
+      im += crealf ( in1[i] ) * yi - cimagf ( in1[i] ) * yr;
+    }
+  return crect ( re, im );
+}
+
 static inline REAL4 local_fmaxf ( REAL4 x, REAL4 y ) {
   return (x > y) ? x : y;
 }
@@ -196,6 +237,96 @@ XLALVectorMath_D2D_GEN ( REAL8 *out, const REAL8 *in, const UINT4 len, REAL8 (*o
   return XLAL_SUCCESS;
 }
 
+// ---------- generic operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_GEN ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*op)(REAL8, REAL8*, REAL8*) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      (*op) ( in[i], &(out1[i]), &(out2[i]) );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+static inline int
+XLALVectorMath_ZZ2Z_GEN ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, COMPLEX16 (*op)(COMPLEX16, COMPLEX16) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      out[i] = (*op) ( in1[i], in2[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+static inline int
+XLALVectorMath_zZ2Z_GEN ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len, COMPLEX16 (*op)(COMPLEX16, COMPLEX16) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      out[i] = (*op) ( scalar, in[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 REAL8 vector inputs to 1 REAL8 scalar output, summing the operator results (DD2d) ----------
+static inline int
+XLALVectorMath_DD2d_GEN ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len, REAL8 (*op)(REAL8, REAL8) )
+{
+  REAL8 sum = 0;
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      sum += (*op) ( in1[i], in2[i] );
+    }
+  *out = sum;
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 scalar output, summing the operator results (ZZ2z) ----------
+static inline int
+XLALVectorMath_ZZ2z_GEN ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, COMPLEX16 (*op)(COMPLEX16, COMPLEX16) )
+{
+  COMPLEX16 sum = 0;
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      sum += (*op) ( in1[i], in2[i] );
+    }
+  *out = sum;
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output, summing blocks of operator results pairwise (ZZD2z) ----------
+static inline int
+XLALVectorMath_ZZD2z_GEN ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, COMPLEX16 (*blockop)(const COMPLEX16*, const COMPLEX16*, const REAL8*, const UINT4) )
+{
+  VectorMathPairwiseSum sum = { .nblocks = 0 };
+  for ( UINT4 i = 0; i < len; )
+    {
+      const UINT4 blocklen = ( len - i < VECTORMATH_PAIRWISE_BLOCKLEN ) ? len - i : VECTORMATH_PAIRWISE_BLOCKLEN;
+      XLALVectorMathPairwiseAdd ( &sum, (*blockop) ( &in1[i], &in2[i], &weight[i], blocklen ) );
+      i += blocklen;
+    }
+  *out = XLALVectorMathPairwiseTotal ( &sum );
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output, summing blocks of operator results pairwise (CCS2c) ----------
+static inline int
+XLALVectorMath_CCS2c_GEN ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len, COMPLEX16 (*blockop)(const COMPLEX8*, const COMPLEX8*, const REAL4*, const UINT4) )
+{
+  VectorMathPairwiseSum sum = { .nblocks = 0 };
+  for ( UINT4 i = 0; i < len; )
+    {
+      const UINT4 blocklen = ( len - i < VECTORMATH_PAIRWISE_BLOCKLEN ) ? len - i : VECTORMATH_PAIRWISE_BLOCKLEN;
+      XLALVectorMathPairwiseAdd ( &sum, (*blockop) ( &in1[i], &in2[i], &weight[i], blocklen ) );
+      i += blocklen;
+    }
+  const COMPLEX16 total = XLALVectorMathPairwiseTotal ( &sum );
+  *out = crectf ( creal ( total ), cimag ( total ) );
+  return XLAL_SUCCESS;
+}
+
 // ========== internal vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -272,3 +403,49 @@ DEFINE_VECTORMATH_cC2C(Shift, local_caddf)
   DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_GEN, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, GEN_OP ) )
 
 DEFINE_VECTORMATH_D2D(Round, round)
+DEFINE_VECTORMATH_D2D(Exp, exp)
+DEFINE_VECTORMATH_D2D(Log, log)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_GEN, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, local_sincos)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define DEFINE_VECTORMATH_ZZ2Z(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2Z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_ZZ2Z(Multiply, local_cmul)
+DEFINE_VECTORMATH_ZZ2Z(ConjugateMultiply, local_cmulconj)
+
+// ---------- define vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+#define DEFINE_VECTORMATH_zZ2Z(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_zZ2Z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, scalar, in, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_zZ2Z(Scale, local_cmul)
+
+// ---------- define vector math functions with 2 REAL8 vector inputs to 1 REAL8 scalar output (DD2d) ----------
+#define DEFINE_VECTORMATH_DD2d(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_DD2d_GEN, NAME ## REAL8, ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_DD2d(DotProduct, local_mul)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 scalar output (ZZ2z) ----------
+#define DEFINE_VECTORMATH_ZZ2z(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_ZZ2z(DotProduct, local_cmul)
+DEFINE_VECTORMATH_ZZ2z(ConjugateDotProduct, local_cmulconj)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define DEFINE_VECTORMATH_ZZD2z(NAME, GEN_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_ZZD2z(WeightedInnerProduct, local_zwip_block)
+
+// ---------- define vector math functions with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output (CCS2c) ----------
+#define DEFINE_VECTORMATH_CCS2c(NAME, GEN_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_CCS2c_GEN, NAME ## COMPLEX8, ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_CCS2c(WeightedInnerProduct, local_cwip_block)
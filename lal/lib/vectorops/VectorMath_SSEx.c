@@ -118,6 +118,115 @@ local_cmul_ps ( __m128 in1, __m128 in2 )
   return _mm_shuffle_ps(result, result,0b11011000);
 }
 
+// in1: a0,b0 in2: c0,d0
+UNUSED static inline __m128d
+local_cmul_pd ( __m128d in1, __m128d in2 )
+{
+  __m128d neg = _mm_setr_pd(-0.0, 0.0);
+
+  // c0,c0 and d0,d0
+  __m128d re2 = _mm_unpacklo_pd(in2, in2);
+  __m128d im2 = _mm_unpackhi_pd(in2, in2);
+
+  // Switch the real and imaginary elements of in1
+  // b0,a0
+  __m128d sw1 = _mm_shuffle_pd(in1, in1, 0x1);
+
+  // a0c0,b0c0 and -b0d0,a0d0
+  __m128d temp1 = _mm_mul_pd(in1, re2);
+  __m128d temp2 = _mm_xor_pd(_mm_mul_pd(sw1, im2), neg);
+
+  // a0c0-b0d0, b0c0+a0d0
+  return _mm_add_pd(temp1, temp2);
+}
+
+// in1: a0,b0 in2: c0,d0
+UNUSED static inline __m128d
+local_cmulconj_pd ( __m128d in1, __m128d in2 )
+{
+  __m128d neg = _mm_setr_pd(0.0, -0.0);
+
+  // c0,c0 and d0,d0
+  __m128d re2 = _mm_unpacklo_pd(in2, in2);
+  __m128d im2 = _mm_unpackhi_pd(in2, in2);
+
+  // Switch the real and imaginary elements of in1
+  // b0,a0
+  __m128d sw1 = _mm_shuffle_pd(in1, in1, 0x1);
+
+  // a0c0,b0c0 and b0d0,-a0d0
+  __m128d temp1 = _mm_mul_pd(in1, re2);
+  __m128d temp2 = _mm_xor_pd(_mm_mul_pd(sw1, im2), neg);
+
+  // a0c0+b0d0, b0c0-a0d0
+  return _mm_add_pd(temp1, temp2);
+}
+
+// accumulate conj(in1) * in2 * weight, for in1: a0,b0 in2: c0,d0 weight: w0,w0
+// sum_re accumulates a0c0w0,b0d0w0 and sum_im accumulates a0d0w0,b0c0w0; see local_wip_sum_pd()
+UNUSED static inline void
+local_wip_pd ( __m128d *sum_re, __m128d *sum_im, __m128d in1, __m128d in2, __m128d weight )
+{
+  __m128d in2w = _mm_mul_pd(in2, weight);
+  *sum_re = _mm_add_pd(*sum_re, _mm_mul_pd(in1, in2w));
+  *sum_im = _mm_add_pd(*sum_im, _mm_mul_pd(in1, _mm_shuffle_pd(in2w, in2w, 0x1)));
+}
+
+// combine partial sums accumulated by local_wip_pd()
+UNUSED static inline COMPLEX16
+local_wip_sum_pd ( __m128d sum_re, __m128d sum_im )
+{
+  V2SF re2, im2;
+  re2.v = sum_re;
+  im2.v = sum_im;
+  return crect( re2.f[0] + re2.f[1], im2.f[0] - im2.f[1] );
+}
+
+// sum of conj(in1[i]) * in2[i] * weight[i] over a block, accumulating into 2 independent partial sums
+UNUSED static inline COMPLEX16
+local_zwip_block_pd ( const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len )
+{
+  __m128d sum_re_1 = _mm_setzero_pd(), sum_im_1 = _mm_setzero_pd();
+  __m128d sum_re_2 = _mm_setzero_pd(), sum_im_2 = _mm_setzero_pd();
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      local_wip_pd( &sum_re_1, &sum_im_1, _mm_loadu_pd( (const REAL8*)&in1[i2] ), _mm_loadu_pd( (const REAL8*)&in2[i2] ), _mm_load1_pd( &weight[i2] ) );
+      local_wip_pd( &sum_re_2, &sum_im_2, _mm_loadu_pd( (const REAL8*)&in1[i2+1] ), _mm_loadu_pd( (const REAL8*)&in2[i2+1] ), _mm_load1_pd( &weight[i2+1] ) );
+    }
+  if ( i2Max < len )
+    {
+      local_wip_pd( &sum_re_1, &sum_im_1, _mm_loadu_pd( (const REAL8*)&in1[i2Max] ), _mm_loadu_pd( (const REAL8*)&in2[i2Max] ), _mm_load1_pd( &weight[i2Max] ) );
+    }
+  return local_wip_sum_pd( _mm_add_pd( sum_re_1, sum_re_2 ), _mm_add_pd( sum_im_1, sum_im_2 ) );
+}
+
+// load 1 COMPLEX8 into double precision
+UNUSED static inline __m128d
+local_load_c_pd ( const COMPLEX8 *in )
+{
+  return _mm_cvtps_pd( _mm_castpd_ps( _mm_load_sd( (const REAL8*)in ) ) );
+}
+
+// COMPLEX8 version of local_zwip_block_pd(), computed in double precision
+UNUSED static inline COMPLEX16
+local_cwip_block_pd ( const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len )
+{
+  __m128d sum_re_1 = _mm_setzero_pd(), sum_im_1 = _mm_setzero_pd();
+  __m128d sum_re_2 = _mm_setzero_pd(), sum_im_2 = _mm_setzero_pd();
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      local_wip_pd( &sum_re_1, &sum_im_1, local_load_c_pd( &in1[i2] ), local_load_c_pd( &in2[i2] ), _mm_set1_pd( weight[i2] ) );
+      local_wip_pd( &sum_re_2, &sum_im_2, local_load_c_pd( &in1[i2+1] ), local_load_c_pd( &in2[i2+1] ), _mm_set1_pd( weight[i2+1] ) );
+    }
+  if ( i2Max < len )
+    {
+      local_wip_pd( &sum_re_1, &sum_im_1, local_load_c_pd( &in1[i2Max] ), local_load_c_pd( &in2[i2Max] ), _mm_set1_pd( weight[i2Max] ) );
+    }
+  return local_wip_sum_pd( _mm_add_pd( sum_re_1, sum_re_2 ), _mm_add_pd( sum_im_1, sum_im_2 ) );
+}
+
 // ========== internal generic SSEx functions ==========
 
 // ---------- generic SSEx operator with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -401,6 +510,149 @@ XLALVectorMath_cC2C_SSEx ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in, c
 
 } // XLALVectorMath_cC2C_SSEx()
 
+// ---------- generic SSEx operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+static inline int
+XLALVectorMath_ZZ2Z_SSEx ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, __m128d (*op)(__m128d, __m128d) )
+{
+
+  // walk through vector one element at a time
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      __m128d in2p_1 = _mm_loadu_pd( (const REAL8*)&in1[i] );
+      __m128d in2p_2 = _mm_loadu_pd( (const REAL8*)&in2[i] );
+      __m128d out2p = (*op) ( in2p_1, in2p_2 );
+      _mm_storeu_pd( (REAL8*)&out[i], out2p );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZ2Z_SSEx()
+
+// ---------- generic SSEx operator with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+static inline int
+XLALVectorMath_zZ2Z_SSEx ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len, __m128d (*op)(__m128d, __m128d) )
+{
+  const V2SF scalar2 = {.f={creal(scalar),cimag(scalar)}};
+
+  // walk through vector one element at a time
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      __m128d in2p = _mm_loadu_pd( (const REAL8*)&in[i] );
+      __m128d out2p = (*op) ( scalar2.v, in2p );
+      _mm_storeu_pd( (REAL8*)&out[i], out2p );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_zZ2Z_SSEx()
+
+// ---------- generic SSEx operator with 2 REAL8 vector inputs to 1 REAL8 scalar output, summing the operator results (DD2d) ----------
+static inline int
+XLALVectorMath_DD2d_SSEx ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len, __m128d (*op)(__m128d, __m128d) )
+{
+
+  // walk through vector in blocks of 4, accumulating into 2 independent partial sums
+  __m128d sum2p_1 = _mm_setzero_pd();
+  __m128d sum2p_2 = _mm_setzero_pd();
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      sum2p_1 = _mm_add_pd( sum2p_1, (*op) ( _mm_loadu_pd( &in1[i4] ), _mm_loadu_pd( &in2[i4] ) ) );
+      sum2p_2 = _mm_add_pd( sum2p_2, (*op) ( _mm_loadu_pd( &in1[i4+2] ), _mm_loadu_pd( &in2[i4+2] ) ) );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  UINT4 i = i4Max;
+  if ( i + 2 <= len )
+    {
+      sum2p_1 = _mm_add_pd( sum2p_1, (*op) ( _mm_loadu_pd( &in1[i] ), _mm_loadu_pd( &in2[i] ) ) );
+      i += 2;
+    }
+  if ( i < len )
+    {
+      V2SF in2_1 = {.f={in1[i],0}};
+      V2SF in2_2 = {.f={in2[i],0}};
+      sum2p_2 = _mm_add_pd( sum2p_2, (*op) ( in2_1.v, in2_2.v ) );
+    }
+
+  // add partial sums
+  V2SF sum2;
+  sum2.v = _mm_add_pd( sum2p_1, sum2p_2 );
+  *out = sum2.f[0] + sum2.f[1];
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_DD2d_SSEx()
+
+// ---------- generic SSEx operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 scalar output, summing the operator results (ZZ2z) ----------
+static inline int
+XLALVectorMath_ZZ2z_SSEx ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, __m128d (*op)(__m128d, __m128d) )
+{
+
+  // walk through vector in blocks of 2, accumulating into 2 independent partial sums
+  __m128d sum2p_1 = _mm_setzero_pd();
+  __m128d sum2p_2 = _mm_setzero_pd();
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      sum2p_1 = _mm_add_pd( sum2p_1, (*op) ( _mm_loadu_pd( (const REAL8*)&in1[i2] ), _mm_loadu_pd( (const REAL8*)&in2[i2] ) ) );
+      sum2p_2 = _mm_add_pd( sum2p_2, (*op) ( _mm_loadu_pd( (const REAL8*)&in1[i2+1] ), _mm_loadu_pd( (const REAL8*)&in2[i2+1] ) ) );
+    }
+
+  // deal with the remaining (<=1) term separately
+  if ( i2Max < len )
+    {
+      sum2p_1 = _mm_add_pd( sum2p_1, (*op) ( _mm_loadu_pd( (const REAL8*)&in1[i2Max] ), _mm_loadu_pd( (const REAL8*)&in2[i2Max] ) ) );
+    }
+
+  // add partial sums
+  V2SF sum2;
+  sum2.v = _mm_add_pd( sum2p_1, sum2p_2 );
+  *out = crect( sum2.f[0], sum2.f[1] );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZ2z_SSEx()
+
+// ---------- generic SSEx operator with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output, summing blocks of operator results pairwise (ZZD2z) ----------
+static inline int
+XLALVectorMath_ZZD2z_SSEx ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, COMPLEX16 (*blockop)(const COMPLEX16*, const COMPLEX16*, const REAL8*, const UINT4) )
+{
+
+  // walk through vector in blocks of VECTORMATH_PAIRWISE_BLOCKLEN, summing block sums pairwise
+  VectorMathPairwiseSum sum = { .nblocks = 0 };
+  for ( UINT4 i = 0; i < len; )
+    {
+      const UINT4 blocklen = ( len - i < VECTORMATH_PAIRWISE_BLOCKLEN ) ? len - i : VECTORMATH_PAIRWISE_BLOCKLEN;
+      XLALVectorMathPairwiseAdd ( &sum, (*blockop) ( &in1[i], &in2[i], &weight[i], blocklen ) );
+      i += blocklen;
+    }
+  *out = XLALVectorMathPairwiseTotal ( &sum );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZD2z_SSEx()
+
+// ---------- generic SSEx operator with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output, summing blocks of operator results pairwise (CCS2c) ----------
+static inline int
+XLALVectorMath_CCS2c_SSEx ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len, COMPLEX16 (*blockop)(const COMPLEX8*, const COMPLEX8*, const REAL4*, const UINT4) )
+{
+
+  // walk through vector in blocks of VECTORMATH_PAIRWISE_BLOCKLEN, summing block sums pairwise
+  VectorMathPairwiseSum sum = { .nblocks = 0 };
+  for ( UINT4 i = 0; i < len; )
+    {
+      const UINT4 blocklen = ( len - i < VECTORMATH_PAIRWISE_BLOCKLEN ) ? len - i : VECTORMATH_PAIRWISE_BLOCKLEN;
+      XLALVectorMathPairwiseAdd ( &sum, (*blockop) ( &in1[i], &in2[i], &weight[i], blocklen ) );
+      i += blocklen;
+    }
+  const COMPLEX16 total = XLALVectorMathPairwiseTotal ( &sum );
+  *out = crectf( creal( total ), cimag( total ) );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_CCS2c_SSEx()
+
 // ========== internal SSEx vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -469,3 +721,41 @@ DEFINE_VECTORMATH_CC2C(Add, local_add_ps)
 
 DEFINE_VECTORMATH_cC2C(Scale, local_cmul_ps)
 DEFINE_VECTORMATH_cC2C(Shift, local_add_ps)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define DEFINE_VECTORMATH_ZZ2Z(NAME, SSE_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2Z_SSEx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_ZZ2Z(Multiply, local_cmul_pd)
+DEFINE_VECTORMATH_ZZ2Z(ConjugateMultiply, local_cmulconj_pd)
+
+// ---------- define vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+#define DEFINE_VECTORMATH_zZ2Z(NAME, SSE_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_zZ2Z_SSEx, NAME ## COMPLEX16, ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, scalar, in, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_zZ2Z(Scale, local_cmul_pd)
+
+// ---------- define vector math functions with 2 REAL8 vector inputs to 1 REAL8 scalar output (DD2d) ----------
+#define DEFINE_VECTORMATH_DD2d(NAME, SSE_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_DD2d_SSEx, NAME ## REAL8, ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_DD2d(DotProduct, local_mul_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 scalar output (ZZ2z) ----------
+#define DEFINE_VECTORMATH_ZZ2z(NAME, SSE_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2z_SSEx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_ZZ2z(DotProduct, local_cmul_pd)
+DEFINE_VECTORMATH_ZZ2z(ConjugateDotProduct, local_cmulconj_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define DEFINE_VECTORMATH_ZZD2z(NAME, SSE_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2z_SSEx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_ZZD2z(WeightedInnerProduct, local_zwip_block_pd)
+
+// ---------- define vector math functions with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output (CCS2c) ----------
+#define DEFINE_VECTORMATH_CCS2c(NAME, SSE_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_CCS2c_SSEx, NAME ## COMPLEX8, ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_CCS2c(WeightedInnerProduct, local_cwip_block_pd)
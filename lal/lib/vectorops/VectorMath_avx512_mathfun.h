@@ -0,0 +1,182 @@
+/*
+   AVX-512F implementation of sincos(2*pi*x) and exp
+
+   Based on "avx_mathfun.h", by Giovanni Garberoglio, which is in turn
+   based on "sse_mathfun.h", by Julien Pommier
+   http://gruntthepeon.free.fr/ssemath/
+
+   Copyright (C) 2012 Giovanni Garberoglio
+   Interdisciplinary Laboratory for Computational Science (LISC)
+   Fondazione Bruno Kessler and University of Trento
+   via Sommarive, 18
+   I-38123 Trento (Italy)
+
+   Altered for AVX-512F with FMA: uses 512-bit vectors, mask registers for
+   polynomial selection, and fused multiply-adds for the range reductions
+   and polynomial evaluations.
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  (this is the zlib license)
+*/
+
+#include <immintrin.h>
+
+typedef __m512  v16sf; // vector of 16 float (avx512)
+typedef __m512i v16si; // vector of 16 int   (avx512)
+
+// ---------- Prototypes ----------
+static v16sf exp512_ps(v16sf x);
+static void sincos512_ps(v16sf x, v16sf *s, v16sf *c);
+static void sincos512_ps_2pi(v16sf xx, v16sf *s, v16sf *c);
+// --------------------------------
+
+/* AVX-512F provides no bitwise operations on floats (these are in AVX-512DQ), so use the integer ones */
+#define _mm512_xor_ps_F(a,b) _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)))
+#define _mm512_and_ps_F(a,b) _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)))
+
+#define _PS512_CONST(Name, Val) \
+  static const float _ps512_##Name = Val
+
+_PS512_CONST(1  , 1.0f);
+_PS512_CONST(0p5, 0.5f);
+
+_PS512_CONST(exp_hi,	88.3762626647949f);
+_PS512_CONST(exp_lo,	-88.3762626647949f);
+
+_PS512_CONST(cephes_LOG2EF, 1.44269504088896341);
+_PS512_CONST(cephes_exp_C1, 0.693359375);
+_PS512_CONST(cephes_exp_C2, -2.12194440e-4);
+
+_PS512_CONST(cephes_exp_p0, 1.9875691500E-4);
+_PS512_CONST(cephes_exp_p1, 1.3981999507E-3);
+_PS512_CONST(cephes_exp_p2, 8.3334519073E-3);
+_PS512_CONST(cephes_exp_p3, 4.1665795894E-2);
+_PS512_CONST(cephes_exp_p4, 1.6666665459E-1);
+_PS512_CONST(cephes_exp_p5, 5.0000001201E-1);
+
+v16sf exp512_ps(v16sf x) {
+  const v16sf one = _mm512_set1_ps(_ps512_1);
+
+  x = _mm512_min_ps(x, _mm512_set1_ps(_ps512_exp_hi));
+  x = _mm512_max_ps(x, _mm512_set1_ps(_ps512_exp_lo));
+
+  /* express exp(x) as exp(g + n*log(2)) */
+  v16sf fx = _mm512_fmadd_ps(x, _mm512_set1_ps(_ps512_cephes_LOG2EF), _mm512_set1_ps(_ps512_0p5));
+  fx = _mm512_roundscale_ps(fx, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+  x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(_ps512_cephes_exp_C1), x);
+  x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(_ps512_cephes_exp_C2), x);
+
+  v16sf z = _mm512_mul_ps(x,x);
+
+  v16sf y = _mm512_set1_ps(_ps512_cephes_exp_p0);
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(_ps512_cephes_exp_p1));
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(_ps512_cephes_exp_p2));
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(_ps512_cephes_exp_p3));
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(_ps512_cephes_exp_p4));
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(_ps512_cephes_exp_p5));
+  y = _mm512_fmadd_ps(y, z, x);
+  y = _mm512_add_ps(y, one);
+
+  /* multiply by 2^n */
+  return _mm512_scalef_ps(y, fx);
+}
+
+_PS512_CONST(minus_cephes_DP1, -0.78515625);
+_PS512_CONST(minus_cephes_DP2, -2.4187564849853515625e-4);
+_PS512_CONST(minus_cephes_DP3, -3.77489497744594108e-8);
+_PS512_CONST(sincof_p0, -1.9515295891E-4);
+_PS512_CONST(sincof_p1,  8.3321608736E-3);
+_PS512_CONST(sincof_p2, -1.6666654611E-1);
+_PS512_CONST(coscof_p0,  2.443315711809948E-005);
+_PS512_CONST(coscof_p1, -1.388731625493765E-003);
+_PS512_CONST(coscof_p2,  4.166664568298827E-002);
+_PS512_CONST(cephes_FOPI, 1.27323954473516); // 4 / M_PI
+
+/* evaluation of 16 sines and cosines at once, following sincos256_ps() */
+void sincos512_ps(v16sf x, v16sf *s, v16sf *c) {
+  const v16si sign_mask = _mm512_set1_epi32(0x80000000);
+
+  /* extract the sign bit, and take the absolute value */
+  v16sf sign_bit_sin = _mm512_and_ps_F(x, _mm512_castsi512_ps(sign_mask));
+  x = _mm512_abs_ps(x);
+
+  /* scale by 4/Pi, and store the integer part in j */
+  v16sf y = _mm512_mul_ps(x, _mm512_set1_ps(_ps512_cephes_FOPI));
+  v16si j = _mm512_cvttps_epi32(y);
+
+  /* j=(j+1) & (~1) (see the cephes sources) */
+  j = _mm512_add_epi32(j, _mm512_set1_epi32(1));
+  j = _mm512_and_si512(j, _mm512_set1_epi32(~1));
+  y = _mm512_cvtepi32_ps(j);
+
+  /* get the swap sign flag for the sine */
+  v16si swap_sign_bit_sin = _mm512_slli_epi32(_mm512_and_si512(j, _mm512_set1_epi32(4)), 29);
+
+  /* get the polynom selection mask for the sine */
+  __mmask16 poly_mask = _mm512_cmpeq_epi32_mask(_mm512_and_si512(j, _mm512_set1_epi32(2)), _mm512_setzero_si512());
+
+  /* the magic pass: "extended precision modular arithmetic"
+     x = ((x - y * DP1) - y * DP2) - y * DP3; */
+  x = _mm512_fmadd_ps(y, _mm512_set1_ps(_ps512_minus_cephes_DP1), x);
+  x = _mm512_fmadd_ps(y, _mm512_set1_ps(_ps512_minus_cephes_DP2), x);
+  x = _mm512_fmadd_ps(y, _mm512_set1_ps(_ps512_minus_cephes_DP3), x);
+
+  /* get the sign flag for the cosine */
+  v16si sign_bit_cos = _mm512_sub_epi32(j, _mm512_set1_epi32(2));
+  sign_bit_cos = _mm512_andnot_si512(sign_bit_cos, _mm512_set1_epi32(4));
+  sign_bit_cos = _mm512_slli_epi32(sign_bit_cos, 29);
+
+  sign_bit_sin = _mm512_xor_ps_F(sign_bit_sin, _mm512_castsi512_ps(swap_sign_bit_sin));
+
+  /* evaluate the first polynom (0 <= x <= Pi/4) */
+  v16sf z = _mm512_mul_ps(x,x);
+  v16sf y1 = _mm512_set1_ps(_ps512_coscof_p0);
+  y1 = _mm512_fmadd_ps(y1, z, _mm512_set1_ps(_ps512_coscof_p1));
+  y1 = _mm512_fmadd_ps(y1, z, _mm512_set1_ps(_ps512_coscof_p2));
+  y1 = _mm512_mul_ps(y1, z);
+  y1 = _mm512_mul_ps(y1, z);
+  y1 = _mm512_fnmadd_ps(z, _mm512_set1_ps(_ps512_0p5), y1);
+  y1 = _mm512_add_ps(y1, _mm512_set1_ps(_ps512_1));
+
+  /* evaluate the second polynom (Pi/4 <= x <= 0) */
+  v16sf y2 = _mm512_set1_ps(_ps512_sincof_p0);
+  y2 = _mm512_fmadd_ps(y2, z, _mm512_set1_ps(_ps512_sincof_p1));
+  y2 = _mm512_fmadd_ps(y2, z, _mm512_set1_ps(_ps512_sincof_p2));
+  y2 = _mm512_mul_ps(y2, z);
+  y2 = _mm512_fmadd_ps(y2, x, x);
+
+  /* select the correct result from the two polynoms, and update the sign */
+  *s = _mm512_xor_ps_F(_mm512_mask_blend_ps(poly_mask, y1, y2), sign_bit_sin);
+  *c = _mm512_xor_ps_F(_mm512_mask_blend_ps(poly_mask, y2, y1), _mm512_castsi512_ps(sign_bit_cos));
+}
+
+/* sincos2pi() variant of sincos512_ps() above, computing
+ * sin(2pi*x) and cos(2pi*x) of input 'x', which is often used in our F-stat codes
+ */
+_PS512_CONST(2pi, 6.28318530717959f);	// LAL_TWOPI
+void
+sincos512_ps_2pi(v16sf xx, v16sf *s, v16sf *c)
+{
+  // convert from input 'xx' to actual angle '2pi * xx', the rest follows unchanged
+  v16sf x = _mm512_mul_ps ( xx, _mm512_set1_ps(_ps512_2pi) );
+
+  sincos512_ps ( x, s, c );
+
+  return;
+} // sincos512_ps_2pi
@@ -0,0 +1,290 @@
+//
+// Copyright (C) 2021 Yiqi Xie
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+//
+// AVX implementation of double-precision sincos, exp and log
+//
+// The algorithms and coefficients are those of the double-precision sin(), cos(), exp() and log() functions of the
+// Cephes Math Library by Stephen L. Moshier. Integer operations on the exponent bits are only needed by exp() and log(),
+// and are done using SSE2 instructions on each 128-bit half if AVX2 is not available. Accuracy (compared to libm) is:
+//
+// - sincos256_pd(): absolute error < 4e-16 for |x| <= 1000, growing linearly with |x| up to |x| = 2^30;
+//   results for larger |x| are meaningless
+// - exp256_pd(): relative error < 4e-16; overflows to +inf above x = 709.78, and underflows through the
+//   denormals to 0 below x = -745.13
+// - log256_pd(): relative error < 4e-16 for x > 0 including denormals; -inf for x = 0, NaN for x < 0
+//
+
+#include <immintrin.h>
+
+// ---------- Prototypes ----------
+static __m256d exp256_pd(__m256d x);
+static __m256d log256_pd(__m256d x);
+static void sincos256_pd(__m256d x, __m256d *s, __m256d *c);
+// --------------------------------
+
+#define _PD256_CONST(Name, Val) \
+  static const double _pd256_##Name = Val
+
+#define _PD256_CONST_BITS(Name, Val) \
+  static const union { long long i; double d; } _pd256_##Name = { .i = Val }
+
+_PD256_CONST(1, 1.0);
+_PD256_CONST(0p5, 0.5);
+_PD256_CONST(2p52, 4503599627370496.0);
+_PD256_CONST_BITS(sign_mask, (long long)0x8000000000000000ULL);
+_PD256_CONST_BITS(mant_mask, 0x000fffffffffffffLL);
+_PD256_CONST_BITS(inf, 0x7ff0000000000000LL);
+
+// shift the bits of each element left by 52
+static inline __m256d
+local_slli52_pd ( __m256d x )
+{
+#ifdef __AVX2__
+  return _mm256_castsi256_pd ( _mm256_slli_epi64 ( _mm256_castpd_si256 ( x ), 52 ) );
+#else
+  __m128i lo = _mm_slli_epi64 ( _mm_castpd_si128 ( _mm256_castpd256_pd128 ( x ) ), 52 );
+  __m128i hi = _mm_slli_epi64 ( _mm_castpd_si128 ( _mm256_extractf128_pd ( x, 1 ) ), 52 );
+  return _mm256_insertf128_pd ( _mm256_castpd128_pd256 ( _mm_castsi128_pd ( lo ) ), _mm_castsi128_pd ( hi ), 1 );
+#endif
+}
+
+// shift the bits of each element right by 52
+static inline __m256d
+local_srli52_pd ( __m256d x )
+{
+#ifdef __AVX2__
+  return _mm256_castsi256_pd ( _mm256_srli_epi64 ( _mm256_castpd_si256 ( x ), 52 ) );
+#else
+  __m128i lo = _mm_srli_epi64 ( _mm_castpd_si128 ( _mm256_castpd256_pd128 ( x ) ), 52 );
+  __m128i hi = _mm_srli_epi64 ( _mm_castpd_si128 ( _mm256_extractf128_pd ( x, 1 ) ), 52 );
+  return _mm256_insertf128_pd ( _mm256_castpd128_pd256 ( _mm_castsi128_pd ( lo ) ), _mm_castsi128_pd ( hi ), 1 );
+#endif
+}
+
+// compute 2^n for integer-valued n in [-1022, 1023]
+static inline __m256d
+local_pow2n_pd ( __m256d n )
+{
+  // the low mantissa bits of 2^52 + 1023 + n hold the biased exponent of 2^n
+  __m256d t = _mm256_add_pd ( n, _mm256_set1_pd ( _pd256_2p52 + 1023.0 ) );
+  return local_slli52_pd ( t );
+}
+
+_PD256_CONST(exp_hi, 7.09782712893383996843E2);
+_PD256_CONST(exp_lo, -7.451332191019412076235E2);
+
+_PD256_CONST(cephes_LOG2E, 1.4426950408889634073599);
+_PD256_CONST(cephes_exp_C1, 6.93145751953125E-1);
+_PD256_CONST(cephes_exp_C2, 1.42860682030941723212E-6);
+
+_PD256_CONST(cephes_exp_p0, 1.26177193074810590878E-4);
+_PD256_CONST(cephes_exp_p1, 3.02994407707441961300E-2);
+_PD256_CONST(cephes_exp_p2, 9.99999999999999999910E-1);
+_PD256_CONST(cephes_exp_q0, 3.00198505138664455042E-6);
+_PD256_CONST(cephes_exp_q1, 2.52448340349684104192E-3);
+_PD256_CONST(cephes_exp_q2, 2.27265548208155028766E-1);
+_PD256_CONST(cephes_exp_q3, 2.00000000000000000009E0);
+
+__m256d exp256_pd(__m256d x) {
+  const __m256d one = _mm256_set1_pd(_pd256_1);
+  const __m256d x_in = x;
+
+  x = _mm256_min_pd(x, _mm256_set1_pd(_pd256_exp_hi));
+  x = _mm256_max_pd(x, _mm256_set1_pd(_pd256_exp_lo));
+
+  /* express exp(x) as exp(g + n*log(2)) */
+  __m256d n = _mm256_add_pd(_mm256_mul_pd(x, _mm256_set1_pd(_pd256_cephes_LOG2E)), _mm256_set1_pd(_pd256_0p5));
+  n = _mm256_floor_pd(n);
+
+  x = _mm256_sub_pd(x, _mm256_mul_pd(n, _mm256_set1_pd(_pd256_cephes_exp_C1)));
+  x = _mm256_sub_pd(x, _mm256_mul_pd(n, _mm256_set1_pd(_pd256_cephes_exp_C2)));
+
+  /* rational approximation for exponential of the fractional part:
+     e^x = 1 + 2x P(x^2) / ( Q(x^2) - x P(x^2) ) */
+  __m256d xx = _mm256_mul_pd(x, x);
+  __m256d p = _mm256_set1_pd(_pd256_cephes_exp_p0);
+  p = _mm256_add_pd(_mm256_mul_pd(p, xx), _mm256_set1_pd(_pd256_cephes_exp_p1));
+  p = _mm256_add_pd(_mm256_mul_pd(p, xx), _mm256_set1_pd(_pd256_cephes_exp_p2));
+  p = _mm256_mul_pd(p, x);
+  __m256d q = _mm256_set1_pd(_pd256_cephes_exp_q0);
+  q = _mm256_add_pd(_mm256_mul_pd(q, xx), _mm256_set1_pd(_pd256_cephes_exp_q1));
+  q = _mm256_add_pd(_mm256_mul_pd(q, xx), _mm256_set1_pd(_pd256_cephes_exp_q2));
+  q = _mm256_add_pd(_mm256_mul_pd(q, xx), _mm256_set1_pd(_pd256_cephes_exp_q3));
+  __m256d y = _mm256_div_pd(p, _mm256_sub_pd(q, p));
+  y = _mm256_add_pd(_mm256_add_pd(y, y), one);
+
+  /* multiply by 2^n; n is in [-1075, 1024], so split it in two to stay within the range of normal numbers */
+  __m256d n1 = _mm256_floor_pd(_mm256_mul_pd(n, _mm256_set1_pd(_pd256_0p5)));
+  __m256d n2 = _mm256_sub_pd(n, n1);
+  y = _mm256_mul_pd(_mm256_mul_pd(y, local_pow2n_pd(n1)), local_pow2n_pd(n2));
+
+  /* handle overflow and underflow, and pass through NaNs */
+  y = _mm256_blendv_pd(y, _mm256_set1_pd(_pd256_inf.d), _mm256_cmp_pd(x_in, _mm256_set1_pd(_pd256_exp_hi), _CMP_GT_OQ));
+  y = _mm256_blendv_pd(y, _mm256_setzero_pd(), _mm256_cmp_pd(x_in, _mm256_set1_pd(_pd256_exp_lo), _CMP_LT_OQ));
+  y = _mm256_blendv_pd(y, x_in, _mm256_cmp_pd(x_in, x_in, _CMP_UNORD_Q));
+
+  return y;
+}
+
+_PD256_CONST(min_norm_pos, 2.2250738585072014E-308);
+_PD256_CONST(2p54, 18014398509481984.0);
+_PD256_CONST(cephes_SQRTH, 0.70710678118654752440);
+
+_PD256_CONST(cephes_log_p0, 1.01875663804580931796E-4);
+_PD256_CONST(cephes_log_p1, 4.97494994976747001425E-1);
+_PD256_CONST(cephes_log_p2, 4.70579119878881725854E0);
+_PD256_CONST(cephes_log_p3, 1.44989225341610930846E1);
+_PD256_CONST(cephes_log_p4, 1.79368678507819816313E1);
+_PD256_CONST(cephes_log_p5, 7.70838733755885391666E0);
+_PD256_CONST(cephes_log_q0, 1.12873587189167450590E1);
+_PD256_CONST(cephes_log_q1, 4.52279145837532221105E1);
+_PD256_CONST(cephes_log_q2, 8.29875266912776603211E1);
+_PD256_CONST(cephes_log_q3, 7.11544750618563894466E1);
+_PD256_CONST(cephes_log_q4, 2.31251620126765340583E1);
+_PD256_CONST(cephes_log_C1, 2.121944400546905827679E-4);
+_PD256_CONST(cephes_log_C2, 0.693359375);
+
+__m256d log256_pd(__m256d x) {
+  const __m256d one = _mm256_set1_pd(_pd256_1);
+  const __m256d x_in = x;
+
+  /* scale denormals up into the normal range */
+  __m256d denorm = _mm256_cmp_pd(x, _mm256_set1_pd(_pd256_min_norm_pos), _CMP_LT_OQ);
+  x = _mm256_blendv_pd(x, _mm256_mul_pd(x, _mm256_set1_pd(_pd256_2p54)), denorm);
+
+  /* split x into mantissa in [0.5, 1) and exponent, i.e. frexp() */
+  __m256d e = _mm256_or_pd(local_srli52_pd(x), _mm256_set1_pd(_pd256_2p52));
+  e = _mm256_sub_pd(e, _mm256_set1_pd(_pd256_2p52 + 1022.0));
+  e = _mm256_sub_pd(e, _mm256_and_pd(denorm, _mm256_set1_pd(54.0)));
+  x = _mm256_and_pd(x, _mm256_set1_pd(_pd256_mant_mask.d));
+  x = _mm256_or_pd(x, _mm256_set1_pd(_pd256_0p5));
+
+  /* if x < sqrt(1/2): e = e - 1, x = 2x - 1; otherwise x = x - 1 */
+  __m256d lt = _mm256_cmp_pd(x, _mm256_set1_pd(_pd256_cephes_SQRTH), _CMP_LT_OQ);
+  e = _mm256_sub_pd(e, _mm256_and_pd(lt, one));
+  x = _mm256_add_pd(_mm256_sub_pd(x, one), _mm256_and_pd(lt, x));
+
+  /* rational approximation: log(1+x) = x - x^2/2 + x^3 P(x)/Q(x) */
+  __m256d z = _mm256_mul_pd(x, x);
+  __m256d p = _mm256_set1_pd(_pd256_cephes_log_p0);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(_pd256_cephes_log_p1));
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(_pd256_cephes_log_p2));
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(_pd256_cephes_log_p3));
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(_pd256_cephes_log_p4));
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(_pd256_cephes_log_p5));
+  __m256d q = _mm256_add_pd(x, _mm256_set1_pd(_pd256_cephes_log_q0));
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), _mm256_set1_pd(_pd256_cephes_log_q1));
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), _mm256_set1_pd(_pd256_cephes_log_q2));
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), _mm256_set1_pd(_pd256_cephes_log_q3));
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), _mm256_set1_pd(_pd256_cephes_log_q4));
+  __m256d y = _mm256_mul_pd(x, _mm256_div_pd(_mm256_mul_pd(z, p), q));
+
+  /* add e*log(2), split into two parts for extended precision */
+  y = _mm256_sub_pd(y, _mm256_mul_pd(e, _mm256_set1_pd(_pd256_cephes_log_C1)));
+  y = _mm256_sub_pd(y, _mm256_mul_pd(z, _mm256_set1_pd(_pd256_0p5)));
+  y = _mm256_add_pd(x, y);
+  y = _mm256_add_pd(y, _mm256_mul_pd(e, _mm256_set1_pd(_pd256_cephes_log_C2)));
+
+  /* handle special values: log(+inf) = +inf, log(0) = -inf, log(x < 0) = log(NaN) = NaN */
+  const __m256d inf = _mm256_set1_pd(_pd256_inf.d);
+  y = _mm256_blendv_pd(y, inf, _mm256_cmp_pd(x_in, inf, _CMP_EQ_OQ));
+  y = _mm256_blendv_pd(y, _mm256_xor_pd(inf, _mm256_set1_pd(_pd256_sign_mask.d)), _mm256_cmp_pd(x_in, _mm256_setzero_pd(), _CMP_EQ_OQ));
+  y = _mm256_blendv_pd(y, _mm256_set1_pd(NAN), _mm256_cmp_pd(x_in, _mm256_setzero_pd(), _CMP_NGE_UQ));
+
+  return y;
+}
+
+_PD256_CONST(cephes_FOPI, 1.27323954473516268615); // 4 / M_PI
+_PD256_CONST(minus_cephes_DP1, -7.85398125648498535156E-1);
+_PD256_CONST(minus_cephes_DP2, -3.77489470793079817668E-8);
+_PD256_CONST(minus_cephes_DP3, -2.69515142907905952645E-15);
+_PD256_CONST(sincof_p0, 1.58962301576546568060E-10);
+_PD256_CONST(sincof_p1, -2.50507477628578072866E-8);
+_PD256_CONST(sincof_p2, 2.75573136213857245213E-6);
+_PD256_CONST(sincof_p3, -1.98412698295895385996E-4);
+_PD256_CONST(sincof_p4, 8.33333333332211858878E-3);
+_PD256_CONST(sincof_p5, -1.66666666666666307295E-1);
+_PD256_CONST(coscof_p0, -1.13585365213876817300E-11);
+_PD256_CONST(coscof_p1, 2.08757008419747316778E-9);
+_PD256_CONST(coscof_p2, -2.75573141792967388112E-7);
+_PD256_CONST(coscof_p3, 2.48015872888517045348E-5);
+_PD256_CONST(coscof_p4, -1.38888888888730564116E-3);
+_PD256_CONST(coscof_p5, 4.16666666666665929218E-2);
+
+/* evaluation of 4 sines and cosines at once; the octant is computed in floating point, so no integer operations are needed */
+void sincos256_pd(__m256d x, __m256d *s, __m256d *c) {
+  const __m256d sign_mask = _mm256_set1_pd(_pd256_sign_mask.d);
+  const __m256d one = _mm256_set1_pd(_pd256_1);
+  const __m256d two = _mm256_set1_pd(2.0);
+  const __m256d four = _mm256_set1_pd(4.0);
+
+  /* extract the sign bit, and take the absolute value */
+  __m256d sign_bit_sin = _mm256_and_pd(x, sign_mask);
+  x = _mm256_andnot_pd(sign_mask, x);
+
+  /* scale by 4/Pi, and round down to an integer y */
+  __m256d y = _mm256_floor_pd(_mm256_mul_pd(x, _mm256_set1_pd(_pd256_cephes_FOPI)));
+
+  /* round y up to an even integer, and take j = y mod 8 (see the cephes sources) */
+  __m256d odd = _mm256_sub_pd(y, _mm256_mul_pd(two, _mm256_floor_pd(_mm256_mul_pd(y, _mm256_set1_pd(_pd256_0p5)))));
+  y = _mm256_add_pd(y, odd);
+  __m256d j = _mm256_sub_pd(y, _mm256_mul_pd(_mm256_set1_pd(8.0), _mm256_floor_pd(_mm256_mul_pd(y, _mm256_set1_pd(0.125)))));
+
+  /* the magic pass: "extended precision modular arithmetic"
+     x = ((x - y * DP1) - y * DP2) - y * DP3; */
+  x = _mm256_add_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(_pd256_minus_cephes_DP1)));
+  x = _mm256_add_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(_pd256_minus_cephes_DP2)));
+  x = _mm256_add_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(_pd256_minus_cephes_DP3)));
+
+  /* j in {4, 6} flips the sign of the sine; j in {2, 4} flips the sign of the cosine */
+  __m256d j_ge_4 = _mm256_cmp_pd(j, four, _CMP_GE_OQ);
+  __m256d j_eq_2 = _mm256_cmp_pd(j, two, _CMP_EQ_OQ);
+  __m256d j_eq_4 = _mm256_cmp_pd(j, four, _CMP_EQ_OQ);
+  __m256d j_eq_6 = _mm256_cmp_pd(j, _mm256_set1_pd(6.0), _CMP_EQ_OQ);
+  sign_bit_sin = _mm256_xor_pd(sign_bit_sin, _mm256_and_pd(j_ge_4, sign_mask));
+  __m256d sign_bit_cos = _mm256_and_pd(_mm256_or_pd(j_eq_2, j_eq_4), sign_mask);
+
+  /* get the polynom selection mask: j in {2, 6} swaps the sine and cosine polynoms */
+  __m256d poly_mask = _mm256_or_pd(j_eq_2, j_eq_6);
+
+  /* evaluate the cosine polynom */
+  __m256d z = _mm256_mul_pd(x, x);
+  __m256d y1 = _mm256_set1_pd(_pd256_coscof_p0);
+  y1 = _mm256_add_pd(_mm256_mul_pd(y1, z), _mm256_set1_pd(_pd256_coscof_p1));
+  y1 = _mm256_add_pd(_mm256_mul_pd(y1, z), _mm256_set1_pd(_pd256_coscof_p2));
+  y1 = _mm256_add_pd(_mm256_mul_pd(y1, z), _mm256_set1_pd(_pd256_coscof_p3));
+  y1 = _mm256_add_pd(_mm256_mul_pd(y1, z), _mm256_set1_pd(_pd256_coscof_p4));
+  y1 = _mm256_add_pd(_mm256_mul_pd(y1, z), _mm256_set1_pd(_pd256_coscof_p5));
+  y1 = _mm256_mul_pd(_mm256_mul_pd(y1, z), z);
+  y1 = _mm256_add_pd(_mm256_sub_pd(one, _mm256_mul_pd(z, _mm256_set1_pd(_pd256_0p5))), y1);
+
+  /* evaluate the sine polynom */
+  __m256d y2 = _mm256_set1_pd(_pd256_sincof_p0);
+  y2 = _mm256_add_pd(_mm256_mul_pd(y2, z), _mm256_set1_pd(_pd256_sincof_p1));
+  y2 = _mm256_add_pd(_mm256_mul_pd(y2, z), _mm256_set1_pd(_pd256_sincof_p2));
+  y2 = _mm256_add_pd(_mm256_mul_pd(y2, z), _mm256_set1_pd(_pd256_sincof_p3));
+  y2 = _mm256_add_pd(_mm256_mul_pd(y2, z), _mm256_set1_pd(_pd256_sincof_p4));
+  y2 = _mm256_add_pd(_mm256_mul_pd(y2, z), _mm256_set1_pd(_pd256_sincof_p5));
+  y2 = _mm256_add_pd(x, _mm256_mul_pd(_mm256_mul_pd(y2, z), x));
+
+  /* select the correct result from the two polynoms, and update the sign */
+  *s = _mm256_xor_pd(_mm256_blendv_pd(y2, y1, poly_mask), sign_bit_sin);
+  *c = _mm256_xor_pd(_mm256_blendv_pd(y1, y2, poly_mask), sign_bit_cos);
+}
@@ -61,7 +61,7 @@ DECLARE_VECTORMATH_S2I(INT4From, SSE2, NONE, NONE, NONE)
 
 DECLARE_VECTORMATH_S2S(Sin, AVX2, AVX, SSE2, NONE)
 DECLARE_VECTORMATH_S2S(Cos, AVX2, AVX, SSE2, NONE)
-DECLARE_VECTORMATH_S2S(Exp, AVX2, AVX, SSE2, NONE)
+DECLARE_VECTORMATH_S2S(Exp, AVX512F, AVX2, AVX, SSE2)
 DECLARE_VECTORMATH_S2S(Log, AVX2, AVX, SSE2, NONE)
 DECLARE_VECTORMATH_S2S(Round, AVX2, AVX, NONE, NONE)
 
@@ -70,7 +70,7 @@ DECLARE_VECTORMATH_S2S(Round, AVX2, AVX, NONE, NONE)
   DECLARE_VECTORMATH_ANY( NAME ## REAL4, ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UINT4 len ), __VA_ARGS__ )
 
 DECLARE_VECTORMATH_S2SS(SinCos, AVX2, AVX, SSE2, NONE)
-DECLARE_VECTORMATH_S2SS(SinCos2Pi, AVX2, AVX, SSE2, NONE)
+DECLARE_VECTORMATH_S2SS(SinCos2Pi, AVX512F, AVX2, AVX, SSE2)
 
 /* declare internal prototypes of SIMD-specific vector math functions with 2 REAL4 vector inputs to 1 REAL4 vector output (SS2S) */
 #define DECLARE_VECTORMATH_SS2S(NAME, ...)                                   \
@@ -92,13 +92,13 @@ DECLARE_VECTORMATH_sS2S(Scale, AVX2, AVX, SSE2, NONE)
 #define DECLARE_VECTORMATH_SS2uU(NAME, ...)                            \
   DECLARE_VECTORMATH_ANY( NAME ## REAL4, ( UINT4* count, UINT4 *out, const REAL4 *in1, const REAL4 *in2, const UINT4 len ), __VA_ARGS__ )
 
-DECLARE_VECTORMATH_SS2uU(FindVectorLessEqual, AVX2, SSSE3, NONE, NONE)
+DECLARE_VECTORMATH_SS2uU(FindVectorLessEqual, AVX512F, AVX2, SSSE3, NONE)
 
 /* declare internal prototypes of SIMD-specific vector math functions with 1 REAL4 scalar and 1 REAL4 vector inputs to 1 UINT4 scalar and 1 UINT4 vector output (sS2uU) */
 #define DECLARE_VECTORMATH_sS2uU(NAME, ...)                            \
   DECLARE_VECTORMATH_ANY( NAME ## REAL4, ( UINT4* count, UINT4 *out, REAL4 scalar, const REAL4 *in, const UINT4 len ), __VA_ARGS__ )
 
-DECLARE_VECTORMATH_sS2uU(FindScalarLessEqual, AVX2, SSSE3, NONE, NONE)
+DECLARE_VECTORMATH_sS2uU(FindScalarLessEqual, AVX512F, AVX2, SSSE3, NONE)
 
 
 /* declare internal prototypes of SIMD-specific vector math functions with 1 REAL8 scalar and 1 REAL8 vector input to 1 REAL8 vector output (dD2D) */
@@ -121,7 +121,7 @@ DECLARE_VECTORMATH_DD2D(Max, AVX2, AVX, NONE, NONE)
 #define DECLARE_VECTORMATH_CC2C(NAME, ...)                                   \
   DECLARE_VECTORMATH_ANY( NAME ## COMPLEX8, ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const UINT4 len ), __VA_ARGS__ )
 
-DECLARE_VECTORMATH_CC2C(Multiply, AVX2, AVX, SSE2, NONE)
+DECLARE_VECTORMATH_CC2C(Multiply, AVX512F, AVX2, AVX, SSE2)
 DECLARE_VECTORMATH_CC2C(Add, AVX2, AVX, SSE2, NONE)
 
 /* declare internal prototypes of SIMD-specific vector math functions with 1 COMPLEX8 scalar and 1 COMPLEX8 vector input to 1 COMPLEX8 vector output (cC2C) */
@@ -136,3 +136,86 @@ DECLARE_VECTORMATH_cC2C(Shift, AVX2, AVX, SSE2, NONE)
   DECLARE_VECTORMATH_ANY( NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), __VA_ARGS__ )
 
 DECLARE_VECTORMATH_D2D(Round, AVX2, AVX, NONE, NONE)
+DECLARE_VECTORMATH_D2D(Exp, AVX2, AVX, NONE, NONE)
+DECLARE_VECTORMATH_D2D(Log, AVX2, AVX, NONE, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) */
+#define DECLARE_VECTORMATH_D2DD(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_D2DD(SinCos, AVX2, AVX, NONE, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) */
+#define DECLARE_VECTORMATH_ZZ2Z(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_ZZ2Z(Multiply, AVX2, AVX, SSE2, NONE)
+DECLARE_VECTORMATH_ZZ2Z(ConjugateMultiply, AVX2, AVX, SSE2, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (zZ2Z) */
+#define DECLARE_VECTORMATH_zZ2Z(NAME, ...) \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_zZ2Z(Scale, AVX2, AVX, SSE2, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 REAL8 vector inputs to 1 REAL8 scalar output (DD2d) */
+#define DECLARE_VECTORMATH_DD2d(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## REAL8, ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_DD2d(DotProduct, AVX2, AVX, SSE2, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 scalar output (ZZ2z) */
+#define DECLARE_VECTORMATH_ZZ2z(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_ZZ2z(DotProduct, AVX2, AVX, SSE2, NONE)
+DECLARE_VECTORMATH_ZZ2z(ConjugateDotProduct, AVX2, AVX, SSE2, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output (ZZD2z) */
+#define DECLARE_VECTORMATH_ZZD2z(NAME, ...)                                  \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_ZZD2z(WeightedInnerProduct, AVX2, AVX, SSE2, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output (CCS2c) */
+#define DECLARE_VECTORMATH_CCS2c(NAME, ...)                                  \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX8, ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const REAL4 *weight, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_CCS2c(WeightedInnerProduct, AVX2, AVX, SSE2, NONE)
+
+/* ---------- internal pairwise summation of block sums ---------- */
+
+/* number of terms summed directly by the SIMD-specific code, before block sums are combined pairwise */
+#define VECTORMATH_PAIRWISE_BLOCKLEN 128
+
+/* stack of partial sums: if bit k of 'nblocks' is set, 'partial[k]' holds the sum of 2^k consecutive blocks */
+typedef struct tagVectorMathPairwiseSum {
+  UINT4 nblocks;
+  COMPLEX16 partial[32];
+} VectorMathPairwiseSum;
+
+/* add the next block sum, merging equal-sized partial sums like a binary counter */
+UNUSED static inline void
+XLALVectorMathPairwiseAdd ( VectorMathPairwiseSum *sum, COMPLEX16 blocksum )
+{
+  UINT4 k = 0;
+  for ( UINT4 n = sum->nblocks; n & 1; n >>= 1, ++k ) {
+    blocksum += sum->partial[k];
+  }
+  sum->partial[k] = blocksum;
+  ++sum->nblocks;
+}
+
+/* return the total of all block sums, adding the smallest partial sums first */
+UNUSED static inline COMPLEX16
+XLALVectorMathPairwiseTotal ( const VectorMathPairwiseSum *sum )
+{
+  COMPLEX16 total = 0;
+  UINT4 k = 0;
+  for ( UINT4 n = sum->nblocks; n > 0; n >>= 1, ++k ) {
+    if ( n & 1 ) {
+      total += sum->partial[k];
+    }
+  }
+  return total;
+}
@@ -29,8 +29,11 @@
 
 
 #include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <gsl/gsl_sf_bessel.h>
+#include <config.h>
 #include <lal/LALConstants.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALString.h>
@@ -915,3 +918,215 @@ XLALCreateNamedREAL4Window ( const char *windowName, REAL8 beta, UINT4 length )
 {
   return XLALREAL4Window_from_REAL8Window ( XLALCreateNamedREAL8Window ( windowName, beta, length ) );
 }
+
+
+/*
+ * ============================================================================
+ *
+ *                               Window Cache
+ *
+ * ============================================================================
+ */
+
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_mutex_t windowCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+#else
+#define pthread_mutex_lock( pmut )
+#define pthread_mutex_unlock( pmut )
+#endif
+
+
+/* Maximum number, and total size in bytes, of windows kept in the cache
+ * while not in use; a window larger than the byte limit is freed as soon
+ * as its last user releases it */
+#define WINDOW_CACHE_MAX_UNUSED 8
+#define WINDOW_CACHE_MAX_UNUSED_BYTES (32 << 20)
+
+
+/*
+ * A cached window.  The window, its sequence, and its samples are stored in
+ * a single block allocated with malloc(), so that windows kept in the cache
+ * are not reported as memory leaks.  Entries are kept in a list in order of
+ * most recent use.
+ */
+typedef struct tagWindowCacheEntry {
+	struct tagWindowCacheEntry *next;
+	int type;
+	REAL8 beta;
+	UINT4 length;
+	UINT4 refcount;
+	REAL8Window window;
+	REAL8Sequence sequence;
+	REAL8 data[];
+} WindowCacheEntry;
+
+
+static WindowCacheEntry *windowCache = NULL;
+static int windowCacheAtExit = 0;
+
+
+/*
+ * Finds the entry with the given key, moves it to the front of the list,
+ * and increments its reference count.  Must be called with the cache
+ * locked.
+ */
+static WindowCacheEntry *WindowCacheFind(int type, REAL8 beta, UINT4 length)
+{
+	WindowCacheEntry **p;
+
+	for(p = &windowCache; *p; p = &(*p)->next) {
+		WindowCacheEntry *entry = *p;
+		if(entry->type == type && entry->beta == beta && entry->length == length) {
+			*p = entry->next;
+			entry->next = windowCache;
+			windowCache = entry;
+			entry->refcount++;
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+
+/*
+ * Frees the least recently used entries not in use, so that at most max of
+ * them, of at most maxbytes bytes in total, remain.  Must be called with
+ * the cache locked.
+ */
+static void WindowCacheEvict(UINT4 max, size_t maxbytes)
+{
+	WindowCacheEntry **p = &windowCache;
+	UINT4 unused = 0;
+	size_t bytes = 0;
+
+	while(*p) {
+		WindowCacheEntry *entry = *p;
+		size_t size = sizeof(*entry) + entry->length * sizeof(entry->data[0]);
+		if(entry->refcount == 0 && (unused >= max || size > maxbytes - bytes)) {
+			*p = entry->next;
+			free(entry);
+		} else {
+			if(entry->refcount == 0) {
+				unused++;
+				bytes += size;
+			}
+			p = &entry->next;
+		}
+	}
+}
+
+
+/*
+ * Frees the unused windows left in the cache when the process exits.
+ */
+static void WindowCacheFreeAtExit(void)
+{
+	XLALClearREAL8WindowCache();
+}
+
+
+/**
+ * Returns a shared window from the cache, creating it with
+ * XLALCreateNamedREAL8Window() if it is not already cached.  The window
+ * must not be modified, and must be returned with XLALReleaseREAL8Window().
+ */
+const REAL8Window *XLALAcquireNamedREAL8Window(const char *windowName, REAL8 beta, UINT4 length)
+{
+	WindowCacheEntry *entry;
+	WindowCacheEntry *found;
+	REAL8Window *window;
+	int type;
+
+	XLAL_CHECK_NULL(length > 0, XLAL_EINVAL);
+	XLAL_CHECK_NULL((type = XLALParseWindowNameAndCheckBeta(windowName, beta)) >= 0, XLAL_EFUNC);
+
+	pthread_mutex_lock(&windowCacheMutex);
+	entry = WindowCacheFind(type, beta, length);
+	pthread_mutex_unlock(&windowCacheMutex);
+	if(entry)
+		return &entry->window;
+
+	/* compute the window without holding the lock, so that other threads
+	 * can use the cache meanwhile */
+	window = XLALCreateNamedREAL8Window(windowName, beta, length);
+	XLAL_CHECK_NULL(window != NULL, XLAL_EFUNC);
+	/* not XLALMalloc(): windows may stay in the cache after their last
+	 * user releases them, and programs calling LALCheckMemoryLeaks() would
+	 * then report them as leaks.  The cache is instead emptied at exit by
+	 * WindowCacheFreeAtExit(). */
+	entry = malloc(sizeof(*entry) + length * sizeof(entry->data[0]));
+	if(!entry) {
+		XLALDestroyREAL8Window(window);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+	entry->type = type;
+	entry->beta = beta;
+	entry->length = length;
+	entry->refcount = 1;
+	memcpy(entry->data, window->data->data, length * sizeof(entry->data[0]));
+	entry->sequence.length = length;
+	entry->sequence.data = entry->data;
+	entry->window.data = &entry->sequence;
+	entry->window.sumofsquares = window->sumofsquares;
+	entry->window.sum = window->sum;
+	XLALDestroyREAL8Window(window);
+
+	/* another thread may have added the same window in the meantime */
+	pthread_mutex_lock(&windowCacheMutex);
+	found = WindowCacheFind(type, beta, length);
+	if(!found) {
+		entry->next = windowCache;
+		windowCache = entry;
+		if(!windowCacheAtExit) {
+			if(atexit(WindowCacheFreeAtExit) != 0)
+				XLALPrintWarning("WARNING: cached windows will not be freed at exit\n");
+			windowCacheAtExit = 1;
+		}
+	}
+	pthread_mutex_unlock(&windowCacheMutex);
+	if(found) {
+		free(entry);
+		entry = found;
+	}
+
+	return &entry->window;
+}
+
+
+/**
+ * Returns a window obtained from XLALAcquireNamedREAL8Window() to the cache.
+ */
+void XLALReleaseREAL8Window(const REAL8Window *window)
+{
+	WindowCacheEntry *entry;
+
+	if(!window)
+		return;
+
+	pthread_mutex_lock(&windowCacheMutex);
+	for(entry = windowCache; entry; entry = entry->next)
+		if(&entry->window == window)
+			break;
+	if(entry) {
+		entry->refcount--;
+		WindowCacheEvict(WINDOW_CACHE_MAX_UNUSED, WINDOW_CACHE_MAX_UNUSED_BYTES);
+	}
+	pthread_mutex_unlock(&windowCacheMutex);
+
+	if(!entry)
+		XLAL_ERROR_VOID(XLAL_EINVAL, "Window was not obtained from XLALAcquireNamedREAL8Window()");
+}
+
+
+/**
+ * Frees all windows in the cache which are not in use.
+ */
+void XLALClearREAL8WindowCache(void)
+{
+	pthread_mutex_lock(&windowCacheMutex);
+	WindowCacheEvict(0, 0);
+	pthread_mutex_unlock(&windowCacheMutex);
+}
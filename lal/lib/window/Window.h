@@ -232,6 +232,23 @@ extern "C" {
  * or to measure a broad spectrum with a large dynamical range (a Creighton or
  * a Papoulis window).
  *
+ * ### Cached windows ###
+ *
+ * Code which repeatedly needs the same window, e.g.\ for each segment of a
+ * long data stream, may use <tt>XLALAcquireNamedREAL8Window()</tt> instead of
+ * <tt>XLALCreateNamedREAL8Window()</tt>.  Windows are kept in a cache, keyed
+ * on the window type, length, and shape parameter, and a window is only
+ * computed the first time it is requested; later requests return the same
+ * window, including its \c sumofsquares and \c sum.  Cached windows are
+ * shared, and must not be modified.  Each window returned by
+ * <tt>XLALAcquireNamedREAL8Window()</tt> must be returned with
+ * <tt>XLALReleaseREAL8Window()</tt>.  Windows which are no longer in use
+ * remain in the cache, up to a small limit on their number and total size,
+ * until they are evicted to make room for others, or until
+ * <tt>XLALClearREAL8WindowCache()</tt> is called; a very long window is freed
+ * as soon as it is no longer in use.
+ * The cache may be used from multiple threads.
+ *
  */
 /** @{ */
 
@@ -306,6 +323,12 @@ COMPLEX16Sequence *XLALUnitaryWindowCOMPLEX16Sequence(COMPLEX16Sequence *sequenc
 REAL8Window *XLALCreateNamedREAL8Window ( const char *windowName, REAL8 beta, UINT4 length );
 REAL4Window *XLALCreateNamedREAL4Window ( const char *windowName, REAL8 beta, UINT4 length );
 
+#ifndef SWIG   /* exclude from SWIG interface */
+const REAL8Window *XLALAcquireNamedREAL8Window ( const char *windowName, REAL8 beta, UINT4 length );
+void XLALReleaseREAL8Window ( const REAL8Window *window );
+void XLALClearREAL8WindowCache ( void );
+#endif /* SWIG */
+
 /** @} */
 
 #ifdef  __cplusplus
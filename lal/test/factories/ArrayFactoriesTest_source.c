@@ -12,6 +12,7 @@
 #define RFUNC CONCAT3(LAL,TYPECODE,ResizeArray)
 #define DFUNC CONCAT3(LAL,TYPECODE,DestroyArray)
 #define FUNC CONCAT2(TYPECODE,ArrayFactoriesTest)
+#define AFUNCL CONCAT3(XLALArenaCreate,VTYPE,L)
 #else
 #define CFUNC LALCreateArray
 #define RFUNC LALResizeArray
@@ -82,6 +83,24 @@ static void FUNC ( void )
 
   LALCheckMemoryLeaks();
 
+#ifdef TYPECODE
+  /* arena arrays are released with the arena */
+  {
+    LALArena *arena = XLALArenaCreate( 0 );
+    if ( ! arena )
+      exit( 1 );
+    array = AFUNCL ( arena, 3, dims[0], dims[1], dims[2] );
+    if ( ! array || array->dimLength->length != 3
+        || memcmp( array->dimLength->data, dims, sizeof( dims ) ) )
+      exit( 1 );
+    memset( array->data, 0, dims[0]*dims[1]*dims[2]*sizeof( TYPE ) );
+    XLALArenaDestroy( arena );
+    array = NULL;
+  }
+
+  LALCheckMemoryLeaks();
+#endif
+
 
   /*
    *
@@ -162,3 +181,4 @@ static void FUNC ( void )
 #undef RFUNC
 #undef DFUNC
 #undef FUNC
+#undef AFUNCL
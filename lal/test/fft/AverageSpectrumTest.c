@@ -26,11 +26,98 @@
 #include <lal/RealFFT.h>
 #include <lal/Window.h>
 #include <lal/Random.h>
+#include <lal/Date.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/Units.h>
 
 #define TESTSTATUS( s ) \
   if ( (s)->statusCode ) { REPORTSTATUS( s ); exit( 1 ); } else \
 ((void)0)
 
+/* compare the streaming PSD estimator with the batch estimators */
+static int TestPSDStream( const REAL4Vector *noise, LALPSDStreamMethod method, UINT4 nsegments )
+{
+  const UINT4 seglen = 256;
+  const UINT4 stride = 128;
+  const UINT4 chunks[] = { 100, 37, 256, 1, 500, 129 };
+  LIGOTimeGPS epoch = { 1000000000, 0 };
+  REAL8TimeSeries *tseries;
+  REAL8TimeSeries *tail;
+  REAL8FrequencySeries *batch;
+  REAL8FrequencySeries *psd;
+  REAL8FFTPlan *plan;
+  REAL8Window *window;
+  LALPSDStream *stream;
+  UINT4 numseg = 0;
+  UINT4 offset = 0;
+  UINT4 c = 0;
+  UINT4 i;
+  REAL8 maxerr = 0;
+  int n;
+
+  tseries = XLALCreateREAL8TimeSeries( "x", &epoch, 0.0, 1.0 / 1024, &lalDimensionlessUnit, noise->length );
+  for ( i = 0; i < noise->length; ++i )
+    tseries->data->data[i] = noise->data[i];
+  plan = XLALCreateForwardREAL8FFTPlan( seglen, 0 );
+  window = XLALCreateHannREAL8Window( seglen );
+  stream = XLALPSDStreamNew( seglen, stride, nsegments, method, window, plan );
+  if ( ! tseries || ! plan || ! window || ! stream )
+    return 1;
+
+  /* feed the data in irregular chunks */
+  while ( offset < tseries->data->length )
+  {
+    REAL8TimeSeries *chunk;
+    UINT4 length = chunks[c++ % XLAL_NUM_ELEM( chunks )];
+    if ( length > tseries->data->length - offset )
+      length = tseries->data->length - offset;
+    chunk = XLALCutREAL8TimeSeries( tseries, offset, length );
+    n = XLALPSDStreamAddData( stream, chunk );
+    XLALDestroyREAL8TimeSeries( chunk );
+    if ( n < 0 )
+      return 1;
+    numseg += n;
+    offset += length;
+  }
+  if ( numseg != 1 + ( tseries->data->length - seglen ) / stride || numseg < nsegments )
+    return 1;
+  if ( XLALPSDStreamGetNSegments( stream ) != nsegments )
+    return 1;
+
+  /* batch estimate from the most recent nsegments segments */
+  tail = XLALCutREAL8TimeSeries( tseries, ( numseg - nsegments ) * stride, ( nsegments - 1 ) * stride + seglen );
+  batch = XLALCreateREAL8FrequencySeries( "batch", &epoch, 0.0, 0.0, &lalDimensionlessUnit, seglen / 2 + 1 );
+  if ( method == LAL_PSD_STREAM_MEDIAN )
+    n = XLALREAL8AverageSpectrumMedian( batch, tail, seglen, stride, window, plan );
+  else if ( method == LAL_PSD_STREAM_MEDIAN_MEAN )
+    n = XLALREAL8AverageSpectrumMedianMean( batch, tail, seglen, stride, window, plan );
+  else
+    n = XLALREAL8AverageSpectrumWelch( batch, tail, seglen, stride, window, plan );
+  psd = XLALPSDStreamGetPSD( stream );
+  if ( n || ! psd )
+    return 1;
+
+  for ( i = 0; i < psd->data->length; ++i )
+  {
+    REAL8 err = fabs( psd->data->data[i] - batch->data->data[i] ) / batch->data->data[i];
+    if ( isnan( err ) || err > maxerr )
+      maxerr = err;
+  }
+  XLALPrintInfo( "stream %s (%u segments):\tmax relative error:\t%e\n", method == LAL_PSD_STREAM_MEDIAN ? "median" : method == LAL_PSD_STREAM_MEDIAN_MEAN ? "median-mean" : "mean", nsegments, maxerr );
+  if ( ! ( maxerr <= 1e-10 ) || XLALGPSCmp( &psd->epoch, &tail->epoch ) || psd->deltaF != batch->deltaF )
+    return 1;
+
+  XLALDestroyREAL8FrequencySeries( psd );
+  XLALDestroyREAL8FrequencySeries( batch );
+  XLALDestroyREAL8TimeSeries( tail );
+  XLALPSDStreamFree( stream );
+  XLALDestroyREAL8Window( window );
+  XLALDestroyREAL8FFTPlan( plan );
+  XLALDestroyREAL8TimeSeries( tseries );
+  return 0;
+}
+
 int main( void )
 {
   const UINT4 n = 65536;
@@ -41,6 +128,7 @@ int main( void )
   static RandomParams *randpar;
   REAL4FFTPlan *plan;
   REAL4Window *window;
+  REAL4Vector noise;
   REAL8 ave;
   UINT4 i;
 
@@ -93,6 +181,18 @@ int main( void )
   ave /= fseries.data->length - 2;
   fprintf( stdout, "mean:\t%e\terror:\t%f%%\n", ave, fabs( ave - 2.0 ) / 0.02 );
 
+  /* streaming estimates over a shorter stretch of the same data */
+  noise.length = 4096;
+  noise.data = tseries.data->data;
+  if ( TestPSDStream( &noise, LAL_PSD_STREAM_MEDIAN, 9 )
+      || TestPSDStream( &noise, LAL_PSD_STREAM_MEDIAN, 8 )
+      || TestPSDStream( &noise, LAL_PSD_STREAM_MEDIAN_MEAN, 8 )
+      || TestPSDStream( &noise, LAL_PSD_STREAM_MEDIAN_MEAN, 6 )
+      || TestPSDStream( &noise, LAL_PSD_STREAM_WELCH, 9 ) )
+  {
+    fprintf( stderr, "streaming PSD test failed\n" );
+    return 1;
+  }
 
   /* cleanup */
   XLALDestroyREAL4Window( window );
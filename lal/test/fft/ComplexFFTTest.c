@@ -61,6 +61,8 @@
 #include <lal/LALgetopt.h>
 #include <lal/AVFactories.h>
 #include <lal/ComplexFFT.h>
+#include <lal/FFTWMutex.h>
+#include <lal/SeqFactories.h>
 #include <lal/LALString.h>
 #include <config.h>
 
@@ -78,6 +80,12 @@ ParseOptions( int argc, char *argv[] );
 static void
 TestStatus( LALStatus *status, const char *expectedCodes, int exitCode );
 
+static int
+TestBatch( UINT4 n, UINT4 howmany, int interleaved, REAL4 eps );
+
+static int
+TestBatch16( UINT4 n, UINT4 howmany, int interleaved, REAL8 eps );
+
 int
 main( int argc, char *argv[] )
 {
@@ -164,6 +172,34 @@ main( int argc, char *argv[] )
 
   XLALDestroyCOMPLEX8FFTPlan( pfwd );
 
+  /* batched transforms of contiguous and interleaved vectors */
+  if ( TestBatch( n, 5, 0, eps ) || TestBatch( n, 5, 1, eps ) )
+    return 1;
+  if ( TestBatch16( n, 5, 0, 1e-12 ) || TestBatch16( n, 5, 1, 1e-12 ) )
+    return 1;
+
+  /* batch plans whose vectors overlap are rejected */
+  {
+    COMPLEX8FFTBatchPlan *bad8 = NULL;
+    COMPLEX16FFTBatchPlan *bad16 = NULL;
+    int errnum8;
+    int errnum16;
+    XLAL_TRY_SILENT( bad8 = XLALCreateCOMPLEX8FFTBatchPlan( n, 5, 1, n - 1, 1, 0 ), errnum8 );
+    XLAL_TRY_SILENT( bad16 = XLALCreateCOMPLEX16FFTBatchPlan( n, 5, 2, 3, 0, 0 ), errnum16 );
+    if ( bad8 || bad16 || errnum8 != XLAL_EINVAL || errnum16 != XLAL_EINVAL )
+    {
+      fprintf( stderr, "FAIL: batch plan with overlapping vectors was not rejected.\n" );
+      return 1;
+    }
+  }
+
+  /* repeat with threaded plans; results must not depend on thread count */
+  if ( XLALSetFFTThreads( 2 ) != XLAL_SUCCESS || XLALGetFFTThreads() != 2 )
+    return 1;
+  if ( TestBatch( n, 5, 0, eps ) )
+    return 1;
+  XLALSetFFTThreads( 0 );
+
   LALCDestroyVector( &status, &cvec );
   TestStatus( &status, CODES( 0 ), 1 );
 
@@ -178,6 +214,172 @@ main( int argc, char *argv[] )
 }
 
 
+/*
+ * TestBatch()
+ *
+ * Compares a batch of transforms against the single-vector transform of
+ * each vector; vectors are either stored one after another, or interleaved
+ * element by element.
+ *
+ */
+static int
+TestBatch( UINT4 n, UINT4 howmany, int interleaved, REAL4 eps )
+{
+  const UINT4 stride = interleaved ? howmany : 1;
+  const UINT4 dist = interleaved ? 1 : n;
+  COMPLEX8FFTBatchPlan   *pfwd;
+  COMPLEX8FFTBatchPlan   *prev;
+  COMPLEX8FFTPlan        *plan;
+  COMPLEX8VectorSequence *aseq;
+  COMPLEX8VectorSequence *bseq;
+  COMPLEX8VectorSequence *cseq;
+  COMPLEX8Vector         *avec;
+  COMPLEX8Vector         *bvec;
+  UINT4 i;
+  UINT4 j;
+
+  pfwd = XLALCreateForwardCOMPLEX8FFTBatchPlan( n, howmany, stride, dist, 0 );
+  prev = XLALCreateReverseCOMPLEX8FFTBatchPlan( n, howmany, stride, dist, 0 );
+  plan = XLALCreateForwardCOMPLEX8FFTPlan( n, 0 );
+  aseq = XLALCreateCOMPLEX8VectorSequence( howmany, n );
+  bseq = XLALCreateCOMPLEX8VectorSequence( howmany, n );
+  cseq = XLALCreateCOMPLEX8VectorSequence( howmany, n );
+  avec = XLALCreateCOMPLEX8Vector( n );
+  bvec = XLALCreateCOMPLEX8Vector( n );
+  if ( ! pfwd || ! prev || ! plan || ! aseq || ! bseq || ! cseq || ! avec || ! bvec )
+  {
+    fprintf( stderr, "FAIL: could not allocate batch test memory.\n" );
+    return 1;
+  }
+
+  for ( i = 0; i < howmany * n; ++i )
+  {
+    aseq->data[i] = rand() % 5 - 2;
+    aseq->data[i] += I * (rand() % 3 - 1);
+  }
+
+  if ( XLALCOMPLEX8VectorSequenceFFT( bseq, aseq, pfwd ) != 0
+       || XLALCOMPLEX8VectorSequenceFFT( cseq, bseq, prev ) != 0 )
+  {
+    fprintf( stderr, "FAIL: batched FFT returned an error.\n" );
+    return 1;
+  }
+
+  for ( i = 0; i < howmany; ++i )
+  {
+    for ( j = 0; j < n; ++j )
+      avec->data[j] = aseq->data[i * dist + j * stride];
+    XLALCOMPLEX8VectorFFT( bvec, avec, plan );
+    for ( j = 0; j < n; ++j )
+    {
+      const UINT4 idx = i * dist + j * stride;
+      if ( cabsf( bseq->data[idx] - bvec->data[j] ) > eps * n )
+      {
+        fprintf( stderr, "FAIL: batched FFT not equal to FFT of vector %u.\n", i );
+        return 1;
+      }
+      if ( cabsf( cseq->data[idx] / n - aseq->data[idx] ) > eps )
+      {
+        fprintf( stderr, "FAIL: batched IFFT( FFT( a[] ) ) not equal to a[].\n" );
+        return 1;
+      }
+    }
+  }
+
+  XLALDestroyCOMPLEX8Vector( bvec );
+  XLALDestroyCOMPLEX8Vector( avec );
+  XLALDestroyCOMPLEX8VectorSequence( cseq );
+  XLALDestroyCOMPLEX8VectorSequence( bseq );
+  XLALDestroyCOMPLEX8VectorSequence( aseq );
+  XLALDestroyCOMPLEX8FFTPlan( plan );
+  XLALDestroyCOMPLEX8FFTBatchPlan( prev );
+  XLALDestroyCOMPLEX8FFTBatchPlan( pfwd );
+
+  return 0;
+}
+
+/*
+ * TestBatch16()
+ *
+ * As TestBatch(), for COMPLEX16 data.
+ *
+ */
+static int
+TestBatch16( UINT4 n, UINT4 howmany, int interleaved, REAL8 eps )
+{
+  const UINT4 stride = interleaved ? howmany : 1;
+  const UINT4 dist = interleaved ? 1 : n;
+  COMPLEX16FFTBatchPlan   *pfwd;
+  COMPLEX16FFTBatchPlan   *prev;
+  COMPLEX16FFTPlan        *plan;
+  COMPLEX16VectorSequence *aseq;
+  COMPLEX16VectorSequence *bseq;
+  COMPLEX16VectorSequence *cseq;
+  COMPLEX16Vector         *avec;
+  COMPLEX16Vector         *bvec;
+  UINT4 i;
+  UINT4 j;
+
+  pfwd = XLALCreateForwardCOMPLEX16FFTBatchPlan( n, howmany, stride, dist, 0 );
+  prev = XLALCreateReverseCOMPLEX16FFTBatchPlan( n, howmany, stride, dist, 0 );
+  plan = XLALCreateForwardCOMPLEX16FFTPlan( n, 0 );
+  aseq = XLALCreateCOMPLEX16VectorSequence( howmany, n );
+  bseq = XLALCreateCOMPLEX16VectorSequence( howmany, n );
+  cseq = XLALCreateCOMPLEX16VectorSequence( howmany, n );
+  avec = XLALCreateCOMPLEX16Vector( n );
+  bvec = XLALCreateCOMPLEX16Vector( n );
+  if ( ! pfwd || ! prev || ! plan || ! aseq || ! bseq || ! cseq || ! avec || ! bvec )
+  {
+    fprintf( stderr, "FAIL: could not allocate batch test memory.\n" );
+    return 1;
+  }
+
+  for ( i = 0; i < howmany * n; ++i )
+  {
+    aseq->data[i] = rand() % 5 - 2;
+    aseq->data[i] += I * (rand() % 3 - 1);
+  }
+
+  if ( XLALCOMPLEX16VectorSequenceFFT( bseq, aseq, pfwd ) != 0
+       || XLALCOMPLEX16VectorSequenceFFT( cseq, bseq, prev ) != 0 )
+  {
+    fprintf( stderr, "FAIL: batched FFT returned an error.\n" );
+    return 1;
+  }
+
+  for ( i = 0; i < howmany; ++i )
+  {
+    for ( j = 0; j < n; ++j )
+      avec->data[j] = aseq->data[i * dist + j * stride];
+    XLALCOMPLEX16VectorFFT( bvec, avec, plan );
+    for ( j = 0; j < n; ++j )
+    {
+      const UINT4 idx = i * dist + j * stride;
+      if ( cabs( bseq->data[idx] - bvec->data[j] ) > eps * n )
+      {
+        fprintf( stderr, "FAIL: batched FFT not equal to FFT of vector %u.\n", i );
+        return 1;
+      }
+      if ( cabs( cseq->data[idx] / n - aseq->data[idx] ) > eps )
+      {
+        fprintf( stderr, "FAIL: batched IFFT( FFT( a[] ) ) not equal to a[].\n" );
+        return 1;
+      }
+    }
+  }
+
+  XLALDestroyCOMPLEX16Vector( bvec );
+  XLALDestroyCOMPLEX16Vector( avec );
+  XLALDestroyCOMPLEX16VectorSequence( cseq );
+  XLALDestroyCOMPLEX16VectorSequence( bseq );
+  XLALDestroyCOMPLEX16VectorSequence( aseq );
+  XLALDestroyCOMPLEX16FFTPlan( plan );
+  XLALDestroyCOMPLEX16FFTBatchPlan( prev );
+  XLALDestroyCOMPLEX16FFTBatchPlan( pfwd );
+
+  return 0;
+}
+
 /*
  * TestStatus()
  *
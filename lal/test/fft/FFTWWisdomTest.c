@@ -0,0 +1,175 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/**
+ * \file
+ * \ingroup FFTWMutex_h
+ *
+ * \brief Tests the persistent FFTW wisdom cache of XLALFFTWImportWisdomCache()
+ * and XLALFFTWExportWisdomCache().
+ *
+ * The cache is pointed at a new temporary directory.  Measured REAL8 and
+ * REAL4 plans are created and their wisdom exported; the wisdom files are
+ * then re-imported into an empty planner, which must be able to recreate
+ * the same plans from wisdom alone.  Finally, wisdom for a second size is
+ * exported from a planner which has forgotten the first, and the cache
+ * files must then hold the wisdom of both sizes.
+ */
+
+/** \cond DONT_DOXYGEN */
+#include <config.h>
+
+#include <lal/LALConfig.h>
+
+#if !defined(LAL_FFTW3_ENABLED) || !defined(HAVE_UNISTD_H)
+int main(void) { return 77; /* don't do any testing */ }
+#else
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <fftw3.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/FFTWMutex.h>
+#include <lal/RealFFT.h>
+
+#ifdef LAL_FFTW3_MEMALIGN_ENABLED
+#define PLAN_FLAGS ( FFTW_MEASURE | FFTW_WISDOM_ONLY )
+#else
+#define PLAN_FLAGS ( FFTW_MEASURE | FFTW_WISDOM_ONLY | FFTW_UNALIGNED )
+#endif
+
+/* the double- and single-precision cache files in the cache directory */
+static char wisdomFile[2][FILENAME_MAX];
+
+static int FindWisdomFiles(const char *dir)
+{
+  DIR *d;
+  struct dirent *entry;
+  wisdomFile[0][0] = wisdomFile[1][0] = '\0';
+  XLAL_CHECK((d = opendir(dir)) != NULL, XLAL_EIO, "Could not open '%s'", dir);
+  while ((entry = readdir(d)) != NULL) {
+    int k = -1;
+    if (strncmp(entry->d_name, "lal-fftw-", 9) == 0)
+      k = 0;
+    else if (strncmp(entry->d_name, "lal-fftwf-", 10) == 0)
+      k = 1;
+    if (k >= 0)
+      snprintf(wisdomFile[k], sizeof(wisdomFile[k]), "%s/%s", dir, entry->d_name);
+  }
+  closedir(d);
+  XLAL_CHECK(wisdomFile[0][0] != '\0', XLAL_EFAILED, "No double-precision wisdom file in '%s'", dir);
+  XLAL_CHECK(wisdomFile[1][0] != '\0', XLAL_EFAILED, "No single-precision wisdom file in '%s'", dir);
+  return XLAL_SUCCESS;
+}
+
+/* create and destroy measured LAL plans of the given size */
+static int CreateMeasuredPlans(UINT4 n)
+{
+  REAL8FFTPlan *plan8;
+  REAL4FFTPlan *plan4;
+  XLAL_CHECK((plan8 = XLALCreateForwardREAL8FFTPlan(n, 1)) != NULL, XLAL_EFUNC);
+  XLAL_CHECK((plan4 = XLALCreateForwardREAL4FFTPlan(n, 1)) != NULL, XLAL_EFUNC);
+  XLALDestroyREAL8FFTPlan(plan8);
+  XLALDestroyREAL4FFTPlan(plan4);
+  return XLAL_SUCCESS;
+}
+
+/* returns 1 if plans of the given size can be created from wisdom alone, 0 otherwise */
+static int HaveWisdom(UINT4 n)
+{
+  int have = 1;
+  double *in8 = fftw_malloc(n * sizeof(*in8));
+  double *out8 = fftw_malloc(n * sizeof(*out8));
+  float *in4 = fftwf_malloc(n * sizeof(*in4));
+  float *out4 = fftwf_malloc(n * sizeof(*out4));
+  fftw_plan plan8 = fftw_plan_r2r_1d(n, in8, out8, FFTW_R2HC, PLAN_FLAGS);
+  fftwf_plan plan4 = fftwf_plan_r2r_1d(n, in4, out4, FFTW_R2HC, PLAN_FLAGS);
+  if (plan8)
+    fftw_destroy_plan(plan8);
+  else
+    have = 0;
+  if (plan4)
+    fftwf_destroy_plan(plan4);
+  else
+    have = 0;
+  fftw_free(in8);
+  fftw_free(out8);
+  fftwf_free(in4);
+  fftwf_free(out4);
+  return have;
+}
+
+/* replace the planner's wisdom with the contents of the cache files */
+static int ReimportWisdomFiles(void)
+{
+  fftw_forget_wisdom();
+  fftwf_forget_wisdom();
+  XLAL_CHECK(fftw_import_wisdom_from_filename(wisdomFile[0]), XLAL_EFAILED, "Could not import '%s'", wisdomFile[0]);
+  XLAL_CHECK(fftwf_import_wisdom_from_filename(wisdomFile[1]), XLAL_EFAILED, "Could not import '%s'", wisdomFile[1]);
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  const UINT4 n1 = 192;
+  const UINT4 n2 = 320;
+  char dir[] = "FFTWWisdomTest.XXXXXX";
+
+  XLAL_CHECK_MAIN(mkdtemp(dir) != NULL, XLAL_EIO, "Could not create temporary directory");
+  XLAL_CHECK_MAIN(setenv("LAL_FFTW_WISDOM_DIR", dir, 1) == 0, XLAL_ESYS);
+  XLAL_CHECK_MAIN(XLALSetFFTThreads(1) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* the first LAL plan loads the (empty) cache; export writes the cache files */
+  XLAL_CHECK_MAIN(CreateMeasuredPlans(n1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(XLALFFTWExportWisdomCache() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(FindWisdomFiles(dir) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* an empty planner has no wisdom; the cache files restore it */
+  fftw_forget_wisdom();
+  fftwf_forget_wisdom();
+  XLAL_CHECK_MAIN(!HaveWisdom(n1), XLAL_EFAILED, "Planner has wisdom after forgetting it");
+  XLAL_CHECK_MAIN(ReimportWisdomFiles() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(HaveWisdom(n1), XLAL_EFAILED, "Wisdom for size %u did not round-trip through the cache", n1);
+
+  /* new wisdom is merged with that already in the cache files */
+  fftw_forget_wisdom();
+  fftwf_forget_wisdom();
+  XLAL_CHECK_MAIN(CreateMeasuredPlans(n2) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(XLALFFTWExportWisdomCache() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(ReimportWisdomFiles() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(HaveWisdom(n1), XLAL_EFAILED, "Wisdom for size %u was lost when merging", n1);
+  XLAL_CHECK_MAIN(HaveWisdom(n2), XLAL_EFAILED, "Wisdom for size %u was not merged", n2);
+
+  /* save now, so that nothing is left to write to the removed directory at exit */
+  XLAL_CHECK_MAIN(XLALFFTWExportWisdomCache() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(remove(wisdomFile[0]) == 0 && remove(wisdomFile[1]) == 0 && rmdir(dir) == 0, XLAL_EIO, "Could not remove '%s'", dir);
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+#endif
+
+/** \endcond */
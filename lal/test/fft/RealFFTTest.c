@@ -87,6 +87,12 @@ ParseOptions( int argc, char *argv[] );
 static void
 TestStatus( LALStatus *status, const char *expectedCodes, int exitCode );
 
+static int
+TestBatch( UINT4 n, UINT4 howmany, UINT4 stride, UINT4 dist, REAL8 eps );
+
+static int
+TestBatchREAL8( UINT4 n, UINT4 howmany, UINT4 stride, UINT4 dist, REAL8 eps );
+
 void LALForwardRealDFT(
     LALStatus      *status,
     COMPLEX8Vector *output,
@@ -304,10 +310,247 @@ int main( int argc, char *argv[] )
     TestStatus( &status, CODES( 0 ), 1 );
   }
 
+  /*
+   *
+   * Check batched transforms of contiguous, overlapping and interleaved
+   * vectors.
+   *
+   */
+  if ( TestBatch( 64, 7, 1, 64, eps ) || TestBatch( 63, 7, 1, 63, eps ) || TestBatch( 64, 7, 1, 32, eps )
+       || TestBatch( 64, 7, 7, 1, eps ) || TestBatch( 63, 3, 5, 2, eps ) )
+  {
+    return 1;
+  }
+  if ( TestBatchREAL8( 64, 7, 1, 64, 1e-12 ) || TestBatchREAL8( 63, 7, 1, 32, 1e-12 )
+       || TestBatchREAL8( 64, 7, 7, 1, 1e-12 ) || TestBatchREAL8( 63, 3, 5, 2, 1e-12 ) )
+  {
+    return 1;
+  }
+
+  /* reverse batch plans whose real output vectors overlap are rejected */
+  {
+    REAL4FFTBatchPlan *bad4 = NULL;
+    REAL8FFTBatchPlan *bad8 = NULL;
+    int errnum4;
+    int errnum8;
+    XLAL_TRY_SILENT( bad4 = XLALCreateReverseREAL4FFTBatchPlan( 64, 7, 1, 32, 0 ), errnum4 );
+    XLAL_TRY_SILENT( bad8 = XLALCreateReverseREAL8FFTBatchPlan( 63, 3, 2, 3, 0 ), errnum8 );
+    if ( bad4 || bad8 || errnum4 != XLAL_EINVAL || errnum8 != XLAL_EINVAL )
+    {
+      fputs( "FAIL: reverse batch plan with overlapping output vectors was not rejected\n", stderr );
+      return 1;
+    }
+  }
+
   LALCheckMemoryLeaks();
   return 0;
 }
 
+/*
+ * TestBatch()
+ *
+ * Compares a batch of forward transforms and power spectra of howmany
+ * vectors of length n, the first elements of which are dist apart and the
+ * elements of which are stride apart, against the single-vector routines,
+ * and checks the batched reverse transform into the same strided layout.
+ *
+ */
+static int
+TestBatch( UINT4 n, UINT4 howmany, UINT4 stride, UINT4 dist, REAL8 eps )
+{
+  REAL4FFTBatchPlan      *bfwd;
+  REAL4FFTBatchPlan      *brev;
+  REAL4FFTPlan           *fwd;
+  REAL4VectorSequence    *dat;
+  REAL4VectorSequence    *spec;
+  REAL4VectorSequence    *ans;
+  COMPLEX8VectorSequence *fft;
+  REAL4Vector            *vec;
+  REAL4Vector            *pow;
+  COMPLEX8Vector         *ref;
+  UINT4 i;
+  UINT4 j;
+  UINT4 k;
+  const UINT4 extent = ( howmany - 1 ) * dist + ( n - 1 ) * stride + 1;
+  /* overlapping vectors are written back contiguously */
+  const UINT4 rdist = ( stride == 1 && dist < n ) ? n : dist;
+
+  bfwd = XLALCreateForwardREAL4FFTBatchPlan( n, howmany, stride, dist, 0 );
+  brev = XLALCreateReverseREAL4FFTBatchPlan( n, howmany, stride, rdist, 0 );
+  fwd = XLALCreateForwardREAL4FFTPlan( n, 0 );
+  dat = XLALCreateREAL4VectorSequence( 1, extent );
+  spec = XLALCreateREAL4VectorSequence( howmany, n / 2 + 1 );
+  ans = XLALCreateREAL4VectorSequence( 1, ( howmany - 1 ) * rdist + ( n - 1 ) * stride + 1 );
+  fft = XLALCreateCOMPLEX8VectorSequence( howmany, n / 2 + 1 );
+  vec = XLALCreateREAL4Vector( n );
+  pow = XLALCreateREAL4Vector( n / 2 + 1 );
+  ref = XLALCreateCOMPLEX8Vector( n / 2 + 1 );
+  if ( ! bfwd || ! brev || ! fwd || ! dat || ! spec || ! ans || ! fft || ! vec || ! pow || ! ref )
+  {
+    fputs( "FAIL: Unable to allocate memory for batched transforms\n", stderr );
+    return 1;
+  }
+
+  srand( n );
+  for ( j = 0; j < dat->vectorLength; ++j )
+  {
+    dat->data[j] = 20.0 * rand() / (REAL4)( RAND_MAX + 1.0 ) - 10.0;
+  }
+
+  if ( XLALREAL4VectorSequenceForwardFFT( fft, dat, bfwd ) != 0
+       || XLALREAL4VectorSequencePowerSpectrum( spec, dat, bfwd ) != 0
+       || XLALREAL4VectorSequenceReverseFFT( ans, fft, brev ) != 0 )
+  {
+    fputs( "FAIL: Error in batched transform\n", stderr );
+    return 1;
+  }
+
+  for ( i = 0; i < howmany; ++i )
+  {
+    for ( j = 0; j < n; ++j )
+    {
+      vec->data[j] = dat->data[i * dist + j * stride];
+    }
+    XLALREAL4ForwardFFT( ref, vec, fwd );
+    XLALREAL4PowerSpectrum( pow, vec, fwd );
+    for ( k = 0; k <= n / 2; ++k )
+    {
+      REAL8 err = cabs( ref->data[k] - fft->data[i * ( n / 2 + 1 ) + k] );
+      REAL8 perr = fabs( pow->data[k] - spec->data[i * ( n / 2 + 1 ) + k] );
+      if ( err > 1e2 * eps * ( cabs( ref->data[k] ) + 1 ) || perr > 1e2 * eps * ( pow->data[k] + 1 ) )
+      {
+        fputs( "FAIL: Batched transform differs from single transform\n", stderr );
+        fprintf( stderr, "\tvector = %u, bin = %u\n", i, k );
+        return 1;
+      }
+    }
+    for ( j = 0; j < n; ++j )
+    {
+      REAL8 err = fabs( vec->data[j] - ans->data[i * rdist + j * stride] / n );
+      if ( err > 1e3 * eps * ( fabs( vec->data[j] ) + 1 ) )
+      {
+        fputs( "FAIL: Incorrect result after batched reverse transform\n", stderr );
+        fprintf( stderr, "\tvector = %u, element = %u\n", i, j );
+        return 1;
+      }
+    }
+  }
+
+  XLALDestroyCOMPLEX8Vector( ref );
+  XLALDestroyREAL4Vector( pow );
+  XLALDestroyREAL4Vector( vec );
+  XLALDestroyCOMPLEX8VectorSequence( fft );
+  XLALDestroyREAL4VectorSequence( ans );
+  XLALDestroyREAL4VectorSequence( spec );
+  XLALDestroyREAL4VectorSequence( dat );
+  XLALDestroyREAL4FFTPlan( fwd );
+  XLALDestroyREAL4FFTBatchPlan( brev );
+  XLALDestroyREAL4FFTBatchPlan( bfwd );
+
+  return 0;
+}
+
+/*
+ * TestBatchREAL8()
+ *
+ * As TestBatch(), for REAL8 data.
+ *
+ */
+static int
+TestBatchREAL8( UINT4 n, UINT4 howmany, UINT4 stride, UINT4 dist, REAL8 eps )
+{
+  REAL8FFTBatchPlan       *bfwd;
+  REAL8FFTBatchPlan       *brev;
+  REAL8FFTPlan            *fwd;
+  REAL8VectorSequence     *dat;
+  REAL8VectorSequence     *spec;
+  REAL8VectorSequence     *ans;
+  COMPLEX16VectorSequence *fft;
+  REAL8Vector             *vec;
+  REAL8Vector             *pow;
+  COMPLEX16Vector         *ref;
+  UINT4 i;
+  UINT4 j;
+  UINT4 k;
+  const UINT4 extent = ( howmany - 1 ) * dist + ( n - 1 ) * stride + 1;
+  /* overlapping vectors are written back contiguously */
+  const UINT4 rdist = ( stride == 1 && dist < n ) ? n : dist;
+
+  bfwd = XLALCreateForwardREAL8FFTBatchPlan( n, howmany, stride, dist, 0 );
+  brev = XLALCreateReverseREAL8FFTBatchPlan( n, howmany, stride, rdist, 0 );
+  fwd = XLALCreateForwardREAL8FFTPlan( n, 0 );
+  dat = XLALCreateREAL8VectorSequence( 1, extent );
+  spec = XLALCreateREAL8VectorSequence( howmany, n / 2 + 1 );
+  ans = XLALCreateREAL8VectorSequence( 1, ( howmany - 1 ) * rdist + ( n - 1 ) * stride + 1 );
+  fft = XLALCreateCOMPLEX16VectorSequence( howmany, n / 2 + 1 );
+  vec = XLALCreateREAL8Vector( n );
+  pow = XLALCreateREAL8Vector( n / 2 + 1 );
+  ref = XLALCreateCOMPLEX16Vector( n / 2 + 1 );
+  if ( ! bfwd || ! brev || ! fwd || ! dat || ! spec || ! ans || ! fft || ! vec || ! pow || ! ref )
+  {
+    fputs( "FAIL: Unable to allocate memory for batched transforms\n", stderr );
+    return 1;
+  }
+
+  srand( n );
+  for ( j = 0; j < dat->vectorLength; ++j )
+  {
+    dat->data[j] = 20.0 * rand() / (REAL8)( RAND_MAX + 1.0 ) - 10.0;
+  }
+
+  if ( XLALREAL8VectorSequenceForwardFFT( fft, dat, bfwd ) != 0
+       || XLALREAL8VectorSequencePowerSpectrum( spec, dat, bfwd ) != 0
+       || XLALREAL8VectorSequenceReverseFFT( ans, fft, brev ) != 0 )
+  {
+    fputs( "FAIL: Error in batched transform\n", stderr );
+    return 1;
+  }
+
+  for ( i = 0; i < howmany; ++i )
+  {
+    for ( j = 0; j < n; ++j )
+    {
+      vec->data[j] = dat->data[i * dist + j * stride];
+    }
+    XLALREAL8ForwardFFT( ref, vec, fwd );
+    XLALREAL8PowerSpectrum( pow, vec, fwd );
+    for ( k = 0; k <= n / 2; ++k )
+    {
+      REAL8 err = cabs( ref->data[k] - fft->data[i * ( n / 2 + 1 ) + k] );
+      REAL8 perr = fabs( pow->data[k] - spec->data[i * ( n / 2 + 1 ) + k] );
+      if ( err > 1e2 * eps * ( cabs( ref->data[k] ) + 1 ) || perr > 1e2 * eps * ( pow->data[k] + 1 ) )
+      {
+        fputs( "FAIL: Batched transform differs from single transform\n", stderr );
+        fprintf( stderr, "\tvector = %u, bin = %u\n", i, k );
+        return 1;
+      }
+    }
+    for ( j = 0; j < n; ++j )
+    {
+      REAL8 err = fabs( vec->data[j] - ans->data[i * rdist + j * stride] / n );
+      if ( err > 1e3 * eps * ( fabs( vec->data[j] ) + 1 ) )
+      {
+        fputs( "FAIL: Incorrect result after batched reverse transform\n", stderr );
+        fprintf( stderr, "\tvector = %u, element = %u\n", i, j );
+        return 1;
+      }
+    }
+  }
+
+  XLALDestroyCOMPLEX16Vector( ref );
+  XLALDestroyREAL8Vector( pow );
+  XLALDestroyREAL8Vector( vec );
+  XLALDestroyCOMPLEX16VectorSequence( fft );
+  XLALDestroyREAL8VectorSequence( ans );
+  XLALDestroyREAL8VectorSequence( spec );
+  XLALDestroyREAL8VectorSequence( dat );
+  XLALDestroyREAL8FFTPlan( fwd );
+  XLALDestroyREAL8FFTBatchPlan( brev );
+  XLALDestroyREAL8FFTBatchPlan( bfwd );
+
+  return 0;
+}
+
 /*
  * TestStatus()
  *
@@ -91,6 +91,38 @@ int main(void) {
     printf("%g sec (%e sec/deallocate)\n", t, t/n);
   }
 
+  {
+    void *x[1024];
+    printf("LALMallocPerf: Allocate/deallocate in batches of 1024:\t");
+    const REAL8 t0 = XLALGetCPUTime();
+    for (int k = 0; k < n; k += 1024) {
+      for (int i = 0; i < 1024; ++i) {
+        x[i] = XLALMalloc(sizeof(int) * (1 + i % 64));
+      }
+      for (int i = 0; i < 1024; ++i) {
+        XLALFree(x[i]);
+      }
+    }
+    const REAL8 t = XLALGetCPUTime() - t0;
+    printf("%g sec (%e sec/allocate)\n", t, t/n);
+  }
+
+  {
+    LALArena *arena = XLALArenaCreate(0);
+    XLAL_CHECK_MAIN(arena != NULL, XLAL_EFUNC);
+    printf("LALMallocPerf: Arena allocate/reset in batches of 1024:\t");
+    const REAL8 t0 = XLALGetCPUTime();
+    for (int k = 0; k < n; k += 1024) {
+      for (int i = 0; i < 1024; ++i) {
+        XLAL_CHECK_MAIN(XLALArenaAlloc(arena, sizeof(int) * (1 + i % 64)) != NULL, XLAL_EFUNC);
+      }
+      XLALArenaReset(arena);
+    }
+    const REAL8 t = XLALGetCPUTime() - t0;
+    printf("%g sec (%e sec/allocate)\n", t, t/n);
+    XLALArenaDestroy(arena);
+  }
+
   LALCheckMemoryLeaks();
 
   return EXIT_SUCCESS;
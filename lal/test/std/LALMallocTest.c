@@ -126,6 +126,9 @@ size_t  *q;
 size_t  *r;
 size_t  *s;
 size_t **v;
+LALArena *arena;
+char    *a;
+char    *b;
 
 #if defined(NDEBUG)
 /* debugging is turned off */
@@ -332,6 +335,53 @@ static int stressTestRealloc( void )
   XLALClobberDebugLevel(keep);
   return 0;
 }
+
+/* test the arena allocator */
+static int testArena( void )
+{
+  int keep = lalDebugLevel;
+
+  XLALClobberDebugLevel(lalDebugLevel | LALMEMDBGBIT | LALMEMPADBIT | LALMEMTRKBIT);
+  XLALClobberDebugLevel(lalDebugLevel & ~LALMEMINFOBIT);
+
+  /* allocations are aligned and contiguous within a block */
+  trial( arena = XLALArenaCreate( 1024 ), 0, "" );
+  trial( a = XLALArenaAlloc( arena, 1 ), 0, "" );
+  trial( b = XLALArenaAlloc( arena, 100 ), 0, "" );
+  if ( ( (size_t) a ) % LAL_ARENA_ALIGNMENT || ( (size_t) b ) % LAL_ARENA_ALIGNMENT ) die( arena allocation not aligned );
+  if ( b - a != LAL_ARENA_ALIGNMENT ) die( arena allocations not contiguous );
+
+  /* allocations larger than a block, and spanning several blocks */
+  trial( b = XLALArenaCalloc( arena, 4096, 1 ), 0, "" );
+  for ( i = 0; i < 4096; ++i ) if ( b[i] ) die( arena calloc did not zero memory );
+  for ( n = 0; n < 16; ++n )
+  {
+    trial( b = XLALArenaAlloc( arena, 500 ), 0, "" );
+    memset( b, n, 500 );
+  }
+  if ( XLALArenaUsed( arena ) != 64 + 128 + 4096 + 16 * 512 ) die( wrong arena usage );
+
+  /* an arena which is not destroyed is a memory leak */
+  trial( LALCheckMemoryLeaks(), SIGSEGV, "LALCheckMemoryLeaks: memory leak\n" );
+
+  /* after a reset, the same allocations are served from a single block */
+  trial( XLALArenaReset( arena ), 0, "" );
+  if ( XLALArenaUsed( arena ) != 0 ) die( arena not reset );
+  trial( a = XLALArenaAlloc( arena, 1 ), 0, "" );
+  trial( b = XLALArenaAlloc( arena, 100 ), 0, "" );
+  trial( b = XLALArenaCalloc( arena, 4096, 1 ), 0, "" );
+  for ( n = 0; n < 16; ++n )
+  {
+    trial( b = XLALArenaAlloc( arena, 500 ), 0, "" );
+  }
+  if ( b - a != 64 + 128 + 4096 + 15 * 512 ) die( arena blocks not coalesced by reset );
+
+  trial( XLALArenaDestroy( arena ), 0, "" );
+  trial( LALCheckMemoryLeaks(), 0, "" );
+
+  XLALClobberDebugLevel(keep);
+  return 0;
+}
 #endif
 
 
@@ -357,6 +407,7 @@ int main( void )
   if ( testPadding() ) return 1;
   if ( testAllocList() ) return 1;
   if ( stressTestRealloc() ) return 1;
+  if ( testArena() ) return 1;
 
   trial( LALCheckMemoryLeaks(), 0, "" );
 
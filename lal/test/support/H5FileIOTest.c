@@ -5,6 +5,7 @@ int main(void) { return 77; /* don't do any testing */ }
 #else
 
 #include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <lal/LALStdlib.h>
@@ -291,6 +292,232 @@ DEFINE_FREQUENCY_SERIES_FUNCTIONS(COMPLEX8FrequencySeries)
 DEFINE_FREQUENCY_SERIES_FUNCTIONS(COMPLEX16FrequencySeries)
 #undef GENERATE_DATA
 
+/* PARTIAL I/O ROUTINES */
+
+#define SLICE_LENGTH 1000
+#define BLOCK_LENGTH 64
+
+static void test_REAL8VectorSlice(void)
+{
+	REAL8Vector *orig;
+	REAL8Vector *copy;
+	LALH5File *file;
+	size_t i;
+	int errnum;
+	fprintf(stderr, "Testing Read of REAL8Vector slice...");
+	orig = XLALCreateREAL8Vector(SLICE_LENGTH);
+	for (i = 0; i < SLICE_LENGTH; ++i)
+		orig->data[i] = generate_float_data();
+	file = XLALH5FileOpen(FNAME, "w");
+	XLALH5FileWriteREAL8Vector(file, DSET, orig);
+	XLALH5FileClose(file);
+	file = XLALH5FileOpen(FNAME, "r");
+	copy = XLALH5FileReadREAL8VectorSlice(file, DSET, 17, 100, 3);
+	if (copy->length != 100) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	for (i = 0; i < copy->length; ++i)
+		if (copy->data[i] != orig->data[17 + 3 * i]) {
+			fprintf(stderr, " FAIL\n");
+			exit(1); /* fail */
+		}
+	XLALDestroyREAL8Vector(copy);
+	/* last element of the slice is the last element of the dataset */
+	copy = XLALH5FileReadREAL8VectorSlice(file, DSET, 17, (SLICE_LENGTH - 18) / 3 + 1, 3);
+	if (copy->data[copy->length - 1] != orig->data[17 + 3 * (copy->length - 1)]) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLALDestroyREAL8Vector(copy);
+	/* slices extending beyond the end of the dataset must fail */
+	XLAL_TRY_SILENT(copy = XLALH5FileReadREAL8VectorSlice(file, DSET, 17, (SLICE_LENGTH - 18) / 3 + 2, 3), errnum);
+	if (copy != NULL || (errnum & ~XLAL_EFUNC) != XLAL_EINVAL) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLAL_TRY_SILENT(copy = XLALH5FileReadREAL8VectorSlice(file, DSET, SLICE_LENGTH, 1, 1), errnum);
+	if (copy != NULL || (errnum & ~XLAL_EFUNC) != XLAL_EINVAL) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLALH5FileClose(file);
+	XLALDestroyREAL8Vector(orig);
+	fprintf(stderr, " PASS\n");
+}
+
+static void test_ChunkedHyperslab(void)
+{
+	REAL4 orig[DIM1][SLICE_LENGTH];
+	REAL4 copy[2][SLICE_LENGTH / 2];
+	UINT4Vector *dims;
+	UINT4Vector *chunks;
+	LALH5File *file;
+	LALH5Dataset *dset;
+	size_t offset[2];
+	size_t cnt[2];
+	size_t stride[2];
+	size_t i, j;
+	fprintf(stderr, "Testing Read/Write of chunked hyperslabs...");
+	for (i = 0; i < DIM1; ++i)
+		for (j = 0; j < SLICE_LENGTH; ++j)
+			orig[i][j] = generate_float_data();
+	dims = XLALCreateUINT4Vector(2);
+	chunks = XLALCreateUINT4Vector(2);
+	dims->data[0] = DIM1;
+	dims->data[1] = SLICE_LENGTH;
+	chunks->data[0] = 1;
+	chunks->data[1] = BLOCK_LENGTH;
+	file = XLALH5FileOpen(FNAME, "w");
+	dset = XLALH5DatasetAllocChunked(file, DSET, LAL_S_TYPE_CODE, dims, chunks, 6);
+	/* write the data one row at a time */
+	for (i = 0; i < DIM1; ++i) {
+		offset[0] = i;
+		offset[1] = 0;
+		cnt[0] = 1;
+		cnt[1] = SLICE_LENGTH;
+		XLALH5DatasetWriteHyperslab(dset, offset, cnt, NULL, orig[i]);
+	}
+	XLALH5DatasetFree(dset);
+	XLALH5FileClose(file);
+	XLALDestroyUINT4Vector(chunks);
+	XLALDestroyUINT4Vector(dims);
+	/* read every other column of rows 1 and 3 */
+	file = XLALH5FileOpen(FNAME, "r");
+	dset = XLALH5DatasetRead(file, DSET);
+	offset[0] = 1;
+	offset[1] = 1;
+	cnt[0] = 2;
+	cnt[1] = SLICE_LENGTH / 2;
+	stride[0] = 2;
+	stride[1] = 2;
+	XLALH5DatasetQueryHyperslab(copy, dset, offset, cnt, stride);
+	XLALH5DatasetFree(dset);
+	XLALH5FileClose(file);
+	for (i = 0; i < 2; ++i)
+		for (j = 0; j < SLICE_LENGTH / 2; ++j)
+			if (copy[i][j] != orig[1 + 2 * i][1 + 2 * j]) {
+				fprintf(stderr, " FAIL\n");
+				exit(1); /* fail */
+			}
+	fprintf(stderr, " PASS\n");
+}
+
+static void test_REAL8TimeSeriesIter(void)
+{
+	REAL8TimeSeries *orig;
+	REAL8TimeSeries *block;
+	LALH5File *file;
+	LALH5TimeSeriesIter *iter;
+	LIGOTimeGPS t;
+	size_t total = 0;
+	size_t i;
+	UINT8 n;
+	int status;
+	fprintf(stderr, "Testing streaming Read of REAL8TimeSeries...");
+	orig = XLALCreateREAL8TimeSeries("test_REAL8TimeSeries", &epoch, 0.0, 0.1, &lalStrainUnit, SLICE_LENGTH);
+	for (i = 0; i < SLICE_LENGTH; ++i)
+		orig->data->data[i] = generate_float_data();
+	file = XLALH5FileOpen(FNAME, "w");
+	XLALH5FileWriteREAL8TimeSeries(file, DSET, orig);
+	XLALH5FileClose(file);
+	block = XLALCreateREAL8TimeSeries("", &epoch, 0.0, 1.0, &lalDimensionlessUnit, BLOCK_LENGTH);
+	file = XLALH5FileOpen(FNAME, "r");
+	iter = XLALH5TimeSeriesIterOpen(file, DSET);
+	if (XLALH5TimeSeriesIterQueryLength(iter) != SLICE_LENGTH) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	while ((status = XLALH5TimeSeriesIterNextREAL8TimeSeries(&n, block, iter)) == 0 && n > 0) {
+		t = orig->epoch;
+		XLALGPSAdd(&t, total * orig->deltaT);
+		if (XLALGPSCmp(&block->epoch, &t) || block->deltaT != orig->deltaT || strcmp(block->name, orig->name) || XLALUnitCompare(&block->sampleUnits, &orig->sampleUnits)
+		    || memcmp(block->data->data, orig->data->data + total, n * sizeof(*block->data->data))) {
+			fprintf(stderr, " FAIL\n");
+			exit(1); /* fail */
+		}
+		total += n;
+	}
+	if (status < 0 || total != SLICE_LENGTH) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	/* seek back and re-read the final partial block */
+	XLALH5TimeSeriesIterSeek(iter, SLICE_LENGTH - SLICE_LENGTH % BLOCK_LENGTH);
+	status = XLALH5TimeSeriesIterNextREAL8TimeSeries(&n, block, iter);
+	if (status < 0 || n != SLICE_LENGTH % BLOCK_LENGTH || memcmp(block->data->data, orig->data->data + SLICE_LENGTH - n, n * sizeof(*block->data->data))) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLALH5TimeSeriesIterClose(iter);
+	XLALH5FileClose(file);
+	XLALDestroyREAL8TimeSeries(block);
+	XLALDestroyREAL8TimeSeries(orig);
+	fprintf(stderr, " PASS\n");
+}
+
+static void test_MapData(void)
+{
+	REAL8Vector *orig;
+	UINT4Vector *dims;
+	UINT4Vector *chunks;
+	LALH5File *file;
+	LALH5Dataset *dset;
+	const REAL8 *data;
+	size_t i;
+	int retval;
+	int errnum;
+	fprintf(stderr, "Testing memory mapping of datasets...");
+	/* chunked datasets cannot be mapped */
+	dims = XLALCreateUINT4Vector(1);
+	chunks = XLALCreateUINT4Vector(1);
+	dims->data[0] = SLICE_LENGTH;
+	chunks->data[0] = BLOCK_LENGTH;
+	file = XLALH5FileOpen(FNAME, "w");
+	dset = XLALH5DatasetAllocChunked(file, DSET, LAL_D_TYPE_CODE, dims, chunks, 0);
+	if (XLALH5DatasetCheckMappable(dset)) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLALH5DatasetFree(dset);
+	XLALH5FileClose(file);
+	XLALDestroyUINT4Vector(chunks);
+	XLALDestroyUINT4Vector(dims);
+	/* contiguous datasets can be mapped */
+	orig = XLALCreateREAL8Vector(SLICE_LENGTH);
+	for (i = 0; i < SLICE_LENGTH; ++i)
+		orig->data[i] = generate_float_data();
+	file = XLALH5FileOpen(FNAME, "w");
+	XLALH5FileWriteREAL8Vector(file, DSET, orig);
+	XLALH5FileClose(file);
+	file = XLALH5FileOpen(FNAME, "r");
+	dset = XLALH5DatasetRead(file, DSET);
+	if (!XLALH5DatasetCheckMappable(dset)) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	data = XLALH5DatasetMapData(dset);
+	XLALH5DatasetFree(dset);
+	XLALH5FileClose(file);
+	/* the mapping is aligned and outlives the file */
+	if (data == NULL || (uintptr_t)data % sizeof(*data) != 0 || memcmp(data, orig->data, SLICE_LENGTH * sizeof(*data)) != 0) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	/* the mapping is released once, and only mapped data can be released */
+	if (XLALH5DatasetUnmapData(data) != 0) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLAL_TRY_SILENT(retval = XLALH5DatasetUnmapData(data), errnum);
+	if (retval == 0 || (errnum & ~XLAL_EFUNC) != XLAL_EINVAL) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLALDestroyREAL8Vector(orig);
+	fprintf(stderr, " PASS\n");
+}
+
 int main(void)
 {
 	XLALSetErrorHandler(XLALAbortErrorHandler);
@@ -334,6 +561,11 @@ int main(void)
 	test_COMPLEX8FrequencySeries();
 	test_COMPLEX16FrequencySeries();
 
+	test_REAL8VectorSlice();
+	test_ChunkedHyperslab();
+	test_REAL8TimeSeriesIter();
+	test_MapData();
+
 	LALCheckMemoryLeaks();
 	return 0;
 }
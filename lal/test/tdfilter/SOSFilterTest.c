@@ -0,0 +1,316 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/**
+ * \file
+ * \ingroup IIRFilter_h
+ * \brief Tests the second-order-section filters in \ref SOSFilter_c
+ *
+ * A filter with complex and real zeros and poles is applied as a cascade of
+ * second-order sections and as a single \c REAL8IIRFilter, and the outputs
+ * are compared.  Random data is filtered in blocks of random lengths, for a
+ * single channel and for several channels at once, and compared against the
+ * same data filtered in one block.  The zero-phase Butterworth filter is
+ * compared against XLALButterworthREAL8TimeSeries().  Passing
+ * <tt>--benchmark</tt> also compares the throughput of the two when filtering
+ * many channels.
+ */
+
+/** \cond DONT_DOXYGEN */
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/SeqFactories.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+#include <lal/IIRFilter.h>
+#include <lal/ZPGFilter.h>
+#include <lal/BandPassTimeSeries.h>
+#include <lal/LogPrintf.h>
+
+#define NCHANNELS 13
+#define LENGTH 20000
+
+static const LIGOTimeGPS epoch = LIGOTIMEGPSZERO;
+
+static void randomData(REAL8 *data, size_t length)
+{
+  for (size_t i = 0; i < length; ++i) {
+    data[i] = 2.0 * rand() / RAND_MAX - 1.0;
+  }
+}
+
+static REAL8 maxAbsDiff(const REAL8 *x, const REAL8 *y, size_t start, size_t end)
+{
+  REAL8 maxDiff = 0;
+  for (size_t i = start; i < end; ++i) {
+    maxDiff = fmax(maxDiff, fabs(x[i] - y[i]));
+  }
+  return maxDiff;
+}
+
+/* a filter with real and complex zeros and poles in the z-plane */
+static COMPLEX16ZPGFilter *testZPG(void)
+{
+  COMPLEX16ZPGFilter *zpg = XLALCreateCOMPLEX16ZPGFilter(5, 5);
+  XLAL_CHECK_NULL(zpg != NULL, XLAL_EFUNC);
+  zpg->zeros->data[0] = 0.9 * cexp(0.3 * I);
+  zpg->zeros->data[1] = 0.9 * cexp(-0.3 * I);
+  zpg->zeros->data[2] = -1.0;
+  zpg->zeros->data[3] = 0.5;
+  zpg->zeros->data[4] = -0.7;
+  zpg->poles->data[0] = 0.95 * cexp(0.2 * I);
+  zpg->poles->data[1] = 0.3;
+  zpg->poles->data[2] = 0.95 * cexp(-0.2 * I);
+  zpg->poles->data[3] = 0.8 * cexp(0.5 * I);
+  zpg->poles->data[4] = 0.8 * cexp(-0.5 * I);
+  zpg->gain = 0.02;
+  return zpg;
+}
+
+static int testCascade(void)
+{
+  COMPLEX16ZPGFilter *zpg = testZPG();
+  XLAL_CHECK(zpg != NULL, XLAL_EFUNC);
+  REAL8SOSFilter *sos = XLALCreateREAL8SOSFilterFromZPG(zpg, 1);
+  XLAL_CHECK(sos != NULL, XLAL_EFUNC);
+  XLAL_CHECK(sos->numSections == 3, XLAL_EFAILED, "Filter has %u sections, expected 3", sos->numSections);
+  REAL8IIRFilter *iir = XLALCreateREAL8IIRFilter(zpg);
+  XLAL_CHECK(iir != NULL, XLAL_EFUNC);
+
+  REAL8Vector *x = XLALCreateREAL8Vector(LENGTH);
+  REAL8Vector *y = XLALCreateREAL8Vector(LENGTH);
+  XLAL_CHECK(x != NULL && y != NULL, XLAL_EFUNC);
+  randomData(x->data, x->length);
+  memcpy(y->data, x->data, x->length * sizeof(REAL8));
+
+  XLAL_CHECK(XLALSOSFilterREAL8Vector(x, sos) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALIIRFilterREAL8Vector(y, iir) == XLAL_SUCCESS, XLAL_EFUNC);
+  const REAL8 err = maxAbsDiff(x->data, y->data, 0, LENGTH);
+  XLALPrintInfo("%s: maximum difference from REAL8IIRFilter %g\n", __func__, err);
+  XLAL_CHECK(err < 1e-10, XLAL_EFAILED, "Maximum difference from REAL8IIRFilter %g", err);
+
+  /* the impulse response of the cascade must also agree */
+  memset(x->data, 0, x->length * sizeof(REAL8));
+  memset(y->data, 0, y->length * sizeof(REAL8));
+  x->data[0] = y->data[0] = 1;
+  XLAL_CHECK(XLALResetREAL8SOSFilter(sos) == XLAL_SUCCESS, XLAL_EFUNC);
+  memset(iir->history->data, 0, iir->history->length * sizeof(REAL8));
+  XLAL_CHECK(XLALSOSFilterREAL8Vector(x, sos) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALIIRFilterREAL8Vector(y, iir) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(maxAbsDiff(x->data, y->data, 0, LENGTH) < 1e-12, XLAL_EFAILED);
+
+  XLALDestroyREAL8Vector(x);
+  XLALDestroyREAL8Vector(y);
+  XLALDestroyREAL8IIRFilter(iir);
+  XLALDestroyREAL8SOSFilter(sos);
+  XLALDestroyCOMPLEX16ZPGFilter(zpg);
+
+  return XLAL_SUCCESS;
+}
+
+static int testStreaming(void)
+{
+  COMPLEX16ZPGFilter *zpg = testZPG();
+  XLAL_CHECK(zpg != NULL, XLAL_EFUNC);
+  REAL8SOSFilter *single = XLALCreateREAL8SOSFilterFromZPG(zpg, 1);
+  REAL8SOSFilter *multi = XLALCreateREAL8SOSFilterFromZPG(zpg, NCHANNELS);
+  XLAL_CHECK(single != NULL && multi != NULL, XLAL_EFUNC);
+
+  /* filter each channel in one block */
+  REAL8VectorSequence *expected = XLALCreateREAL8VectorSequence(NCHANNELS, LENGTH);
+  REAL8VectorSequence *channels = XLALCreateREAL8VectorSequence(NCHANNELS, LENGTH);
+  XLAL_CHECK(expected != NULL && channels != NULL, XLAL_EFUNC);
+  randomData(expected->data, NCHANNELS * LENGTH);
+  memcpy(channels->data, expected->data, NCHANNELS * LENGTH * sizeof(REAL8));
+  for (UINT4 c = 0; c < NCHANNELS; ++c) {
+    REAL8Vector v = { LENGTH, expected->data + c * LENGTH };
+    XLAL_CHECK(XLALResetREAL8SOSFilter(single) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(XLALSOSFilterREAL8Vector(&v, single) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+
+  /* filter each channel on its own in blocks of random lengths, including empty blocks */
+  REAL8Vector *x = XLALCreateREAL8Vector(LENGTH);
+  XLAL_CHECK(x != NULL, XLAL_EFUNC);
+  for (UINT4 c = 0; c < NCHANNELS; ++c) {
+    memcpy(x->data, channels->data + c * LENGTH, LENGTH * sizeof(REAL8));
+    XLAL_CHECK(XLALResetREAL8SOSFilter(single) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 i = 0; i < LENGTH; ) {
+      UINT4 n = rand() % 3000;
+      if (n > LENGTH - i) {
+        n = LENGTH - i;
+      }
+      REAL8Vector v = { n, x->data + i };
+      XLAL_CHECK(XLALSOSFilterREAL8Vector(&v, single) == XLAL_SUCCESS, XLAL_EFUNC);
+      i += n;
+    }
+    const REAL8 err = maxAbsDiff(x->data, expected->data + c * LENGTH, 0, LENGTH);
+    XLAL_CHECK(err == 0, XLAL_EFAILED, "Channel %u: maximum difference from filtering in one block %g", c, err);
+  }
+
+  /* filter all channels together in blocks of random lengths */
+  REAL8VectorSequence *block = XLALCreateREAL8VectorSequence(NCHANNELS, 3000);
+  XLAL_CHECK(block != NULL, XLAL_EFUNC);
+  for (UINT4 i = 0; i < LENGTH; ) {
+    UINT4 n = rand() % 3000;
+    if (n > LENGTH - i) {
+      n = LENGTH - i;
+    }
+    block->vectorLength = n;
+    for (UINT4 c = 0; c < NCHANNELS; ++c) {
+      memcpy(block->data + c * n, channels->data + c * LENGTH + i, n * sizeof(REAL8));
+    }
+    XLAL_CHECK(XLALSOSFilterREAL8VectorSequence(block, multi) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 c = 0; c < NCHANNELS; ++c) {
+      memcpy(channels->data + c * LENGTH + i, block->data + c * n, n * sizeof(REAL8));
+    }
+    i += n;
+  }
+  block->vectorLength = 3000;
+  const REAL8 err = maxAbsDiff(channels->data, expected->data, 0, NCHANNELS * LENGTH);
+  XLALPrintInfo("%s: maximum difference of %u channels from single-channel filtering %g\n", __func__, NCHANNELS, err);
+  XLAL_CHECK(err < 1e-12, XLAL_EFAILED, "Maximum difference of %u channels from single-channel filtering %g", NCHANNELS, err);
+
+  /* the number of channels must match the filter */
+  {
+    int errnum;
+    XLAL_TRY_SILENT(XLALSOSFilterREAL8Vector(x, multi), errnum);
+    XLAL_CHECK(errnum == XLAL_EINVAL, XLAL_EFAILED);
+    XLAL_TRY_SILENT(XLALSOSFilterREAL8VectorSequence(block, single), errnum);
+    XLAL_CHECK(errnum == XLAL_EBADLEN, XLAL_EFAILED);
+  }
+
+  XLALDestroyREAL8Vector(x);
+  XLALDestroyREAL8VectorSequence(block);
+  XLALDestroyREAL8VectorSequence(channels);
+  XLALDestroyREAL8VectorSequence(expected);
+  XLALDestroyREAL8SOSFilter(single);
+  XLALDestroyREAL8SOSFilter(multi);
+  XLALDestroyCOMPLEX16ZPGFilter(zpg);
+
+  return XLAL_SUCCESS;
+}
+
+static int testZeroPhase(REAL8 f1, REAL8 a1, REAL8 f2, REAL8 a2, INT4 nMax)
+{
+  const REAL8 deltaT = 1.0 / 4096;
+  PassBandParamStruc params = { NULL, nMax, f1, f2, a1, a2 };
+
+  REAL8SOSFilter *sos = XLALCreateButterworthREAL8SOSFilter(&params, deltaT, NCHANNELS);
+  XLAL_CHECK(sos != NULL, XLAL_EFUNC);
+
+  REAL8TimeSeries *series = XLALCreateREAL8TimeSeries("data", &epoch, 0.0, deltaT, &lalDimensionlessUnit, LENGTH);
+  REAL8VectorSequence *channels = XLALCreateREAL8VectorSequence(NCHANNELS, LENGTH);
+  XLAL_CHECK(series != NULL && channels != NULL, XLAL_EFUNC);
+  srand(1234);
+  randomData(channels->data, NCHANNELS * LENGTH);
+  XLAL_CHECK(XLALSOSFilterZeroPhaseREAL8VectorSequence(channels, sos) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* compare each channel against XLALButterworthREAL8TimeSeries(), which
+     applies each section forwards and backwards in turn, away from the ends */
+  srand(1234);
+  REAL8 maxErr = 0;
+  for (UINT4 c = 0; c < NCHANNELS; ++c) {
+    randomData(series->data->data, LENGTH);
+    XLAL_CHECK(XLALButterworthREAL8TimeSeries(series, &params) == XLAL_SUCCESS, XLAL_EFUNC);
+    maxErr = fmax(maxErr, maxAbsDiff(series->data->data, channels->data + c * LENGTH, LENGTH / 4, 3 * LENGTH / 4));
+  }
+  XLALPrintInfo("%s: f1=%g a1=%g f2=%g a2=%g: %u sections, maximum difference from XLALButterworthREAL8TimeSeries() %g\n", __func__, f1, a1, f2, a2, sos->numSections, maxErr);
+  XLAL_CHECK(maxErr < 1e-9, XLAL_EFAILED, "f1=%g a1=%g f2=%g a2=%g: maximum difference from XLALButterworthREAL8TimeSeries() %g", f1, a1, f2, a2, maxErr);
+
+  /* the filter state must not be used */
+  for (UINT4 k = 0; k < sos->history->length; ++k) {
+    XLAL_CHECK(sos->history->data[k] == 0, XLAL_EFAILED);
+  }
+
+  XLALDestroyREAL8VectorSequence(channels);
+  XLALDestroyREAL8TimeSeries(series);
+  XLALDestroyREAL8SOSFilter(sos);
+
+  return XLAL_SUCCESS;
+}
+
+static int benchmark(void)
+{
+  const REAL8 deltaT = 1.0 / 16384;
+  const UINT4 nchannels = 32, length = 16384 * 4;
+  PassBandParamStruc params = { NULL, 8, 100.0, -1, 0.5, -1 };
+
+  REAL8SOSFilter *sos = XLALCreateButterworthREAL8SOSFilter(&params, deltaT, nchannels);
+  REAL8TimeSeries *series = XLALCreateREAL8TimeSeries("data", &epoch, 0.0, deltaT, &lalDimensionlessUnit, length);
+  REAL8VectorSequence *channels = XLALCreateREAL8VectorSequence(nchannels, length);
+  XLAL_CHECK(sos != NULL && series != NULL && channels != NULL, XLAL_EFUNC);
+  randomData(channels->data, nchannels * length);
+  randomData(series->data->data, length);
+
+  REAL8 t0 = XLALGetCPUTime();
+  for (UINT4 c = 0; c < nchannels; ++c) {
+    XLAL_CHECK(XLALButterworthREAL8TimeSeries(series, &params) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+  const REAL8 tButterworth = XLALGetCPUTime() - t0;
+
+  t0 = XLALGetCPUTime();
+  XLAL_CHECK(XLALSOSFilterZeroPhaseREAL8VectorSequence(channels, sos) == XLAL_SUCCESS, XLAL_EFUNC);
+  const REAL8 tSOS = XLALGetCPUTime() - t0;
+
+  const REAL8 nsamples = 1e-6 * nchannels * length;
+  printf("SOSFilterTest: %u channels, %u samples, %u sections: Butterworth %g sec (%g Msamples/sec), SOS %g sec (%g Msamples/sec)\n",
+         nchannels, length, sos->numSections, tButterworth, nsamples / tButterworth, tSOS, nsamples / tSOS);
+
+  XLALDestroyREAL8VectorSequence(channels);
+  XLALDestroyREAL8TimeSeries(series);
+  XLALDestroyREAL8SOSFilter(sos);
+
+  return XLAL_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+
+  XLAL_CHECK_MAIN(testCascade() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testStreaming() == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* low-pass filters of even and odd order */
+  XLAL_CHECK_MAIN(testZeroPhase(200.0, 0.9, 400.0, 0.1, 0) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testZeroPhase(300.0, 0.5, -1, -1, 5) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* high-pass filters of even and odd order */
+  XLAL_CHECK_MAIN(testZeroPhase(-1, -1, 100.0, 0.5, 8) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testZeroPhase(50.0, 0.1, 80.0, 0.9, 0) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* the throughput comparison is slow, so it is opt-in */
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--benchmark") == 0) {
+      XLAL_CHECK_MAIN(benchmark() == XLAL_SUCCESS, XLAL_EFUNC);
+    }
+  }
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+/** \endcond */
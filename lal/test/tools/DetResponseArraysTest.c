@@ -0,0 +1,97 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/**
+ * \file
+ * \ingroup DetResponse_h
+ * \brief Tests XLALComputeDetAMResponseArrays() against the scalar routines.
+ *
+ * F+, Fx and the time delay from the geocentre are computed for several
+ * detectors over a grid of sky positions, polarization angles and sidereal
+ * times, and compared with XLALComputeDetAMResponse() and
+ * XLALTimeDelayFromEarthCenter().
+ */
+
+/** \cond DONT_DOXYGEN */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDetectors.h>
+#include <lal/Date.h>
+#include <lal/TimeDelay.h>
+#include <lal/DetResponse.h>
+
+/* not a multiple of the internal block length */
+#define NUM_SKY 1000
+
+int main(void)
+{
+  const LALDetector *detectors[] = {
+    &lalCachedDetectors[LAL_LHO_4K_DETECTOR],
+    &lalCachedDetectors[LAL_LLO_4K_DETECTOR],
+    &lalCachedDetectors[LAL_VIRGO_DETECTOR],
+    &lalCachedDetectors[LAL_KAGRA_DETECTOR],
+  };
+  const UINT4 numDetectors = XLAL_NUM_ELEM(detectors);
+  const LIGOTimeGPS gps = { 1000000000, 123456789 };
+  const REAL8 gmst0 = XLALGreenwichMeanSiderealTime(&gps);
+  XLAL_CHECK_MAIN(!XLAL_IS_REAL8_FAIL_NAN(gmst0), XLAL_EFUNC);
+
+  static REAL8 ra[NUM_SKY], dec[NUM_SKY], psi[NUM_SKY], gmst[NUM_SKY];
+  static REAL8 fplus[4 * NUM_SKY], fcross[4 * NUM_SKY], delay[4 * NUM_SKY], delay2[4 * NUM_SKY];
+  for (UINT4 i = 0; i < NUM_SKY; ++i) {
+    ra[i] = LAL_TWOPI * fmod(0.618034 * i, 1.0);
+    dec[i] = asin(-1 + 2 * (i + 0.5) / NUM_SKY);
+    psi[i] = LAL_PI * fmod(0.414214 * i, 1.0);
+    gmst[i] = (i % 2) ? gmst0 : gmst0 + 0.1;
+  }
+
+  XLAL_CHECK_MAIN(XLALComputeDetAMResponseArrays(fplus, fcross, delay, detectors, numDetectors, ra, dec, psi, gmst, NUM_SKY) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* delays alone do not need the polarization angles */
+  XLAL_CHECK_MAIN(XLALComputeDetAMResponseArrays(NULL, NULL, delay2, detectors, numDetectors, ra, dec, NULL, gmst, NUM_SKY) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  for (UINT4 d = 0; d < numDetectors; ++d) {
+    for (UINT4 i = 0; i < NUM_SKY; ++i) {
+      const UINT4 k = d * NUM_SKY + i;
+      double fp, fc;
+      XLALComputeDetAMResponse(&fp, &fc, detectors[d]->response, ra[i], dec[i], psi[i], gmst[i]);
+      XLAL_CHECK_MAIN(fabs(fplus[k] - fp) < 1e-12, XLAL_EFAILED, "%s: F+ at sky position %u is %.15g, expected %.15g", detectors[d]->frDetector.name, i, fplus[k], fp);
+      XLAL_CHECK_MAIN(fabs(fcross[k] - fc) < 1e-12, XLAL_EFAILED, "%s: Fx at sky position %u is %.15g, expected %.15g", detectors[d]->frDetector.name, i, fcross[k], fc);
+
+      XLAL_CHECK_MAIN(delay2[k] == delay[k], XLAL_EFAILED, "%s: delay at sky position %u differs without F+ and Fx", detectors[d]->frDetector.name, i);
+
+      /* the scalar routine computes the sidereal time of gps itself */
+      if (gmst[i] == gmst0) {
+        const double dt = XLALTimeDelayFromEarthCenter(detectors[d]->location, ra[i], dec[i], &gps);
+        XLAL_CHECK_MAIN(fabs(delay[k] - dt) < 1e-15, XLAL_EFAILED, "%s: delay at sky position %u is %.15g, expected %.15g", detectors[d]->frDetector.name, i, delay[k], dt);
+      }
+    }
+  }
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+/** \endcond */
@@ -0,0 +1,179 @@
+/*
+ *  Copyright (C) 2021 Yiqi Xie
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ * \brief Tests the routines in LALDict.h; with <tt>--benchmark</tt>, also measures the performance of dictionary lookups.
+ */
+
+/** \cond DONT_DOXYGEN */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALDict.h>
+#include <lal/LogPrintf.h>
+#include <tools/LALDict_private.h>
+
+#define NKEYS 1000
+
+/* typical number of parameters in a waveform dictionary */
+#define NPERF 40
+
+/* measure lookup performance on a dictionary of typical size */
+static int benchmark(char keys[][LAL_KEYNAME_MAX + 1])
+{
+  LALDict *dict = XLALCreateDict();
+  XLAL_CHECK(dict != NULL, XLAL_EFUNC);
+  const LALDictKey *handles[NPERF];
+  for (int i = 0; i < NPERF; ++i) {
+    XLAL_CHECK(XLALDictInsertREAL8Value(dict, keys[i], i) == XLAL_SUCCESS, XLAL_EFUNC);
+    handles[i] = XLALDictKeyHandle(keys[i]);
+  }
+  const int nlookup = 1 << 22;
+  REAL8 sum = 0;
+  {
+    const REAL8 t0 = XLALGetCPUTime();
+    for (int l = 0; l < nlookup; ++l) {
+      sum += XLALDictLookupREAL8Value(dict, keys[l % NPERF]);
+    }
+    const REAL8 t = XLALGetCPUTime() - t0;
+    printf("LALDictPerf: lookups by key name:\t%g sec (%.3g lookups/sec)\n", t, nlookup / t);
+  }
+  {
+    const REAL8 t0 = XLALGetCPUTime();
+    for (int l = 0; l < nlookup; ++l) {
+      sum += XLALValueGetREAL8(XLALDictEntryGetValue(XLALDictLookupHandle(dict, handles[l % NPERF])));
+    }
+    const REAL8 t = XLALGetCPUTime() - t0;
+    printf("LALDictPerf: lookups by key handle:\t%g sec (%.3g lookups/sec)\n", t, nlookup / t);
+  }
+  XLAL_CHECK(sum == 2.0 * (nlookup / NPERF) * (NPERF * (NPERF - 1) / 2) + 2.0 * ((nlookup % NPERF) * ((nlookup % NPERF) - 1) / 2), XLAL_EFAILED);
+  XLALDestroyDict(dict);
+
+  return XLAL_SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+
+  setvbuf(stdout, NULL, _IONBF, 0);
+
+  char keys[NKEYS][LAL_KEYNAME_MAX + 1];
+  for (int i = 0; i < NKEYS; ++i) {
+    snprintf(keys[i], sizeof(keys[i]), "key%d", i);
+  }
+
+  /* test insertion, including growth of the table and long values */
+  LALDict *dict = XLALCreateDict();
+  XLAL_CHECK_MAIN(dict != NULL, XLAL_EFUNC);
+  for (int i = 0; i < NKEYS; ++i) {
+    if (i % 3 == 0) {
+      XLAL_CHECK_MAIN(XLALDictInsertStringValue(dict, keys[i], i % 2 ? "a value string too long to be stored inline" : "short") == XLAL_SUCCESS, XLAL_EFUNC);
+    } else {
+      XLAL_CHECK_MAIN(XLALDictInsertREAL8Value(dict, keys[i], i) == XLAL_SUCCESS, XLAL_EFUNC);
+    }
+  }
+  XLAL_CHECK_MAIN(XLALDictSize(dict) == NKEYS, XLAL_EFAILED);
+
+  /* test replacing values with values of different sizes */
+  for (int i = 0; i < NKEYS; i += 6) {
+    XLAL_CHECK_MAIN(XLALDictInsertStringValue(dict, keys[i], "a replacement string also too long to be stored inline") == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALDictInsertINT4Value(dict, keys[i + 3], -i) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+  XLAL_CHECK_MAIN(XLALDictSize(dict) == NKEYS, XLAL_EFAILED);
+
+  /* test lookups by name and by handle */
+  for (int i = 0; i < NKEYS; ++i) {
+    const LALDictKey *key = XLALDictKeyHandle(keys[i]);
+    XLAL_CHECK_MAIN(key != NULL, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(key == XLALDictKeyHandle(keys[i]), XLAL_EFAILED, "Key `%s' was not interned", keys[i]);
+    XLAL_CHECK_MAIN(strcmp(XLALDictKeyGetName(key), keys[i]) == 0, XLAL_EFAILED);
+    LALDictEntry *entry = XLALDictLookupHandle(dict, key);
+    XLAL_CHECK_MAIN(entry != NULL && entry == XLALDictLookup(dict, keys[i]), XLAL_EFAILED, "Key `%s' not found", keys[i]);
+    XLAL_CHECK_MAIN(strcmp(XLALDictEntryGetKey(entry), keys[i]) == 0, XLAL_EFAILED);
+    const LALValue *value = XLALDictEntryGetValue(entry);
+    if (i % 6 == 0) {
+      XLAL_CHECK_MAIN(strcmp(XLALValueGetString(value), "a replacement string also too long to be stored inline") == 0, XLAL_EFAILED);
+    } else if (i % 6 == 3) {
+      XLAL_CHECK_MAIN(XLALValueGetINT4(value) == 3 - i, XLAL_EFAILED);
+    } else {
+      XLAL_CHECK_MAIN(XLALDictLookupREAL8Value(dict, keys[i]) == i, XLAL_EFAILED);
+    }
+  }
+  XLAL_CHECK_MAIN(!XLALDictContains(dict, "nokey"), XLAL_EFAILED);
+  XLAL_CHECK_MAIN(!XLALDictContainsHandle(dict, XLALDictKeyHandle("nokey")), XLAL_EFAILED);
+  XLAL_CHECK_MAIN(XLALDictKeyHandle("a key name which is longer than LAL_KEYNAME_MAX") == NULL, XLAL_EFAILED);
+  XLALClearErrno();
+
+  /* test that entries and keys without a name return NULL */
+  {
+    LALDictEntry *entry = XLALDictEntryAlloc(sizeof(REAL8));
+    XLAL_CHECK_MAIN(entry != NULL, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALDictEntryGetKey(entry) == NULL, XLAL_EFAILED);
+    XLALDictEntryFree(entry);
+    XLAL_CHECK_MAIN(XLALDictKeyGetName(NULL) == NULL, XLAL_EFAILED);
+  }
+
+  /* test removal; remaining keys must still be found */
+  for (int i = 0; i < NKEYS; i += 2) {
+    XLAL_CHECK_MAIN(XLALDictRemove(dict, keys[i]) == 0, XLAL_EFAILED);
+  }
+  XLAL_CHECK_MAIN(XLALDictRemove(dict, keys[0]) == -1, XLAL_EFAILED);
+  XLAL_CHECK_MAIN(XLALDictSize(dict) == NKEYS / 2, XLAL_EFAILED);
+  for (int i = 0; i < NKEYS; ++i) {
+    XLAL_CHECK_MAIN(XLALDictContains(dict, keys[i]) == (i % 2), XLAL_EFAILED, "Key `%s' %s after removal", keys[i], i % 2 ? "lost" : "found");
+  }
+
+  /* test iteration and duplication */
+  {
+    LALDictIter iter;
+    LALDictEntry *entry;
+    size_t n = 0;
+    XLALDictIterInit(&iter, dict);
+    while ((entry = XLALDictIterNext(&iter)) != NULL) {
+      ++n;
+    }
+    XLAL_CHECK_MAIN(n == NKEYS / 2, XLAL_EFAILED);
+    LALDict *copy = XLALDictDuplicate(dict);
+    XLAL_CHECK_MAIN(copy != NULL, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALDictSize(copy) == NKEYS / 2, XLAL_EFAILED);
+    for (int i = 1; i < NKEYS; i += 2) {
+      XLAL_CHECK_MAIN(XLALValueEqual(XLALDictEntryGetValue(XLALDictLookup(copy, keys[i])), XLALDictEntryGetValue(XLALDictLookup(dict, keys[i]))), XLAL_EFAILED);
+    }
+    XLALDestroyDict(copy);
+  }
+  XLALDestroyDict(dict);
+
+  if (argc > 1 && strcmp(argv[1], "--benchmark") == 0) {
+    XLAL_CHECK_MAIN(benchmark(keys) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+
+  /* test that keys can be interned again after the key table is cleared */
+  XLALClearDictKeyTable();
+  XLAL_CHECK_MAIN(strcmp(XLALDictKeyGetName(XLALDictKeyHandle(keys[0])), keys[0]) == 0, XLAL_EFAILED);
+  XLALClearDictKeyTable();
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+/** \endcond */
@@ -0,0 +1,251 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/**
+ * \file
+ * \ingroup ResampleTimeSeries_h
+ * \brief Tests the polyphase FIR resampler in \ref ResampleTimeSeries.h
+ *
+ * Sine waves are resampled by rational factors with XLALResampleREAL8TimeSeries()
+ * and compared against the exact resampled sine wave, and random data is
+ * resampled in blocks of random lengths with XLALREAL8PolyphaseResamplerApply()
+ * and compared against the same data resampled in one block; empty time
+ * series and empty blocks are also resampled. When run with
+ * the <tt>--benchmark</tt> option, the throughput of the polyphase resampler
+ * is also compared to that of the Butterworth low pass filter used for
+ * downsampling by a power of two; this takes several seconds and so is not
+ * done by default.
+ */
+
+/** \cond DONT_DOXYGEN */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Date.h>
+#include <lal/Sequence.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+#include <lal/ResampleTimeSeries.h>
+
+static const LIGOTimeGPS epoch = LIGOTIMEGPSZERO;
+
+static REAL8TimeSeries *sineSeries(REAL8 deltaT, UINT4 length, REAL8 freq, REAL8 phase)
+{
+  REAL8TimeSeries *series = XLALCreateREAL8TimeSeries("sine", &epoch, 0.0, deltaT, &lalDimensionlessUnit, length);
+  XLAL_CHECK_NULL(series != NULL, XLAL_EFUNC);
+  for (UINT4 i = 0; i < length; ++i) {
+    series->data->data[i] = sin(LAL_TWOPI * freq * i * deltaT + phase);
+  }
+  return series;
+}
+
+static int testSine(REAL8 inRate, REAL8 outRate, REAL8 freq)
+{
+  const REAL8 duration = 8;
+  const REAL8 phase = 0.3;
+  REAL8TimeSeries *series = sineSeries(1.0 / inRate, duration * inRate, freq, phase);
+  XLAL_CHECK(series != NULL, XLAL_EFUNC);
+
+  XLAL_CHECK(XLALResampleREAL8TimeSeries(series, 1.0 / outRate) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(series->deltaT == 1.0 / outRate, XLAL_EFAILED);
+  const UINT4 length = ceil(duration * outRate);
+  XLAL_CHECK(series->data->length == length, XLAL_EFAILED, "%g Hz -> %g Hz: resampled length is %u, expected %u", inRate, outRate, series->data->length, length);
+
+  /* compare against the exact sine wave, away from the corrupted ends */
+  REAL8 maxErr = 0;
+  for (UINT4 j = outRate / 4; j < length - outRate / 4; ++j) {
+    const REAL8 exact = sin(LAL_TWOPI * freq * j / outRate + phase);
+    maxErr = fmax(maxErr, fabs(series->data->data[j] - exact));
+  }
+  XLALPrintInfo("%s: %g Hz -> %g Hz, %g Hz sine: maximum error %g\n", __func__, inRate, outRate, freq, maxErr);
+  XLAL_CHECK(maxErr < 1e-4, XLAL_EFAILED, "%g Hz -> %g Hz, %g Hz sine: maximum error %g", inRate, outRate, freq, maxErr);
+
+  XLALDestroyREAL8TimeSeries(series);
+
+  return XLAL_SUCCESS;
+}
+
+static int testStreaming(UINT4 up, UINT4 down)
+{
+  const UINT4 length = 100000;
+  REAL8Sequence *input = XLALCreateREAL8Sequence(length);
+  XLAL_CHECK(input != NULL, XLAL_EFUNC);
+  for (UINT4 i = 0; i < length; ++i) {
+    input->data[i] = 2.0 * rand() / RAND_MAX - 1.0;
+  }
+
+  /* resample all of the data at once */
+  LALREAL8PolyphaseResampler *resampler = XLALREAL8PolyphaseResamplerCreate(up, down, 16);
+  XLAL_CHECK(resampler != NULL, XLAL_EFUNC);
+  REAL8Sequence *output = XLALCreateREAL8Sequence(XLALREAL8PolyphaseResamplerOutputLength(resampler, length));
+  XLAL_CHECK(output != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALREAL8PolyphaseResamplerApply(resampler, output, input) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* resample the same data in blocks of random lengths, including empty blocks */
+  XLAL_CHECK(XLALREAL8PolyphaseResamplerReset(resampler) == XLAL_SUCCESS, XLAL_EFUNC);
+  UINT4 i = 0, j = 0;
+  while (i < length) {
+    UINT4 blocklen = rand() % 2000;
+    if (blocklen > length - i) {
+      blocklen = length - i;
+    }
+    REAL8Sequence block = { .length = blocklen, .data = input->data + i };
+    REAL8Sequence *blockout = XLALCreateREAL8Sequence(XLALREAL8PolyphaseResamplerOutputLength(resampler, blocklen));
+    XLAL_CHECK(blockout != NULL, XLAL_EFUNC);
+    XLAL_CHECK(XLALREAL8PolyphaseResamplerApply(resampler, blockout, &block) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(j + blockout->length <= output->length, XLAL_EFAILED, "%u/%u: too many output samples", up, down);
+    for (UINT4 k = 0; k < blockout->length; ++k, ++j) {
+      XLAL_CHECK(blockout->data[k] == output->data[j], XLAL_EFAILED, "%u/%u: output sample %u is %.15g, expected %.15g", up, down, j, blockout->data[k], output->data[j]);
+    }
+    XLALDestroyREAL8Sequence(blockout);
+    i += blocklen;
+  }
+  XLAL_CHECK(j == output->length, XLAL_EFAILED, "%u/%u: %u output samples, expected %u", up, down, j, output->length);
+
+  /* a mismatched output length is an error */
+  {
+    REAL8Sequence *badout = XLALCreateREAL8Sequence(XLALREAL8PolyphaseResamplerOutputLength(resampler, 100) + 1);
+    XLAL_CHECK(badout != NULL, XLAL_EFUNC);
+    REAL8Sequence block = { .length = 100, .data = input->data };
+    int errnum;
+    XLAL_TRY_SILENT(XLALREAL8PolyphaseResamplerApply(resampler, badout, &block), errnum);
+    XLAL_CHECK(errnum == XLAL_EBADLEN, XLAL_EFAILED);
+    XLALDestroyREAL8Sequence(badout);
+  }
+
+  XLALDestroyREAL8Sequence(input);
+  XLALDestroyREAL8Sequence(output);
+  XLALREAL8PolyphaseResamplerDestroy(resampler);
+
+  return XLAL_SUCCESS;
+}
+
+static int testZeroLength(UINT4 up, UINT4 down)
+{
+  const UINT4 length = 1000;
+
+  /* resampling an empty time series gives an empty time series */
+  REAL8TimeSeries *series = sineSeries(1.0 / (16384.0 * up), 0, 100.0, 0.0);
+  XLAL_CHECK(series != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALResampleREAL8TimeSeries(series, series->deltaT * down / up) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(series->data->length == 0, XLAL_EFAILED, "%u/%u: resampled length is %u, expected 0", up, down, series->data->length);
+  XLALDestroyREAL8TimeSeries(series);
+
+  /* an empty block gives no output, and does not change the state of the resampler */
+  REAL8Sequence *input = XLALCreateREAL8Sequence(length);
+  XLAL_CHECK(input != NULL, XLAL_EFUNC);
+  for (UINT4 i = 0; i < length; ++i) {
+    input->data[i] = 2.0 * rand() / RAND_MAX - 1.0;
+  }
+  LALREAL8PolyphaseResampler *resampler = XLALREAL8PolyphaseResamplerCreate(up, down, 16);
+  XLAL_CHECK(resampler != NULL, XLAL_EFUNC);
+  REAL8Sequence *output = XLALCreateREAL8Sequence(XLALREAL8PolyphaseResamplerOutputLength(resampler, length));
+  XLAL_CHECK(output != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALREAL8PolyphaseResamplerApply(resampler, output, input) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALREAL8PolyphaseResamplerReset(resampler) == XLAL_SUCCESS, XLAL_EFUNC);
+  REAL8Sequence empty = { .length = 0, .data = NULL };
+  XLAL_CHECK(XLALREAL8PolyphaseResamplerOutputLength(resampler, 0) == 0, XLAL_EFAILED, "%u/%u: empty block gives output", up, down);
+  XLAL_CHECK(XLALREAL8PolyphaseResamplerApply(resampler, &empty, &empty) == XLAL_SUCCESS, XLAL_EFUNC);
+  REAL8Sequence *output2 = XLALCreateREAL8Sequence(XLALREAL8PolyphaseResamplerOutputLength(resampler, length));
+  XLAL_CHECK(output2 != NULL, XLAL_EFUNC);
+  XLAL_CHECK(output2->length == output->length, XLAL_EFAILED, "%u/%u: %u output samples after empty block, expected %u", up, down, output2->length, output->length);
+  XLAL_CHECK(XLALREAL8PolyphaseResamplerApply(resampler, output2, input) == XLAL_SUCCESS, XLAL_EFUNC);
+  for (UINT4 j = 0; j < output->length; ++j) {
+    XLAL_CHECK(output2->data[j] == output->data[j], XLAL_EFAILED, "%u/%u: output sample %u after empty block is %.15g, expected %.15g", up, down, j, output2->data[j], output->data[j]);
+  }
+
+  XLALDestroyREAL8Sequence(input);
+  XLALDestroyREAL8Sequence(output);
+  XLALDestroyREAL8Sequence(output2);
+  XLALREAL8PolyphaseResamplerDestroy(resampler);
+
+  return XLAL_SUCCESS;
+}
+
+static int benchmark(void)
+{
+  const REAL8 inRate = 16384, outRate = 4096;
+  const UINT4 length = 64 * inRate;
+
+  /* the current path: Butterworth low pass filter applied forwards and backwards, then decimation */
+  REAL8TimeSeries *series = sineSeries(1.0 / inRate, length, 100.0, 0.0);
+  XLAL_CHECK(series != NULL, XLAL_EFUNC);
+  clock_t t0 = clock();
+  XLAL_CHECK(XLALResampleREAL8TimeSeries(series, 1.0 / outRate) == XLAL_SUCCESS, XLAL_EFUNC);
+  const REAL8 tButterworth = (REAL8)(clock() - t0) / CLOCKS_PER_SEC;
+  XLALDestroyREAL8TimeSeries(series);
+
+  /* the polyphase resampler */
+  series = sineSeries(1.0 / inRate, length, 100.0, 0.0);
+  XLAL_CHECK(series != NULL, XLAL_EFUNC);
+  LALREAL8PolyphaseResampler *resampler = XLALREAL8PolyphaseResamplerCreate(1, 4, 32);
+  XLAL_CHECK(resampler != NULL, XLAL_EFUNC);
+  REAL8Sequence *output = XLALCreateREAL8Sequence(XLALREAL8PolyphaseResamplerOutputLength(resampler, length));
+  XLAL_CHECK(output != NULL, XLAL_EFUNC);
+  t0 = clock();
+  XLAL_CHECK(XLALREAL8PolyphaseResamplerApply(resampler, output, series->data) == XLAL_SUCCESS, XLAL_EFUNC);
+  const REAL8 tPolyphase = (REAL8)(clock() - t0) / CLOCKS_PER_SEC;
+  XLALDestroyREAL8Sequence(output);
+  XLALREAL8PolyphaseResamplerDestroy(resampler);
+  XLALDestroyREAL8TimeSeries(series);
+
+  printf("PolyphaseResamplerTest: %g Hz -> %g Hz, %g sec of data: Butterworth %g sec (%g Msamples/sec), polyphase %g sec (%g Msamples/sec)\n",
+         inRate, outRate, length / inRate, tButterworth, length / tButterworth / 1e6, tPolyphase, length / tPolyphase / 1e6);
+
+  return XLAL_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+
+  /* rational downsampling, integer downsampling by a factor which is not a power of two, and upsampling */
+  XLAL_CHECK_MAIN(testSine(16384, 3000, 100.3) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testSine(16384, 3000, 1100.4) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testSine(16384, 16384.0 / 3, 1000.7) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testSine(4096, 16384, 1500.2) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testSine(3000, 4096, 1100.1) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* streaming */
+  XLAL_CHECK_MAIN(testStreaming(1, 4) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testStreaming(375, 2048) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testStreaming(4, 1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testStreaming(3, 2) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* empty input */
+  XLAL_CHECK_MAIN(testZeroLength(375, 2048) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testZeroLength(4, 1) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* benchmark only on request, to keep 'make check' fast */
+  if (argc > 1 && strcmp(argv[1], "--benchmark") == 0) {
+    XLAL_CHECK_MAIN(benchmark() == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+/** \endcond */
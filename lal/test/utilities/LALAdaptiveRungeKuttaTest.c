@@ -0,0 +1,270 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/**
+ * \file
+ * \ingroup LALAdaptiveRungeKuttaIntegrator_h
+ * \brief Tests the batched and dense-output adaptive Runge-Kutta integrators against the scalar integrator.
+ *
+ * A set of damped harmonic oscillators with different frequencies is evolved
+ * with XLALAdaptiveRungeKutta4HermiteBatch() and XLALAdaptiveRungeKutta4Dense(),
+ * and each one is compared against the same oscillator evolved with
+ * XLALAdaptiveRungeKutta4Hermite() and with the analytic solution.  Half of
+ * the oscillators are terminated by the stopping test when they first cross
+ * zero.  A system whose derivative jumps is checked to terminate with an
+ * error once its step size can no longer be reduced.
+ */
+
+/** \cond DONT_DOXYGEN */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALAdaptiveRungeKuttaIntegrator.h>
+#include <lal/LogPrintf.h>
+
+#define NLANES 13
+#define DAMPING 0.05
+
+/* returned by the stopping tests */
+#define TEST_STOP 1234
+
+typedef struct {
+  REAL8 omega;
+  int stopatzero;
+} oscillator;
+
+static int dydt(double t, const double y[], double dydt_out[], void *params)
+{
+  const oscillator *osc = params;
+  (void)t;
+  dydt_out[0] = y[1];
+  dydt_out[1] = -osc->omega * osc->omega * y[0] - 2 * DAMPING * osc->omega * y[1];
+  return GSL_SUCCESS;
+}
+
+static int stop(double t, const double y[], double dydt_in[], void *params)
+{
+  const oscillator *osc = params;
+  (void)t;
+  (void)dydt_in;
+  return (osc->stopatzero && y[0] < 0) ? TEST_STOP : GSL_SUCCESS;
+}
+
+static int dydtBatch(size_t nlanes, const double t[], const double y[], double dydt_out[], const int active[], int status[], void *params)
+{
+  const oscillator *osc = params;
+  (void)t;
+  for (size_t l = 0; l < nlanes; ++l) {
+    if (active[l]) {
+      dydt_out[l] = y[nlanes + l];
+      dydt_out[nlanes + l] = -osc[l].omega * osc[l].omega * y[l] - 2 * DAMPING * osc[l].omega * y[nlanes + l];
+      status[l] = GSL_SUCCESS;
+    }
+  }
+  return 0;
+}
+
+static int stopBatch(size_t nlanes, const double t[], const double y[], const double dydt_in[], const int active[], int status[], void *params)
+{
+  const oscillator *osc = params;
+  (void)t;
+  (void)dydt_in;
+  for (size_t l = 0; l < nlanes; ++l) {
+    if (active[l]) {
+      status[l] = (osc[l].stopatzero && y[l] < 0) ? TEST_STOP : GSL_SUCCESS;
+    }
+  }
+  return 0;
+}
+
+/* a derivative with a jump that no step size can resolve */
+static int dydtBatchJump(size_t nlanes, const double t[], const double y[], double dydt_out[], const int active[], int status[], void *params)
+{
+  (void)y;
+  (void)params;
+  for (size_t l = 0; l < nlanes; ++l) {
+    if (active[l]) {
+      dydt_out[l] = (t[l] < 0.5) ? 0.0 : 1e30;
+      status[l] = GSL_SUCCESS;
+    }
+  }
+  return 0;
+}
+
+static const REAL8 tinit = 0, tend = 10, deltat = 1.0 / 64;
+static const REAL8 eps = 1e-10;
+
+static REAL8 exactSolution(const oscillator *osc, REAL8 t)
+{
+  const REAL8 omegad = osc->omega * sqrt(1 - DAMPING * DAMPING);
+  return exp(-DAMPING * osc->omega * t) * (cos(omegad * t) + DAMPING * osc->omega / omegad * sin(omegad * t));
+}
+
+static int testBatch(void)
+{
+  oscillator osc[NLANES];
+  REAL8 yinit[2 * NLANES];
+  for (size_t l = 0; l < NLANES; ++l) {
+    osc[l].omega = 1.0 + 0.37 * l;
+    osc[l].stopatzero = l % 2;
+    yinit[l] = 1.0;
+    yinit[NLANES + l] = 0.0;
+  }
+
+  /* evolve all oscillators in lock-step */
+  LALAdaptiveRungeKuttaBatchIntegrator *batch = XLALAdaptiveRungeKutta4BatchInit(2, NLANES, dydtBatch, stopBatch, eps, eps);
+  XLAL_CHECK(batch != NULL, XLAL_EFUNC);
+  REAL8Array *youtBatch[NLANES];
+  XLAL_CHECK(XLALAdaptiveRungeKutta4HermiteBatch(batch, osc, yinit, tinit, tend, deltat, youtBatch) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* evolve each oscillator individually, and compare */
+  LALAdaptiveRungeKuttaIntegrator *integrator = XLALAdaptiveRungeKutta4Init(2, dydt, stop, eps, eps);
+  XLAL_CHECK(integrator != NULL, XLAL_EFUNC);
+  for (size_t l = 0; l < NLANES; ++l) {
+    REAL8 y[2] = {1.0, 0.0};
+    REAL8Array *yout = NULL;
+    const int len = XLALAdaptiveRungeKutta4Hermite(integrator, &osc[l], y, tinit, tend, deltat, &yout);
+    XLAL_CHECK(len > 0, XLAL_EFUNC);
+
+    const int lenBatch = youtBatch[l]->dimLength->data[1];
+    XLAL_CHECK(lenBatch == len, XLAL_EFAILED, "Oscillator %zu: batch output has length %i, expected %i", l, lenBatch, len);
+    XLAL_CHECK(batch->returncode[l] == integrator->returncode, XLAL_EFAILED, "Oscillator %zu: batch return code %i, expected %i", l, batch->returncode[l], integrator->returncode);
+    XLAL_CHECK(batch->returncode[l] == (osc[l].stopatzero ? TEST_STOP : 0), XLAL_EFAILED, "Oscillator %zu: unexpected return code %i", l, batch->returncode[l]);
+
+    for (int j = 0; j < len; ++j) {
+      const REAL8 t = yout->data[j];
+      XLAL_CHECK(youtBatch[l]->data[j] == t, XLAL_EFAILED, "Oscillator %zu: sample %i at time %g, expected %g", l, j, youtBatch[l]->data[j], t);
+      for (int i = 1; i <= 2; ++i) {
+        const REAL8 yb = youtBatch[l]->data[i * len + j];
+        const REAL8 ys = yout->data[i * len + j];
+        XLAL_CHECK(fabs(yb - ys) <= 1e-12 * (1 + fabs(ys)), XLAL_EFAILED, "Oscillator %zu: sample %i of variable %i is %.15g, expected %.15g", l, j, i, yb, ys);
+      }
+      const REAL8 yexact = exactSolution(&osc[l], t);
+      XLAL_CHECK(fabs(youtBatch[l]->data[len + j] - yexact) <= 1e-6, XLAL_EFAILED, "Oscillator %zu: sample %i is %.15g, exact solution is %.15g", l, j, youtBatch[l]->data[len + j], yexact);
+    }
+
+    XLAL_CHECK(yinit[l] == y[0] && yinit[NLANES + l] == y[1], XLAL_EFAILED, "Oscillator %zu: final values differ", l);
+
+    XLALDestroyREAL8Array(yout);
+    XLALDestroyREAL8Array(youtBatch[l]);
+  }
+
+  XLALAdaptiveRungeKuttaFree(integrator);
+  XLALAdaptiveRungeKuttaBatchFree(batch);
+
+  return XLAL_SUCCESS;
+}
+
+static int testBatchJump(void)
+{
+  REAL8 yinit[1] = {0.0};
+  REAL8Array *yout[1];
+
+  /* the step size underflows at the jump, which must terminate the system */
+  LALAdaptiveRungeKuttaBatchIntegrator *batch = XLALAdaptiveRungeKutta4BatchInit(1, 1, dydtBatchJump, NULL, eps, eps);
+  XLAL_CHECK(batch != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALAdaptiveRungeKutta4HermiteBatch(batch, NULL, yinit, tinit, tend, deltat, yout) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(batch->returncode[0] == XLAL_EFAILED, XLAL_EFAILED, "Unexpected return code %i", batch->returncode[0]);
+  XLAL_CHECK(yout[0]->data[yout[0]->dimLength->data[1] - 1] < 0.5, XLAL_EFAILED, "Integration stepped over the jump");
+
+  XLALDestroyREAL8Array(yout[0]);
+  XLALAdaptiveRungeKuttaBatchFree(batch);
+
+  return XLAL_SUCCESS;
+}
+
+static int testDense(void)
+{
+  LALAdaptiveRungeKuttaIntegrator *integrator = XLALAdaptiveRungeKutta4Init(2, dydt, stop, eps, eps);
+  XLAL_CHECK(integrator != NULL, XLAL_EFUNC);
+
+  for (size_t l = 0; l < 4; ++l) {
+    oscillator osc = { 1.0 + 0.37 * l, l % 2 };
+
+    /* integrate once, recording the continuous extension */
+    REAL8 yd[2] = {1.0, 0.0};
+    LALAdaptiveRungeKuttaDenseOutput *dense = NULL;
+    const int nsteps = XLALAdaptiveRungeKutta4Dense(integrator, &osc, yd, tinit, tend, deltat, &dense);
+    XLAL_CHECK(nsteps > 0, XLAL_EFUNC);
+    XLAL_CHECK((size_t)nsteps == dense->length, XLAL_EFAILED);
+    XLAL_CHECK(integrator->returncode == (osc.stopatzero ? TEST_STOP : 0), XLAL_EFAILED, "Oscillator %zu: unexpected return code %i", l, integrator->returncode);
+    XLAL_CHECK(yd[0] == dense->y[2 * nsteps] && yd[1] == dense->y[2 * nsteps + 1], XLAL_EFAILED, "Oscillator %zu: final values differ", l);
+
+    /* sampling the continuous extension must reproduce the on-the-fly interpolation */
+    REAL8 y[2] = {1.0, 0.0};
+    REAL8Array *yout = NULL;
+    const int len = XLALAdaptiveRungeKutta4Hermite(integrator, &osc, y, tinit, tend, deltat, &yout);
+    XLAL_CHECK(len > 0, XLAL_EFUNC);
+    REAL8Array *youtDense = XLALAdaptiveRungeKuttaDenseOutputEvalUniform(dense, tinit, deltat, 0);
+    XLAL_CHECK(youtDense != NULL, XLAL_EFUNC);
+    const int lenDense = youtDense->dimLength->data[1];
+    XLAL_CHECK(lenDense == len || lenDense == len + 1, XLAL_EFAILED, "Oscillator %zu: dense output has length %i, expected %i", l, lenDense, len);
+    for (int j = 0; j < len; ++j) {
+      XLAL_CHECK(fabs(youtDense->data[j] - yout->data[j]) <= 1e-12, XLAL_EFAILED, "Oscillator %zu: sample %i at time %g, expected %g", l, j, youtDense->data[j], yout->data[j]);
+      for (int i = 1; i <= 2; ++i) {
+        const REAL8 yd_ij = youtDense->data[i * lenDense + j];
+        const REAL8 ys = yout->data[i * len + j];
+        XLAL_CHECK(fabs(yd_ij - ys) <= 1e-12 * (1 + fabs(ys)), XLAL_EFAILED, "Oscillator %zu: sample %i of variable %i is %.15g, expected %.15g", l, j, i, yd_ij, ys);
+      }
+    }
+    XLALDestroyREAL8Array(yout);
+    XLALDestroyREAL8Array(youtDense);
+
+    /* evaluate the continuous extension at arbitrary times, in any order */
+    const REAL8 tlast = dense->t[dense->length];
+    for (int j = 0; j <= 1000; ++j) {
+      const REAL8 t = tinit + (tlast - tinit) * ((j * 617) % 1001) / 1000.0;
+      REAL8 ye[2];
+      XLAL_CHECK(XLALAdaptiveRungeKuttaDenseOutputEval(ye, dense, t) == XLAL_SUCCESS, XLAL_EFUNC);
+      XLAL_CHECK(fabs(ye[0] - exactSolution(&osc, t)) <= 1e-6, XLAL_EFAILED, "Oscillator %zu: value at time %g is %.15g, exact solution is %.15g", l, t, ye[0], exactSolution(&osc, t));
+    }
+
+    /* times outside of the integration range are an error */
+    {
+      REAL8 ye[2];
+      int errnum;
+      XLAL_TRY_SILENT(XLALAdaptiveRungeKuttaDenseOutputEval(ye, dense, tlast + 1), errnum);
+      XLAL_CHECK(errnum == XLAL_EDOM, XLAL_EFAILED);
+    }
+
+    XLALDestroyAdaptiveRungeKuttaDenseOutput(dense);
+  }
+
+  XLALAdaptiveRungeKuttaFree(integrator);
+
+  return XLAL_SUCCESS;
+}
+
+int main(void) {
+
+  XLAL_CHECK_MAIN(testBatch() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testBatchJump() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testDense() == XLAL_SUCCESS, XLAL_EFUNC);
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+/** \endcond */
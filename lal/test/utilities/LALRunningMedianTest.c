@@ -19,12 +19,15 @@
 
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALConstants.h>
 #include <lal/LALMalloc.h>
 #include <lal/SeqFactories.h>
+#include <lal/Sequence.h>
 #include <lal/PrintVector.h>
 #include <lal/LALRunningMedian.h>
+#include <lal/LogPrintf.h>
 
 
 /**
@@ -37,7 +40,7 @@
  * ### Usage ###
  *
  * \code
- * LALRunningMedianTest [length blocksize [lalDebugLevel]]
+ * LALRunningMedianTest [--benchmark] [length blocksize [lalDebugLevel]]
  * \endcode
  *
  * ### Description ###
@@ -57,6 +60,12 @@
  * to files, using the PrintVector functions
  * from the support package.
  *
+ * The XLALRunningMedian functions are tested in the same way, for a range of
+ * small and large block sizes and for a sequence of vectors.  Finally, with
+ * <tt>--benchmark</tt>, the speed of XLALRunningMedianREAL8() is compared
+ * with that of LALDRunningMedian2() for block sizes between 50 and 2000, and
+ * the timings are printed to standard output.
+ *
  */
 
 /**\name Error Codes */
@@ -113,6 +122,9 @@ int testDRunningMedian(LALStatus *stat, REAL8Sequence *input, UINT4 length,
 		       LALRunningMedianPar param, BOOLEAN verbose, BOOLEAN bmimpl);
 int testSRunningMedian(LALStatus *stat, REAL4Sequence *input, UINT4 length,
 		       LALRunningMedianPar param, BOOLEAN verbose, BOOLEAN bmimpl);
+int testXLALRunningMedian(REAL8Sequence *input8, REAL4Sequence *input4, UINT4 blocksize);
+int testXLALRunningMedianVectorSequence(UINT4 nvec, UINT4 length, UINT4 blocksize);
+int benchmarkXLALRunningMedian(LALStatus *stat);
 
 
 struct rngmed_val_index {
@@ -344,6 +356,162 @@ int testSRunningMedian(LALStatus *stat, REAL4Sequence *input, UINT4 length,
 
 
 
+int testXLALRunningMedian(REAL8Sequence *input8, REAL4Sequence *input4, UINT4 blocksize) {
+/* Test XLALRunningMedianREAL8() and XLALRunningMedianREAL4() by
+   comparing the results to individually calculated medians */
+
+  REAL8 median;
+  REAL8Sequence *medians8;
+  REAL4Sequence *medians4;
+  struct rngmed_val_index *index_block;
+  UINT4 i,k;
+
+  medians8 = XLALCreateREAL8Sequence( input8->length - blocksize + 1 );
+  medians4 = XLALCreateREAL4Sequence( input4->length - blocksize + 1 );
+  index_block = (struct rngmed_val_index *)LALCalloc(blocksize, sizeof(struct rngmed_val_index));
+  if ( !medians8 || !medians4 || !index_block ) {
+    EXIT( LALRUNNINGMEDIANTESTC_EALOC, argv0, LALRUNNINGMEDIANTESTC_MSGEALOC );
+  }
+
+  if ( XLALRunningMedianREAL8( medians8, input8, blocksize ) != XLAL_SUCCESS
+       || XLALRunningMedianREAL4( medians4, input4, blocksize ) != XLAL_SUCCESS ) {
+    printf("ERROR: XLALRunningMedian returned error %d\n", xlalErrno);
+    EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+  }
+
+  for(i=0;i<medians8->length;i++) {
+
+    for(k=0;k<blocksize;k++){
+      index_block[k].data=input8->data[k+i];
+      index_block[k].index=k;
+    }
+    qsort(index_block, blocksize, sizeof(struct rngmed_val_index),rngmed_sortindex);
+    if(blocksize%2==1)
+      median = index_block[(blocksize-1)/2].data;
+    else
+      median = (index_block[blocksize/2-1].data+index_block[blocksize/2].data)/2;
+
+    if(compare_double(median,medians8->data[i])) {
+      printf("ERROR: blocksize:%d index:%d median:% 22.15e running median:% 22.15e mismatch\n",
+             blocksize, i, median, medians8->data[i]);
+      EXIT( LALRUNNINGMEDIANTESTC_EFALSE, argv0, LALRUNNINGMEDIANTESTC_MSGEFALSE );
+    }
+
+    for(k=0;k<blocksize;k++){
+      index_block[k].data=input4->data[k+i];
+      index_block[k].index=k;
+    }
+    qsort(index_block, blocksize, sizeof(struct rngmed_val_index),rngmed_sortindex);
+    if(blocksize%2==1)
+      median = index_block[(blocksize-1)/2].data;
+    else
+      median = (index_block[blocksize/2-1].data+index_block[blocksize/2].data)/2;
+
+    if(compare_single(median,medians4->data[i])) {
+      printf("ERROR: blocksize:%d index:%d median:%f running median:%f mismatch\n",
+             blocksize, i, median, medians4->data[i]);
+      EXIT( LALRUNNINGMEDIANTESTC_EFALSE, argv0, LALRUNNINGMEDIANTESTC_MSGEFALSE );
+    }
+  }
+
+  LALFree(index_block);
+  XLALDestroyREAL8Sequence(medians8);
+  XLALDestroyREAL4Sequence(medians4);
+  return(0);
+}
+
+
+int testXLALRunningMedianVectorSequence(UINT4 nvec, UINT4 length, UINT4 blocksize) {
+/* Test XLALRunningMedianREAL8VectorSequence() by comparing each row
+   to the result of XLALRunningMedianREAL8() */
+
+  REAL8VectorSequence *input, *medians;
+  REAL8Sequence row, *rowmedians;
+  UINT4 i,k;
+
+  input = XLALCreateREAL8VectorSequence( nvec, length );
+  medians = XLALCreateREAL8VectorSequence( nvec, length - blocksize + 1 );
+  rowmedians = XLALCreateREAL8Sequence( length - blocksize + 1 );
+  if ( !input || !medians || !rowmedians ) {
+    EXIT( LALRUNNINGMEDIANTESTC_EALOC, argv0, LALRUNNINGMEDIANTESTC_MSGEALOC );
+  }
+  for(i=0;i<nvec*length;i++)
+    input->data[i] = (double)rand()/(double)RAND_MAX;
+
+  if ( XLALRunningMedianREAL8VectorSequence( medians, input, blocksize ) != XLAL_SUCCESS ) {
+    printf("ERROR: XLALRunningMedianREAL8VectorSequence returned error %d\n", xlalErrno);
+    EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+  }
+
+  for(k=0;k<nvec;k++) {
+    row.length = length;
+    row.data = input->data + k*length;
+    if ( XLALRunningMedianREAL8( rowmedians, &row, blocksize ) != XLAL_SUCCESS ) {
+      EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+    }
+    for(i=0;i<rowmedians->length;i++)
+      if ( medians->data[k*medians->vectorLength + i] != rowmedians->data[i] ) {
+        printf("ERROR: vector:%d index:%d mismatch\n", k, i);
+        EXIT( LALRUNNINGMEDIANTESTC_EFALSE, argv0, LALRUNNINGMEDIANTESTC_MSGEFALSE );
+      }
+  }
+
+  XLALDestroyREAL8VectorSequence(input);
+  XLALDestroyREAL8VectorSequence(medians);
+  XLALDestroyREAL8Sequence(rowmedians);
+  return(0);
+}
+
+
+int benchmarkXLALRunningMedian(LALStatus *stat) {
+/* Compare the speed of XLALRunningMedianREAL8() and LALDRunningMedian2() */
+
+  const UINT4 length = 20000;
+  const UINT4 blocksizes[] = { 50, 100, 200, 500, 1000, 2000 };
+  REAL8Sequence *input, *medians;
+  LALRunningMedianPar param;
+  REAL8 tic, toc1, toc2;
+  UINT4 i,j;
+
+  input = XLALCreateREAL8Sequence( length );
+  if ( !input ) {
+    EXIT( LALRUNNINGMEDIANTESTC_EALOC, argv0, LALRUNNINGMEDIANTESTC_MSGEALOC );
+  }
+  for(i=0;i<length;i++)
+    input->data[i] = (double)rand()/(double)RAND_MAX;
+
+  for(j=0;j<sizeof(blocksizes)/sizeof(blocksizes[0]);j++) {
+    param.blocksize = blocksizes[j];
+    medians = XLALCreateREAL8Sequence( length - param.blocksize + 1 );
+    if ( !medians ) {
+      EXIT( LALRUNNINGMEDIANTESTC_EALOC, argv0, LALRUNNINGMEDIANTESTC_MSGEALOC );
+    }
+
+    tic = XLALGetCPUTime();
+    LALDRunningMedian2( stat, medians, input, param );
+    toc1 = XLALGetCPUTime() - tic;
+    if ( stat->statusCode ) {
+      EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+    }
+
+    tic = XLALGetCPUTime();
+    if ( XLALRunningMedianREAL8( medians, input, param.blocksize ) != XLAL_SUCCESS ) {
+      EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+    }
+    toc2 = XLALGetCPUTime() - tic;
+
+    printf( "blocksize %4d: LALDRunningMedian2 %6.1f ns/sample, XLALRunningMedianREAL8 %6.1f ns/sample\n",
+            param.blocksize, 1e9 * toc1 / medians->length, 1e9 * toc2 / medians->length );
+
+    XLALDestroyREAL8Sequence(medians);
+  }
+
+  XLALDestroyREAL8Sequence(input);
+  return(0);
+}
+
+
+
 
 
 /**************
@@ -360,6 +528,7 @@ int main( int argc, char **argv )
   LALRunningMedianPar param;
   UINT4 i;
   BOOLEAN verbose = 0;
+  BOOLEAN benchmark = 0;
 
 
   /* set global program name */
@@ -373,6 +542,11 @@ int main( int argc, char **argv )
 
 
   /* Parse input line. */
+  if ( argc >= 2 && strcmp(argv[1], "--benchmark") == 0 ) {
+    benchmark = 1;
+    ++argv;
+    --argc;
+  }
   if ( argc >= 3 ) {
     length = atoi(argv[1]);
     blocksize = atoi(argv[2]);
@@ -680,6 +854,28 @@ int main( int argc, char **argv )
     printf("  PASS: LALSRunningMedian2(%d,%d)\n",length,param.blocksize);
   }
 
+  /* test the XLAL functions with small (sorted window) and large (heap) block sizes */
+  {
+    const UINT4 xlalblocksizes[] = { 1, 2, 3, 4, 7, 8, 9, 47, 48, 49, 64, 65, 100, 101, blocksize - 1, blocksize };
+    for(i=0;i<sizeof(xlalblocksizes)/sizeof(xlalblocksizes[0]);i++) {
+      if(testXLALRunningMedian(input8,input4,xlalblocksizes[i])) {
+        EXIT( LALRUNNINGMEDIANTESTC_EFALSE, argv0, LALRUNNINGMEDIANTESTC_MSGEFALSE );
+      }
+    }
+    printf("  PASS: XLALRunningMedianREAL8/REAL4(%d,...)\n",length);
+  }
+
+  if(testXLALRunningMedianVectorSequence(7,length,5) || testXLALRunningMedianVectorSequence(7,length,blocksize)) {
+    EXIT( LALRUNNINGMEDIANTESTC_EFALSE, argv0, LALRUNNINGMEDIANTESTC_MSGEFALSE );
+  } else {
+    printf("  PASS: XLALRunningMedianREAL8VectorSequence(7,%d,...)\n",length);
+  }
+
+  /* compare speed with LALDRunningMedian2() */
+  if(benchmark && benchmarkXLALRunningMedian(&stat)) {
+    EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+  }
+
 
   /* free dummy input memory */
   LALDDestroyVector(&stat,&input8);
@@ -0,0 +1,220 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/**
+ * \file
+ * \ingroup PhiloxRandom_c
+ * \brief Tests the counter-based random number streams in \ref PhiloxRandom_c.
+ *
+ * The Philox4x32-10 bijection is checked against the known-answer tests of
+ * its reference implementation, and the first deviates of two streams are
+ * checked against reference values.  Deviates generated in one call are checked
+ * to be bitwise identical to the same deviates generated in several calls
+ * with jumps, and against a scalar evaluation of the Box-Muller transform;
+ * finally, the first moments of a large sample of normal deviates are
+ * checked.
+ */
+
+/** \cond DONT_DOXYGEN */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/AVFactories.h>
+#include <lal/Random.h>
+
+static int testKnownAnswers(void)
+{
+  const struct {
+    UINT4 key[2];
+    UINT4 counter[4];
+    UINT4 expected[4];
+  } tests[] = {
+    { { 0x00000000, 0x00000000 }, { 0x00000000, 0x00000000, 0x00000000, 0x00000000 }, { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 } },
+    { { 0xffffffff, 0xffffffff }, { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd } },
+    { { 0xa4093822, 0x299f31d0 }, { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } },
+  };
+  for (size_t t = 0; t < XLAL_NUM_ELEM(tests); ++t) {
+    UINT4 out[4];
+    XLALPhiloxRandomBlock(out, tests[t].key, tests[t].counter);
+    for (int i = 0; i < 4; ++i) {
+      XLAL_CHECK(out[i] == tests[t].expected[i], XLAL_EFAILED, "Test %zu: word %i is 0x%08x, expected 0x%08x", t, i, out[i], tests[t].expected[i]);
+    }
+  }
+  return XLAL_SUCCESS;
+}
+
+static int testReferenceValues(void)
+{
+  const struct {
+    UINT8 seed;
+    UINT8 stream;
+    UINT8 position;
+    REAL8 uniform[6];
+    REAL8 normal[6];
+  } tests[] = {
+    { 0, 0, 0,
+      { 0.88052019788861424, 0.60548185387992126, 0.36209111566940344, 0.037094080749417335, 0.31944576791009149, 0.27174698657843899 },
+      { -0.39766753844418223, -0.31039547880173801, 1.3868444271028377, 0.32921320019214323, -0.2057862889642241, 1.4966587865707792 } },
+    { 0x0123456789abcdefULL, 42, 12345,
+      { 0.8754003803745336, 0.13998714111437183, 0.96409615383125347, 0.52738766432319761, 0.12172628867316482, 0.1355016423233546 },
+      { -0.8423986339839229, 1.9327847134720924, -0.44356811305274357, 0.81616989044916322, 0.7832659189597535, 0.63240746529134084 } },
+  };
+  for (size_t t = 0; t < XLAL_NUM_ELEM(tests); ++t) {
+    REAL8 data[6];
+    REAL8Vector deviates = { XLAL_NUM_ELEM(data), data };
+    PhiloxRandomParams params;
+    XLALResetPhiloxRandomParams(&params, tests[t].seed, tests[t].stream);
+    params.position = tests[t].position;
+    XLAL_CHECK(XLALPhiloxUniformDeviates(&deviates, &params) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 i = 0; i < deviates.length; ++i) {
+      XLAL_CHECK(data[i] == tests[t].uniform[i], XLAL_EFAILED, "Test %zu: uniform deviate %u is %.17g, expected %.17g", t, i, data[i], tests[t].uniform[i]);
+    }
+    params.position = tests[t].position;
+    XLAL_CHECK(XLALPhiloxNormalDeviates(&deviates, &params) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 i = 0; i < deviates.length; ++i) {
+      /* allow for the last-bit differences between C libraries */
+      XLAL_CHECK(fabs(data[i] - tests[t].normal[i]) <= 1e-14 * fabs(tests[t].normal[i]), XLAL_EFAILED, "Test %zu: normal deviate %u is %.17g, expected %.17g", t, i, data[i], tests[t].normal[i]);
+    }
+  }
+  return XLAL_SUCCESS;
+}
+
+static int testDeviates(void)
+{
+  const UINT8 seed = 0x0123456789abcdefULL, stream = 42;
+  const UINT4 n = 1000;
+  PhiloxRandomParams *params = XLALCreatePhiloxRandomParams(seed, stream);
+  XLAL_CHECK(params != NULL, XLAL_EFUNC);
+  REAL8Vector *uniform = XLALCreateREAL8Vector(n);
+  REAL8Vector *normal = XLALCreateREAL8Vector(n);
+  XLAL_CHECK(uniform != NULL && normal != NULL, XLAL_EFUNC);
+
+  /* generate deviates in one call, starting from an odd position */
+  const UINT8 start = 12345;
+  XLAL_CHECK(XLALPhiloxRandomJump(params, start) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALPhiloxUniformDeviates(uniform, params) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(params->position == start + n, XLAL_EFAILED);
+  params->position = start;
+  XLAL_CHECK(XLALPhiloxNormalDeviates(normal, params) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* compare against the bijection and a scalar Box-Muller transform */
+  for (UINT4 i = 0; i < n; ++i) {
+    const UINT8 j = start + i;
+    const UINT4 counter[4] = { (UINT4)(j / 2), (UINT4)((j / 2) >> 32), (UINT4)stream, (UINT4)(stream >> 32) };
+    UINT4 w[4];
+    XLALPhiloxRandomBlock(w, params->key, counter);
+    const UINT8 x0 = ((UINT8)w[1] << 32) | w[0];
+    const UINT8 x1 = ((UINT8)w[3] << 32) | w[2];
+    const REAL8 u = ((j % 2 ? x1 : x0) >> 11) * 0x1.0p-53;
+    XLAL_CHECK(uniform->data[i] == u, XLAL_EFAILED, "Uniform deviate %u is %.17g, expected %.17g", i, uniform->data[i], u);
+    const REAL8 rad = sqrt(-2 * log(((x0 >> 11) + 1) * 0x1.0p-53));
+    const REAL8 phase = LAL_TWOPI * ((x1 >> 11) * 0x1.0p-53);
+    const REAL8 g = rad * (j % 2 ? sin(phase) : cos(phase));
+    XLAL_CHECK(fabs(normal->data[i] - g) <= 1e-14 * (1 + fabs(g)), XLAL_EFAILED, "Normal deviate %u is %.17g, expected %.17g", i, normal->data[i], g);
+  }
+
+  /* generate the same deviates in pieces of varying length */
+  {
+    REAL8Vector piece;
+    UINT4 i = 0, len = 1;
+    XLALResetPhiloxRandomParams(params, seed, stream);
+    params->position = start;
+    while (i < n) {
+      piece.length = (len < n - i) ? len : n - i;
+      piece.data = normal->data + i;
+      REAL8 saved[piece.length];
+      for (UINT4 k = 0; k < piece.length; ++k) {
+        saved[k] = piece.data[k];
+        piece.data[k] = 0;
+      }
+      XLAL_CHECK(XLALPhiloxNormalDeviates(&piece, params) == XLAL_SUCCESS, XLAL_EFUNC);
+      for (UINT4 k = 0; k < piece.length; ++k) {
+        XLAL_CHECK(piece.data[k] == saved[k], XLAL_EFAILED, "Normal deviate %u differs when generated in pieces", i + k);
+      }
+      i += piece.length;
+      len = 3 * len + 1;
+    }
+  }
+
+  /* a different stream gives different deviates */
+  {
+    REAL8Vector piece = { 4, uniform->data };
+    XLALResetPhiloxRandomParams(params, seed, stream + 1);
+    params->position = start;
+    XLAL_CHECK(XLALPhiloxNormalDeviates(&piece, params) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 k = 0; k < piece.length; ++k) {
+      XLAL_CHECK(piece.data[k] != normal->data[k], XLAL_EFAILED, "Streams %llu and %llu agree at deviate %u", (unsigned long long)stream, (unsigned long long)stream + 1, k);
+    }
+  }
+
+  XLALDestroyREAL8Vector(uniform);
+  XLALDestroyREAL8Vector(normal);
+  XLALDestroyPhiloxRandomParams(params);
+
+  return XLAL_SUCCESS;
+}
+
+static int testMoments(void)
+{
+  const UINT4 n = 1 << 20;
+  PhiloxRandomParams params;
+  XLALResetPhiloxRandomParams(&params, 0, 0);
+  REAL8Vector *normal = XLALCreateREAL8Vector(n);
+  XLAL_CHECK(normal != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALPhiloxNormalDeviates(normal, &params) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  REAL8 m1 = 0, m2 = 0, m4 = 0;
+  for (UINT4 i = 0; i < n; ++i) {
+    const REAL8 x = normal->data[i];
+    m1 += x;
+    m2 += x * x;
+    m4 += x * x * x * x;
+  }
+  m1 /= n;
+  m2 /= n;
+  m4 /= n;
+
+  /* allow for 5 standard deviations of each sample moment */
+  XLAL_CHECK(fabs(m1) < 5 * sqrt(1.0 / n), XLAL_EFAILED, "Sample mean is %g", m1);
+  XLAL_CHECK(fabs(m2 - 1) < 5 * sqrt(2.0 / n), XLAL_EFAILED, "Sample variance is %g", m2);
+  XLAL_CHECK(fabs(m4 - 3) < 5 * sqrt(96.0 / n), XLAL_EFAILED, "Sample fourth moment is %g", m4);
+
+  XLALDestroyREAL8Vector(normal);
+
+  return XLAL_SUCCESS;
+}
+
+int main(void) {
+
+  XLAL_CHECK_MAIN(testKnownAnswers() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testReferenceValues() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testDeviates() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testMoments() == XLAL_SUCCESS, XLAL_EFUNC);
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+/** \endcond */
@@ -0,0 +1,132 @@
+/*
+*  Copyright (C) 2021 Yiqi Xie
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/**
+ * \file
+ * \ingroup SphericalHarmonics_h
+ * \brief Tests the batched Wigner-d matrix and spin-weighted spherical harmonic routines.
+ *
+ * The output of XLALWignerdMatrixBatch() is compared against XLALWignerdMatrix(),
+ * and the output of XLALSpinWeightedSphericalHarmonicBatch() against
+ * XLALSpinWeightedSphericalHarmonic() for spin weights -2 and +2 (using
+ * \f$ {}_{s}Y_{lm}^* = (-1)^{s+m} {}_{-s}Y_{l,-m} \f$), and against
+ * XLALScalarSphericalHarmonic() for spin weight 0, over a grid of angles.
+ */
+
+/** \cond DONT_DOXYGEN */
+
+#include <math.h>
+#include <complex.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/SphericalHarmonics.h>
+
+#define NANGLES 37
+#define LMAX 8
+
+static int testWignerd(void)
+{
+  REAL8 beta[NANGLES];
+  for (size_t k = 0; k < NANGLES; ++k) {
+    beta[k] = -LAL_PI + 2 * LAL_PI * k / (NANGLES - 1);
+  }
+
+  const int nrows = XLALWignerdMatrixIndex(LMAX + 1, -LMAX - 1, -LMAX - 1);
+  XLAL_CHECK(nrows == (LMAX + 1) * (2 * LMAX + 1) * (2 * LMAX + 3) / 3, XLAL_EFAILED, "Unexpected number of matrix elements %i", nrows);
+  REAL8 *d = XLALMalloc(nrows * NANGLES * sizeof(*d));
+  XLAL_CHECK(d != NULL, XLAL_ENOMEM);
+  XLAL_CHECK(XLALWignerdMatrixBatch(d, LMAX, beta, NANGLES) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  int row = 0;
+  for (int l = 0; l <= LMAX; ++l) {
+    for (int mp = -l; mp <= l; ++mp) {
+      for (int m = -l; m <= l; ++m, ++row) {
+        XLAL_CHECK(XLALWignerdMatrixIndex(l, mp, m) == row, XLAL_EFAILED, "Index of (l,m',m)=(%i,%i,%i) is %i, expected %i", l, mp, m, XLALWignerdMatrixIndex(l, mp, m), row);
+        for (size_t k = 0; k < NANGLES; ++k) {
+          const REAL8 dexp = XLALWignerdMatrix(l, mp, m, beta[k]);
+          const REAL8 dgot = d[row * NANGLES + k];
+          XLAL_CHECK(fabs(dgot - dexp) <= 1e-12, XLAL_EFAILED, "d^%i_{%i,%i}(%g) is %.15g, expected %.15g", l, mp, m, beta[k], dgot, dexp);
+        }
+      }
+    }
+  }
+
+  XLALFree(d);
+
+  return XLAL_SUCCESS;
+}
+
+static int testSpinWeightedSphericalHarmonic(int s)
+{
+  REAL8 theta[NANGLES], phi[NANGLES];
+  for (size_t k = 0; k < NANGLES; ++k) {
+    theta[k] = LAL_PI * k / (NANGLES - 1);
+    phi[k] = 0.1 + 2 * LAL_PI * ((k * 7) % NANGLES) / NANGLES;
+  }
+
+  const int nrows = (LMAX + 1) * (LMAX + 1);
+  COMPLEX16 *Y = XLALMalloc(nrows * NANGLES * sizeof(*Y));
+  XLAL_CHECK(Y != NULL, XLAL_ENOMEM);
+  XLAL_CHECK(XLALSpinWeightedSphericalHarmonicBatch(Y, s, LMAX, theta, phi, NANGLES) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  for (int l = 0; l <= LMAX; ++l) {
+    for (int m = -l; m <= l; ++m) {
+      for (size_t k = 0; k < NANGLES; ++k) {
+        const COMPLEX16 Ygot = Y[(l * l + l + m) * NANGLES + k];
+        if (l < abs(s)) {
+          XLAL_CHECK(Ygot == 0, XLAL_EFAILED, "%iY_{%i,%i} is nonzero", s, l, m);
+          continue;
+        }
+        COMPLEX16 Yexp;
+        if (s == 0) {
+          XLAL_CHECK(XLALScalarSphericalHarmonic(&Yexp, l, m, theta[k], phi[k]) == XLAL_SUCCESS, XLAL_EFUNC);
+        } else if (s == -2) {
+          Yexp = XLALSpinWeightedSphericalHarmonic(theta[k], phi[k], -2, l, m);
+          XLAL_CHECK(xlalErrno == 0, XLAL_EFUNC);
+        } else {
+          Yexp = ((m % 2) ? -1 : 1) * conj(XLALSpinWeightedSphericalHarmonic(theta[k], phi[k], -2, l, -m));
+          XLAL_CHECK(xlalErrno == 0, XLAL_EFUNC);
+        }
+        XLAL_CHECK(cabs(Ygot - Yexp) <= 1e-11, XLAL_EFAILED, "%iY_{%i,%i}(%g,%g) is %.15g%+.15gi, expected %.15g%+.15gi", s, l, m, theta[k], phi[k], creal(Ygot), cimag(Ygot), creal(Yexp), cimag(Yexp));
+      }
+    }
+  }
+
+  XLALFree(Y);
+
+  return XLAL_SUCCESS;
+}
+
+int main(void) {
+
+  XLAL_CHECK_MAIN(testWignerd() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testSpinWeightedSphericalHarmonic(-2) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testSpinWeightedSphericalHarmonic(2) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(testSpinWeightedSphericalHarmonic(0) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+/** \endcond */
@@ -38,6 +38,8 @@
 #define Relerr(dx,x) (fabsf(x)>0 ? fabsf((dx)/(x)) : fabsf(dx) )
 #define Relerrd(dx,x) (fabs(x)>0 ? fabs((dx)/(x)) : fabs(dx) )
 #define cRelerr(dx,x) (cabsf(x)>0 ? cabsf((dx)/(x)) : fabsf(dx) )
+#define zRelerr(dx,x) (cabs(x)>0 ? cabs((dx)/(x)) : fabs(dx) )
+#define drand() (rand() / (REAL8)RAND_MAX)
 
 // ----- test and benchmark operators with 1 REAL4 vector input and 1 INT4 vector output (S2I) ----------
 #define TESTBENCH_VECTORMATH_S2I(name,in)                               \
@@ -200,8 +202,8 @@
     maxErr = maxRelerr = 0;                                             \
     for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
     {                                                                   \
-      REAL8 err = fabs ( xOut[i] - xOutRef[i] );                      \
-      REAL8 relerr = Relerrd ( err, xOutRef[i] );                       \
+      REAL8 err = fabs ( xOutD[i] - xOutRefD[i] );                      \
+      REAL8 relerr = Relerrd ( err, xOutRefD[i] );                       \
       maxErr    = fmax ( err, maxErr );                                \
       maxRelerr = fmax ( relerr, maxRelerr );                          \
     }                                                                   \
@@ -211,6 +213,140 @@
     XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxRelerr, reltol ); \
   }
 
+// ----- test and benchmark operators with 1 REAL8 vector input and 2 REAL8 vector outputs (D2DD) ----------
+#define TESTBENCH_VECTORMATH_D2DD(name,in)                              \
+  {                                                                     \
+    XLAL_CHECK ( XLALVector##name##REAL8_GEN( xOutRefD, xOutRef2D, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##REAL8( xOutD, xOut2D, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = maxRelerr = 0;                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ ) {                            \
+      REAL8 err1 = fabs ( xOutD[i] - xOutRefD[i] );                     \
+      REAL8 err2 = fabs ( xOut2D[i] - xOutRef2D[i] );                   \
+      REAL8 relerr1 = Relerrd ( err1, xOutRefD[i] );                    \
+      REAL8 relerr2 = Relerrd ( err2, xOutRef2D[i] );                   \
+      maxErr    = fmax ( err1, maxErr );                                \
+      maxErr    = fmax ( err2, maxErr );                                \
+      maxRelerr = fmax ( relerr1, maxRelerr );                          \
+      maxRelerr = fmax ( relerr2, maxRelerr );                          \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##REAL8_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 2 COMPLEX16 vector inputs and 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define TESTBENCH_VECTORMATH_ZZ2Z(name,in1,in2)                         \
+  {                                                                     \
+    XLAL_CHECK ( XLALVector##name##COMPLEX16_GEN( xOutRefZ, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16( xOutZ, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = maxRelerr = 0;                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
+    {                                                                   \
+      REAL8 err = cabs ( xOutZ[i] - xOutRefZ[i] );                      \
+      REAL8 relerr = zRelerr ( err, xOutRefZ[i] );                      \
+      maxErr    = fmax ( err, maxErr );                                 \
+      maxRelerr = fmax ( relerr, maxRelerr );                           \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX16_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 2 REAL8 vector inputs and 1 REAL8 scalar output (DD2d) ----------
+#define TESTBENCH_VECTORMATH_DD2d(name,in1,in2)                         \
+  {                                                                     \
+    REAL8 xOutd = 0, xOutRefd = 0;                                      \
+    XLAL_CHECK ( XLALVector##name##REAL8_GEN( &xOutRefd, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##REAL8( &xOutd, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = fabs ( xOutd - xOutRefd );                                 \
+    maxRelerr = Relerrd ( maxErr, xOutRefd );                           \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##REAL8_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 2 COMPLEX16 vector inputs and 1 COMPLEX16 scalar output (ZZ2z) ----------
+#define TESTBENCH_VECTORMATH_ZZ2z(name,in1,in2)                         \
+  {                                                                     \
+    COMPLEX16 xOutz = 0, xOutRefz = 0;                                  \
+    XLAL_CHECK ( XLALVector##name##COMPLEX16_GEN( &xOutRefz, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16( &xOutz, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = cabs ( xOutz - xOutRefz );                                 \
+    maxRelerr = zRelerr ( maxErr, xOutRefz );                           \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX16_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 2 COMPLEX16 vector inputs and 1 REAL8 vector weight to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define TESTBENCH_VECTORMATH_ZZD2z(name,in1,in2,w)                      \
+  {                                                                     \
+    COMPLEX16 xOutz = 0, xOutRefz = 0;                                  \
+    XLAL_CHECK ( XLALVector##name##COMPLEX16_GEN( &xOutRefz, in1, in2, w, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16( &xOutz, in1, in2, w, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = cabs ( xOutz - xOutRefz );                                 \
+    maxRelerr = zRelerr ( maxErr, xOutRefz );                           \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX16_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 2 COMPLEX8 vector inputs and 1 REAL4 vector weight to 1 COMPLEX8 scalar output (CCS2c) ----------
+#define TESTBENCH_VECTORMATH_CCS2c(name,in1,in2,w)                      \
+  {                                                                     \
+    COMPLEX8 xOutc = 0, xOutRefc = 0;                                   \
+    XLAL_CHECK ( XLALVector##name##COMPLEX8_GEN( &xOutRefc, in1, in2, w, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX8( &xOutc, in1, in2, w, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    const REAL4 err = cabsf ( xOutc - xOutRefc );                       \
+    maxErr = err;                                                       \
+    maxRelerr = cRelerr ( err, xOutRefc );                              \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX8_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX8", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX8", maxRelerr, reltol ); \
+  }
+
+// ----- test operators with 1 REAL8 vector input and 1 REAL8 vector output (D2D) on special values ----------
+#define TEST_VECTORMATH_D2D_SPECIAL(name,in,n)                          \
+  {                                                                     \
+    XLAL_CHECK ( XLALVector##name##REAL8_GEN( xOutRefD, in, n ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    XLAL_CHECK ( XLALVector##name##REAL8( xOutD, in, n ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    for ( UINT4 i = 0; i < n; i ++ )                                    \
+    {                                                                   \
+      XLAL_CHECK ( ( isnan ( xOutD[i] ) && isnan ( xOutRefD[i] ) ) || ( xOutD[i] == xOutRefD[i] ) || ( fabs ( xOutD[i] - xOutRefD[i] ) <= 4e-16 * fabs ( xOutRefD[i] ) ), XLAL_ETOL, \
+                   "%s: result for special value %g (%g) differs from reference (%g)", #name "REAL8", in[i], xOutD[i], xOutRefD[i] ); \
+    }                                                                   \
+  }
+
 // local types
 typedef struct
 {
@@ -276,17 +412,21 @@ main ( int argc, char *argv[] )
   REAL4 *xOutRef  = xOutRef_a->data;
   REAL4 *xOutRef2 = xOutRef2_a->data;
 
-  REAL8VectorAligned *xInD_a, *xIn2D_a, *xOutD_a, *xOutRefD_a;
+  REAL8VectorAligned *xInD_a, *xIn2D_a, *xOutD_a, *xOut2D_a, *xOutRefD_a, *xOutRef2D_a;
   XLAL_CHECK ( ( xInD_a   = XLALCreateREAL8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( ( xIn2D_a  = XLALCreateREAL8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( ( xOutD_a  = XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( ( xOut2D_a = XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( (xOutRefD_a= XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( (xOutRef2D_a= XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
 
   // extract aligned REAL8 vectors from these
   REAL8 *xInD      = xInD_a->data;
   REAL8 *xIn2D     = xIn2D_a->data;
   REAL8 *xOutD     = xOutD_a->data;
+  REAL8 *xOut2D    = xOut2D_a->data;
   REAL8 *xOutRefD  = xOutRefD_a->data;
+  REAL8 *xOutRef2D = xOutRef2D_a->data;
 
   COMPLEX8VectorAligned *xInC_a, *xIn2C_a, *xOutC_a, *xOutRefC_a;
   XLAL_CHECK ( ( xInC_a   = XLALCreateCOMPLEX8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
@@ -300,9 +440,21 @@ main ( int argc, char *argv[] )
   COMPLEX8 *xOutC     = xOutC_a->data;
   COMPLEX8 *xOutRefC  = xOutRefC_a->data;
 
+  COMPLEX16VectorAligned *xInZ_a, *xIn2Z_a, *xOutZ_a, *xOutRefZ_a;
+  XLAL_CHECK ( ( xInZ_a   = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( ( xIn2Z_a  = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( ( xOutZ_a  = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( (xOutRefZ_a  = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+
+  // extract aligned COMPLEX16 vectors from these
+  COMPLEX16 *xInZ      = xInZ_a->data;
+  COMPLEX16 *xIn2Z     = xIn2Z_a->data;
+  COMPLEX16 *xOutZ     = xOutZ_a->data;
+  COMPLEX16 *xOutRefZ  = xOutRefZ_a->data;
+
   REAL8 tic, toc;
-  REAL4 maxErr = 0, maxRelerr = 0;
-  REAL4 abstol, reltol;
+  REAL8 maxErr = 0, maxRelerr = 0;
+  REAL8 abstol, reltol;
 
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
     xIn[i] = 2000 * ( frand() - 0.5 );
@@ -383,6 +535,107 @@ main ( int argc, char *argv[] )
   TESTBENCH_VECTORMATH_CC2C(Scale,xInC[0],xIn2C);
   TESTBENCH_VECTORMATH_CC2C(Shift,xInC[0],xIn2C);
 
+  // ==================== SINCOS(), EXP(), LOG() (REAL8) ====================
+  XLALPrintInfo ("\nTesting sin(x), cos(x) for x in [-1000, 1000] in double precision\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 2000 * ( drand() - 0.5 );
+  }
+  abstol = 4e-16, reltol = 1e-14;
+  TESTBENCH_VECTORMATH_D2DD(SinCos,xInD);
+
+  XLALPrintInfo ("\nTesting exp(x) for x in [-10, 10] in double precision\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 20 * ( drand() - 0.5 );
+  }
+  abstol = 1e-11, reltol = 4e-16;
+  TESTBENCH_VECTORMATH_D2D(Exp,xInD);
+
+  XLALPrintInfo ("\nTesting log(x) for x in (0, 10000] in double precision\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 10000.0 * drand() + 1e-12;
+  }
+  abstol = 4e-15, reltol = 4e-16;
+  TESTBENCH_VECTORMATH_D2D(Log,xInD);
+
+  XLALPrintInfo ("\nTesting exp(x), log(x) for special values in double precision\n");
+  {
+    const REAL8 special[] = { INFINITY, -INFINITY, NAN, 0.0, -0.0, 1.0, -1.0, 710.0, -746.0, -700.0, 700.0, 1e-310, 1e300 };
+    const UINT4 Nspecial = XLAL_NUM_ELEM(special);
+    for ( UINT4 i = 0; i < Nspecial; i ++ ) {
+      xInD[i] = special[i];
+    }
+    TEST_VECTORMATH_D2D_SPECIAL(Exp,xInD,Nspecial);
+    TEST_VECTORMATH_D2D_SPECIAL(Log,xInD,Nspecial);
+  }
+
+  // ==================== REAL8 DOTPRODUCT ====================
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = drand();
+    xIn2D[i]= 1.0 + drand();
+  } // for i < Ntrials
+  abstol = 1e-6, reltol = 1e-13;
+
+  XLALPrintInfo ("\nTesting dot product of x in (0, 1] and y in (1, 2] in double precision\n");
+  TESTBENCH_VECTORMATH_DD2d(DotProduct,xInD,xIn2D);
+
+  // ==================== COMPLEX16 MULTIPLY,SCALE,DOTPRODUCT ====================
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInZ[i] = -10000.0 + 20000.0 * drand() + ( -10000.0 + 20000.0 * drand() ) * _Complex_I;
+    xIn2Z[i]= -10000.0 + 20000.0 * drand() + ( -10000.0 + 20000.0 * drand() ) * _Complex_I;
+  } // for i < Ntrials
+  abstol = 0, reltol = 0;
+
+  XLALPrintInfo ("\nTesting multiply,scale(x,y) for complex x,y in (-10000, 10000] in double precision\n");
+  TESTBENCH_VECTORMATH_ZZ2Z(Multiply,xInZ,xIn2Z);
+  TESTBENCH_VECTORMATH_ZZ2Z(ConjugateMultiply,xInZ,xIn2Z);
+  TESTBENCH_VECTORMATH_ZZ2Z(Scale,xInZ[0],xIn2Z);
+
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInZ[i] = -1.0 + 2.0 * drand() + ( -1.0 + 2.0 * drand() ) * _Complex_I;
+    xIn2Z[i]= -1.0 + 2.0 * drand() + ( -1.0 + 2.0 * drand() ) * _Complex_I;
+  } // for i < Ntrials
+  abstol = 2e-10, reltol = 1e-12;
+
+  XLALPrintInfo ("\nTesting dot products of complex x,y in (-1, 1] in double precision\n");
+  TESTBENCH_VECTORMATH_ZZ2z(DotProduct,xInZ,xIn2Z);
+  TESTBENCH_VECTORMATH_ZZ2z(ConjugateDotProduct,xInZ,xIn2Z);
+
+  // ==================== WEIGHTED INNER PRODUCT ====================
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 1e-3 + drand();
+    xInC[i] = xInZ[i];
+    xIn2C[i] = xIn2Z[i];
+    xIn[i] = xInD[i];
+  } // for i < Ntrials
+
+  XLALPrintInfo ("\nTesting weighted inner products of complex x,y in (-1, 1] with weights in (0.001, 1.001]\n");
+  abstol = 1e-12, reltol = 1e-14;
+  TESTBENCH_VECTORMATH_ZZD2z(WeightedInnerProduct,xInZ,xIn2Z,xInD);
+  abstol = 2e-4, reltol = 2e-7;
+  TESTBENCH_VECTORMATH_CCS2c(WeightedInnerProduct,xInC,xIn2C,xIn);
+
+  // check accuracy of pairwise summation against an extended-precision sequential sum
+  {
+    long double refre = 0, refim = 0, refabs = 0, crefre = 0, crefim = 0;
+    for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+      refre += xInD[i] * ( (long double)creal(xInZ[i]) * creal(xIn2Z[i]) + (long double)cimag(xInZ[i]) * cimag(xIn2Z[i]) );
+      refim += xInD[i] * ( (long double)creal(xInZ[i]) * cimag(xIn2Z[i]) - (long double)cimag(xInZ[i]) * creal(xIn2Z[i]) );
+      refabs += xInD[i] * cabs(xInZ[i]) * cabs(xIn2Z[i]);
+      crefre += xIn[i] * ( (long double)crealf(xInC[i]) * crealf(xIn2C[i]) + (long double)cimagf(xInC[i]) * cimagf(xIn2C[i]) );
+      crefim += xIn[i] * ( (long double)crealf(xInC[i]) * cimagf(xIn2C[i]) - (long double)cimagf(xInC[i]) * crealf(xIn2C[i]) );
+    }
+    COMPLEX16 xOutz = 0;
+    COMPLEX8 xOutc = 0;
+    XLAL_CHECK ( XLALVectorWeightedInnerProductCOMPLEX16( &xOutz, xInZ, xIn2Z, xInD, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK ( XLALVectorWeightedInnerProductCOMPLEX8( &xOutc, xInC, xIn2C, xIn, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const REAL8 err = cabs ( xOutz - crect ( refre, refim ) ) / refabs;
+    const REAL8 cerr = cabs ( xOutc - crect ( crefre, crefim ) ) / cabs ( crect ( crefre, crefim ) );
+    XLALPrintInfo ( "%-32s: error relative to sum of |terms| = %7.2g (tol=%7.2g)\n", XLALVectorWeightedInnerProductCOMPLEX16_name, err, 1e-15 );
+    XLALPrintInfo ( "%-32s: relative error = %7.2g (tol=%7.2g)\n", XLALVectorWeightedInnerProductCOMPLEX8_name, cerr, 1.2e-7 );
+    XLAL_CHECK ( err <= 1e-15, XLAL_ETOL, "WeightedInnerProductCOMPLEX16: error (%g) relative to sum of |terms| exceeds tolerance (%g)\n", err, 1e-15 );
+    XLAL_CHECK ( cerr <= 1.2e-7, XLAL_ETOL, "WeightedInnerProductCOMPLEX8: relative error (%g) exceeds tolerance (%g)\n", cerr, 1.2e-7 );
+  }
+
   // ==================== FIND ====================
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
     xIn[i]  = -10000.0f + 20000.0f * frand() + 1e-6;
@@ -414,13 +667,20 @@ main ( int argc, char *argv[] )
   XLALDestroyREAL8VectorAligned ( xInD_a );
   XLALDestroyREAL8VectorAligned ( xIn2D_a );
   XLALDestroyREAL8VectorAligned ( xOutD_a );
+  XLALDestroyREAL8VectorAligned ( xOut2D_a );
   XLALDestroyREAL8VectorAligned ( xOutRefD_a );
+  XLALDestroyREAL8VectorAligned ( xOutRef2D_a );
 
   XLALDestroyCOMPLEX8VectorAligned ( xInC_a );
   XLALDestroyCOMPLEX8VectorAligned ( xIn2C_a );
   XLALDestroyCOMPLEX8VectorAligned ( xOutC_a );
   XLALDestroyCOMPLEX8VectorAligned ( xOutRefC_a );
 
+  XLALDestroyCOMPLEX16VectorAligned ( xInZ_a );
+  XLALDestroyCOMPLEX16VectorAligned ( xIn2Z_a );
+  XLALDestroyCOMPLEX16VectorAligned ( xOutZ_a );
+  XLALDestroyCOMPLEX16VectorAligned ( xOutRefZ_a );
+
   XLALDestroyUserVars();
 
   LALCheckMemoryLeaks();
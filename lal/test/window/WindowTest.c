@@ -412,6 +412,82 @@ static int test_parameter_safety(void)
 }
 
 
+/*
+ * Window cache
+ */
+
+
+static int test_window_cache(void)
+{
+	const REAL8Window *cached1, *cached2, *cached3;
+	REAL8Window *window;
+	UINT4 i;
+	int fail = 0;
+
+	cached1 = XLALAcquireNamedREAL8Window("Tukey", 0.5, 1001);
+	cached2 = XLALAcquireNamedREAL8Window("tukey", 0.5, 1001);
+	cached3 = XLALAcquireNamedREAL8Window("Tukey", 0.25, 1001);
+	window = XLALCreateTukeyREAL8Window(1001, 0.5);
+	if(!cached1 || !cached2 || !cached3 || !window) {
+		fprintf(stderr, "error: failed to create cached Tukey windows\n");
+		return 1;
+	}
+
+	if(cached1 != cached2) {
+		fprintf(stderr, "error: window cache returned different windows for the same parameters\n");
+		fail = 1;
+	}
+	if(cached1 == cached3) {
+		fprintf(stderr, "error: window cache returned the same window for different parameters\n");
+		fail = 1;
+	}
+	if(cached1->data->length != window->data->length || cached1->sum != window->sum || cached1->sumofsquares != window->sumofsquares) {
+		fprintf(stderr, "error: cached Tukey window differs from XLALCreateTukeyREAL8Window()\n");
+		fail = 1;
+	} else
+		for(i = 0; i < window->data->length; i++)
+			if(cached1->data->data[i] != window->data->data[i]) {
+				fprintf(stderr, "error: cached Tukey window sample %u is %.17g, expected %.17g\n", i, cached1->data->data[i], window->data->data[i]);
+				fail = 1;
+				break;
+			}
+
+	XLALReleaseREAL8Window(cached1);
+	XLALReleaseREAL8Window(cached2);
+	XLALReleaseREAL8Window(cached3);
+
+	/* a window not obtained from the cache must be rejected */
+	XLALReleaseREAL8Window(window);
+	if(xlalErrno != XLAL_EINVAL) {
+		fprintf(stderr, "error: window cache accepted a window it did not create\n");
+		fail = 1;
+	}
+	XLALClearErrno();
+	XLALDestroyREAL8Window(window);
+
+	/* released windows are kept, and reused */
+	cached2 = XLALAcquireNamedREAL8Window("Tukey", 0.5, 1001);
+	if(cached2 != cached1) {
+		fprintf(stderr, "error: window cache did not reuse a released window\n");
+		fail = 1;
+	}
+	XLALReleaseREAL8Window(cached2);
+
+	/* invalid parameters are rejected */
+	cached1 = XLALAcquireNamedREAL8Window("Tukey", 2, 1001);
+	if(cached1) {
+		fprintf(stderr, "error: window cache accepted out-of-range parameter\n");
+		XLALReleaseREAL8Window(cached1);
+		fail = 1;
+	}
+	XLALClearErrno();
+
+	XLALClearREAL8WindowCache();
+
+	return fail;
+}
+
+
 /*
  * Display sample windows.
  */
@@ -525,6 +601,11 @@ int main(void)
 	if(test_parameter_safety())
 		fail = 1;
 
+	/* Test the window cache */
+
+	if(test_window_cache())
+		fail = 1;
+
 	/* Verbosity */
 
 	display();
@@ -68,6 +68,9 @@ typedef struct
   BOOLEAN sharedWorkspace;   	// useful for checking workspace sharing for Resampling
   BOOLEAN perSegmentSFTs;     	// Weave vs GCT convention: GCT loads SFT frequency ranges globally, Weave loads them per segment (more efficient)
   BOOLEAN resampFFTPowerOf2;
+  INT4 resampFFTThreads;
+  INT4 resampSincPhases;
+  BOOLEAN perStageTiming;	// report timing of the individual stages of the F-statistic method
   INT4 Dterms;
   INT4 randSeed;
 
@@ -120,6 +123,8 @@ main ( int argc, char *argv[] )
   uvar->Tsft = 1800;
   uvar->sharedWorkspace = 1;
   uvar->resampFFTPowerOf2 = FstatOptionalArgsDefaults.resampFFTPowerOf2;
+  uvar->resampFFTThreads = FstatOptionalArgsDefaults.resampFFTThreads;
+  uvar->resampSincPhases = FstatOptionalArgsDefaults.resampSincPhases;
   uvar->perSegmentSFTs = 1;
 
   uvar->Dterms = FstatOptionalArgsDefaults.Dterms;
@@ -155,6 +160,9 @@ main ( int argc, char *argv[] )
   XLAL_CHECK_MAIN ( XLALRegisterUvarMember ( sharedWorkspace,BOOLEAN,        0, OPTIONAL,  "Use workspace sharing across segments (only used in Resampling)" ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK_MAIN ( XLALRegisterUvarMember ( perSegmentSFTs, BOOLEAN,        0, OPTIONAL,  "Weave vs GCT: GCT determines and loads SFT frequency ranges globally, Weave does that per segment (more efficient)" ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK_MAIN ( XLALRegisterUvarMember ( resampFFTPowerOf2, BOOLEAN,     0, OPTIONAL,  "For Resampling methods: enforce FFT length to be a power of two (by rounding up)" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN ( XLALRegisterUvarMember ( resampFFTThreads, INT4,         0, OPTIONAL,  "For Resampling methods: number of threads per FFT (0 = LAL default, see LAL_FFT_THREADS)" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN ( XLALRegisterUvarMember ( resampSincPhases, INT4,         0, OPTIONAL,  "For Resampling methods: tabulate sinc-interpolation kernel at this many fractional offsets per sample (0 = compute exactly)" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN ( XLALRegisterUvarMember ( perStageTiming, BOOLEAN,        0, OPTIONAL,  "Report timing-model values of the individual F-statistic stages, averaged over segments" ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   XLAL_CHECK_MAIN ( XLALRegisterUvarMember ( Dterms,         INT4,           0, OPTIONAL,  "Number of kernel terms (single-sided) in\na) Dirichlet kernel if FstatMethod=Demod*\nb) sinc-interpolation if FstatMethod=Resamp*" ) == XLAL_SUCCESS, XLAL_EFUNC );
 
@@ -223,6 +231,10 @@ main ( int argc, char *argv[] )
   optionalArgs.FstatMethod = uvar->FstatMethod;
   optionalArgs.collectTiming = 1;
   optionalArgs.resampFFTPowerOf2 = uvar->resampFFTPowerOf2;
+  XLAL_CHECK_MAIN ( uvar->resampFFTThreads >= 0, XLAL_EINVAL );
+  optionalArgs.resampFFTThreads = uvar->resampFFTThreads;
+  XLAL_CHECK_MAIN ( uvar->resampSincPhases >= 0, XLAL_EINVAL );
+  optionalArgs.resampSincPhases = uvar->resampSincPhases;
   optionalArgs.Dterms = uvar->Dterms;
 
   FILE *timingLogFILE = NULL;
@@ -344,6 +356,29 @@ main ( int argc, char *argv[] )
       const char *FmethodName = XLALGetFstatInputMethodName ( inputs->data[0] );
       fprintf (stderr, "%-15s: memoryUsage = %6.1f MB\n", FmethodName, memUsage );
 
+      // ----- report per-stage timing, averaged over segments
+      if ( uvar->perStageTiming )
+        {
+          REAL8 tauF_core = 0, tauF_buffer = 0;
+          REAL8 XLAL_INIT_DECL(stageTau, [TIMING_MODEL_MAX_VARS]);
+          FstatTimingModel XLAL_INIT_DECL(timingModel);
+          for ( INT4 l = 0; l < uvar->numSegments; l ++ )
+            {
+              FstatTimingGeneric XLAL_INIT_DECL(timingGeneric);
+              XLAL_CHECK_MAIN ( XLALGetFstatTiming ( inputs->data[l], &timingGeneric, &timingModel ) == XLAL_SUCCESS, XLAL_EFUNC );
+              tauF_core   += timingGeneric.tauF_core / uvar->numSegments;
+              tauF_buffer += timingGeneric.tauF_buffer / uvar->numSegments;
+              for ( UINT4 k = 0; k < timingModel.numVariables; k ++ ) {
+                stageTau[k] += timingModel.values[k] / uvar->numSegments;
+              }
+            }
+          fprintf ( stderr, "%-15s: tauF_core = %.2e s, tauF_buffer = %.2e s", FmethodName, tauF_core, tauF_buffer );
+          for ( UINT4 k = 0; k < timingModel.numVariables; k ++ ) {
+            fprintf ( stderr, ", %s = %.2e s", timingModel.names[k], stageTau[k] );
+          }
+          fprintf ( stderr, "\n" );
+        }
+
       if ( timingParFILE != NULL )
         {
           fprintf ( timingParFILE, "%10d %20d %20.16g %20.16g %20.16g %20.16g %20.16g %20.16g %20.16g %12g %20.16g %20.16g %20.16g %20.16g %"LAL_GPS_FORMAT"\n",
@@ -1217,7 +1217,7 @@ InitFstat ( ConfigVariables *cfg, const UserInput_t *uvar )
   XLAL_CHECK ( chdir ( uvar->workingDir ) == 0, XLAL_EINVAL, "Unable to change directory to workinDir '%s'\n", uvar->workingDir );
 
   /* ----- set computational parameters for F-statistic from User-input ----- */
-  cfg->useResamp = ( uvar->FstatMethod >= FMETHOD_RESAMP_GENERIC ); // use resampling;
+  cfg->useResamp = ( uvar->FstatMethod >= FMETHOD_RESAMP_GENERIC && uvar->FstatMethod <= FMETHOD_RESAMP_BEST ); // use resampling;
 
   /* check that resampling is compatible with gridType */
   if ( cfg->useResamp && uvar->gridType > GRID_SKY_LAST /* end-marker for factored grid types */ ) {
@@ -509,22 +509,27 @@ XLALMakeSFTsFromREAL8TimeSeries ( const REAL8TimeSeries *timeseries,	//!< input
                     "Inconsistent sampling-step (dt=%g) and Tsft=%g: must be integer multiple Tsft/dt = %g >= %g\n",
                     dt, Tsft, timestepsSFT0, eps );
 
+  // everything below is freed at XLAL_FAIL, on success and on error
+  const REAL8Window *window = NULL;
+  REAL8Vector *timeStretchCopy = NULL;	// input array of length N
+  fftw_complex *fftOut = NULL;	// output array of length N/2 + 1
+  fftw_plan fftplan = NULL;	// FFTW plan
+  SFTVector *sftvect = NULL;
+  SFTVector *retn = NULL;
+
   // prepare window function if requested
-  REAL8Window *window = NULL;
   if ( windowType != NULL ) {
-    XLAL_CHECK_NULL ( (window = XLALCreateNamedREAL8Window ( windowType, windowBeta, timestepsSFT )) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_FAIL ( (window = XLALAcquireNamedREAL8Window ( windowType, windowBeta, timestepsSFT )) != NULL, XLAL_EFUNC );
   }
 
   // ---------- Prepare FFT ----------
-  REAL8Vector *timeStretchCopy;	// input array of length N
-  XLAL_CHECK_NULL ( (timeStretchCopy = XLALCreateREAL8Vector ( timestepsSFT )) != NULL, XLAL_EFUNC, "XLALCreateREAL4Vector(%d) failed.\n", timestepsSFT );
+  XLAL_CHECK_FAIL ( (timeStretchCopy = XLALCreateREAL8Vector ( timestepsSFT )) != NULL, XLAL_EFUNC, "XLALCreateREAL4Vector(%d) failed.\n", timestepsSFT );
   UINT4 numSFTBins = timestepsSFT / 2 + 1;	// number of positive frequency-bins + 'DC' to be stored in SFT
-  fftw_complex *fftOut;	// output array of length N/2 + 1
-  XLAL_CHECK_NULL ( (fftOut = fftw_malloc ( numSFTBins * sizeof(fftOut[0]) )) != NULL, XLAL_ENOMEM, "fftw_malloc(%d*sizeof(complex)) failed\n", numSFTBins );
-  fftw_plan fftplan;	// FFTW plan
+  XLAL_CHECK_FAIL ( (fftOut = fftw_malloc ( numSFTBins * sizeof(fftOut[0]) )) != NULL, XLAL_ENOMEM, "fftw_malloc(%d*sizeof(complex)) failed\n", numSFTBins );
   LAL_FFTW_WISDOM_LOCK;
-  XLAL_CHECK_NULL ( (fftplan = fftw_plan_dft_r2c_1d ( timestepsSFT, timeStretchCopy->data, fftOut, FFTW_ESTIMATE)) != NULL, XLAL_EFUNC );	// FIXME: or try FFTW_MEASURE
+  fftplan = fftw_plan_dft_r2c_1d ( timestepsSFT, timeStretchCopy->data, fftOut, FFTW_ESTIMATE );	// FIXME: or try FFTW_MEASURE
   LAL_FFTW_WISDOM_UNLOCK;
+  XLAL_CHECK_FAIL ( fftplan != NULL, XLAL_EFUNC );
 
   LIGOTimeGPS tStart = timeseries->epoch;
 
@@ -537,17 +542,16 @@ XLALMakeSFTsFromREAL8TimeSeries ( const REAL8TimeSeries *timeseries,	//!< input
   for ( UINT4 i = 0; i < timestamps->length; i ++ )
     {
       char buf1[256], buf2[256];
-      XLAL_CHECK_NULL ( XLALGPSDiff ( &tStart, &(timestamps->data[i]) ) <= 0, XLAL_EDOM, "Timestamp i=%d: %s before start-time %s\n",
+      XLAL_CHECK_FAIL ( XLALGPSDiff ( &tStart, &(timestamps->data[i]) ) <= 0, XLAL_EDOM, "Timestamp i=%d: %s before start-time %s\n",
                         i, XLALGPSToStr ( buf1, &(timestamps->data[i]) ), XLALGPSToStr ( buf2, &tStart ) );
-      XLAL_CHECK_NULL ( XLALGPSDiff ( &tLast,   &(timestamps->data[i]) ) >=0, XLAL_EDOM, "Timestamp i=%d: %s after last start-time %s\n",
+      XLAL_CHECK_FAIL ( XLALGPSDiff ( &tLast,   &(timestamps->data[i]) ) >=0, XLAL_EDOM, "Timestamp i=%d: %s after last start-time %s\n",
                         i, XLALGPSToStr ( buf1, &(timestamps->data[i]) ), XLALGPSToStr ( buf2, &tLast ) );
     }
 
   UINT4 numSFTs = timestamps->length;
 
   // prepare output SFT-vector
-  SFTVector *sftvect;
-  XLAL_CHECK_NULL ( (sftvect = XLALCreateSFTVector ( numSFTs, numSFTBins )) != NULL, XLAL_EFUNC,
+  XLAL_CHECK_FAIL ( (sftvect = XLALCreateSFTVector ( numSFTs, numSFTBins )) != NULL, XLAL_EFUNC,
                     "XLALCreateSFTVector(numSFTs=%d, numBins=%d) failed.\n", numSFTs, numSFTBins );
 
   // main loop: apply FFT to the requested time-stretches and store in output SFTs
@@ -593,20 +597,28 @@ XLALMakeSFTsFromREAL8TimeSeries ( const REAL8TimeSeries *timeseries,	//!< input
 
       // correct heterodyning-phase, IF NECESSARY: ie if (fHet * tStart) is not an integer, such that phase-corr = multiple of 2pi
       if ( ( (INT4)timeseries->f0 != timeseries->f0  ) || (timeseries->epoch.gpsNanoSeconds != 0) || (thisSFT->epoch.gpsNanoSeconds != 0) ) {
-        XLAL_CHECK_NULL ( XLALcorrect_phase ( thisSFT, timeseries->epoch) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_FAIL ( XLALcorrect_phase ( thisSFT, timeseries->epoch) == XLAL_SUCCESS, XLAL_EFUNC );
       }
 
     } // for iSFT < numSFTs
 
+  // success: return the SFTs instead of freeing them
+  retn = sftvect;
+  sftvect = NULL;
+
+XLAL_FAIL:
   // free memory
   fftw_free ( fftOut );
-  LAL_FFTW_WISDOM_LOCK;
-  fftw_destroy_plan ( fftplan );
-  LAL_FFTW_WISDOM_UNLOCK;
+  if ( fftplan != NULL ) {
+    LAL_FFTW_WISDOM_LOCK;
+    fftw_destroy_plan ( fftplan );
+    LAL_FFTW_WISDOM_UNLOCK;
+  }
   XLALDestroyREAL8Vector ( timeStretchCopy );
-  XLALDestroyREAL8Window ( window );
+  XLALReleaseREAL8Window ( window );
+  XLALDestroySFTVector ( sftvect );
 
-  return sftvect;
+  return retn;
 
 } // XLALMakeSFTsFromREAL8TimeSeries()
 
@@ -23,6 +23,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <gsl/gsl_math.h>
 
 #include "ComputeFstat_internal.h"
@@ -37,6 +40,7 @@
 #include <lal/NormalizeSFTRngMed.h>
 #include <lal/ExtrapolatePulsarSpins.h>
 #include <lal/VectorMath.h>
+#include <lal/SinCosLUT.h>
 
 // ---------- Internal struct definitions ---------- //
 
@@ -70,7 +74,8 @@ int XLALExtractResampledTimeseries_ResampCUDA ( MultiCOMPLEX8TimeSeries **multiT
 int XLALGetFstatTiming_ResampCUDA ( const void *method_data, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
 #endif
 
-static int XLALSelectBestFstatMethod ( FstatMethodType *method );
+static int XLALSelectBestFstatMethod ( FstatMethodType *method, UINT4 Dterms );
+static BOOLEAN isDemodFstatMethod ( FstatMethodType method );
 static void XLALDestroyFstatInputTimeslice_common ( FstatCommon *common );
 
 // ---------- Constant variable definitions ---------- //
@@ -85,6 +90,10 @@ static const char *const FstatMethodNames[FMETHOD_END] = {
   [FMETHOD_RESAMP_GENERIC]	= "ResampGeneric",
   [FMETHOD_RESAMP_CUDA]		= "ResampCUDA",
   [FMETHOD_RESAMP_BEST]		= "ResampBest",
+
+  [FMETHOD_DEMOD_AVX2]		= "DemodAVX2",
+  [FMETHOD_DEMOD_AVX512]	= "DemodAVX512",
+  [FMETHOD_DEMOD_PARALLEL]	= "DemodParallel",
 };
 
 const FstatOptionalArgs FstatOptionalArgsDefaults = {
@@ -98,7 +107,9 @@ const FstatOptionalArgs FstatOptionalArgsDefaults = {
   .assumeSqrtSX = NULL,
   .prevInput = NULL,
   .collectTiming = 0,
-  .resampFFTPowerOf2 = 1
+  .resampFFTPowerOf2 = 1,
+  .resampFFTThreads = 0,
+  .resampSincPhases = 0
 };
 
 static const char FstatTimingGenericHelp[] =
@@ -395,7 +406,7 @@ XLALCreateFstatInput ( const SFTCatalog *SFTcatalog,              ///< [in] Cata
   // Check optional Fstat method type argument
   XLAL_CHECK_NULL ( ( FMETHOD_START < optArgs.FstatMethod ) && ( optArgs.FstatMethod < FMETHOD_END ), XLAL_EINVAL );
   XLAL_CHECK_NULL ( FstatMethodNames[optArgs.FstatMethod] != NULL, XLAL_EFAULT );
-  XLAL_CHECK_NULL ( XLALSelectBestFstatMethod( &optArgs.FstatMethod ) == XLAL_SUCCESS, XLAL_EFAULT );
+  XLAL_CHECK_NULL ( XLALSelectBestFstatMethod( &optArgs.FstatMethod, optArgs.Dterms ) == XLAL_SUCCESS, XLAL_EFAULT );
 
   //
   // Parse which F-statistic method to use, and set these variables:
@@ -430,6 +441,14 @@ XLALCreateFstatInput ( const SFTCatalog *SFTcatalog,              ///< [in] Cata
     setupFuncMethod = XLALSetupFstatDemod;
     break;
 
+  case FMETHOD_DEMOD_AVX2:		// Demod: AVX2 hotloop
+  case FMETHOD_DEMOD_AVX512:		// Demod: AVX-512 hotloop
+  case FMETHOD_DEMOD_PARALLEL:		// Demod: best available hotloop, shared between threads
+    XLAL_CHECK_NULL ( optArgs.Dterms > 0, XLAL_EINVAL );
+    extraBinsMethod = optArgs.Dterms;
+    setupFuncMethod = XLALSetupFstatDemod;
+    break;
+
   case FMETHOD_RESAMP_CUDA:		// Resamp: CUDA implementation
 #ifdef LALPULSAR_CUDA_ENABLED
     extraBinsMethod = 8;   // use 8 extra bins to give better agreement with Demod(w Dterms=8) near the boundaries
@@ -889,6 +908,150 @@ XLALComputeFstat ( FstatResults **Fstats,               ///< [in/out] Address of
 
 } // XLALComputeFstat()
 
+///
+/// Compare two Doppler points by the parameters which determine the quantities buffered by the
+/// \f$\mathcal{F}\f$-statistic methods between calls, i.e. sky position, reference time and
+/// binary-orbital parameters, but not the frequency and spindowns.
+///
+static int
+compareFstatBuffering ( const PulsarDopplerParams *a, const PulsarDopplerParams *b )
+{
+#define CMP(x, y) do { if ( (x) < (y) ) return -1; if ( (x) > (y) ) return 1; } while (0)
+  CMP ( a->Alpha, b->Alpha );
+  CMP ( a->Delta, b->Delta );
+  CMP ( XLALGPSDiff ( &a->refTime, &b->refTime ), 0 );
+  CMP ( a->asini, b->asini );
+  CMP ( a->period, b->period );
+  CMP ( a->ecc, b->ecc );
+  CMP ( XLALGPSDiff ( &a->tp, &b->tp ), 0 );
+  CMP ( a->argp, b->argp );
+#undef CMP
+  return 0;
+} // compareFstatBuffering()
+
+///
+/// qsort() comparison function for pointers into the array of Doppler points passed to
+/// XLALComputeFstatBatch(); ties are broken by position in the array, to keep the order deterministic.
+///
+static int
+compareFstatBatchOrder ( const void *x, const void *y )
+{
+  const PulsarDopplerParams *a = *( const PulsarDopplerParams *const * ) x;
+  const PulsarDopplerParams *b = *( const PulsarDopplerParams *const * ) y;
+  const int cmp = compareFstatBuffering ( a, b );
+  if ( cmp != 0 ) {
+    return cmp;
+  }
+  return ( a > b ) - ( a < b );
+} // compareFstatBatchOrder()
+
+///
+/// Compute the \f$\mathcal{F}\f$-statistic over a batch of Doppler points, as if XLALComputeFstat()
+/// were called for each point in turn, with the results for <tt>dopplers[i]</tt> returned in <tt>Fstats[i]</tt>.
+///
+/// Points are processed in an order in which those with the same sky position, reference time and
+/// binary-orbital parameters are computed consecutively, so that the buffered SSB times, antenna-pattern
+/// coefficients and resampled timeseries of each method are re-used as much as possible.
+///
+/// If OpenMP is enabled, the batch is shared between up to <tt>inputs->length</tt> threads, where each
+/// thread computes on one of the \c FstatInput structures in \p inputs. These must have been created by
+/// XLALCreateFstatInput() with identical arguments, except that their workspaces must not be shared
+/// through FstatOptionalArgs::prevInput, since it is modified by every computation. Since each thread
+/// keeps its own FFT plans and buffers, the results are identical to those of a sequential computation,
+/// regardless of the number of threads used. With a single input, the batch is computed sequentially.
+///
+int
+XLALComputeFstatBatch ( FstatResults **Fstats,                  ///< [in/out] Array of \p numPoints pointers to \c FstatResults results structures; any \c NULL pointers are allocated here.
+                        FstatInputVector *inputs,               ///< [in] Input data structures created by one of the setup functions, one per thread.
+                        const PulsarDopplerParams *dopplers,    ///< [in] Array of \p numPoints Doppler parameters, including starting frequencies, at which to compute \f$2\mathcal{F}\f$
+                        const UINT4 numPoints,                  ///< [in] Number of Doppler points.
+                        const UINT4 numFreqBins,                ///< [in] Number of frequencies at which the \f$2\mathcal{F}\f$ are to be computed, for each Doppler point.
+                        const FstatQuantities whatToCompute     ///< [in] Bit-field of which \f$\mathcal{F}\f$-statistic quantities to compute.
+                        )
+{
+  // Check input
+  XLAL_CHECK ( Fstats != NULL || numPoints == 0, XLAL_EINVAL );
+  XLAL_CHECK ( inputs != NULL && inputs->length > 0 && inputs->data != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( dopplers != NULL || numPoints == 0, XLAL_EINVAL );
+  const FstatInput *input0 = inputs->data[0];
+  XLAL_CHECK ( input0 != NULL, XLAL_EINVAL );
+  for ( UINT4 n = 1; n < inputs->length; ++n )
+    {
+      const FstatInput *input = inputs->data[n];
+      XLAL_CHECK ( input != NULL, XLAL_EINVAL );
+      XLAL_CHECK ( input->method == input0->method, XLAL_EINVAL, "Input %u uses FstatMethod '%d', expected '%d'", n, input->method, input0->method );
+      XLAL_CHECK ( input->common.dFreq == input0->common.dFreq && input->singleFreqBin == input0->singleFreqBin, XLAL_EINVAL, "Input %u uses a different frequency resolution", n );
+      XLAL_CHECK ( input->common.detectors.length == input0->common.detectors.length, XLAL_EINVAL, "Input %u uses a different number of detectors", n );
+      for ( UINT4 m = 0; m < n; ++m ) {
+        XLAL_CHECK ( input->common.workspace == NULL || input->common.workspace != inputs->data[m]->common.workspace, XLAL_EINVAL,
+                     "Inputs %u and %u share a workspace; they must be created without 'optionalArgs.prevInput'", m, n );
+      }
+    }
+  if ( numPoints == 0 ) {
+    return XLAL_SUCCESS;
+  }
+
+  // Sort points so that those sharing buffered quantities are adjacent
+  const PulsarDopplerParams **order = XLALMalloc ( numPoints * sizeof ( order[0] ) );
+  XLAL_CHECK ( order != NULL, XLAL_ENOMEM );
+  for ( UINT4 i = 0; i < numPoints; ++i ) {
+    order[i] = &dopplers[i];
+  }
+  qsort ( order, numPoints, sizeof ( order[0] ), compareFstatBatchOrder );
+
+  // Split the sorted points into tasks of points sharing buffered quantities; a long run is
+  // split further so that it can be shared between threads, at the cost of one buffer miss per task
+  const UINT4 maxTaskLen = ( numPoints + inputs->length - 1 ) / inputs->length;
+  UINT4 *taskStart = XLALMalloc ( ( numPoints + 1 ) * sizeof ( taskStart[0] ) );
+  if ( taskStart == NULL ) {
+    XLALFree ( order );
+    XLAL_ERROR ( XLAL_ENOMEM );
+  }
+  UINT4 numTasks = 0;
+  for ( UINT4 i = 0; i < numPoints; ++i ) {
+    if ( i == 0 || i - taskStart[numTasks - 1] >= maxTaskLen || compareFstatBuffering ( order[i - 1], order[i] ) != 0 ) {
+      taskStart[numTasks++] = i;
+    }
+  }
+  taskStart[numTasks] = numPoints;
+
+  // Initialise the sin/cos lookup table used by some methods outside of the parallel region
+  XLALSinCosLUTInit();
+
+  // Compute tasks, each on the input belonging to the thread it is scheduled on
+  int errnum = 0;
+#pragma omp parallel for schedule(dynamic) num_threads(inputs->length)
+  for ( INT4 t = 0; t < (INT4) numTasks; ++t )
+    {
+#pragma omp flush(errnum)
+      if ( errnum ) {
+        continue;
+      }
+#ifdef _OPENMP
+      FstatInput *input = inputs->data[omp_get_thread_num()];
+#else
+      FstatInput *input = inputs->data[0];
+#endif
+      for ( UINT4 i = taskStart[t]; i < taskStart[t + 1]; ++i )
+        {
+          const UINT4 j = order[i] - dopplers;
+          if ( XLALComputeFstat ( &Fstats[j], input, order[i], numFreqBins, whatToCompute ) != XLAL_SUCCESS ) {
+            errnum = XLAL_EFUNC;
+#pragma omp flush(errnum)
+            break;
+          }
+        }
+    } // for t < numTasks
+
+  XLALFree ( taskStart );
+  XLALFree ( order );
+
+  XLAL_CHECK ( errnum == 0, errnum );
+
+  return XLAL_SUCCESS;
+
+} // XLALComputeFstatBatch()
+
 ///
 /// Free all memory associated with a \c FstatInput structure.
 ///
@@ -901,7 +1064,7 @@ XLALDestroyFstatInput ( FstatInput* input       ///< [in] \c FstatInput structur
   }
   if ( input->common.isTimeslice )
     {
-      XLAL_CHECK_VOID ( input->method < FMETHOD_RESAMP_GENERIC, XLAL_EINVAL,
+      XLAL_CHECK_VOID ( isDemodFstatMethod ( input->method ), XLAL_EINVAL,
                         "Something is wrong: 'isTimeslice==TRUE' for non-LALDemod F-stat method '%s' is not supported!\n", XLALGetFstatInputMethodName(input));
       XLALDestroyFstatInputTimeslice_common ( &input->common );
       XLALDestroyFstatInputTimeslice_Demod ( input->method_data);
@@ -1064,10 +1227,10 @@ XLALComputeFstatFromAtoms ( const MultiFstatAtomVector *multiFstatAtoms,   ///<
 } // XLALComputeFstatFromAtoms()
 
 ///
-/// If user asks for a 'best' \c FstatMethodType, find and select it
+/// If user asks for a 'best' \c FstatMethodType, find and select it; \c Dterms is that of the Demod hotloop
 ///
 static int
-XLALSelectBestFstatMethod ( FstatMethodType *method )
+XLALSelectBestFstatMethod ( FstatMethodType *method, UINT4 Dterms )
 {
   switch ( *method ) {
 
@@ -1079,10 +1242,19 @@ XLALSelectBestFstatMethod ( FstatMethodType *method )
     //     FMETHOD_..._OPTIMISED,    (always avaiable)
     //     FMETHOD_..._SUPERFAST     (not always available; requires special hardware)
     //     FMETHOD_..._BEST          (must **always** avaiable)
+    //   Demod methods added after FMETHOD_RESAMP_BEST are not in this order: the AVX-512 and AVX2 hotloops
+    //   (which support any Dterms > 0) are tried first, fastest first; FMETHOD_DEMOD_PARALLEL, which starts
+    //   its own threads, is never selected and must be requested explicitly
     XLALPrintInfo( "%s: trying to find best available Fstat method for '%s'\n", __func__, FstatMethodNames[*method] );
-    while ( !XLALFstatMethodIsAvailable( --( *method ) ) ) {
-      XLAL_CHECK ( FMETHOD_START < *method, XLAL_EFAILED );
-      XLALPrintInfo( "%s: Fstat method '%s' is unavailable\n",  __func__, FstatMethodNames[*method] );
+    if ( *method == FMETHOD_DEMOD_BEST && Dterms > 0 && XLALFstatMethodIsAvailable( FMETHOD_DEMOD_AVX512 ) ) {
+      *method = FMETHOD_DEMOD_AVX512;
+    } else if ( *method == FMETHOD_DEMOD_BEST && Dterms > 0 && XLALFstatMethodIsAvailable( FMETHOD_DEMOD_AVX2 ) ) {
+      *method = FMETHOD_DEMOD_AVX2;
+    } else {
+      while ( !XLALFstatMethodIsAvailable( --( *method ) ) ) {
+        XLAL_CHECK ( FMETHOD_START < *method, XLAL_EFAILED );
+        XLALPrintInfo( "%s: Fstat method '%s' is unavailable\n",  __func__, FstatMethodNames[*method] );
+      }
     }
     XLALPrintInfo( "%s: Fstat method '%s' is available; selected as best method\n", __func__, FstatMethodNames[*method] );
     break;
@@ -1096,6 +1268,27 @@ XLALSelectBestFstatMethod ( FstatMethodType *method )
   return XLAL_SUCCESS;
 }
 
+///
+/// Return true if given \c FstatMethodType is a \a Demod method; these do not form a contiguous range of values
+///
+static BOOLEAN
+isDemodFstatMethod ( FstatMethodType method )
+{
+  switch ( method ) {
+  case FMETHOD_DEMOD_GENERIC:
+  case FMETHOD_DEMOD_OPTC:
+  case FMETHOD_DEMOD_ALTIVEC:
+  case FMETHOD_DEMOD_SSE:
+  case FMETHOD_DEMOD_BEST:
+  case FMETHOD_DEMOD_AVX2:
+  case FMETHOD_DEMOD_AVX512:
+  case FMETHOD_DEMOD_PARALLEL:
+    return 1;
+  default:
+    return 0;
+  }
+}
+
 ///
 /// Return true if given \c FstatMethodType corresponds to a valid and *available* Fstat method, false otherwise
 ///
@@ -1132,6 +1325,28 @@ XLALFstatMethodIsAvailable ( FstatMethodType method )
     return 0;
 #endif
 
+  case FMETHOD_DEMOD_AVX2:
+    // This method is available only if compiled with AVX2 support,
+    // and AVX2 is available on the current execution machine
+#ifdef HAVE_AVX2_COMPILER
+    return LAL_HAVE_AVX2_RUNTIME();
+#else
+    return 0;
+#endif
+
+  case FMETHOD_DEMOD_AVX512:
+    // This method is available only if compiled with AVX-512 support,
+    // and AVX-512 is available on the current execution machine
+#ifdef HAVE_AVX512F_COMPILER
+    return LAL_HAVE_AVX512F_RUNTIME();
+#else
+    return 0;
+#endif
+
+  case FMETHOD_DEMOD_PARALLEL:
+    // This method is always available, but only uses multiple threads if compiled with OpenMP support
+    return 1;
+
   case FMETHOD_RESAMP_CUDA:
     // This medthod is available only if compiled with CUDA support
 #ifdef LALPULSAR_CUDA_ENABLED
@@ -1176,7 +1391,7 @@ XLALFstatMethodChoices ( void )
             continue;
           }
           FstatMethodType bm = m;
-          XLAL_CHECK_NULL ( XLALSelectBestFstatMethod( &bm ) == XLAL_SUCCESS, XLAL_EFAULT );
+          XLAL_CHECK_NULL ( XLALSelectBestFstatMethod( &bm, FstatOptionalArgsDefaults.Dterms ) == XLAL_SUCCESS, XLAL_EFAULT );
           if ( bm == m ) {
             // add an Fstat method
             choices[i].name = FstatMethodNames[m];
@@ -1218,6 +1433,9 @@ XLALGetFstatTiming ( const FstatInput* input, FstatTimingGeneric *timingGeneric,
   case FMETHOD_DEMOD_OPTC:
   case FMETHOD_DEMOD_ALTIVEC:
   case FMETHOD_DEMOD_SSE:
+  case FMETHOD_DEMOD_AVX2:
+  case FMETHOD_DEMOD_AVX512:
+  case FMETHOD_DEMOD_PARALLEL:
     XLAL_CHECK ( XLALGetFstatTiming_Demod ( input->method_data, timingGeneric, timingModel ) == XLAL_SUCCESS, XLAL_EFUNC );
     break;
 
@@ -1340,7 +1558,7 @@ XLALFstatInputTimeslice ( FstatInput ** slice,                ///< [out] Address
               LAL_GPS_PRINT(*minStartGPS), LAL_GPS_PRINT(*maxStartGPS) );
 
   // only supported for 'LALDemod' Fstat methods
-  XLAL_CHECK ( input->method < FMETHOD_RESAMP_GENERIC, XLAL_EINVAL, "This function is not avavible for the chosen FstatMethod '%s'!", XLALGetFstatInputMethodName ( input ) );
+  XLAL_CHECK ( isDemodFstatMethod ( input->method ), XLAL_EINVAL, "This function is not avavible for the chosen FstatMethod '%s'!", XLALGetFstatInputMethodName ( input ) );
 
   const FstatCommon *common = &(input->common);
   UINT4 numIFOs = common->detectors.length;
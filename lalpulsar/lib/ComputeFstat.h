@@ -47,7 +47,9 @@ extern "C" {
 /// XLALCreateFstatInput() is provided for creating an \c FstatInput structure configured
 /// for the particular method.  The \c FstatInput structure is passed to the function
 /// XLALComputeFstat(), which computes the \f$\mathcal{F}\f$-statistic using the chosen method, and
-/// fills a \c FstatResults structure with the results.
+/// fills a \c FstatResults structure with the results. Many Doppler points can be computed at once
+/// by XLALComputeFstatBatch(), which orders them to re-use buffered quantities and shares them
+/// between OpenMP threads.
 ///
 /// \note The \f$\mathcal{F}\f$-statistic method codes are partly descended from earlier
 /// implementations found in:
@@ -123,6 +125,11 @@ typedef enum tagFstatMethodType {
   FMETHOD_RESAMP_CUDA,		///< \a Resamp: CUDA resampling \cite DunnEtAl2022
   FMETHOD_RESAMP_BEST,		///< \a Resamp: best guess of the fastest available implementation
 
+  // later \a Demod methods are added here, to keep the values of the methods above unchanged
+  FMETHOD_DEMOD_AVX2,		///< \a Demod: AVX2 hotloop, works for any number of Dirichlet kernel terms \f$\text{Dterms}\f$
+  FMETHOD_DEMOD_AVX512,		///< \a Demod: AVX-512 hotloop, works for any number of Dirichlet kernel terms \f$\text{Dterms}\f$
+  FMETHOD_DEMOD_PARALLEL,	///< \a Demod: best available hotloop, with frequency bins and detectors shared between OpenMP threads
+
   /// \cond DONT_DOXYGEN
   FMETHOD_END
   /// \endcond
@@ -146,6 +153,8 @@ typedef struct tagFstatOptionalArgs {
   BOOLEAN collectTiming;		///< a flag to turn on/off the collection of F-stat-method-specific timing-data
   BOOLEAN resampFFTPowerOf2;		///< \a Resamp: round up FFT lengths to next power of 2; see \c FstatMethodType.
   REAL8 allowedMismatchFromSFTLength;      ///<  Optional override for XLALFstatCheckSFTLengthMismatch().
+  UINT4 resampFFTThreads;		///< \a Resamp: number of threads used by the FFT; 0 uses the LAL default, see XLALSetFFTThreads().
+  UINT4 resampSincPhases;		///< \a Resamp: if non-zero, tabulate the sinc-interpolation kernel at this many fractional offsets per sample; see XLALCreateSincInterpolationLUT().
 } FstatOptionalArgs;
 
 ///
@@ -367,6 +376,10 @@ SWIGLAL(INOUT_STRUCTS(FstatResults**, Fstats));
 #endif
 int XLALComputeFstat ( FstatResults **Fstats, FstatInput *input, const PulsarDopplerParams *doppler,
                        const UINT4 numFreqBins, const FstatQuantities whatToCompute );
+#ifndef SWIG // exclude from SWIG interface
+int XLALComputeFstatBatch ( FstatResults **Fstats, FstatInputVector *inputs, const PulsarDopplerParams *dopplers,
+                            const UINT4 numPoints, const UINT4 numFreqBins, const FstatQuantities whatToCompute );
+#endif // SWIG
 
 void XLALDestroyFstatInput ( FstatInput* input );
 void XLALDestroyFstatResults ( FstatResults* Fstats );
@@ -23,6 +23,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 
 #include "ComputeFstat_internal.h"
@@ -71,12 +72,18 @@ typedef struct {
     COMPLEX8 *, COMPLEX8 *, FstatAtomVector **, const SFTVector *, const PulsarSpins, const SSBtimes *, const AMCoeffs *, const UINT4 Dterms
     );
   UINT4 Dterms;					// Number of terms to keep in Dirichlet kernel
+  BOOLEAN parallel;				// Share frequency bins and detectors between OpenMP threads
   MultiSFTVector *multiSFTs;			// Input multi-detector SFTs
   REAL8 prevAlpha, prevDelta;			// buffering: previous skyposition computed
   LIGOTimeGPS prevRefTime;			// buffering: keep track of previous refTime for SSBtimes buffering
   MultiSSBtimes *prevMultiSSBtimes;		// buffering: previous multiSSB times, unique to skypos + SFTs
   MultiAMCoeffs *prevMultiAMcoef;		// buffering: previous AM-coeffs, unique to skypos + SFTs
 
+  // ----- workspace -----
+  UINT4 workspaceLength;			// allocated length of workspace arrays, in units of (frequency bins * detectors)
+  COMPLEX8 *FaX_k, *FbX_k;			// per-detector Fa and Fb for each frequency bin
+  FstatAtomVector **FatomsX_k;			// per-detector F-stat atoms for each frequency bin
+
   // ----- timing -----
   BOOLEAN collectTiming;			// flag whether or not to collect timing information
   FstatTimingGeneric timingGeneric;		// measured generic F-statistic timing values
@@ -104,6 +111,16 @@ int XLALComputeFaFb_SSE     ( COMPLEX8 *Fa, COMPLEX8 *Fb, FstatAtomVector **Fsta
                               const PulsarSpins fkdot, const SSBtimes *tSSB, const AMCoeffs *amcoe, const UINT4 Dterms );
 #endif
 
+#ifdef HAVE_AVX2_COMPILER
+int XLALComputeFaFb_AVX2    ( COMPLEX8 *Fa, COMPLEX8 *Fb, FstatAtomVector **FstatAtoms, const SFTVector *sfts,
+                              const PulsarSpins fkdot, const SSBtimes *tSSB, const AMCoeffs *amcoe, const UINT4 Dterms );
+#endif
+
+#ifdef HAVE_AVX512F_COMPILER
+int XLALComputeFaFb_AVX512  ( COMPLEX8 *Fa, COMPLEX8 *Fb, FstatAtomVector **FstatAtoms, const SFTVector *sfts,
+                              const PulsarSpins fkdot, const SSBtimes *tSSB, const AMCoeffs *amcoe, const UINT4 Dterms );
+#endif
+
 int XLALGetFstatTiming_Demod ( const void *method_data, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
 void *XLALFstatInputTimeslice_Demod ( const void *method_data, const UINT4 iStart[PULSAR_MAX_DETECTORS], const UINT4 iEnd[PULSAR_MAX_DETECTORS] );
 void XLALDestroyFstatInputTimeslice_Demod ( void *method_data );
@@ -207,12 +224,79 @@ XLALComputeFstatDemod ( FstatResults* Fstats,
   REAL4 Ed = multiAMcoef->Mmunu.Ed;;
   REAL4 Dd_inv = 1.0 / multiAMcoef->Mmunu.Dd;
 
-  // ---------- Compute F-stat for each frequency bin ----------
-  for ( UINT4 k = 0; k < Fstats->numFreqBins; k++ )
+  // ---------- Compute Fa and Fb for each frequency bin and detector ----------
+  // With FMETHOD_DEMOD_PARALLEL, these are shared between OpenMP threads; each (bin, detector) pair
+  // writes only to its own slot in the workspace, so results do not depend on the number of threads
+  const UINT4 numFreqBins = Fstats->numFreqBins;
+  const UINT4 numFaFb = numFreqBins * numDetectors;
+  if ( numFaFb > demod->workspaceLength )
     {
+      // reallocate through temporaries, so that the workspace is still valid (and freed) if any allocation fails
+      COMPLEX8 *newFaX_k, *newFbX_k;
+      FstatAtomVector **newFatomsX_k;
+      if ( (newFaX_k = XLALRealloc ( demod->FaX_k, numFaFb * sizeof(demod->FaX_k[0]) )) != NULL ) {
+        demod->FaX_k = newFaX_k;
+      }
+      if ( (newFbX_k = XLALRealloc ( demod->FbX_k, numFaFb * sizeof(demod->FbX_k[0]) )) != NULL ) {
+        demod->FbX_k = newFbX_k;
+      }
+      if ( (newFatomsX_k = XLALRealloc ( demod->FatomsX_k, numFaFb * sizeof(demod->FatomsX_k[0]) )) != NULL ) {
+        demod->FatomsX_k = newFatomsX_k;
+      }
+      if ( newFaX_k == NULL || newFbX_k == NULL || newFatomsX_k == NULL )
+        {
+          XLALDestroyMultiSSBtimes ( multiBinary );
+          XLAL_ERROR ( XLAL_ENOMEM );
+        }
+      demod->workspaceLength = numFaFb;
+    }
+  COMPLEX8 *FaX_k = demod->FaX_k;
+  COMPLEX8 *FbX_k = demod->FbX_k;
+  FstatAtomVector **FatomsX_k = demod->FatomsX_k;
+  memset ( FatomsX_k, 0, numFaFb * sizeof(FatomsX_k[0]) );
+
+  int errnum = 0;
+#pragma omp parallel for schedule(static) if (demod->parallel)
+  for ( INT4 iFaFb = 0; iFaFb < (INT4) numFaFb; iFaFb ++ )
+    {
+#pragma omp flush(errnum)
+      if ( errnum ) {
+        continue;
+      }
+      const UINT4 k = iFaFb / numDetectors;
+      const UINT4 X = iFaFb % numDetectors;
+
       // Set frequency to search at
-      thisPoint.fkdot[0] = fStart + k * Fstats->dFreq;
+      PulsarSpins fkdot;
+      memcpy ( fkdot, thisPoint.fkdot, sizeof(fkdot) );
+      fkdot[0] = fStart + k * Fstats->dFreq;
+
+      // call XLALComputeFaFb_...() function for the user-requested hotloop variant
+      FstatAtomVector **FstatAtoms_p = returnAtoms ? (&FatomsX_k[iFaFb]) : NULL;
+      if ( (demod->computefafb_func) ( &FaX_k[iFaFb], &FbX_k[iFaFb], FstatAtoms_p, multiSFTs->data[X], fkdot,
+                                       multiSSBTotal->data[X], multiAMcoef->data[X], demod->Dterms ) != XLAL_SUCCESS )
+        {
+          errnum = XLAL_EFUNC;
+#pragma omp flush(errnum)
+        }
+      else if ( !( isfinite(creal(FaX_k[iFaFb])) && isfinite(cimag(FaX_k[iFaFb])) && isfinite(creal(FbX_k[iFaFb])) && isfinite(cimag(FbX_k[iFaFb])) ) )
+        {
+          errnum = XLAL_EFPOVRFLW;
+#pragma omp flush(errnum)
+        }
+    } // for iFaFb < numFaFb
+  if ( errnum )
+    {
+      for ( UINT4 iFaFb = 0; iFaFb < numFaFb; iFaFb ++ ) {
+        XLALDestroyFstatAtomVector ( FatomsX_k[iFaFb] );
+      }
+      XLALDestroyMultiSSBtimes ( multiBinary );
+      XLAL_ERROR ( errnum );
+    }
 
+  // ---------- Compute F-stat for each frequency bin ----------
+  for ( UINT4 k = 0; k < numFreqBins; k++ )
+    {
       COMPLEX8 Fa = 0;       		// complex amplitude Fa
       COMPLEX8 Fb = 0;                 // complex amplitude Fb
       MultiFstatAtomVector *multiFstatAtoms = NULL;	// per-IFO, per-SFT arrays of F-stat 'atoms', ie quantities required to compute F-stat
@@ -225,23 +309,16 @@ XLALComputeFstatDemod ( FstatResults* Fstats,
           XLAL_CHECK ( (multiFstatAtoms->data = XLALMalloc ( numDetectors * sizeof(*multiFstatAtoms->data) )) != NULL, XLAL_ENOMEM );
         } // if returnAtoms
 
-      // loop over detectors and compute all detector-specific quantities
+      // loop over detectors and combine all detector-specific quantities
       for ( UINT4 X=0; X < numDetectors; X ++)
         {
-          COMPLEX8 FaX, FbX;
-          FstatAtomVector *FstatAtoms = NULL;
-          FstatAtomVector **FstatAtoms_p = returnAtoms ? (&FstatAtoms) : NULL;
-
-          // call XLALComputeFaFb_...() function for the user-requested hotloop variant
-          XLAL_CHECK ( (demod->computefafb_func) ( &FaX, &FbX, FstatAtoms_p, multiSFTs->data[X], thisPoint.fkdot,
-                                                   multiSSBTotal->data[X], multiAMcoef->data[X], demod->Dterms ) == XLAL_SUCCESS, XLAL_EFUNC );
+          const COMPLEX8 FaX = FaX_k[k * numDetectors + X];
+          const COMPLEX8 FbX = FbX_k[k * numDetectors + X];
 
           if ( returnAtoms ) {
-            multiFstatAtoms->data[X] = FstatAtoms;     // copy pointer to IFO-specific Fstat-atoms 'contents'
+            multiFstatAtoms->data[X] = FatomsX_k[k * numDetectors + X];     // copy pointer to IFO-specific Fstat-atoms 'contents'
           }
 
-          XLAL_CHECK ( isfinite(creal(FaX)) && isfinite(cimag(FaX)) && isfinite(creal(FbX)) && isfinite(cimag(FbX)), XLAL_EFPOVRFLW );
-
           if ( whatToCompute & FSTATQ_FAFB_PER_DET )
             {
               Fstats->FaPerDet[X][k] = FaX;
@@ -293,7 +370,7 @@ XLALComputeFstatDemod ( FstatResults* Fstats,
           Fstats->multiFatoms[k] = multiFstatAtoms;
         }
 
-    } // for k < Fstats->numFreqBins
+    } // for k < numFreqBins
 
   // this needs to be free'ed, as it's currently not buffered
   XLALDestroyMultiSSBtimes ( multiBinary );
@@ -371,6 +448,9 @@ XLALDestroyDemodMethodData ( void* method_data )
   XLALDestroyMultiSFTVector ( demod->multiSFTs);
   XLALDestroyMultiSSBtimes  ( demod->prevMultiSSBtimes );
   XLALDestroyMultiAMCoeffs  ( demod->prevMultiAMcoef );
+  XLALFree ( demod->FaX_k );
+  XLALFree ( demod->FbX_k );
+  XLALFree ( demod->FatomsX_k );
   XLALFree ( demod );
 
 } // XLALDestroyDemodMethodData()
@@ -422,8 +502,27 @@ XLALSetupFstatDemod ( void **method_data,
       demod->timingDemod.Nsft	= 1.0 * numSFTs / numDetectors;	// average number of sfts *per detector*
     } // if collectTiming
 
+  // initialize sin/cos lookuptable here, as some hotloops use that directly, possibly from several threads
+  XLALSinCosLUTInit();
+
   // Select XLALComputeFaFb_...() function for the user-requested hotloop variant
-  switch ( optArgs->FstatMethod ) {
+  FstatMethodType hotloopMethod = optArgs->FstatMethod;
+  if ( hotloopMethod == FMETHOD_DEMOD_PARALLEL )
+    {
+      // use the fastest available hotloop which supports the requested Dterms
+      demod->parallel = 1;
+      if ( XLALFstatMethodIsAvailable ( FMETHOD_DEMOD_AVX512 ) ) {
+        hotloopMethod = FMETHOD_DEMOD_AVX512;
+      } else if ( XLALFstatMethodIsAvailable ( FMETHOD_DEMOD_AVX2 ) ) {
+        hotloopMethod = FMETHOD_DEMOD_AVX2;
+      } else if ( demod->Dterms <= 20 ) {
+        hotloopMethod = FMETHOD_DEMOD_OPTC;
+      } else {
+        hotloopMethod = FMETHOD_DEMOD_GENERIC;
+      }
+      XLALPrintInfo ( "%s: using hotloop '%s' for method '%s'\n", __func__, XLALFstatMethodName ( hotloopMethod ), XLALFstatMethodName ( optArgs->FstatMethod ) );
+    }
+  switch ( hotloopMethod ) {
   case  FMETHOD_DEMOD_GENERIC:
     demod->computefafb_func = XLALComputeFaFb_Generic;
     break;
@@ -439,6 +538,16 @@ XLALSetupFstatDemod ( void **method_data,
   case FMETHOD_DEMOD_SSE:
     demod->computefafb_func = XLALComputeFaFb_SSE;
     break;
+#endif
+#ifdef HAVE_AVX2_COMPILER
+  case FMETHOD_DEMOD_AVX2:
+    demod->computefafb_func = XLALComputeFaFb_AVX2;
+    break;
+#endif
+#ifdef HAVE_AVX512F_COMPILER
+  case FMETHOD_DEMOD_AVX512:
+    demod->computefafb_func = XLALComputeFaFb_AVX512;
+    break;
 #endif
   default:
     XLAL_ERROR ( XLAL_EINVAL, "Invalid Demod hotloop optArgs->FstatMethod='%d'", optArgs->FstatMethod );
@@ -534,6 +643,11 @@ XLALFstatInputTimeslice_Demod ( const void *method_data,
   demod_slice->prevMultiSSBtimes = NULL;
   demod_slice->prevMultiAMcoef = NULL;
 
+  // the workspace is not shared with the input
+  demod_slice->workspaceLength = 0;
+  demod_slice->FaX_k = demod_slice->FbX_k = NULL;
+  demod_slice->FatomsX_k = NULL;
+
   // reset timing counters
   XLAL_INIT_MEM(demod_slice->timingGeneric);
   XLAL_INIT_MEM(demod_slice->timingDemod);
@@ -556,6 +670,9 @@ XLALDestroyFstatInputTimeslice_Demod ( void *method_data )
 
   XLALDestroyMultiSSBtimes  ( demod->prevMultiSSBtimes );
   XLALDestroyMultiAMCoeffs  ( demod->prevMultiAMcoef );
+  XLALFree ( demod->FaX_k );
+  XLALFree ( demod->FbX_k );
+  XLALFree ( demod->FatomsX_k );
 
   for ( UINT4 X=0; X < demod->multiSFTs->length; X ++ ) {
     XLALFree ( demod->multiSFTs->data[X] );
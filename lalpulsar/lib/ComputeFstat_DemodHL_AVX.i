@@ -0,0 +1,73 @@
+//
+// Copyright (C) 2021 Yiqi Xie
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// this hotloop 'template' requires the following macros to be set:
+// VEC_T:              vector type of interleaved real and imaginary REAL4 parts
+// VEC_NBINS:          number of complex frequency bins per vector
+// VEC_ZERO():         vector of zeros
+// VEC_LOADU(p):       unaligned load of VEC_NBINS complex bins from p
+// VEC_MADD(a, b, c):  a * b + c
+// VEC_RECIP(x):       1/x, 1/(x-1), ..., 1/(x-VEC_NBINS+1), computed from REAL8 x, each repeated twice
+
+/// [hotloop]
+{
+  /* unrestricted Dterms: as in the generic hotloop, but with the sums
+   *   U_alpha = sum_k Re(X_alpha_k) / x_k,   V_alpha = sum_k Im(X_alpha_k) / x_k
+   * accumulated over VEC_NBINS frequency bins at a time, and the (common)
+   * trig-functions of kappa_star only applied at the end
+   */
+  const REAL8 kappa_max = kappa_star + 1.0 * Dterms - 1.0;
+  const UINT4 numTerms = 2 * Dterms;
+  const REAL4 *Xf = (const REAL4 *) Xalpha_l;
+
+  VEC_T sumUV = VEC_ZERO();
+  UINT4 l = 0;
+  for ( ; l + VEC_NBINS <= numTerms; l += VEC_NBINS )
+    {
+      sumUV = VEC_MADD ( VEC_LOADU ( Xf + 2 * l ), VEC_RECIP ( kappa_max - l ), sumUV );
+    }
+
+  REAL4 UV[2 * VEC_NBINS] __attribute__ ((aligned (64)));
+  memcpy ( UV, &sumUV, sizeof(UV) );
+  REAL4 U_alpha = 0, V_alpha = 0;
+  for ( UINT4 j = 0; j < VEC_NBINS; j ++ )
+    {
+      U_alpha += UV[2 * j];
+      V_alpha += UV[2 * j + 1];
+    }
+
+  /* remaining terms, if 2*Dterms is not a multiple of VEC_NBINS */
+  for ( ; l < numTerms; l ++ )
+    {
+      REAL4 xinv = 1.0 / ( kappa_max - l );
+      U_alpha += Xf[2 * l] * xinv;
+      V_alpha += Xf[2 * l + 1] * xinv;
+    }
+
+  REAL4 s_alpha, c_alpha;   /* sin(2pi kappa_alpha) and (cos(2pi kappa_alpha)-1) */
+  XLALSinCos2PiLUTtrimmed ( &s_alpha, &c_alpha, kappa_star );
+  c_alpha -= 1.0f;
+
+  realXP = s_alpha * U_alpha - c_alpha * V_alpha;
+  imagXP = c_alpha * U_alpha + s_alpha * V_alpha;
+
+  /* real- and imaginary part of e^{i 2 pi lambda_alpha } */
+  XLALSinCos2PiLUT ( &imagQ, &realQ, lambda_alpha );
+}
+/// [hotloop]
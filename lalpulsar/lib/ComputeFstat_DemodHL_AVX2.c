@@ -0,0 +1,55 @@
+//
+// Copyright (C) 2021 Yiqi Xie
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <immintrin.h>
+
+#include <lal/ComputeFstat.h>
+#include <lal/Factorial.h>
+#include <lal/SinCosLUT.h>
+
+///
+/// \file ComputeFstat_DemodHL_AVX2.c
+/// \ingroup ComputeFstat_Demod_c
+/// \brief AVX2 hotloop code (unrestricted Dterms)
+///
+/// \snippet ComputeFstat_DemodHL_AVX.i hotloop
+///
+
+static inline __m256 recip_avx2 ( const REAL8 x )
+{
+  const __m256d r = _mm256_div_pd ( _mm256_set1_pd ( 1.0 ), _mm256_sub_pd ( _mm256_set1_pd ( x ), _mm256_set_pd ( 3, 2, 1, 0 ) ) );
+  const __m128 rf = _mm256_cvtpd_ps ( r );
+  return _mm256_set_m128 ( _mm_unpackhi_ps ( rf, rf ), _mm_unpacklo_ps ( rf, rf ) );
+}
+
+#define VEC_T                   __m256
+#define VEC_NBINS               4
+#define VEC_ZERO()              _mm256_setzero_ps()
+#define VEC_LOADU(p)            _mm256_loadu_ps(p)
+#define VEC_MADD(a, b, c)       _mm256_add_ps(_mm256_mul_ps(a, b), c)
+#define VEC_RECIP(x)            recip_avx2(x)
+
+#define FUNC XLALComputeFaFb_AVX2
+#define HOTLOOP_SOURCE "ComputeFstat_DemodHL_AVX.i"
+#include "ComputeFstat_Demod_ComputeFaFb.c"
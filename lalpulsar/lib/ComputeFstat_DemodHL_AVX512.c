@@ -0,0 +1,56 @@
+//
+// Copyright (C) 2021 Yiqi Xie
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <immintrin.h>
+
+#include <lal/ComputeFstat.h>
+#include <lal/Factorial.h>
+#include <lal/SinCosLUT.h>
+
+///
+/// \file ComputeFstat_DemodHL_AVX512.c
+/// \ingroup ComputeFstat_Demod_c
+/// \brief AVX-512 hotloop code (unrestricted Dterms)
+///
+/// \snippet ComputeFstat_DemodHL_AVX.i hotloop
+///
+
+static inline __m512 recip_avx512 ( const REAL8 x )
+{
+  const __m512d r = _mm512_div_pd ( _mm512_set1_pd ( 1.0 ), _mm512_sub_pd ( _mm512_set1_pd ( x ), _mm512_set_pd ( 7, 6, 5, 4, 3, 2, 1, 0 ) ) );
+  const __m256 rf = _mm512_cvtpd_ps ( r );
+  const __m512i dup = _mm512_set_epi32 ( 7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0 );
+  return _mm512_permutexvar_ps ( dup, _mm512_castps256_ps512 ( rf ) );
+}
+
+#define VEC_T                   __m512
+#define VEC_NBINS               8
+#define VEC_ZERO()              _mm512_setzero_ps()
+#define VEC_LOADU(p)            _mm512_loadu_ps(p)
+#define VEC_MADD(a, b, c)       _mm512_fmadd_ps(a, b, c)
+#define VEC_RECIP(x)            recip_avx512(x)
+
+#define FUNC XLALComputeFaFb_AVX512
+#define HOTLOOP_SOURCE "ComputeFstat_DemodHL_AVX.i"
+#include "ComputeFstat_Demod_ComputeFaFb.c"
@@ -101,13 +101,6 @@ FUNC ( COMPLEX8 *Fa,                         /* [out] Fa returned */
     freqIndex1 = freqIndex0 + sfts->data[0].data->length;
   }
 
-  // locally initialize sin/cos lookuptable, as some hotloops use that directly
-  static int firstcall = 1;
-  if ( firstcall ) {
-    XLALSinCosLUTInit();
-    firstcall = 0;
-  }
-
   /* ----- prepare return of 'FstatAtoms' if requested */
   if ( FstatAtoms != NULL )
     {
@@ -78,6 +78,7 @@ typedef struct tagResampGenericWorkspace
 typedef struct
 {
   UINT4 Dterms;						// Number of terms to use (on either side) in Windowed-Sinc interpolation kernel
+  SincInterpolationLUT *sincLUT;			// optional polyphase table of Windowed-Sinc interpolation kernel weights
   MultiCOMPLEX8TimeSeries  *multiTimeSeries_DET;	// input SFTs converted into a heterodyned timeseries
   // ----- buffering -----
   PulsarDopplerParams prev_doppler;			// buffering: previous phase-evolution ("doppler") parameters
@@ -110,7 +111,7 @@ int XLALExtractResampledTimeseries_ResampGeneric ( MultiCOMPLEX8TimeSeries **mul
 int XLALGetFstatTiming_ResampGeneric ( const void *method_data, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
 
 static int XLALComputeFstatResampGeneric ( FstatResults* Fstats, const FstatCommon *common, void *method_data );
-static int XLALApplySpindownAndFreqShiftGeneric ( COMPLEX8 *xOut, const COMPLEX8TimeSeries *xIn, const PulsarDopplerParams *doppler, REAL8 freqShift );
+static int XLALApplySpindownAndFreqShiftGeneric ( COMPLEX8 *xOut_a, COMPLEX8 *xOut_b, const COMPLEX8TimeSeries *xIn_a, const COMPLEX8TimeSeries *xIn_b, const PulsarDopplerParams *doppler, REAL8 freqShift );
 static int XLALBarycentricResampleMultiCOMPLEX8TimeSeriesGeneric ( ResampGenericMethodData *resamp, const PulsarDopplerParams *thisPoint, const FstatCommon *common );
 static int XLALComputeFaFb_ResampGeneric ( ResampGenericMethodData *resamp, ResampGenericWorkspace *ws, const PulsarDopplerParams thisPoint, REAL8 dFreq, UINT4 numFreqBins, const COMPLEX8TimeSeries *TimeSeries_SRC_a, const COMPLEX8TimeSeries *TimeSeries_SRC_b );
 static void XLALGetFFTPlanHints ( int * planMode, double * planGenTimeoutSeconds );
@@ -146,6 +147,7 @@ static void XLALDestroyResampGenericMethodData ( void* method_data )
   ResampGenericMethodData *resamp = (ResampGenericMethodData*) method_data;
 
   XLALDestroyMultiCOMPLEX8TimeSeries (resamp->multiTimeSeries_DET );
+  XLALDestroySincInterpolationLUT ( resamp->sincLUT );
 
   // ----- free buffer
   XLALDestroyMultiCOMPLEX8TimeSeries ( resamp->multiTimeSeries_SRC_a );
@@ -182,6 +184,9 @@ XLALSetupFstatResampGeneric ( void **method_data,
   XLAL_CHECK( resamp != NULL, XLAL_ENOMEM );
 
   resamp->Dterms = optArgs->Dterms;
+  if ( optArgs->resampSincPhases > 0 ) {
+    XLAL_CHECK ( (resamp->sincLUT = XLALCreateSincInterpolationLUT ( optArgs->Dterms, optArgs->resampSincPhases )) != NULL, XLAL_EFUNC );
+  }
 
   // Set method function pointers
   funcs->compute_func = XLALComputeFstatResampGeneric;
@@ -322,6 +327,8 @@ XLALSetupFstatResampGeneric ( void **method_data,
   static int tried_wisdom = 0;
 
   LAL_FFTW_WISDOM_LOCK;
+  // import LAL's persistent wisdom cache, if enabled by LAL_FFTW_WISDOM_DIR
+  XLALFFTWImportWisdomCache();
   // if FFTWF_WISDOM_FILENAME is set, try to import that wisdom
   wisdom_filename = getenv("FFTWF_WISDOM_FILENAME");
   if (wisdom_filename && !tried_wisdom) {
@@ -339,8 +346,12 @@ XLALSetupFstatResampGeneric ( void **method_data,
   }
   XLALGetFFTPlanHints (& fft_plan_flags , & fft_plan_timeout);
   fftw_set_timelimit( fft_plan_timeout );
-  XLAL_CHECK ( (resamp->fftplan = fftwf_plan_dft_1d ( resamp->numSamplesFFT, ws->TS_FFT, ws->FabX_Raw, FFTW_FORWARD, fft_plan_flags )) != NULL, XLAL_EFAILED, "fftwf_plan_dft_1d() failed\n");
+  XLALFFTWPlanWithNThreads ( optArgs->resampFFTThreads );
+  resamp->fftplan = fftwf_plan_dft_1d ( resamp->numSamplesFFT, ws->TS_FFT, ws->FabX_Raw, FFTW_FORWARD, fft_plan_flags );
+  // reset to a single thread, so that other FFTW planners do not inherit the Resamp thread count
+  XLALFFTWPlanWithNThreads ( 1 );
   LAL_FFTW_WISDOM_UNLOCK;
+  XLAL_CHECK ( resamp->fftplan != NULL, XLAL_EFAILED, "fftwf_plan_dft_1d() failed\n");
 
   // turn on timing collection if requested
   resamp->collectTiming = optArgs->collectTiming;
@@ -673,10 +684,13 @@ XLALComputeFaFb_ResampGeneric ( ResampGenericMethodData *resamp,				//!< [in,out
   if ( collectTiming ) {
     tic = XLALGetCPUTime();
   }
-  memset ( ws->TS_FFT, 0, resamp->numSamplesFFT * sizeof(ws->TS_FFT[0]) );
-  // ----- compute FaX_k
-  // apply spindown phase-factors, store result in zero-padded timeseries for 'FFT'ing
-  XLAL_CHECK ( XLALApplySpindownAndFreqShiftGeneric ( ws->TS_FFT, TimeSeries_SRC_a, &thisPoint, freqShift ) == XLAL_SUCCESS, XLAL_EFUNC );
+  UINT4 numSamples_SRC = TimeSeries_SRC_a->data->length;
+  XLAL_CHECK ( TimeSeries_SRC_b->data->length == numSamples_SRC, XLAL_EINVAL );
+  XLAL_CHECK ( ws->TStmp1_SRC->length >= numSamples_SRC, XLAL_EINVAL );
+  memset ( ws->TS_FFT + numSamples_SRC, 0, (resamp->numSamplesFFT - numSamples_SRC) * sizeof(ws->TS_FFT[0]) );
+  // ----- apply spindown phase-factors to both a- and b-timeseries in one pass:
+  // store Fa(t) in zero-padded timeseries for 'FFT'ing, and keep Fb(t) in temporary timeseries until needed
+  XLAL_CHECK ( XLALApplySpindownAndFreqShiftGeneric ( ws->TS_FFT, ws->TStmp1_SRC->data, TimeSeries_SRC_a, TimeSeries_SRC_b, &thisPoint, freqShift ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   if ( collectTiming ) {
     toc = XLALGetCPUTime();
@@ -704,16 +718,16 @@ XLALComputeFaFb_ResampGeneric ( ResampGenericMethodData *resamp,				//!< [in,out
   }
 
   // ----- compute FbX_k
-  // apply spindown phase-factors, store result in zero-padded timeseries for 'FFT'ing
-  XLAL_CHECK ( XLALApplySpindownAndFreqShiftGeneric ( ws->TS_FFT, TimeSeries_SRC_b, &thisPoint, freqShift ) == XLAL_SUCCESS, XLAL_EFUNC );
+  // copy spindown-corrected Fb(t) into zero-padded timeseries for 'FFT'ing
+  memcpy ( ws->TS_FFT, ws->TStmp1_SRC->data, numSamples_SRC * sizeof(ws->TS_FFT[0]) );
 
   if ( collectTiming ) {
     toc = XLALGetCPUTime();
-    tiRS->Tau.Spin += ( toc - tic);
+    tiRS->Tau.Copy += ( toc - tic);
     tic = toc;
   }
 
-  // Fourier transform the resampled Fa(t)
+  // Fourier transform the resampled Fb(t)
   fftwf_execute_dft ( resamp->fftplan, ws->TS_FFT, ws->FabX_Raw );
 
   if ( collectTiming ) {
@@ -756,15 +770,18 @@ XLALComputeFaFb_ResampGeneric ( ResampGenericMethodData *resamp,				//!< [in,out
 } // XLALComputeFaFb_ResampGeneric()
 
 static int
-XLALApplySpindownAndFreqShiftGeneric ( COMPLEX8 *restrict xOut,      			///< [out] the spindown-corrected SRC-frame timeseries
-                                       const COMPLEX8TimeSeries *restrict xIn,		///< [in] the input SRC-frame timeseries
+XLALApplySpindownAndFreqShiftGeneric ( COMPLEX8 *restrict xOut_a,      			///< [out] the spindown-corrected SRC-frame timeseries * a(t)
+                                       COMPLEX8 *restrict xOut_b,      			///< [out] the spindown-corrected SRC-frame timeseries * b(t)
+                                       const COMPLEX8TimeSeries *restrict xIn_a,	///< [in] the input SRC-frame timeseries * a(t)
+                                       const COMPLEX8TimeSeries *restrict xIn_b,	///< [in] the input SRC-frame timeseries * b(t)
                                        const PulsarDopplerParams *restrict doppler,	///< [in] containing spindown parameters
                                        REAL8 freqShift					///< [in] frequency-shift to apply, sign is "new - old"
                                        )
 {
   // input sanity checks
-  XLAL_CHECK ( xOut != NULL, XLAL_EINVAL );
-  XLAL_CHECK ( xIn != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( xOut_a != NULL && xOut_b != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( xIn_a != NULL && xIn_b != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( xIn_a->data->length == xIn_b->data->length, XLAL_EINVAL );
   XLAL_CHECK ( doppler != NULL, XLAL_EINVAL );
 
   // determine number of spin downs to include
@@ -773,13 +790,13 @@ XLALApplySpindownAndFreqShiftGeneric ( COMPLEX8 *restrict xOut,      			///< [ou
     s_max --;
   }
 
-  REAL8 dt = xIn->deltaT;
-  UINT4 numSamplesIn  = xIn->data->length;
+  REAL8 dt = xIn_a->deltaT;
+  UINT4 numSamplesIn  = xIn_a->data->length;
 
-  LIGOTimeGPS epoch = xIn->epoch;
+  LIGOTimeGPS epoch = xIn_a->epoch;
   REAL8 Dtau0 = GPSDIFF ( epoch, doppler->refTime );
 
-  // loop over time samples
+  // loop over time samples: the phase-factor is computed once and applied to both timeseries
   for ( UINT4 j = 0; j < numSamplesIn; j ++ )
     {
       REAL8 taup_j = j * dt;
@@ -799,7 +816,8 @@ XLALApplySpindownAndFreqShiftGeneric ( COMPLEX8 *restrict xOut,      			///< [ou
       COMPLEX8 em2piphase = crectf ( cosphase, sinphase );
 
       // weight the complex timeseries by the antenna patterns
-      xOut[j] = em2piphase * xIn->data->data[j];
+      xOut_a[j] = em2piphase * xIn_a->data->data[j];
+      xOut_b[j] = em2piphase * xIn_b->data->data[j];
 
     } // for j < numSamplesIn
 
@@ -1008,7 +1026,11 @@ XLALBarycentricResampleMultiCOMPLEX8TimeSeriesGeneric ( ResampGenericMethodData
       XLAL_CHECK ( ti_DET->length >= TimeSeries_SRCX_a->data->length, XLAL_EINVAL );
       UINT4 bak_length = ti_DET->length;
       ti_DET->length = TimeSeries_SRCX_a->data->length;
-      XLAL_CHECK ( XLALSincInterpolateCOMPLEX8TimeSeries ( TimeSeries_SRCX_a->data, ti_DET, TimeSeries_DETX, resamp->Dterms ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( resamp->sincLUT != NULL ) {
+        XLAL_CHECK ( XLALSincInterpolateCOMPLEX8TimeSeriesLUT ( TimeSeries_SRCX_a->data, ti_DET, TimeSeries_DETX, resamp->sincLUT ) == XLAL_SUCCESS, XLAL_EFUNC );
+      } else {
+        XLAL_CHECK ( XLALSincInterpolateCOMPLEX8TimeSeries ( TimeSeries_SRCX_a->data, ti_DET, TimeSeries_DETX, resamp->Dterms ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
       ti_DET->length = bak_length;
 
       // apply heterodyne correction and AM-functions a(t) and b(t) to interpolated timeseries
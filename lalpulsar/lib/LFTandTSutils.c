@@ -45,10 +45,24 @@
 #define OOTWOPI         (1.0 / LAL_TWOPI)      // 1/2pi
 #define OOPI         (1.0 / LAL_PI)      // 1/pi
 #define LD_SMALL4       (2.0e-4)                // "small" number for REAL4: taken from Demod()
+#define SINC_NUM_LANES  16                      // number of independent REAL4 accumulator lanes in sinc-interpolation
+#define SINC_PADDED_LENGTH(n) ( ( ((n) + SINC_NUM_LANES/2 - 1) / (SINC_NUM_LANES/2) ) * (SINC_NUM_LANES/2) )	// kernel length padded to whole blocks of lanes
+
+/*---------- internal types ----------*/
+
+/** Polyphase table of windowed-sinc interpolation kernel weights, see XLALCreateSincInterpolationLUT() */
+struct tagSincInterpolationLUT
+{
+  UINT4 Dterms;		///< window sinc kernel sum to +-Dterms around max
+  UINT4 numPhases;	///< number of fractional-offset steps tabulated per input sample
+  REAL4 *weights;	///< (numPhases+1) rows of (2*Dterms+1) kernel weights [zero-padded to whole blocks], at offsets delta = -1/2 + p/numPhases from the closest sample
+};
+
 /*---------- Global variables ----------*/
 static LALUnit emptyLALUnit;
 
 /* ---------- local prototypes ---------- */
+static int SincInterpolateCOMPLEX8TimeSeries ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, UINT4 Dterms, const SincInterpolationLUT *lut );
 
 /*---------- empty initializers ---------- */
 
@@ -893,6 +907,12 @@ XLALCheckVectorComparisonTolerances ( const VectorComparison *result,	///< [in]
  * and a transition bandwidth of (4/L) * Bandwidth.
  * You need to make sure to include sufficient effective sidebands to the input timeseries, so that the transition band can
  * be safely ignored or 'cut out' at the end
+ *
+ * NOTE4: the kernel weights of each output sample are first computed into a contiguous single-precision array,
+ * with the alternating sign of the sin-term folded into the window, and then summed against the interleaved
+ * (re,im) input samples in independent lanes. Both loops are free of gathers and loop-carried dependencies,
+ * and are therefore vectorised by the compiler. See XLALSincInterpolateCOMPLEX8TimeSeriesLUT() for a variant
+ * using a precomputed polyphase table of kernel weights instead.
  */
 int
 XLALSincInterpolateCOMPLEX8TimeSeries ( COMPLEX8Vector *y_out,		///< [out] output series of interpolated y-values [must be same size as t_out]
@@ -900,6 +920,156 @@ XLALSincInterpolateCOMPLEX8TimeSeries ( COMPLEX8Vector *y_out,		///< [out] outpu
                                         const COMPLEX8TimeSeries *ts_in,///< [in] regularly-spaced input timeseries
                                         UINT4 Dterms			///< [in] window sinc kernel sum to +-Dterms around max
                                         )
+{
+  XLAL_CHECK ( SincInterpolateCOMPLEX8TimeSeries ( y_out, t_out, ts_in, Dterms, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+} // XLALSincInterpolateCOMPLEX8TimeSeries()
+
+/**
+ * Create a polyphase table of the windowed-sinc kernel used by XLALSincInterpolateCOMPLEX8TimeSeries(), for use with
+ * XLALSincInterpolateCOMPLEX8TimeSeriesLUT().
+ *
+ * The (2*Dterms+1) kernel weights are tabulated at numPhases+1 equally-spaced fractional offsets \f$\delta\in[-1/2,1/2]\f$
+ * from the closest input sample, and linearly interpolated between them. The maximal error on the weights is
+ * approximately \f$\pi^2/(24\,\mathrm{numPhases}^2)\f$, i.e. about 4e-7 for numPhases=1024, which is below REAL4 precision.
+ */
+SincInterpolationLUT *
+XLALCreateSincInterpolationLUT ( UINT4 Dterms,		///< [in] window sinc kernel sum to +-Dterms around max
+                                 UINT4 numPhases	///< [in] number of fractional-offset steps to tabulate per input sample
+                                 )
+{
+  XLAL_CHECK_NULL ( numPhases > 0, XLAL_EINVAL );
+
+  SincInterpolationLUT *lut = NULL, *retn = NULL;
+  const REAL8Window *win = NULL;
+
+  XLAL_CHECK_FAIL ( (lut = XLALCalloc ( 1, sizeof(*lut) )) != NULL, XLAL_ENOMEM );
+  lut->Dterms = Dterms;
+  lut->numPhases = numPhases;
+
+  const UINT4 winLen = 2 * Dterms + 1;
+  const UINT4 winLenPad = SINC_PADDED_LENGTH ( winLen );
+  XLAL_CHECK_FAIL ( (lut->weights = XLALCalloc ( (numPhases + 1) * winLenPad, sizeof(lut->weights[0]) )) != NULL, XLAL_ENOMEM );
+
+  XLAL_CHECK_FAIL ( (win = XLALAcquireNamedREAL8Window ( "hamming", 0, winLen )) != NULL, XLAL_EFUNC );
+
+  for ( UINT4 p = 0; p <= numPhases; p ++ )
+    {
+      REAL8 delta = -0.5 + (REAL8)p / numPhases;
+      for ( UINT4 k = 0; k < winLen; k ++ )
+        {
+          REAL8 delta_k = delta + Dterms - (REAL8)k;
+          REAL8 sinc_k = ( delta_k == 0 ) ? 1 : sin ( LAL_PI * delta_k ) / ( LAL_PI * delta_k );
+          lut->weights[p * winLenPad + k] = win->data->data[k] * sinc_k;
+        }
+    } // for p <= numPhases
+
+  retn = lut;
+  lut = NULL;
+
+XLAL_FAIL:
+  XLALReleaseREAL8Window ( win );
+  XLALDestroySincInterpolationLUT ( lut );
+
+  return retn;
+
+} // XLALCreateSincInterpolationLUT()
+
+/// Destroy a polyphase table created by XLALCreateSincInterpolationLUT()
+void
+XLALDestroySincInterpolationLUT ( SincInterpolationLUT *lut )
+{
+  if ( lut == NULL ) {
+    return;
+  }
+  XLALFree ( lut->weights );
+  XLALFree ( lut );
+  return;
+} // XLALDestroySincInterpolationLUT()
+
+/**
+ * Variant of XLALSincInterpolateCOMPLEX8TimeSeries() which takes the kernel weights from a polyphase table
+ * created by XLALCreateSincInterpolationLUT(), instead of computing them for every output sample.
+ */
+int
+XLALSincInterpolateCOMPLEX8TimeSeriesLUT ( COMPLEX8Vector *y_out,		///< [out] output series of interpolated y-values [must be same size as t_out]
+                                           const REAL8Vector *t_out,		///< [in] output time-steps to interpolate input to
+                                           const COMPLEX8TimeSeries *ts_in,	///< [in] regularly-spaced input timeseries
+                                           const SincInterpolationLUT *lut	///< [in] polyphase table of kernel weights
+                                           )
+{
+  XLAL_CHECK ( lut != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( SincInterpolateCOMPLEX8TimeSeries ( y_out, t_out, ts_in, lut->Dterms, lut ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+} // XLALSincInterpolateCOMPLEX8TimeSeriesLUT()
+
+//
+// The following kernels work on blocks of SINC_NUM_LANES/2 complex terms with fixed trip counts and
+// non-aliasing arguments, so that they are vectorised by the compiler at the default optimisation level.
+//
+
+/// Compute the kernel weights 'sin(pi*delta) * winsgn_k / (delta + offset_k)', duplicated for interleaved (re,im) samples
+static inline void
+SincKernelWeights ( REAL4 *restrict weights2, const REAL4 *restrict winsgn, const REAL4 *restrict offset, REAL4 sin0, REAL4 delta, UINT4 numBlocks )
+{
+  for ( UINT4 b = 0; b < numBlocks; b ++ )
+    {
+      for ( UINT4 m = 0; m < SINC_NUM_LANES/2; m ++ )
+        {
+          const REAL4 Ck = winsgn[m] * sin0 / ( delta + offset[m] );
+          weights2[2*m] = Ck;
+          weights2[2*m+1] = Ck;
+        }
+      weights2 += SINC_NUM_LANES;
+      winsgn += SINC_NUM_LANES/2;
+      offset += SINC_NUM_LANES/2;
+    }
+} // SincKernelWeights()
+
+/// Linearly interpolate the kernel weights between two rows of a polyphase table, duplicated for interleaved (re,im) samples
+static inline void
+SincKernelWeightsLUT ( REAL4 *restrict weights2, const REAL4 *restrict w0, const REAL4 *restrict w1, REAL4 frac, UINT4 numBlocks )
+{
+  for ( UINT4 b = 0; b < numBlocks; b ++ )
+    {
+      for ( UINT4 m = 0; m < SINC_NUM_LANES/2; m ++ )
+        {
+          const REAL4 Ck = w0[m] + frac * ( w1[m] - w0[m] );
+          weights2[2*m] = Ck;
+          weights2[2*m+1] = Ck;
+        }
+      weights2 += SINC_NUM_LANES;
+      w0 += SINC_NUM_LANES/2;
+      w1 += SINC_NUM_LANES/2;
+    }
+} // SincKernelWeightsLUT()
+
+/// Sum the kernel weights against contiguous interleaved (re,im) input samples, in independent lanes
+static inline COMPLEX8
+SincKernelSum ( const REAL4 *restrict weights2, const REAL4 *restrict x, UINT4 numBlocks )
+{
+  REAL4 acc[SINC_NUM_LANES] = { 0 };
+  for ( UINT4 b = 0; b < numBlocks; b ++ )
+    {
+      for ( UINT4 m = 0; m < SINC_NUM_LANES; m ++ )
+        {
+          acc[m] += weights2[m] * x[m];
+        }
+      weights2 += SINC_NUM_LANES;
+      x += SINC_NUM_LANES;
+    }
+  REAL4 re = 0, im = 0;
+  for ( UINT4 m = 0; m < SINC_NUM_LANES; m += 2 )
+    {
+      re += acc[m];
+      im += acc[m+1];
+    }
+  return crectf ( re, im );
+} // SincKernelSum()
+
+/// Common implementation of XLALSincInterpolateCOMPLEX8TimeSeries() and XLALSincInterpolateCOMPLEX8TimeSeriesLUT()
+static int
+SincInterpolateCOMPLEX8TimeSeries ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, UINT4 Dterms, const SincInterpolationLUT *lut )
 {
   XLAL_CHECK ( y_out != NULL, XLAL_EINVAL );
   XLAL_CHECK ( t_out != NULL, XLAL_EINVAL );
@@ -911,11 +1081,34 @@ XLALSincInterpolateCOMPLEX8TimeSeries ( COMPLEX8Vector *y_out,		///< [out] outpu
   REAL8 dt = ts_in->deltaT;
   REAL8 tmin = XLALGPSGetREAL8 ( &(ts_in->epoch) );	// time of first bin in input timeseries
 
-  REAL8Window *win;
-  UINT4 winLen = 2 * Dterms + 1;
-  XLAL_CHECK ( (win = XLALCreateHammingREAL8Window ( winLen )) != NULL, XLAL_EFUNC );
+  // kernel terms k correspond to input samples j = jStart0 + k; they are padded with zero weights to whole blocks
+  const UINT4 winLen = 2 * Dterms + 1;
+  const UINT4 winLenPad = SINC_PADDED_LENGTH ( winLen );
+  const UINT4 numBlocks = winLenPad / ( SINC_NUM_LANES/2 );
+
+  int retn = XLAL_FAILURE;
+
+  // per-sample kernel weights, duplicated for the interleaved (re,im) input samples
+  REAL4 *weights2 = NULL;
+  // window (-1)^(Dterms-k) * w_k / pi, with the alternating sign of the sin-term folded in, and offsets (Dterms - k) of the kernel terms
+  REAL4 *winsgn = NULL, *offset = NULL;
+  const REAL8Window *win = NULL;
+
+  XLAL_CHECK_FAIL ( (weights2 = XLALMalloc ( 2 * winLenPad * sizeof(weights2[0]) )) != NULL, XLAL_ENOMEM );
+  if ( lut == NULL )
+    {
+      XLAL_CHECK_FAIL ( (win = XLALAcquireNamedREAL8Window ( "hamming", 0, winLen )) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_FAIL ( (winsgn = XLALMalloc ( winLenPad * sizeof(winsgn[0]) )) != NULL, XLAL_ENOMEM );
+      XLAL_CHECK_FAIL ( (offset = XLALMalloc ( winLenPad * sizeof(offset[0]) )) != NULL, XLAL_ENOMEM );
+      for ( UINT4 k = 0; k < winLenPad; k ++ )
+        {
+          winsgn[k] = ( k < winLen ) ? ( ((Dterms + k) % 2) ? -1 : 1 ) * win->data->data[k] * OOPI : 0;
+          offset[k] = (REAL4)Dterms - (REAL4)k;
+        }
+    }
 
   const REAL8 oodt = 1.0 / dt;
+  const REAL4 *x_in = (const REAL4 *) ts_in->data->data;	// interleaved (re,im) input samples
 
   for ( UINT4 l = 0; l < numSamplesOut; l ++ )
     {
@@ -937,37 +1130,56 @@ XLALSincInterpolateCOMPLEX8TimeSeries ( COMPLEX8Vector *y_out,		///< [out] outpu
           continue;
         }
 
-      INT4 jStart0 = jstar - Dterms;
-      UINT4 jEnd0 = jstar + Dterms;
-      UINT4 jStart = MYMAX ( jStart0, 0 );
-      UINT4 jEnd   = MYMIN ( jEnd0, numSamplesIn - 1 );
-
-      REAL4 delta_jStart = (t_by_dt - jStart);
-      REAL4 sin0, cos0;
-      XLALSinCosLUT ( &sin0, &cos0, LAL_PI * delta_jStart );
-      REAL4 sin0oopi = sin0 * OOPI;
+      INT8 jStart0 = jstar - Dterms;
+      REAL4 delta = (REAL4)( t_by_dt - jstar );	// in [-1/2, 1/2]
 
-      COMPLEX8 y_l = 0;
-      REAL8 delta_j = delta_jStart;
-      for ( UINT8 j = jStart; j <= jEnd; j ++ )
+      // ----- compute kernel weights
+      if ( lut == NULL )
         {
-          COMPLEX8 Cj = win->data->data[j - jStart0] * sin0oopi / delta_j;
-
-          y_l += Cj * ts_in->data->data[j];
-
-          sin0oopi = -sin0oopi;		// sin-term flips sign every step
-          delta_j --;
-        } // for j in [j* - Dterms, ... ,j* + Dterms]
+          REAL4 sin0, cos0;
+          XLALSinCosLUT ( &sin0, &cos0, LAL_PI * delta );
+          SincKernelWeights ( weights2, winsgn, offset, sin0, delta, numBlocks );
+        }
+      else
+        {
+          REAL4 phase = ( delta + 0.5f ) * lut->numPhases;
+          UINT4 p = MYMIN ( (UINT4) phase, lut->numPhases - 1 );
+          REAL4 frac = phase - p;
+          const REAL4 *w0 = lut->weights + p * winLenPad;
+          const REAL4 *w1 = w0 + winLenPad;
+          SincKernelWeightsLUT ( weights2, w0, w1, frac, numBlocks );
+        }
 
-      y_out->data[l] = y_l;
+      // ----- sum over kernel terms: whole blocks if they fit inside the input timeseries, otherwise truncated
+      if ( ( jStart0 >= 0 ) && ( jStart0 + winLenPad <= numSamplesIn ) )
+        {
+          y_out->data[l] = SincKernelSum ( weights2, x_in + 2 * jStart0, numBlocks );
+        }
+      else
+        {
+          UINT4 kStart = ( jStart0 < 0 ) ? (UINT4)( - jStart0 ) : 0;
+          UINT4 kEnd   = MYMIN ( winLen - 1, (UINT4)( numSamplesIn - 1 - jStart0 ) );
+          COMPLEX8 y_l = 0;
+          for ( UINT4 k = kStart; k <= kEnd; k ++ )
+            {
+              y_l += weights2[2*k] * ts_in->data->data[jStart0 + k];
+            }
+          y_out->data[l] = y_l;
+        }
 
     } // for l < numSamplesOut
 
-  XLALDestroyREAL8Window ( win );
+  retn = XLAL_SUCCESS;
 
-  return XLAL_SUCCESS;
+XLAL_FAIL:
+  XLALFree ( weights2 );
+  XLALFree ( winsgn );
+  XLALFree ( offset );
+  XLALReleaseREAL8Window ( win );
 
-} // XLALSincInterpolateCOMPLEX8TimeSeries()
+  return retn;
+
+} // SincInterpolateCOMPLEX8TimeSeries()
 
 /** Interpolate a given regularly-spaced COMPLEX8 frequency-series 'fs_in = x_in( k * df)' onto new samples
  *  'y_out(f_out)' using (complex) Sinc interpolation (obtained from Dirichlet kernel in large-N limit), truncated to (2*Dterms+1) terms, namely
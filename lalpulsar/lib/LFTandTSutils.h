@@ -68,6 +68,9 @@ typedef struct tagVectorComparison
   REAL4 relErr_atMaxAbsy;	///< single-sample relative error *at* maximum |sample-value| of second vector 'x'
 } VectorComparison;
 
+/** Opaque polyphase table of windowed-sinc interpolation kernel weights, see XLALCreateSincInterpolationLUT() */
+typedef struct tagSincInterpolationLUT SincInterpolationLUT;
+
 /*---------- exported Global variables ----------*/
 
 /*---------- exported prototypes [API] ----------*/
@@ -93,6 +96,9 @@ int XLALCopyCOMPLEX8TimeSeries ( COMPLEX8TimeSeries *ts_out, COMPLEX8TimeSeries
 void XLALDestroyMultiCOMPLEX8TimeSeries ( MultiCOMPLEX8TimeSeries *multiTimes );
 
 int XLALSincInterpolateCOMPLEX8TimeSeries ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, UINT4 Dterms );
+SincInterpolationLUT *XLALCreateSincInterpolationLUT ( UINT4 Dterms, UINT4 numPhases );
+void XLALDestroySincInterpolationLUT ( SincInterpolationLUT *lut );
+int XLALSincInterpolateCOMPLEX8TimeSeriesLUT ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, const SincInterpolationLUT *lut );
 int XLALSincInterpolateCOMPLEX8FrequencySeries ( COMPLEX8Vector *y_out, const REAL8Vector *f_out, const COMPLEX8FrequencySeries *fs_in, UINT4 Dterms );
 SFTtype *XLALSincInterpolateSFT ( const SFTtype *sft_in, REAL8 f0Out, REAL8 dfOut, UINT4 numBinsOut, UINT4 Dterms );
 
@@ -188,21 +188,38 @@ XLALNormalizeMultiSFTVect ( MultiSFTVector *multsft,		/**< [in/out] multi-vector
       multiPSD->data[X]->length = numsft;
       XLAL_CHECK_NULL ( (multiPSD->data[X]->data = XLALCalloc ( numsft, sizeof(*(multiPSD->data[X]->data)))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numsft, sizeof(*(multiPSD->data[X]->data)) );
 
-      /* loop over sfts for this IFO X */
+      /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
+      const REAL8 assumeSqrtS = (assumeSqrtSX != NULL) ? assumeSqrtSX->sqrtSn[X] : 0.0;
+
+      /* loop over sfts for this IFO X; SFTs are normalized independently, so in parallel */
+      int errnum = 0;
+#pragma omp parallel for schedule(dynamic)
       for ( UINT4 j = 0; j < numsft; j++ )
         {
+#pragma omp flush(errnum)
+          if ( errnum != 0 ) {
+            continue;
+          }
+
           SFTtype *sft = &multsft->data[X]->data[j];
 
           /* memory allocation of psd vector for this SFT */
           UINT4 lengthsft = sft->data->length;
-          XLAL_CHECK_NULL ( (multiPSD->data[X]->data[j].data = XLALCreateREAL8Vector ( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed.", lengthsft );
-
-          /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
-          const REAL8 assumeSqrtS = (assumeSqrtSX != NULL) ? assumeSqrtSX->sqrtSn[X] : 0.0;
-
-          XLAL_CHECK_NULL( XLALNormalizeSFT ( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed");
+          if ( (multiPSD->data[X]->data[j].data = XLALCreateREAL8Vector ( lengthsft ) ) == NULL )
+            {
+              errnum = XLAL_EFUNC;
+#pragma omp flush(errnum)
+              continue;
+            }
+
+          if ( XLALNormalizeSFT ( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS ) != XLAL_SUCCESS )
+            {
+              errnum = XLAL_EFUNC;
+#pragma omp flush(errnum)
+            }
 
         } /* for j < numsft */
+      XLAL_CHECK_NULL ( errnum == 0, errnum, "XLALNormalizeSFT() failed for detector %d", X );
 
     } /* for X < numifo */
 
@@ -334,8 +351,6 @@ XLALPeriodoToRngmed ( REAL8FrequencySeries  *rngmed,		/**< [out] resulting 'smoo
 
   UINT4 blocks2 = blockSize/2; /* integer division, round down */
 
-  LALRunningMedianPar rngMedPar;
-  rngMedPar.blocksize = blockSize;
   REAL8Sequence mediansV, inputV;
   inputV.length = length;
   inputV.data = periodo->data->data;
@@ -343,9 +358,7 @@ XLALPeriodoToRngmed ( REAL8FrequencySeries  *rngmed,		/**< [out] resulting 'smoo
   mediansV.length = medianVLength;
   mediansV.data = rngmed->data->data + blocks2;
 
-  LALStatus XLAL_INIT_DECL(status);
-  LALDRunningMedian2 ( &status, &mediansV, &inputV, rngMedPar);
-  XLAL_CHECK ( status.statusCode == 0, XLAL_EFAILED, "LALDRunningMedian2() failed with statusCode = %d", status.statusCode );
+  XLAL_CHECK ( XLALRunningMedianREAL8 ( &mediansV, &inputV, blockSize ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   /* copy values in the wings */
   for ( UINT4 j=0; j<blocks2; j++)
@@ -36,6 +36,8 @@
  */
 
 /*---------- INCLUDES ----------*/
+#include <config.h>
+
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <errno.h>
@@ -47,6 +49,15 @@
 #include <dirent.h>
 #else
 #include <io.h>
+#define realpath(N,R) _fullpath((R),(N),0)
+#endif
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
 #endif
 
 #include <lal/LALStdio.h>
@@ -58,6 +69,10 @@
 #include <lal/ConfigFile.h>
 #include <lal/UserInputParse.h>
 #include <lal/SFTutils.h>
+#include <lal/LALHashTbl.h>
+#include <lal/LALHashFunc.h>
+
+#include "SFTfileIO_CRC64.i"
 
 /*---------- DEFINES ----------*/
 
@@ -95,6 +110,54 @@ struct tagSFTLocator
   UINT4 isft;           /* index of SFT this locator belongs to, used only in XLALLoadSFTs() */
 };
 
+struct tagSFTFileMap
+{
+  SFTCatalog *blocks;	/* headers of all SFT-blocks in the file, in file order */
+  CHAR *base;		/* contents of the file in memory */
+  size_t size;		/* size of the file contents */
+  COMPLEX8 **data;	/* data of each SFT-block, pointing into the file contents */
+};
+
+/* entry of the persistent SFT index: the headers of all SFT-blocks in one file */
+typedef struct
+{
+  CHAR *fname;		/* canonical path of the file, as returned by realpath() */
+  INT8 stamp[5];	/* device, inode, size, modification and status-change time of the file */
+  SFTCatalog *blocks;	/* headers of all SFT-blocks in the file, in file order */
+  BOOLEAN *crc_valid;	/* whether the CRC64 checksum of each SFT-block has been validated */
+  BOOLEAN checked;	/* whether the stamp has been checked against the file since loading */
+} SFTIndexEntry;
+
+typedef struct
+{
+  CHAR *fname;		/* name of the index file */
+  UINT4 length;		/* number of entries */
+  UINT4 maxLength;	/* number of allocated entries */
+  SFTIndexEntry **data;	/* entries, in the order they were added */
+  LALHashTbl *ht;	/* entries, hashed by filename */
+  BOOLEAN modified;	/* whether entries were added or updated since loading */
+} SFTIndex;
+
+/* fixed-size record of an SFT-block header in the index file; followed by the comment, if any */
+typedef struct
+{
+  INT8 offset;
+  INT4 gps_sec;
+  INT4 gps_nsec;
+  REAL8 f0;
+  REAL8 deltaF;
+  UINT8 crc64;
+  UINT4 numBins;
+  UINT4 version;
+  UINT4 comment_length;
+  CHAR detector[2];
+  CHAR crc_valid;
+  CHAR padding;
+} _SFT_index_record_t;
+
+static const CHAR SFT_INDEX_MAGIC[8] = { 'L', 'A', 'L', 'S', 'F', 'T', 'I', 'X' };
+#define SFT_INDEX_VERSION 1
+
 typedef struct
 {
   REAL8 version;
@@ -187,13 +250,28 @@ static int read_v2_header_from_fp ( FILE *fp, SFTtype *header, UINT4 *nsamples,
 
 static int read_SFDB_header_from_fp ( FILE *fp, SFDBHeader *header );
 
+static SFTCatalog *read_SFTcatalog_from_fp ( FILE *fp, const CHAR *fname );
+static SFTCatalog *read_SFTcatalog_from_file ( const CHAR *fname );
+static int copy_SFTDescriptor ( SFTDescriptor *dest, const SFTDescriptor *src );
+static int map_SFT_file_from_fp ( SFTFileMap *map, const CHAR *fname, FILE *fp );
+
+static SFTIndex *load_SFTIndex ( const CHAR *fname );
+static int read_SFTIndex_from_fp ( SFTIndex *index, FILE *fp );
+static int add_to_SFTIndex ( SFTIndex *index, CHAR *fname, const INT8 stamp[5], SFTCatalog *blocks, BOOLEAN *crc_valid );
+static SFTIndexEntry *lookup_SFTIndex ( SFTIndex *index, const CHAR *fname );
+static int save_SFTIndex ( const SFTIndex *index );
+static void clear_SFTIndex ( SFTIndex *index );
+static void destroy_SFTIndex ( SFTIndex *index );
+static UINT8 SFTIndexEntry_hash ( const void *x );
+static int SFTIndexEntry_cmp ( const void *x, const void *y );
+
 int compareSFTdesc(const void *ptr1, const void *ptr2);
 static int compareSFTloc(const void *ptr1, const void *ptr2);
 static int compareDetNameCatalogs ( const void *ptr1, const void *ptr2 );
 static int compareSFTepoch(const void *ptr1, const void *ptr2);
 
 static UINT8 calc_crc64(const CHAR *data, UINT4 length, UINT8 crc);
-static BOOLEAN has_valid_v2_crc64 (FILE *fp );
+static int has_valid_v2_crc64 (FILE *fp );
 
 static int read_SFTversion_from_fp ( UINT4 *version, BOOLEAN *need_swap, FILE *fp );
 REAL8 TSFTfromDFreq ( REAL8 dFreq );
@@ -271,6 +349,15 @@ UINT4 XLALRoundFrequencyUpToSFTBin( const REAL8 freq, const REAL8 df )
  *
  * The returned SFTs in the catalogue are sorted by increasing GPS-epochs !
  *
+ * If the environment variable <tt>LAL_SFT_INDEX_FILENAME</tt> names a file, it is used as a
+ * persistent index of the SFT-block headers of all files matched so far, keyed by their canonical
+ * path: files whose device, inode, size, modification and status-change times are unchanged
+ * since they were indexed are not re-parsed, and newly-parsed files are added to the index on
+ * return. Only the matched files are checked against the index. The index is written to a
+ * temporary file which is then renamed, so it may be shared between concurrent jobs; an
+ * unreadable index is ignored (with a warning) and rebuilt. Entries for files which no longer
+ * exist are dropped from the index when it is next rewritten.
+ *
  */
 SFTCatalog *
 XLALSFTdataFind ( const CHAR *file_pattern,		/**< which SFT-files */
@@ -297,191 +384,129 @@ XLALSFTdataFind ( const CHAR *file_pattern,		/**< which SFT-files */
   XLAL_CHECK_NULL ( (fnames = XLALFindFiles (file_pattern)) != NULL, XLAL_EFUNC, "Failed to find filelist matching pattern '%s'.\n\n", file_pattern );
   UINT4 numFiles = fnames->length;
 
+  /* use a persistent SFT index, if one is named in the environment */
+  SFTIndex *index = NULL;
+  const char *index_fname = getenv ( "LAL_SFT_INDEX_FILENAME" );
+  if ( ( index_fname != NULL ) && ( index_fname[0] != '\0' ) )
+    {
+      if ( (index = load_SFTIndex ( index_fname )) == NULL )
+        {
+          XLALDestroyStringVector ( fnames );
+          XLALDestroySFTCatalog ( ret );
+          XLAL_ERROR_NULL ( XLAL_EFUNC );
+        }
+    }
+
   UINT4 numSFTs = 0;
   /* ----- main loop: parse all matching files */
   for ( UINT4 i = 0; i < numFiles; i ++ )
     {
       const CHAR *fname = fnames->data[i];
 
-      /* merged SFTs need to satisfy stronger consistency-constraints (-> see spec) */
-      BOOLEAN mfirst_block = TRUE;
-      UINT4   mprev_version = 0;
-      SFTtype XLAL_INIT_DECL( mprev_header );
-      REAL8   mprev_nsamples = 0;
-
-      FILE *fp;
-      if ( ( fp = fopen( fname, "rb" ) ) == NULL )
-	{
-          XLALPrintError ("ERROR: Failed to open matched file '%s'\n\n", fname );
-	  XLALDestroyStringVector ( fnames );
-	  XLALDestroySFTCatalog ( ret );
-	  XLAL_ERROR_NULL ( XLAL_EIO );
-	}
-
-      long file_len;
-      if ( (file_len = get_file_len(fp)) == 0 )
-	{
-          XLALPrintError ("ERROR: got file-len == 0 for '%s'\n\n", fname );
-	  XLALDestroyStringVector ( fnames );
-	  XLALDestroySFTCatalog ( ret );
-	  fclose(fp);
-	  XLAL_ERROR_NULL ( XLAL_EIO );
-	}
-
-      /* go through SFT-blocks in fp */
-      while ( ftell(fp) < file_len )
-	{
-	  SFTtype this_header;
-	  UINT4 this_version;
-	  UINT4 this_nsamples;
-	  UINT8 this_crc;
-	  CHAR *this_comment = NULL;
-	  BOOLEAN endian;
-	  BOOLEAN want_this_block = FALSE;
-
-	  long this_filepos;
-	  if ( (this_filepos = ftell(fp)) == -1 )
-	    {
-              XLALPrintError ("ERROR: ftell() failed for '%s'\n\n", fname );
-	      XLALDestroyStringVector ( fnames );
-	      XLALDestroySFTCatalog ( ret );
-	      fclose (fp);
-	      XLAL_ERROR_NULL ( XLAL_EIO );
-	    }
-
-	  if ( read_sft_header_from_fp (fp, &this_header, &this_version, &this_crc, &endian, &this_comment, &this_nsamples ) != 0 )
-	    {
-              XLALPrintError ("ERROR: File-block '%s:%ld' is not a valid SFT!\n\n", fname, ftell(fp));
-	      XLALDestroyStringVector ( fnames );
-	      XLALFree ( this_comment );
-	      XLALDestroySFTCatalog ( ret );
-	      fclose(fp);
-	      XLAL_ERROR_NULL ( XLAL_EDATA );
-	    }
-
-	  /* if merged-SFT: check consistency constraints */
-	  if ( !mfirst_block )
-	    {
-	      if ( ! consistent_mSFT_header ( mprev_header, mprev_version, mprev_nsamples, this_header, this_version, this_nsamples ) )
-		{
-                  XLALPrintError ( "ERROR: merged SFT-file '%s' contains inconsistent SFT-blocks!\n\n", fname);
-		  XLALFree ( this_comment );
-		  XLALDestroyStringVector ( fnames );
-		  XLALDestroySFTCatalog ( ret );
-		  fclose(fp);
-		  XLAL_ERROR_NULL ( XLAL_EDATA );
-		}
-	    } /* if !mfirst_block */
+      /* get the headers of all SFT-blocks in this file, from the index if possible */
+      const SFTCatalog *blocks;
+      SFTCatalog *file_blocks = NULL;
+      if ( index ) {
+        const SFTIndexEntry *entry = lookup_SFTIndex ( index, fname );
+        blocks = entry ? entry->blocks : NULL;
+      } else {
+        blocks = file_blocks = read_SFTcatalog_from_file ( fname );
+      }
+      if ( blocks == NULL )
+        {
+          XLALDestroyStringVector ( fnames );
+          XLALDestroySFTCatalog ( ret );
+          destroy_SFTIndex ( index );
+          XLAL_ERROR_NULL ( XLAL_EFUNC );
+        }
 
-	  mprev_header = this_header;
-	  mprev_version = this_version;
-	  mprev_nsamples = this_nsamples;
+      for ( UINT4 k = 0; k < blocks->length; k ++ )
+        {
+          const SFTDescriptor *block = &(blocks->data[k]);
 
-	  want_this_block = TRUE;	/* default */
-	  /* but does this SFT-block satisfy the user-constraints ? */
-	  if ( constraints )
-	    {
-	      if ( constraints->detector )
-		{
-                  if ( strncmp( constraints->detector, this_header.name, 2) ) {
-		    want_this_block = FALSE;
-                  }
-		}
+          /* does this SFT-block satisfy the user-constraints ? */
+          if ( constraints )
+            {
+              if ( constraints->detector && strncmp( constraints->detector, block->header.name, 2) ) {
+                continue;
+              }
 
-	      if ( XLALCWGPSinRange(this_header.epoch, constraints->minStartTime, constraints->maxStartTime) != 0 ) {
-		want_this_block = FALSE;
+              if ( XLALCWGPSinRange(block->header.epoch, constraints->minStartTime, constraints->maxStartTime) != 0 ) {
+                continue;
               }
 
-	      if ( constraints->timestamps && !timestamp_in_list(this_header.epoch, constraints->timestamps) ) {
-		want_this_block = FALSE;
+              if ( constraints->timestamps && !timestamp_in_list(block->header.epoch, constraints->timestamps) ) {
+                continue;
               }
 
-	    } /* if constraints */
+            } /* if constraints */
 
-	  if ( want_this_block )
-	    {
-	      numSFTs ++;
-
-	      /* do we need to alloc more memory for the SFTs? */
-	      if (  numSFTs > ret->length )
-		{
-		  /* we realloc SFT-memory blockwise in order to
-		   * improve speed in debug-mode (using LALMalloc/LALFree)
-		   */
-                  int len = (ret->length + SFTFILEIO_REALLOC_BLOCKSIZE) * sizeof( *(ret->data) );
-                  if ( (ret->data = LALRealloc ( ret->data, len )) == NULL )
-		    {
-                      XLALPrintError ("ERROR: SFT memory reallocation failed: nSFT:%d, len = %d\n", numSFTs, len );
-		      XLALDestroyStringVector ( fnames );
-		      XLALDestroySFTCatalog ( ret );
-		      XLALFree ( this_comment );
-		      fclose(fp);
-		      XLAL_ERROR_NULL ( XLAL_ENOMEM );
-		    }
-
-		  /* properly initialize data-fields pointers to NULL to avoid SegV when Freeing */
-		  for ( UINT4 j=0; j < SFTFILEIO_REALLOC_BLOCKSIZE; j ++ ) {
-		    memset ( &(ret->data[ret->length + j]), 0, sizeof( ret->data[0] ) );
-                  }
+          numSFTs ++;
 
-		  ret->length += SFTFILEIO_REALLOC_BLOCKSIZE;
-		} // if numSFTs > ret->length
-
-	      SFTDescriptor *desc = &(ret->data[numSFTs - 1]);
+          /* do we need to alloc more memory for the SFTs? */
+          if (  numSFTs > ret->length )
+            {
+              /* we realloc SFT-memory blockwise in order to
+               * improve speed in debug-mode (using LALMalloc/LALFree)
+               */
+              int len = (ret->length + SFTFILEIO_REALLOC_BLOCKSIZE) * sizeof( *(ret->data) );
+              if ( (ret->data = LALRealloc ( ret->data, len )) == NULL )
+                {
+                  XLALPrintError ("ERROR: SFT memory reallocation failed: nSFT:%d, len = %d\n", numSFTs, len );
+                  XLALDestroyStringVector ( fnames );
+                  XLALDestroySFTCatalog ( ret );
+                  XLALDestroySFTCatalog ( file_blocks );
+                  destroy_SFTIndex ( index );
+                  XLAL_ERROR_NULL ( XLAL_ENOMEM );
+                }
 
-	      desc->locator = XLALCalloc ( 1, sizeof ( *(desc->locator) ) );
-	      if ( desc->locator ) {
-		desc->locator->fname = XLALCalloc( 1, strlen(fname) + 1 );
+              /* properly initialize data-fields pointers to NULL to avoid SegV when Freeing */
+              for ( UINT4 j=0; j < SFTFILEIO_REALLOC_BLOCKSIZE; j ++ ) {
+                memset ( &(ret->data[ret->length + j]), 0, sizeof( ret->data[0] ) );
               }
-	      if ( (desc->locator == NULL) || (desc->locator->fname == NULL ) )
-		{
-                  XLALPrintError ("ERROR: XLALCalloc() failed\n" );
-		  XLALDestroyStringVector ( fnames );
-		  XLALDestroySFTCatalog ( ret );
-		  fclose(fp);
-		  XLAL_ERROR_NULL ( XLAL_ENOMEM );
-		}
-	      strcpy ( desc->locator->fname, fname );
-	      desc->locator->offset = this_filepos;
-
-	      desc->header  = this_header;
-	      desc->comment = this_comment;
-	      desc->numBins = this_nsamples;
-	      desc->version = this_version;
-	      desc->crc64   = this_crc;
 
-	    } /* if want_this_block */
-	  else
-	    {
-	      XLALFree ( this_comment );
-	    }
-
-	  mfirst_block = FALSE;
+              ret->length += SFTFILEIO_REALLOC_BLOCKSIZE;
+            } // if numSFTs > ret->length
 
-	  /* skip seeking if we know we would reach the end */
-	  if ( ftell ( fp ) + (long)this_nsamples * 8 >= file_len )
-	    break;
+          if ( copy_SFTDescriptor ( &(ret->data[numSFTs - 1]), block ) != XLAL_SUCCESS )
+            {
+              XLALDestroyStringVector ( fnames );
+              XLALDestroySFTCatalog ( ret );
+              XLALDestroySFTCatalog ( file_blocks );
+              destroy_SFTIndex ( index );
+              XLAL_ERROR_NULL ( XLAL_EFUNC );
+            }
 
-	  /* seek to end of SFT data-entries in file  */
-	  if ( fseek ( fp, this_nsamples * 8 , SEEK_CUR ) == -1 )
-	    {
-              XLALPrintError ("ERROR: Failed to skip DATA field for SFT '%s': %s\n", fname, strerror(errno) );
-	      XLALFree ( this_comment );
-	      XLALDestroyStringVector ( fnames );
-	      XLALDestroySFTCatalog ( ret );
-	      fclose(fp);
-	      XLAL_ERROR_NULL ( XLAL_EIO );
-	    }
+          /* the index holds canonical paths; return the filename as matched */
+          struct tagSFTLocator *locator = ret->data[numSFTs - 1].locator;
+          if ( index && ( strcmp ( locator->fname, fname ) != 0 ) )
+            {
+              XLALFree ( locator->fname );
+              if ( (locator->fname = XLALStringDuplicate ( fname )) == NULL )
+                {
+                  XLALDestroyStringVector ( fnames );
+                  XLALDestroySFTCatalog ( ret );
+                  destroy_SFTIndex ( index );
+                  XLAL_ERROR_NULL ( XLAL_EFUNC );
+                }
+            }
 
-	} /* while !feof */
+        } /* for k < blocks->length */
 
-      fclose(fp);
+      XLALDestroySFTCatalog ( file_blocks );
 
     } /* for i < numFiles */
 
   /* free matched filenames */
   XLALDestroyStringVector ( fnames );
 
+  /* save any newly-parsed files to the index; failure to do so is not fatal */
+  if ( index )
+    {
+      save_SFTIndex ( index );
+      destroy_SFTIndex ( index );
+    }
+
   /* now realloc SFT-vector (alloc'ed blockwise) to its *actual size* */
   int len;
   if ( (ret->data = XLALRealloc ( ret->data, len = numSFTs * sizeof( *(ret->data) ))) == NULL )
@@ -548,6 +573,123 @@ XLALSFTdataFind ( const CHAR *file_pattern,		/**< which SFT-files */
 } /* XLALSFTdataFind() */
 
 
+/**
+ * Map an SFT file into memory, and index the headers of all its SFT-blocks.
+ *
+ * The file is parsed once; frequency bands of its SFT-blocks can then be accessed
+ * with XLALSFTFileMapBandView() without reading or copying any SFT data. Where
+ * <tt>mmap()</tt> is available the file is mapped privately, so only the pages which
+ * are accessed are read from disk, and SFT-blocks which need endian-swapping are
+ * swapped in memory without modifying the file; otherwise the whole file is read
+ * into memory.
+ */
+SFTFileMap *
+XLALCreateSFTFileMap ( const CHAR *fname	/**< name of the SFT file */
+                       )
+{
+  XLAL_CHECK_NULL ( fname != NULL, XLAL_EINVAL );
+
+  FILE *fp;
+  XLAL_CHECK_NULL ( (fp = fopen ( fname, "rb" )) != NULL, XLAL_EIO, "Failed to open SFT file '%s': %s\n", fname, strerror(errno) );
+
+  SFTFileMap *map = XLALCalloc ( 1, sizeof ( *map ) );
+  if ( map == NULL )
+    {
+      fclose ( fp );
+      XLAL_ERROR_NULL ( XLAL_ENOMEM );
+    }
+
+  int retn = map_SFT_file_from_fp ( map, fname, fp );
+  fclose ( fp );
+  if ( retn != XLAL_SUCCESS )
+    {
+      XLALDestroySFTFileMap ( map );
+      XLAL_ERROR_NULL ( XLAL_EFUNC );
+    }
+
+  return map;
+
+} /* XLALCreateSFTFileMap() */
+
+
+/** Unmap an SFT file; any views created by XLALSFTFileMapBandView() become invalid */
+void
+XLALDestroySFTFileMap ( SFTFileMap *map )
+{
+  if ( map == NULL ) {
+    return;
+  }
+
+  if ( map->base != NULL )
+    {
+#ifdef HAVE_SYS_MMAN_H
+      munmap ( map->base, map->size );
+#else
+      XLALFree ( map->base );
+#endif
+    }
+  XLALFree ( map->data );
+  XLALDestroySFTCatalog ( map->blocks );
+  XLALFree ( map );
+
+} /* XLALDestroySFTFileMap() */
+
+
+/**
+ * Return the headers of all SFT-blocks in a mapped SFT file, in file order.
+ * The returned catalog belongs to the map and must not be freed or modified.
+ */
+const SFTCatalog *
+XLALSFTFileMapCatalog ( const SFTFileMap *map )
+{
+  XLAL_CHECK_NULL ( map != NULL, XLAL_EFAULT );
+  return map->blocks;
+} /* XLALSFTFileMapCatalog() */
+
+
+/**
+ * Return a view of the frequency-band <tt>[fMin, fMax)</tt> of an SFT-block in a mapped SFT file.
+ *
+ * The frequency bins are chosen as in XLALLoadSFTs(), and \a fMin (or \a fMax) may be set to \c -1
+ * to start from the lowest (or end at the highest) frequency bin of the SFT-block; the band must
+ * lie within the SFT-block.
+ *
+ * No SFT data is copied: on return <tt>view->data</tt> points to \a viewData, which in turn points
+ * into the mapped file. The view must therefore not be freed with XLALDestroySFT(), must not be
+ * modified, and is only valid until the map is destroyed.
+ */
+int
+XLALSFTFileMapBandView ( SFTtype *view,			/**< [out] header of the view */
+                         COMPLEX8Vector *viewData,	/**< [out] data of the view */
+                         const SFTFileMap *map,		/**< [in] mapped SFT file */
+                         UINT4 iblock,			/**< [in] index of the SFT-block in XLALSFTFileMapCatalog() */
+                         REAL8 fMin,			/**< [in] minimum requested frequency (-1 = from lowest) */
+                         REAL8 fMax			/**< [in] maximum requested frequency (-1 = up to highest) */
+                         )
+{
+  XLAL_CHECK ( view != NULL && viewData != NULL && map != NULL, XLAL_EFAULT );
+  XLAL_CHECK ( iblock < map->blocks->length, XLAL_EDOM, "SFT-block index %u is out of range [0, %u)\n", iblock, map->blocks->length );
+
+  const SFTDescriptor *block = &(map->blocks->data[iblock]);
+  const REAL8 deltaF = block->header.deltaF;
+  const UINT4 minbin = lround ( block->header.f0 / deltaF );
+  const UINT4 maxbin = minbin + block->numBins - 1;
+  const UINT4 firstbin = ( fMin < 0 ) ? minbin : XLALRoundFrequencyDownToSFTBin ( fMin, deltaF );
+  const UINT4 lastbin = ( fMax < 0 ) ? maxbin : XLALRoundFrequencyUpToSFTBin ( fMax, deltaF ) - 1;
+  XLAL_CHECK ( ( minbin <= firstbin ) && ( firstbin <= lastbin ) && ( lastbin <= maxbin ), XLAL_EDOM,
+               "Requested frequency-band [%.9g, %.9g) is not contained in SFT-block %u with bins [%u, %u]\n", fMin, fMax, iblock, minbin, maxbin );
+
+  (*view) = block->header;
+  view->f0 = 1.0 * firstbin * deltaF;
+  viewData->length = lastbin - firstbin + 1;
+  viewData->data = map->data[iblock] + ( firstbin - minbin );
+  view->data = viewData;
+
+  return XLAL_SUCCESS;
+
+} /* XLALSFTFileMapBandView() */
+
+
 /*
    This function reads an SFT (segment) from an open file pointer into a buffer.
    firstBin2read specifies the first bin to read from the SFT, lastBin2read is the last bin.
@@ -1182,6 +1324,12 @@ XLALReadTimestampsFileConstrained ( const CHAR *fname, const LIGOTimeGPS *minGPS
  * XLAL_SUCCESS if the operation suceeds (even if the checksums fail to validate),
  * and XLAL_FAILURE otherwise.
  *
+ * The SFTs are validated in parallel if OpenMP is enabled. If the environment variable
+ * <tt>LAL_SFT_INDEX_FILENAME</tt> names a persistent SFT index (see XLALSFTdataFind()),
+ * SFTs that were previously validated, in files that are unchanged since, are not read
+ * again, and newly-validated SFTs are recorded in the index. Note that the index cannot
+ * detect corruption which leaves the file metadata unchanged.
+ *
  * \note: because this function has to read the complete SFT data into memory it is
  * potentially slow and memory-intensive.
  */
@@ -1198,42 +1346,153 @@ XLALCheckCRCSFTCatalog(
   /* CRC checks are assumed to pass until one fails */
   *crc_check = 1;
 
-  /* step through SFTs and check CRC64 */
+  if ( catalog->length == 0 ) {
+    return XLAL_SUCCESS;
+  }
+
+  /* outcome of checking each SFT */
+  enum { CRC_UNCHECKED = 0, CRC_VALID, CRC_INVALID, CRC_OPEN_FAILED, CRC_READ_FAILED, CRC_BAD_VERSION };
+  INT4 *status = XLALCalloc ( catalog->length, sizeof ( status[0] ) );
+  SFTIndexEntry **entries = XLALCalloc ( catalog->length, sizeof ( entries[0] ) );
+  UINT4 *entry_block = XLALCalloc ( catalog->length, sizeof ( entry_block[0] ) );
+  SFTIndex *index = NULL;
+  int errnum = 0;
+  int retn = XLAL_SUCCESS;
+  if ( ( status == NULL ) || ( entries == NULL ) || ( entry_block == NULL ) )
+    {
+      errnum = XLAL_ENOMEM;
+      goto done;
+    }
+
+  /* skip SFTs recorded as valid in the persistent SFT index, if any */
+  const char *index_fname = getenv ( "LAL_SFT_INDEX_FILENAME" );
+  if ( ( index_fname != NULL ) && ( index_fname[0] != '\0' ) )
+    {
+      if ( (index = load_SFTIndex ( index_fname )) == NULL )
+        {
+          errnum = XLAL_EFUNC;
+          goto done;
+        }
+      for ( UINT4 i = 0; i < catalog->length; i ++ )
+        {
+          const struct tagSFTLocator *locator = catalog->data[i].locator;
+          if ( (entries[i] = lookup_SFTIndex ( index, locator->fname )) == NULL )
+            {
+              errnum = XLAL_EFUNC;
+              goto done;
+            }
+          for ( UINT4 k = 0; k < entries[i]->blocks->length; k ++ )
+            {
+              if ( entries[i]->blocks->data[k].locator->offset == locator->offset )
+                {
+                  entry_block[i] = k;
+                  if ( entries[i]->crc_valid[k] ) {
+                    status[i] = CRC_VALID;
+                  }
+                  break;
+                }
+            }
+        }
+    }
+
+  /* step through SFTs and check CRC64, each thread opening its own files */
+#pragma omp parallel for schedule(dynamic)
   for ( UINT4 i=0; i < catalog->length; i ++ )
     {
-      FILE *fp;
+      if ( status[i] != CRC_UNCHECKED ) {
+        continue;
+      }
 
+      FILE *fp;
       switch ( catalog->data[i].version  )
 	{
 	case 1:	/* version 1 had no CRC  */
-	  continue;
+	  status[i] = CRC_VALID;
+	  break;
 	case 2:
 	  if ( (fp = fopen_SFTLocator ( catalog->data[i].locator )) == NULL )
 	    {
-	      XLALPrintError ( "Failed to open locator '%s'\n",
-			      XLALshowSFTLocator ( catalog->data[i].locator ) );
-              return XLAL_FAILURE;
+	      status[i] = CRC_OPEN_FAILED;
+	      break;
 	    }
-	  if ( !(has_valid_v2_crc64 ( fp ) != 0) )
+	  switch ( has_valid_v2_crc64 ( fp ) )
 	    {
-	      XLALPrintError ( "CRC64 checksum failure for SFT '%s'\n",
-			      XLALshowSFTLocator ( catalog->data[i].locator ) );
-              *crc_check = 0;
-	      fclose(fp);
-              return XLAL_SUCCESS;
+	    case 1:
+	      status[i] = CRC_VALID;
+	      break;
+	    case 0:
+	      status[i] = CRC_INVALID;
+	      break;
+	    default:
+	      status[i] = CRC_READ_FAILED;
+	      break;
 	    }
 	  fclose(fp);
 	  break;
 
 	default:
-	  XLALPrintError ( "Illegal SFT-version encountered : %d\n", catalog->data[i].version );
-          return XLAL_FAILURE;
+	  status[i] = CRC_BAD_VERSION;
 	  break;
 	} /* switch (version ) */
 
     } /* for i < numSFTs */
 
-  return XLAL_SUCCESS;
+  /* record newly-validated SFTs in the index */
+  if ( index )
+    {
+      for ( UINT4 i = 0; i < catalog->length; i ++ )
+        {
+          SFTIndexEntry *entry = entries[i];
+          if ( ( status[i] == CRC_VALID ) && ( entry->blocks->data[entry_block[i]].locator->offset == catalog->data[i].locator->offset ) && !entry->crc_valid[entry_block[i]] )
+            {
+              entry->crc_valid[entry_block[i]] = TRUE;
+              index->modified = TRUE;
+            }
+        }
+      save_SFTIndex ( index );
+    }
+
+  /* report the first failure, in catalog order */
+  for ( UINT4 i = 0; i < catalog->length; i ++ )
+    {
+      if ( status[i] == CRC_VALID ) {
+        continue;
+      }
+      if ( status[i] == CRC_INVALID )
+        {
+	  XLALPrintError ( "CRC64 checksum failure for SFT '%s'\n",
+			  XLALshowSFTLocator ( catalog->data[i].locator ) );
+          *crc_check = 0;
+        }
+      else if ( status[i] == CRC_OPEN_FAILED )
+        {
+	  XLALPrintError ( "Failed to open locator '%s'\n",
+			  XLALshowSFTLocator ( catalog->data[i].locator ) );
+          retn = XLAL_FAILURE;
+        }
+      else if ( status[i] == CRC_READ_FAILED )
+        {
+	  XLALPrintError ( "Failed to read SFT '%s'\n",
+			  XLALshowSFTLocator ( catalog->data[i].locator ) );
+          retn = XLAL_FAILURE;
+        }
+      else
+        {
+	  XLALPrintError ( "Illegal SFT-version encountered : %d\n", catalog->data[i].version );
+          retn = XLAL_FAILURE;
+        }
+      break;
+    }
+
+ done:
+  XLALFree ( status );
+  XLALFree ( entries );
+  XLALFree ( entry_block );
+  destroy_SFTIndex ( index );
+  if ( errnum != 0 ) {
+    XLAL_ERROR ( errnum );
+  }
+  return retn;
 
 } /* XLALCheckCRCSFTCatalog() */
 
@@ -3188,14 +3447,13 @@ static long get_file_len ( FILE *fp )
 
 
 /* ----- the following function crc64() was taken from SFTReferenceLibrary.c
- * and adapted to LAL .
+ * and adapted to LAL; it now uses the slice-by-8 algorithm, which processes
+ * 8 bytes at a time using the constant lookup tables in SFTfileIO_CRC64.i.
  *
- *  The quantity below is: D800000000000000 (base-16) =
+ *  The tables are built from: D800000000000000 (base-16) =
  *  1101100000000000000000000000000000000000000000000000000000000000
  *  (base-2).  The primitive polynomial is x^64 + x^4 + x^3 + x + 1.
  */
-#define POLY64 0xd800000000000000ULL
-#define TABLELEN 256
 
 /* The crc64 checksum of M bytes of data at address data is returned
  * by crc64(data, M, ~(0ULL)). Call the function multiple times to
@@ -3204,34 +3462,26 @@ static long get_file_len ( FILE *fp )
 static UINT8
 calc_crc64(const CHAR *data, UINT4 length, UINT8 crc)
 {
-  UINT8 CRCTable[TABLELEN];
-  UINT4 i;
+  const unsigned char *p = (const unsigned char *) data;
 
   /* is there is no data, simply return previous checksum value */
   if (!length || !data )
     return crc;
 
-  /* initialize the CRC table for fast computation.  We could keep
-     this table in memory to make the computation faster, but that is
-     not re-entrant for multi-threaded code.
-  */
-  for (i = 0; i < TABLELEN; i++) {
-    UINT4 j;
-    UINT8 part = i;
-    for (j = 0; j < 8; j++) {
-      if (part & 1)
-        part = (part >> 1) ^ POLY64;
-      else
-        part >>= 1;
-    }
-    CRCTable[i] = part;
+  /* compute the CRC-64 code 8 bytes at a time; the bytes are combined
+     in little-endian order, independent of the byte order of the host */
+  for ( ; length >= 8; p += 8, length -= 8 ) {
+    crc ^= (UINT8) p[0] | ( (UINT8) p[1] << 8 ) | ( (UINT8) p[2] << 16 ) | ( (UINT8) p[3] << 24 )
+      | ( (UINT8) p[4] << 32 ) | ( (UINT8) p[5] << 40 ) | ( (UINT8) p[6] << 48 ) | ( (UINT8) p[7] << 56 );
+    crc = crc64Table[7][crc & 0xff] ^ crc64Table[6][(crc >> 8) & 0xff]
+      ^ crc64Table[5][(crc >> 16) & 0xff] ^ crc64Table[4][(crc >> 24) & 0xff]
+      ^ crc64Table[3][(crc >> 32) & 0xff] ^ crc64Table[2][(crc >> 40) & 0xff]
+      ^ crc64Table[1][(crc >> 48) & 0xff] ^ crc64Table[0][crc >> 56];
   }
 
-  /* compute the CRC-64 code */
-  for (i=0; i<length; i++) {
-    UINT8 temp1 = crc >> 8;
-    UINT8 temp2 = CRCTable[(crc ^ (UINT8) data[i]) & 0xff];
-    crc = temp1 ^ temp2;
+  /* compute the CRC-64 code of any remaining bytes one at a time */
+  for ( ; length > 0; p ++, length -- ) {
+    crc = ( crc >> 8 ) ^ crc64Table[0][(crc ^ *p) & 0xff];
   }
 
   return crc;
@@ -3242,8 +3492,9 @@ calc_crc64(const CHAR *data, UINT4 length, UINT8 crc)
 /**
  * Check the v2 SFT-block starting at fp for valid crc64 checksum.
  * Restores filepointer before leaving.
+ * Returns 1 if the checksum is valid, 0 if it is not, and -1 if the SFT-block could not be read.
  */
-static BOOLEAN
+static int
 has_valid_v2_crc64 ( FILE *fp )
 {
   long save_filepos;
@@ -3260,7 +3511,7 @@ has_valid_v2_crc64 ( FILE *fp )
   if ( !fp )
     {
       XLALPrintError ("\nhas_valid_v2_crc64() was called with NULL filepointer!\n\n");
-      return FALSE;
+      return -1;
     }
 
   /* store fileposition for restoring in case of failure */
@@ -3297,7 +3548,7 @@ has_valid_v2_crc64 ( FILE *fp )
       if (toread != (int)fread ( block, 1, toread, fp) )
 	{
 	  XLALPrintError ("\nFailed to read all frequency-bins from SFT.\n\n");
-	  return FALSE;
+	  return -1;
 	}
       data_len -= toread;
 
@@ -3307,11 +3558,578 @@ has_valid_v2_crc64 ( FILE *fp )
     } /* while data */
 
   /* check that checksum is consistent */
-  return ( computed_crc == ref_crc );
+  return ( computed_crc == ref_crc ) ? 1 : 0;
 
 } /* has_valid_v2_crc64 */
 
 
+/* Parse the headers of all SFT-blocks in an open SFT file, and return them as a catalog in file order.
+ * Merged SFTs need to satisfy stronger consistency-constraints (-> see spec)
+ */
+static SFTCatalog *
+read_SFTcatalog_from_fp ( FILE *fp, const CHAR *fname )
+{
+  SFTCatalog *ret;
+  XLAL_CHECK_NULL ( (ret = XLALCalloc ( 1, sizeof (*ret) )) != NULL, XLAL_ENOMEM );
+
+  long file_len;
+  if ( (file_len = get_file_len(fp)) == 0 )
+    {
+      XLALDestroySFTCatalog ( ret );
+      XLAL_ERROR_NULL ( XLAL_EIO, "Got file-len == 0 for '%s'\n", fname );
+    }
+
+  UINT4 numBlocks = 0;
+  SFTtype XLAL_INIT_DECL( mprev_header );
+  UINT4 mprev_version = 0;
+  UINT4 mprev_nsamples = 0;
+
+  /* go through SFT-blocks in fp */
+  while ( ftell(fp) < file_len )
+    {
+      SFTtype this_header;
+      UINT4 this_version;
+      UINT4 this_nsamples;
+      UINT8 this_crc;
+      CHAR *this_comment = NULL;
+      BOOLEAN endian;
+
+      long this_filepos;
+      if ( (this_filepos = ftell(fp)) == -1 )
+        {
+          XLALDestroySFTCatalog ( ret );
+          XLAL_ERROR_NULL ( XLAL_EIO, "ftell() failed for '%s'\n", fname );
+        }
+
+      if ( read_sft_header_from_fp (fp, &this_header, &this_version, &this_crc, &endian, &this_comment, &this_nsamples ) != 0 )
+        {
+          XLALDestroySFTCatalog ( ret );
+          XLAL_ERROR_NULL ( XLAL_EDATA, "File-block '%s:%ld' is not a valid SFT!\n", fname, ftell(fp) );
+        }
+
+      /* if merged-SFT: check consistency constraints */
+      if ( ( numBlocks > 0 ) && ! consistent_mSFT_header ( mprev_header, mprev_version, mprev_nsamples, this_header, this_version, this_nsamples ) )
+        {
+          XLALFree ( this_comment );
+          XLALDestroySFTCatalog ( ret );
+          XLAL_ERROR_NULL ( XLAL_EDATA, "Merged SFT-file '%s' contains inconsistent SFT-blocks!\n", fname );
+        }
+
+      mprev_header = this_header;
+      mprev_version = this_version;
+      mprev_nsamples = this_nsamples;
+
+      /* do we need to alloc more memory for the SFT-blocks? */
+      if ( numBlocks == ret->length )
+        {
+          SFTDescriptor *data = XLALRealloc ( ret->data, (ret->length + SFTFILEIO_REALLOC_BLOCKSIZE) * sizeof( ret->data[0] ) );
+          if ( data == NULL )
+            {
+              XLALFree ( this_comment );
+              XLALDestroySFTCatalog ( ret );
+              XLAL_ERROR_NULL ( XLAL_ENOMEM );
+            }
+          memset ( &(data[ret->length]), 0, SFTFILEIO_REALLOC_BLOCKSIZE * sizeof( data[0] ) );
+          ret->data = data;
+          ret->length += SFTFILEIO_REALLOC_BLOCKSIZE;
+        }
+
+      SFTDescriptor *desc = &(ret->data[numBlocks++]);
+      desc->comment = this_comment;
+      if ( ( (desc->locator = XLALCalloc ( 1, sizeof ( *(desc->locator) ) )) == NULL )
+           || ( (desc->locator->fname = XLALStringDuplicate ( fname )) == NULL ) )
+        {
+          XLALDestroySFTCatalog ( ret );
+          XLAL_ERROR_NULL ( XLAL_ENOMEM );
+        }
+      desc->locator->offset = this_filepos;
+
+      desc->header  = this_header;
+      desc->numBins = this_nsamples;
+      desc->version = this_version;
+      desc->crc64   = this_crc;
+
+      /* skip seeking if we know we would reach the end */
+      if ( ftell ( fp ) + (long)this_nsamples * 8 >= file_len )
+        break;
+
+      /* seek to end of SFT data-entries in file  */
+      if ( fseek ( fp, this_nsamples * 8 , SEEK_CUR ) == -1 )
+        {
+          XLALDestroySFTCatalog ( ret );
+          XLAL_ERROR_NULL ( XLAL_EIO, "Failed to skip DATA field for SFT '%s': %s\n", fname, strerror(errno) );
+        }
+
+    } /* while ftell(fp) < file_len */
+
+  /* now realloc SFT-blocks (alloc'ed blockwise) to their *actual number* */
+  ret->data = XLALRealloc ( ret->data, numBlocks * sizeof( ret->data[0] ) );
+  ret->length = numBlocks;
+  if ( ret->data == NULL )
+    {
+      ret->length = 0;
+      XLALDestroySFTCatalog ( ret );
+      XLAL_ERROR_NULL ( XLAL_ENOMEM );
+    }
+
+  return ret;
+
+} /* read_SFTcatalog_from_fp() */
+
+
+/* Parse the headers of all SFT-blocks in an SFT file */
+static SFTCatalog *
+read_SFTcatalog_from_file ( const CHAR *fname )
+{
+  FILE *fp;
+  XLAL_CHECK_NULL ( (fp = fopen ( fname, "rb" )) != NULL, XLAL_EIO, "Failed to open matched file '%s'\n", fname );
+  SFTCatalog *ret = read_SFTcatalog_from_fp ( fp, fname );
+  fclose ( fp );
+  XLAL_CHECK_NULL ( ret != NULL, XLAL_EFUNC );
+  return ret;
+} /* read_SFTcatalog_from_file() */
+
+
+/* Deep-copy an SFT-descriptor, duplicating its locator and comment */
+static int
+copy_SFTDescriptor ( SFTDescriptor *dest, const SFTDescriptor *src )
+{
+  (*dest) = (*src);
+  dest->locator = NULL;
+  dest->comment = NULL;
+
+  XLAL_CHECK ( (dest->locator = XLALCalloc ( 1, sizeof ( *(dest->locator) ) )) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK ( (dest->locator->fname = XLALStringDuplicate ( src->locator->fname )) != NULL, XLAL_EFUNC );
+  dest->locator->offset = src->locator->offset;
+
+  if ( src->comment ) {
+    XLAL_CHECK ( (dest->comment = XLALStringDuplicate ( src->comment )) != NULL, XLAL_EFUNC );
+  }
+
+  return XLAL_SUCCESS;
+
+} /* copy_SFTDescriptor() */
+
+
+/* Index the SFT-blocks of an open SFT file, then map the file into memory and locate the data of each block */
+static int
+map_SFT_file_from_fp ( SFTFileMap *map, const CHAR *fname, FILE *fp )
+{
+  XLAL_CHECK ( (map->blocks = read_SFTcatalog_from_fp ( fp, fname )) != NULL, XLAL_EFUNC );
+  map->size = get_file_len ( fp );
+
+#ifdef HAVE_SYS_MMAN_H
+  /* a private writable mapping allows endian-swapping without touching the file */
+  void *base = mmap ( NULL, map->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno ( fp ), 0 );
+  XLAL_CHECK ( base != MAP_FAILED, XLAL_EIO, "Failed to map SFT file '%s' into memory: %s\n", fname, strerror(errno) );
+  map->base = base;
+#else
+  XLAL_CHECK ( (map->base = XLALMalloc ( map->size )) != NULL, XLAL_ENOMEM );
+  rewind ( fp );
+  XLAL_CHECK ( fread ( map->base, 1, map->size, fp ) == map->size, XLAL_EIO, "Failed to read SFT file '%s': %s\n", fname, strerror(errno) );
+#endif
+
+  XLAL_CHECK ( (map->data = XLALCalloc ( map->blocks->length, sizeof ( map->data[0] ) )) != NULL, XLAL_ENOMEM );
+  for ( UINT4 k = 0; k < map->blocks->length; k ++ )
+    {
+      const SFTDescriptor *block = &(map->blocks->data[k]);
+      const size_t offset = block->locator->offset;
+
+      /* the header has already been validated, so its version tells the endianness */
+      _SFT_header_v2_t rawheader;
+      memcpy ( &rawheader, map->base + offset, sizeof ( rawheader ) );
+      const REAL8 version = block->version;
+      const BOOLEAN need_swap = ( memcmp ( &rawheader.version, &version, sizeof ( version ) ) != 0 );
+      if ( need_swap ) {
+        endian_swap ( (CHAR*)(&rawheader.comment_length), sizeof ( rawheader.comment_length ), 1 );
+      }
+
+      const size_t data_offset = offset + sizeof ( rawheader ) + rawheader.comment_length;
+      XLAL_CHECK ( data_offset + block->numBins * sizeof ( COMPLEX8 ) <= map->size, XLAL_EDATA, "SFT-block '%s:%zu' is truncated\n", fname, offset );
+      map->data[k] = (COMPLEX8*)( map->base + data_offset );
+      if ( need_swap ) {
+        endian_swap ( (CHAR*)map->data[k], sizeof ( REAL4 ), 2 * block->numBins );
+      }
+    }
+
+  return XLAL_SUCCESS;
+
+} /* map_SFT_file_from_fp() */
+
+
+/* hash SFT index entries by filename */
+static UINT8
+SFTIndexEntry_hash ( const void *x )
+{
+  const SFTIndexEntry *entry = x;
+  return XLALCityHash64 ( entry->fname, strlen ( entry->fname ) );
+}
+static int
+SFTIndexEntry_cmp ( const void *x, const void *y )
+{
+  const SFTIndexEntry *entry1 = x;
+  const SFTIndexEntry *entry2 = y;
+  return strcmp ( entry1->fname, entry2->fname );
+}
+
+
+/* Load the persistent SFT index from a file; a missing index file gives an empty index,
+ * and an invalid one is ignored with a warning (and will be rebuilt)
+ */
+static SFTIndex *
+load_SFTIndex ( const CHAR *fname )
+{
+  SFTIndex *index;
+  XLAL_CHECK_NULL ( (index = XLALCalloc ( 1, sizeof ( *index ) )) != NULL, XLAL_ENOMEM );
+  if ( ( (index->fname = XLALStringDuplicate ( fname )) == NULL )
+       || ( (index->ht = XLALHashTblCreate ( NULL, SFTIndexEntry_hash, SFTIndexEntry_cmp )) == NULL ) )
+    {
+      destroy_SFTIndex ( index );
+      XLAL_ERROR_NULL ( XLAL_EFUNC );
+    }
+
+  FILE *fp;
+  if ( (fp = fopen ( fname, "rb" )) != NULL )
+    {
+      int retn = read_SFTIndex_from_fp ( index, fp );
+      fclose ( fp );
+      if ( retn != 0 )
+        {
+          XLALPrintWarning ( "%s: ignoring invalid SFT index '%s'\n", __func__, fname );
+          clear_SFTIndex ( index );
+        }
+    }
+
+  return index;
+
+} /* load_SFTIndex() */
+
+
+/* Read the entries of an SFT index file; returns 0 if OK, -1 if the index is invalid */
+static int
+read_SFTIndex_from_fp ( SFTIndex *index, FILE *fp )
+{
+  const long file_len = get_file_len ( fp );
+
+  CHAR magic[sizeof ( SFT_INDEX_MAGIC )];
+  UINT4 version, numEntries;
+  if ( ( fread ( magic, sizeof ( magic ), 1, fp ) != 1 ) || ( memcmp ( magic, SFT_INDEX_MAGIC, sizeof ( magic ) ) != 0 ) )
+    return -1;
+  if ( ( fread ( &version, sizeof ( version ), 1, fp ) != 1 ) || ( version != SFT_INDEX_VERSION ) )
+    return -1;
+  if ( fread ( &numEntries, sizeof ( numEntries ), 1, fp ) != 1 )
+    return -1;
+
+  for ( UINT4 i = 0; i < numEntries; i ++ )
+    {
+      CHAR *fname = NULL;
+      SFTCatalog *blocks = NULL;
+      BOOLEAN *crc_valid = NULL;
+      UINT4 fname_length, numBlocks;
+      INT8 stamp[5];
+
+      /* lengths are checked against the remaining file size before allocating any memory */
+      if ( ( fread ( &fname_length, sizeof ( fname_length ), 1, fp ) != 1 ) || ( fname_length == 0 ) || ( fname_length > file_len - ftell(fp) ) )
+        goto failed;
+      if ( ( (fname = XLALMalloc ( fname_length )) == NULL ) || ( fread ( fname, fname_length, 1, fp ) != 1 ) || ( fname[fname_length - 1] != '\0' ) )
+        goto failed;
+      if ( ( fread ( stamp, sizeof ( stamp ), 1, fp ) != 1 ) || ( fread ( &numBlocks, sizeof ( numBlocks ), 1, fp ) != 1 ) )
+        goto failed;
+      if ( ( numBlocks == 0 ) || ( numBlocks > ( file_len - ftell(fp) ) / sizeof ( _SFT_index_record_t ) ) )
+        goto failed;
+
+      if ( ( (blocks = XLALCalloc ( 1, sizeof ( *blocks ) )) == NULL ) || ( (blocks->data = XLALCalloc ( numBlocks, sizeof ( blocks->data[0] ) )) == NULL )
+           || ( (crc_valid = XLALCalloc ( numBlocks, sizeof ( crc_valid[0] ) )) == NULL ) )
+        goto failed;
+      blocks->length = numBlocks;
+      for ( UINT4 k = 0; k < numBlocks; k ++ )
+        {
+          SFTDescriptor *desc = &(blocks->data[k]);
+          _SFT_index_record_t record;
+          if ( ( fread ( &record, sizeof ( record ), 1, fp ) != 1 ) || ( record.comment_length > file_len - ftell(fp) ) )
+            goto failed;
+
+          if ( ( (desc->locator = XLALCalloc ( 1, sizeof ( *(desc->locator) ) )) == NULL ) || ( (desc->locator->fname = XLALStringDuplicate ( fname )) == NULL ) )
+            goto failed;
+          desc->locator->offset = record.offset;
+
+          desc->header.name[0] = record.detector[0];
+          desc->header.name[1] = record.detector[1];
+          desc->header.epoch.gpsSeconds = record.gps_sec;
+          desc->header.epoch.gpsNanoSeconds = record.gps_nsec;
+          desc->header.f0 = record.f0;
+          desc->header.deltaF = record.deltaF;
+          desc->numBins = record.numBins;
+          desc->version = record.version;
+          desc->crc64 = record.crc64;
+          crc_valid[k] = ( record.crc_valid != 0 );
+
+          if ( record.comment_length > 0 )
+            {
+              if ( ( (desc->comment = XLALMalloc ( record.comment_length )) == NULL ) || ( fread ( desc->comment, record.comment_length, 1, fp ) != 1 ) || ( desc->comment[record.comment_length - 1] != '\0' ) )
+                goto failed;
+            }
+        }
+
+      /* duplicate filenames also make the index invalid */
+      const SFTIndexEntry key = { .fname = fname };
+      const void *found = NULL;
+      if ( ( XLALHashTblFind ( index->ht, &key, &found ) != XLAL_SUCCESS ) || ( found != NULL ) )
+        goto failed;
+
+      /* entries are checked against their files only when looked up, see lookup_SFTIndex() */
+      if ( add_to_SFTIndex ( index, fname, stamp, blocks, crc_valid ) != XLAL_SUCCESS )
+        return -1;
+
+      continue;
+
+    failed:
+      XLALFree ( fname );
+      XLALDestroySFTCatalog ( blocks );
+      XLALFree ( crc_valid );
+      return -1;
+
+    } /* for i < numEntries */
+
+  return 0;
+
+} /* read_SFTIndex_from_fp() */
+
+
+/* Add an entry to the SFT index, which takes ownership of 'fname', 'blocks' and 'crc_valid' (even on failure);
+ * if 'crc_valid' is NULL, none of the SFT-blocks are marked as validated
+ */
+static int
+add_to_SFTIndex ( SFTIndex *index, CHAR *fname, const INT8 stamp[5], SFTCatalog *blocks, BOOLEAN *crc_valid )
+{
+  SFTIndexEntry *entry = NULL;
+  if ( ( crc_valid == NULL ) && ( (crc_valid = XLALCalloc ( blocks->length, sizeof ( crc_valid[0] ) )) == NULL ) )
+    goto failed;
+  if ( index->length == index->maxLength )
+    {
+      const UINT4 maxLength = 2 * index->maxLength + SFTFILEIO_REALLOC_BLOCKSIZE;
+      SFTIndexEntry **data = XLALRealloc ( index->data, maxLength * sizeof ( data[0] ) );
+      if ( data == NULL )
+        goto failed;
+      index->data = data;
+      index->maxLength = maxLength;
+    }
+  if ( (entry = XLALCalloc ( 1, sizeof ( *entry ) )) == NULL )
+    goto failed;
+
+  entry->fname = fname;
+  memcpy ( entry->stamp, stamp, sizeof ( entry->stamp ) );
+  entry->blocks = blocks;
+  entry->crc_valid = crc_valid;
+  index->data[index->length ++] = entry;
+
+  XLAL_CHECK ( XLALHashTblAdd ( index->ht, entry ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+ failed:
+  XLALFree ( fname );
+  XLALDestroySFTCatalog ( blocks );
+  XLALFree ( crc_valid );
+  XLAL_ERROR ( XLAL_ENOMEM );
+
+} /* add_to_SFTIndex() */
+
+
+/* Return the index entry of an SFT file, if the file is unchanged since it was indexed,
+ * otherwise parse the file and (re-)index it. Files are indexed by their canonical path,
+ * so that different names of the same file share one entry. The returned entry belongs to the index.
+ */
+static SFTIndexEntry *
+lookup_SFTIndex ( SFTIndex *index, const CHAR *fname )
+{
+  CHAR *path = NULL;
+  SFTCatalog *blocks = NULL;
+  BOOLEAN *crc_valid = NULL;
+
+  char *resolved = realpath ( fname, NULL );
+  XLAL_CHECK_NULL ( resolved != NULL, XLAL_EIO, "Failed to resolve matched file '%s': %s\n", fname, strerror(errno) );
+  path = XLALStringDuplicate ( resolved );
+  free ( resolved );
+  XLAL_CHECK_NULL ( path != NULL, XLAL_EFUNC );
+
+  /* identify the file contents by device, inode, size, and modification and status-change times */
+  struct stat st;
+  XLAL_CHECK_FAIL ( stat ( path, &st ) == 0, XLAL_EIO, "Failed to stat matched file '%s': %s\n", fname, strerror(errno) );
+  const INT8 stamp[5] = { st.st_dev, st.st_ino, st.st_size, st.st_mtime, st.st_ctime };
+
+  const SFTIndexEntry key = { .fname = path };
+  const void *found = NULL;
+  XLAL_CHECK_FAIL ( XLALHashTblFind ( index->ht, &key, &found ) == XLAL_SUCCESS, XLAL_EFUNC );
+  SFTIndexEntry *entry = (SFTIndexEntry*) found;
+  if ( ( entry != NULL ) && ( memcmp ( entry->stamp, stamp, sizeof ( stamp ) ) == 0 ) )
+    {
+      entry->checked = TRUE;
+      XLALFree ( path );
+      return entry;
+    }
+
+  /* file is new or has changed: parse it */
+  XLAL_CHECK_FAIL ( (blocks = read_SFTcatalog_from_file ( fname )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK_FAIL ( (crc_valid = XLALCalloc ( blocks->length, sizeof ( crc_valid[0] ) )) != NULL, XLAL_ENOMEM );
+  index->modified = TRUE;
+  if ( entry != NULL )
+    {
+      XLALDestroySFTCatalog ( entry->blocks );
+      XLALFree ( entry->crc_valid );
+      entry->blocks = blocks;
+      entry->crc_valid = crc_valid;
+      memcpy ( entry->stamp, stamp, sizeof ( entry->stamp ) );
+      XLALFree ( path );
+    }
+  else
+    {
+      /* add_to_SFTIndex() takes ownership, also on failure */
+      const int retn = add_to_SFTIndex ( index, path, stamp, blocks, crc_valid );
+      XLAL_CHECK_NULL ( retn == XLAL_SUCCESS, XLAL_EFUNC );
+      entry = index->data[index->length - 1];
+    }
+  entry->checked = TRUE;
+
+  return entry;
+
+XLAL_FAIL:
+  XLALFree ( path );
+  XLALDestroySFTCatalog ( blocks );
+  XLALFree ( crc_valid );
+  return NULL;
+
+} /* lookup_SFTIndex() */
+
+
+/* Save the SFT index if it was modified, by writing a temporary file and renaming it over the
+ * index file, so that concurrent readers never see a partial index; failures only produce a warning.
+ * The index is written in native byte order, which is checked on reading by the version number.
+ * Entries of files which no longer exist are dropped here, so that the index does not grow without bound.
+ */
+static int
+save_SFTIndex ( const SFTIndex *index )
+{
+  if ( !index->modified ) {
+    return 0;
+  }
+
+  /* entries not looked up since loading are only checked for existence */
+  BOOLEAN *keep = XLALCalloc ( index->length + 1, sizeof ( keep[0] ) );
+  if ( keep == NULL ) {
+    return -1;
+  }
+  UINT4 numEntries = 0;
+  for ( UINT4 i = 0; i < index->length; i ++ )
+    {
+      struct stat st;
+      keep[i] = index->data[i]->checked || ( stat ( index->data[i]->fname, &st ) == 0 );
+      numEntries += keep[i] ? 1 : 0;
+    }
+
+#ifdef HAVE_UNISTD_H
+  CHAR *tmp_fname = XLALStringAppendFmt ( NULL, "%s.%ld.tmp", index->fname, (long) getpid() );
+#else
+  CHAR *tmp_fname = XLALStringAppendFmt ( NULL, "%s.tmp", index->fname );
+#endif
+  if ( tmp_fname == NULL ) {
+    XLALFree ( keep );
+    return -1;
+  }
+
+  FILE *fp;
+  if ( (fp = fopen ( tmp_fname, "wb" )) == NULL )
+    {
+      XLALPrintWarning ( "%s: failed to open '%s' for writing: %s\n", __func__, tmp_fname, strerror(errno) );
+      XLALFree ( tmp_fname );
+      XLALFree ( keep );
+      return -1;
+    }
+
+  const UINT4 version = SFT_INDEX_VERSION;
+  BOOLEAN ok = ( fwrite ( SFT_INDEX_MAGIC, sizeof ( SFT_INDEX_MAGIC ), 1, fp ) == 1 )
+    && ( fwrite ( &version, sizeof ( version ), 1, fp ) == 1 )
+    && ( fwrite ( &numEntries, sizeof ( numEntries ), 1, fp ) == 1 );
+  for ( UINT4 i = 0; ok && ( i < index->length ); i ++ )
+    {
+      if ( !keep[i] ) {
+        continue;
+      }
+      const SFTIndexEntry *entry = index->data[i];
+      const UINT4 fname_length = strlen ( entry->fname ) + 1;
+      ok = ( fwrite ( &fname_length, sizeof ( fname_length ), 1, fp ) == 1 )
+        && ( fwrite ( entry->fname, fname_length, 1, fp ) == 1 )
+        && ( fwrite ( entry->stamp, sizeof ( entry->stamp ), 1, fp ) == 1 )
+        && ( fwrite ( &entry->blocks->length, sizeof ( entry->blocks->length ), 1, fp ) == 1 );
+      for ( UINT4 k = 0; ok && ( k < entry->blocks->length ); k ++ )
+        {
+          const SFTDescriptor *desc = &(entry->blocks->data[k]);
+          _SFT_index_record_t XLAL_INIT_DECL(record);
+          record.offset = desc->locator->offset;
+          record.gps_sec = desc->header.epoch.gpsSeconds;
+          record.gps_nsec = desc->header.epoch.gpsNanoSeconds;
+          record.f0 = desc->header.f0;
+          record.deltaF = desc->header.deltaF;
+          record.crc64 = desc->crc64;
+          record.numBins = desc->numBins;
+          record.version = desc->version;
+          record.comment_length = desc->comment ? strlen ( desc->comment ) + 1 : 0;
+          record.detector[0] = desc->header.name[0];
+          record.detector[1] = desc->header.name[1];
+          record.crc_valid = entry->crc_valid[k];
+          ok = ( fwrite ( &record, sizeof ( record ), 1, fp ) == 1 )
+            && ( ( record.comment_length == 0 ) || ( fwrite ( desc->comment, record.comment_length, 1, fp ) == 1 ) );
+        }
+    }
+  ok = ( fclose ( fp ) == 0 ) && ok;
+  ok = ok && ( rename ( tmp_fname, index->fname ) == 0 );
+
+  if ( !ok )
+    {
+      XLALPrintWarning ( "%s: failed to write SFT index '%s': %s\n", __func__, index->fname, strerror(errno) );
+      remove ( tmp_fname );
+    }
+  XLALFree ( tmp_fname );
+  XLALFree ( keep );
+
+  return ok ? 0 : -1;
+
+} /* save_SFTIndex() */
+
+
+/* Remove all entries from the SFT index */
+static void
+clear_SFTIndex ( SFTIndex *index )
+{
+  XLALHashTblClear ( index->ht );
+  for ( UINT4 i = 0; i < index->length; i ++ )
+    {
+      XLALFree ( index->data[i]->fname );
+      XLALDestroySFTCatalog ( index->data[i]->blocks );
+      XLALFree ( index->data[i]->crc_valid );
+      XLALFree ( index->data[i] );
+    }
+  index->length = 0;
+} /* clear_SFTIndex() */
+
+
+/* Free the SFT index */
+static void
+destroy_SFTIndex ( SFTIndex *index )
+{
+  if ( index == NULL ) {
+    return;
+  }
+  if ( index->ht != NULL ) {
+    clear_SFTIndex ( index );
+    XLALHashTblDestroy ( index->ht );
+  }
+  XLALFree ( index->data );
+  XLALFree ( index->fname );
+  XLALFree ( index );
+} /* destroy_SFTIndex() */
+
+
 /* compare two SFT-descriptors by their GPS-epoch, then starting frequency */
 int
 compareSFTdesc(const void *ptr1, const void *ptr2)
@@ -131,6 +131,12 @@ extern "C" {
  * The function XLALLoadMultiSFTs() is similar to the above, except that it accepts an \c SFTCatalog with different detectors,
  * and returns corresponding multi-IFO vector of SFTVectors.
  *
+ * <h4>Memory-mapped SFT files</h4>
+ *
+ * XLALCreateSFTFileMap() maps a single (merged or single) SFT file into memory and indexes its SFT-blocks,
+ * which are returned by XLALSFTFileMapCatalog(). XLALSFTFileMapBandView() then returns read-only views of
+ * frequency-bands of these SFT-blocks, which point directly into the mapped file instead of copying the data.
+ *
  * <p><h2>Usage: Writing of SFT-files</h2>
  *
  * For <b>writing SFTs</b>:
@@ -275,6 +281,13 @@ typedef struct tagMultiSFTCatalogView
 } MultiSFTCatalogView;
 
 
+/**
+ * An SFT file mapped into memory, with an index of the headers of all its SFT-blocks,
+ * as returned by XLALCreateSFTFileMap() [opaque!]
+ */
+typedef struct tagSFTFileMap SFTFileMap;
+
+
 /*---------- Global variables ----------*/
 
 /*
@@ -310,6 +323,11 @@ MultiSFTVector *XLALLoadMultiSFTsFromView ( const MultiSFTCatalogView *multiCata
 
 int XLALCheckCRCSFTCatalog( BOOLEAN *crc_check, SFTCatalog *catalog );
 
+SFTFileMap *XLALCreateSFTFileMap ( const CHAR *fname );
+void XLALDestroySFTFileMap ( SFTFileMap *map );
+const SFTCatalog *XLALSFTFileMapCatalog ( const SFTFileMap *map );
+int XLALSFTFileMapBandView ( SFTtype *view, COMPLEX8Vector *viewData, const SFTFileMap *map, UINT4 iblock, REAL8 fMin, REAL8 fMax );
+
 void XLALDestroySFTCatalog ( SFTCatalog *catalog );
 LALStringVector *XLALListIFOsInCatalog( const SFTCatalog *catalog );
 INT4 XLALCountIFOsInCatalog( const SFTCatalog *catalog );
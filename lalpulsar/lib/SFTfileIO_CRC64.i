@@ -0,0 +1,562 @@
+//
+// Copyright (C) 2021 Yiqi Xie
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+/*
+  This file defines the lookup tables crc64Table[8][256] for the slice-by-8
+  computation of the CRC64 checksum of SFTs in calc_crc64(), for the primitive
+  polynomial x^64 + x^4 + x^3 + x + 1 (POLY64 = 0xd800000000000000 in
+  reflected bit order):
+  - crc64Table[0][i] is the CRC of the byte i, i.e. i shifted right 8 times,
+    XOR-ing POLY64 whenever a 1 is shifted out;
+  - crc64Table[k][i] = (crc64Table[k-1][i] >> 8) ^ crc64Table[0][crc64Table[k-1][i] & 0xff]
+    is the CRC of the byte i followed by k zero bytes.
+  The tables are constant so that calc_crc64() is re-entrant without any
+  initialization.
+*/
+
+static const UINT8 crc64Table[8][256] = {
+  {
+    0x0000000000000000ULL, 0x01b0000000000000ULL, 0x0360000000000000ULL, 0x02d0000000000000ULL,
+    0x06c0000000000000ULL, 0x0770000000000000ULL, 0x05a0000000000000ULL, 0x0410000000000000ULL,
+    0x0d80000000000000ULL, 0x0c30000000000000ULL, 0x0ee0000000000000ULL, 0x0f50000000000000ULL,
+    0x0b40000000000000ULL, 0x0af0000000000000ULL, 0x0820000000000000ULL, 0x0990000000000000ULL,
+    0x1b00000000000000ULL, 0x1ab0000000000000ULL, 0x1860000000000000ULL, 0x19d0000000000000ULL,
+    0x1dc0000000000000ULL, 0x1c70000000000000ULL, 0x1ea0000000000000ULL, 0x1f10000000000000ULL,
+    0x1680000000000000ULL, 0x1730000000000000ULL, 0x15e0000000000000ULL, 0x1450000000000000ULL,
+    0x1040000000000000ULL, 0x11f0000000000000ULL, 0x1320000000000000ULL, 0x1290000000000000ULL,
+    0x3600000000000000ULL, 0x37b0000000000000ULL, 0x3560000000000000ULL, 0x34d0000000000000ULL,
+    0x30c0000000000000ULL, 0x3170000000000000ULL, 0x33a0000000000000ULL, 0x3210000000000000ULL,
+    0x3b80000000000000ULL, 0x3a30000000000000ULL, 0x38e0000000000000ULL, 0x3950000000000000ULL,
+    0x3d40000000000000ULL, 0x3cf0000000000000ULL, 0x3e20000000000000ULL, 0x3f90000000000000ULL,
+    0x2d00000000000000ULL, 0x2cb0000000000000ULL, 0x2e60000000000000ULL, 0x2fd0000000000000ULL,
+    0x2bc0000000000000ULL, 0x2a70000000000000ULL, 0x28a0000000000000ULL, 0x2910000000000000ULL,
+    0x2080000000000000ULL, 0x2130000000000000ULL, 0x23e0000000000000ULL, 0x2250000000000000ULL,
+    0x2640000000000000ULL, 0x27f0000000000000ULL, 0x2520000000000000ULL, 0x2490000000000000ULL,
+    0x6c00000000000000ULL, 0x6db0000000000000ULL, 0x6f60000000000000ULL, 0x6ed0000000000000ULL,
+    0x6ac0000000000000ULL, 0x6b70000000000000ULL, 0x69a0000000000000ULL, 0x6810000000000000ULL,
+    0x6180000000000000ULL, 0x6030000000000000ULL, 0x62e0000000000000ULL, 0x6350000000000000ULL,
+    0x6740000000000000ULL, 0x66f0000000000000ULL, 0x6420000000000000ULL, 0x6590000000000000ULL,
+    0x7700000000000000ULL, 0x76b0000000000000ULL, 0x7460000000000000ULL, 0x75d0000000000000ULL,
+    0x71c0000000000000ULL, 0x7070000000000000ULL, 0x72a0000000000000ULL, 0x7310000000000000ULL,
+    0x7a80000000000000ULL, 0x7b30000000000000ULL, 0x79e0000000000000ULL, 0x7850000000000000ULL,
+    0x7c40000000000000ULL, 0x7df0000000000000ULL, 0x7f20000000000000ULL, 0x7e90000000000000ULL,
+    0x5a00000000000000ULL, 0x5bb0000000000000ULL, 0x5960000000000000ULL, 0x58d0000000000000ULL,
+    0x5cc0000000000000ULL, 0x5d70000000000000ULL, 0x5fa0000000000000ULL, 0x5e10000000000000ULL,
+    0x5780000000000000ULL, 0x5630000000000000ULL, 0x54e0000000000000ULL, 0x5550000000000000ULL,
+    0x5140000000000000ULL, 0x50f0000000000000ULL, 0x5220000000000000ULL, 0x5390000000000000ULL,
+    0x4100000000000000ULL, 0x40b0000000000000ULL, 0x4260000000000000ULL, 0x43d0000000000000ULL,
+    0x47c0000000000000ULL, 0x4670000000000000ULL, 0x44a0000000000000ULL, 0x4510000000000000ULL,
+    0x4c80000000000000ULL, 0x4d30000000000000ULL, 0x4fe0000000000000ULL, 0x4e50000000000000ULL,
+    0x4a40000000000000ULL, 0x4bf0000000000000ULL, 0x4920000000000000ULL, 0x4890000000000000ULL,
+    0xd800000000000000ULL, 0xd9b0000000000000ULL, 0xdb60000000000000ULL, 0xdad0000000000000ULL,
+    0xdec0000000000000ULL, 0xdf70000000000000ULL, 0xdda0000000000000ULL, 0xdc10000000000000ULL,
+    0xd580000000000000ULL, 0xd430000000000000ULL, 0xd6e0000000000000ULL, 0xd750000000000000ULL,
+    0xd340000000000000ULL, 0xd2f0000000000000ULL, 0xd020000000000000ULL, 0xd190000000000000ULL,
+    0xc300000000000000ULL, 0xc2b0000000000000ULL, 0xc060000000000000ULL, 0xc1d0000000000000ULL,
+    0xc5c0000000000000ULL, 0xc470000000000000ULL, 0xc6a0000000000000ULL, 0xc710000000000000ULL,
+    0xce80000000000000ULL, 0xcf30000000000000ULL, 0xcde0000000000000ULL, 0xcc50000000000000ULL,
+    0xc840000000000000ULL, 0xc9f0000000000000ULL, 0xcb20000000000000ULL, 0xca90000000000000ULL,
+    0xee00000000000000ULL, 0xefb0000000000000ULL, 0xed60000000000000ULL, 0xecd0000000000000ULL,
+    0xe8c0000000000000ULL, 0xe970000000000000ULL, 0xeba0000000000000ULL, 0xea10000000000000ULL,
+    0xe380000000000000ULL, 0xe230000000000000ULL, 0xe0e0000000000000ULL, 0xe150000000000000ULL,
+    0xe540000000000000ULL, 0xe4f0000000000000ULL, 0xe620000000000000ULL, 0xe790000000000000ULL,
+    0xf500000000000000ULL, 0xf4b0000000000000ULL, 0xf660000000000000ULL, 0xf7d0000000000000ULL,
+    0xf3c0000000000000ULL, 0xf270000000000000ULL, 0xf0a0000000000000ULL, 0xf110000000000000ULL,
+    0xf880000000000000ULL, 0xf930000000000000ULL, 0xfbe0000000000000ULL, 0xfa50000000000000ULL,
+    0xfe40000000000000ULL, 0xfff0000000000000ULL, 0xfd20000000000000ULL, 0xfc90000000000000ULL,
+    0xb400000000000000ULL, 0xb5b0000000000000ULL, 0xb760000000000000ULL, 0xb6d0000000000000ULL,
+    0xb2c0000000000000ULL, 0xb370000000000000ULL, 0xb1a0000000000000ULL, 0xb010000000000000ULL,
+    0xb980000000000000ULL, 0xb830000000000000ULL, 0xbae0000000000000ULL, 0xbb50000000000000ULL,
+    0xbf40000000000000ULL, 0xbef0000000000000ULL, 0xbc20000000000000ULL, 0xbd90000000000000ULL,
+    0xaf00000000000000ULL, 0xaeb0000000000000ULL, 0xac60000000000000ULL, 0xadd0000000000000ULL,
+    0xa9c0000000000000ULL, 0xa870000000000000ULL, 0xaaa0000000000000ULL, 0xab10000000000000ULL,
+    0xa280000000000000ULL, 0xa330000000000000ULL, 0xa1e0000000000000ULL, 0xa050000000000000ULL,
+    0xa440000000000000ULL, 0xa5f0000000000000ULL, 0xa720000000000000ULL, 0xa690000000000000ULL,
+    0x8200000000000000ULL, 0x83b0000000000000ULL, 0x8160000000000000ULL, 0x80d0000000000000ULL,
+    0x84c0000000000000ULL, 0x8570000000000000ULL, 0x87a0000000000000ULL, 0x8610000000000000ULL,
+    0x8f80000000000000ULL, 0x8e30000000000000ULL, 0x8ce0000000000000ULL, 0x8d50000000000000ULL,
+    0x8940000000000000ULL, 0x88f0000000000000ULL, 0x8a20000000000000ULL, 0x8b90000000000000ULL,
+    0x9900000000000000ULL, 0x98b0000000000000ULL, 0x9a60000000000000ULL, 0x9bd0000000000000ULL,
+    0x9fc0000000000000ULL, 0x9e70000000000000ULL, 0x9ca0000000000000ULL, 0x9d10000000000000ULL,
+    0x9480000000000000ULL, 0x9530000000000000ULL, 0x97e0000000000000ULL, 0x9650000000000000ULL,
+    0x9240000000000000ULL, 0x93f0000000000000ULL, 0x9120000000000000ULL, 0x9090000000000000ULL
+  },
+  {
+    0x0000000000000000ULL, 0x0001b00000000000ULL, 0x0003600000000000ULL, 0x0002d00000000000ULL,
+    0x0006c00000000000ULL, 0x0007700000000000ULL, 0x0005a00000000000ULL, 0x0004100000000000ULL,
+    0x000d800000000000ULL, 0x000c300000000000ULL, 0x000ee00000000000ULL, 0x000f500000000000ULL,
+    0x000b400000000000ULL, 0x000af00000000000ULL, 0x0008200000000000ULL, 0x0009900000000000ULL,
+    0x001b000000000000ULL, 0x001ab00000000000ULL, 0x0018600000000000ULL, 0x0019d00000000000ULL,
+    0x001dc00000000000ULL, 0x001c700000000000ULL, 0x001ea00000000000ULL, 0x001f100000000000ULL,
+    0x0016800000000000ULL, 0x0017300000000000ULL, 0x0015e00000000000ULL, 0x0014500000000000ULL,
+    0x0010400000000000ULL, 0x0011f00000000000ULL, 0x0013200000000000ULL, 0x0012900000000000ULL,
+    0x0036000000000000ULL, 0x0037b00000000000ULL, 0x0035600000000000ULL, 0x0034d00000000000ULL,
+    0x0030c00000000000ULL, 0x0031700000000000ULL, 0x0033a00000000000ULL, 0x0032100000000000ULL,
+    0x003b800000000000ULL, 0x003a300000000000ULL, 0x0038e00000000000ULL, 0x0039500000000000ULL,
+    0x003d400000000000ULL, 0x003cf00000000000ULL, 0x003e200000000000ULL, 0x003f900000000000ULL,
+    0x002d000000000000ULL, 0x002cb00000000000ULL, 0x002e600000000000ULL, 0x002fd00000000000ULL,
+    0x002bc00000000000ULL, 0x002a700000000000ULL, 0x0028a00000000000ULL, 0x0029100000000000ULL,
+    0x0020800000000000ULL, 0x0021300000000000ULL, 0x0023e00000000000ULL, 0x0022500000000000ULL,
+    0x0026400000000000ULL, 0x0027f00000000000ULL, 0x0025200000000000ULL, 0x0024900000000000ULL,
+    0x006c000000000000ULL, 0x006db00000000000ULL, 0x006f600000000000ULL, 0x006ed00000000000ULL,
+    0x006ac00000000000ULL, 0x006b700000000000ULL, 0x0069a00000000000ULL, 0x0068100000000000ULL,
+    0x0061800000000000ULL, 0x0060300000000000ULL, 0x0062e00000000000ULL, 0x0063500000000000ULL,
+    0x0067400000000000ULL, 0x0066f00000000000ULL, 0x0064200000000000ULL, 0x0065900000000000ULL,
+    0x0077000000000000ULL, 0x0076b00000000000ULL, 0x0074600000000000ULL, 0x0075d00000000000ULL,
+    0x0071c00000000000ULL, 0x0070700000000000ULL, 0x0072a00000000000ULL, 0x0073100000000000ULL,
+    0x007a800000000000ULL, 0x007b300000000000ULL, 0x0079e00000000000ULL, 0x0078500000000000ULL,
+    0x007c400000000000ULL, 0x007df00000000000ULL, 0x007f200000000000ULL, 0x007e900000000000ULL,
+    0x005a000000000000ULL, 0x005bb00000000000ULL, 0x0059600000000000ULL, 0x0058d00000000000ULL,
+    0x005cc00000000000ULL, 0x005d700000000000ULL, 0x005fa00000000000ULL, 0x005e100000000000ULL,
+    0x0057800000000000ULL, 0x0056300000000000ULL, 0x0054e00000000000ULL, 0x0055500000000000ULL,
+    0x0051400000000000ULL, 0x0050f00000000000ULL, 0x0052200000000000ULL, 0x0053900000000000ULL,
+    0x0041000000000000ULL, 0x0040b00000000000ULL, 0x0042600000000000ULL, 0x0043d00000000000ULL,
+    0x0047c00000000000ULL, 0x0046700000000000ULL, 0x0044a00000000000ULL, 0x0045100000000000ULL,
+    0x004c800000000000ULL, 0x004d300000000000ULL, 0x004fe00000000000ULL, 0x004e500000000000ULL,
+    0x004a400000000000ULL, 0x004bf00000000000ULL, 0x0049200000000000ULL, 0x0048900000000000ULL,
+    0x00d8000000000000ULL, 0x00d9b00000000000ULL, 0x00db600000000000ULL, 0x00dad00000000000ULL,
+    0x00dec00000000000ULL, 0x00df700000000000ULL, 0x00dda00000000000ULL, 0x00dc100000000000ULL,
+    0x00d5800000000000ULL, 0x00d4300000000000ULL, 0x00d6e00000000000ULL, 0x00d7500000000000ULL,
+    0x00d3400000000000ULL, 0x00d2f00000000000ULL, 0x00d0200000000000ULL, 0x00d1900000000000ULL,
+    0x00c3000000000000ULL, 0x00c2b00000000000ULL, 0x00c0600000000000ULL, 0x00c1d00000000000ULL,
+    0x00c5c00000000000ULL, 0x00c4700000000000ULL, 0x00c6a00000000000ULL, 0x00c7100000000000ULL,
+    0x00ce800000000000ULL, 0x00cf300000000000ULL, 0x00cde00000000000ULL, 0x00cc500000000000ULL,
+    0x00c8400000000000ULL, 0x00c9f00000000000ULL, 0x00cb200000000000ULL, 0x00ca900000000000ULL,
+    0x00ee000000000000ULL, 0x00efb00000000000ULL, 0x00ed600000000000ULL, 0x00ecd00000000000ULL,
+    0x00e8c00000000000ULL, 0x00e9700000000000ULL, 0x00eba00000000000ULL, 0x00ea100000000000ULL,
+    0x00e3800000000000ULL, 0x00e2300000000000ULL, 0x00e0e00000000000ULL, 0x00e1500000000000ULL,
+    0x00e5400000000000ULL, 0x00e4f00000000000ULL, 0x00e6200000000000ULL, 0x00e7900000000000ULL,
+    0x00f5000000000000ULL, 0x00f4b00000000000ULL, 0x00f6600000000000ULL, 0x00f7d00000000000ULL,
+    0x00f3c00000000000ULL, 0x00f2700000000000ULL, 0x00f0a00000000000ULL, 0x00f1100000000000ULL,
+    0x00f8800000000000ULL, 0x00f9300000000000ULL, 0x00fbe00000000000ULL, 0x00fa500000000000ULL,
+    0x00fe400000000000ULL, 0x00fff00000000000ULL, 0x00fd200000000000ULL, 0x00fc900000000000ULL,
+    0x00b4000000000000ULL, 0x00b5b00000000000ULL, 0x00b7600000000000ULL, 0x00b6d00000000000ULL,
+    0x00b2c00000000000ULL, 0x00b3700000000000ULL, 0x00b1a00000000000ULL, 0x00b0100000000000ULL,
+    0x00b9800000000000ULL, 0x00b8300000000000ULL, 0x00bae00000000000ULL, 0x00bb500000000000ULL,
+    0x00bf400000000000ULL, 0x00bef00000000000ULL, 0x00bc200000000000ULL, 0x00bd900000000000ULL,
+    0x00af000000000000ULL, 0x00aeb00000000000ULL, 0x00ac600000000000ULL, 0x00add00000000000ULL,
+    0x00a9c00000000000ULL, 0x00a8700000000000ULL, 0x00aaa00000000000ULL, 0x00ab100000000000ULL,
+    0x00a2800000000000ULL, 0x00a3300000000000ULL, 0x00a1e00000000000ULL, 0x00a0500000000000ULL,
+    0x00a4400000000000ULL, 0x00a5f00000000000ULL, 0x00a7200000000000ULL, 0x00a6900000000000ULL,
+    0x0082000000000000ULL, 0x0083b00000000000ULL, 0x0081600000000000ULL, 0x0080d00000000000ULL,
+    0x0084c00000000000ULL, 0x0085700000000000ULL, 0x0087a00000000000ULL, 0x0086100000000000ULL,
+    0x008f800000000000ULL, 0x008e300000000000ULL, 0x008ce00000000000ULL, 0x008d500000000000ULL,
+    0x0089400000000000ULL, 0x0088f00000000000ULL, 0x008a200000000000ULL, 0x008b900000000000ULL,
+    0x0099000000000000ULL, 0x0098b00000000000ULL, 0x009a600000000000ULL, 0x009bd00000000000ULL,
+    0x009fc00000000000ULL, 0x009e700000000000ULL, 0x009ca00000000000ULL, 0x009d100000000000ULL,
+    0x0094800000000000ULL, 0x0095300000000000ULL, 0x0097e00000000000ULL, 0x0096500000000000ULL,
+    0x0092400000000000ULL, 0x0093f00000000000ULL, 0x0091200000000000ULL, 0x0090900000000000ULL
+  },
+  {
+    0x0000000000000000ULL, 0x000001b000000000ULL, 0x0000036000000000ULL, 0x000002d000000000ULL,
+    0x000006c000000000ULL, 0x0000077000000000ULL, 0x000005a000000000ULL, 0x0000041000000000ULL,
+    0x00000d8000000000ULL, 0x00000c3000000000ULL, 0x00000ee000000000ULL, 0x00000f5000000000ULL,
+    0x00000b4000000000ULL, 0x00000af000000000ULL, 0x0000082000000000ULL, 0x0000099000000000ULL,
+    0x00001b0000000000ULL, 0x00001ab000000000ULL, 0x0000186000000000ULL, 0x000019d000000000ULL,
+    0x00001dc000000000ULL, 0x00001c7000000000ULL, 0x00001ea000000000ULL, 0x00001f1000000000ULL,
+    0x0000168000000000ULL, 0x0000173000000000ULL, 0x000015e000000000ULL, 0x0000145000000000ULL,
+    0x0000104000000000ULL, 0x000011f000000000ULL, 0x0000132000000000ULL, 0x0000129000000000ULL,
+    0x0000360000000000ULL, 0x000037b000000000ULL, 0x0000356000000000ULL, 0x000034d000000000ULL,
+    0x000030c000000000ULL, 0x0000317000000000ULL, 0x000033a000000000ULL, 0x0000321000000000ULL,
+    0x00003b8000000000ULL, 0x00003a3000000000ULL, 0x000038e000000000ULL, 0x0000395000000000ULL,
+    0x00003d4000000000ULL, 0x00003cf000000000ULL, 0x00003e2000000000ULL, 0x00003f9000000000ULL,
+    0x00002d0000000000ULL, 0x00002cb000000000ULL, 0x00002e6000000000ULL, 0x00002fd000000000ULL,
+    0x00002bc000000000ULL, 0x00002a7000000000ULL, 0x000028a000000000ULL, 0x0000291000000000ULL,
+    0x0000208000000000ULL, 0x0000213000000000ULL, 0x000023e000000000ULL, 0x0000225000000000ULL,
+    0x0000264000000000ULL, 0x000027f000000000ULL, 0x0000252000000000ULL, 0x0000249000000000ULL,
+    0x00006c0000000000ULL, 0x00006db000000000ULL, 0x00006f6000000000ULL, 0x00006ed000000000ULL,
+    0x00006ac000000000ULL, 0x00006b7000000000ULL, 0x000069a000000000ULL, 0x0000681000000000ULL,
+    0x0000618000000000ULL, 0x0000603000000000ULL, 0x000062e000000000ULL, 0x0000635000000000ULL,
+    0x0000674000000000ULL, 0x000066f000000000ULL, 0x0000642000000000ULL, 0x0000659000000000ULL,
+    0x0000770000000000ULL, 0x000076b000000000ULL, 0x0000746000000000ULL, 0x000075d000000000ULL,
+    0x000071c000000000ULL, 0x0000707000000000ULL, 0x000072a000000000ULL, 0x0000731000000000ULL,
+    0x00007a8000000000ULL, 0x00007b3000000000ULL, 0x000079e000000000ULL, 0x0000785000000000ULL,
+    0x00007c4000000000ULL, 0x00007df000000000ULL, 0x00007f2000000000ULL, 0x00007e9000000000ULL,
+    0x00005a0000000000ULL, 0x00005bb000000000ULL, 0x0000596000000000ULL, 0x000058d000000000ULL,
+    0x00005cc000000000ULL, 0x00005d7000000000ULL, 0x00005fa000000000ULL, 0x00005e1000000000ULL,
+    0x0000578000000000ULL, 0x0000563000000000ULL, 0x000054e000000000ULL, 0x0000555000000000ULL,
+    0x0000514000000000ULL, 0x000050f000000000ULL, 0x0000522000000000ULL, 0x0000539000000000ULL,
+    0x0000410000000000ULL, 0x000040b000000000ULL, 0x0000426000000000ULL, 0x000043d000000000ULL,
+    0x000047c000000000ULL, 0x0000467000000000ULL, 0x000044a000000000ULL, 0x0000451000000000ULL,
+    0x00004c8000000000ULL, 0x00004d3000000000ULL, 0x00004fe000000000ULL, 0x00004e5000000000ULL,
+    0x00004a4000000000ULL, 0x00004bf000000000ULL, 0x0000492000000000ULL, 0x0000489000000000ULL,
+    0x0000d80000000000ULL, 0x0000d9b000000000ULL, 0x0000db6000000000ULL, 0x0000dad000000000ULL,
+    0x0000dec000000000ULL, 0x0000df7000000000ULL, 0x0000dda000000000ULL, 0x0000dc1000000000ULL,
+    0x0000d58000000000ULL, 0x0000d43000000000ULL, 0x0000d6e000000000ULL, 0x0000d75000000000ULL,
+    0x0000d34000000000ULL, 0x0000d2f000000000ULL, 0x0000d02000000000ULL, 0x0000d19000000000ULL,
+    0x0000c30000000000ULL, 0x0000c2b000000000ULL, 0x0000c06000000000ULL, 0x0000c1d000000000ULL,
+    0x0000c5c000000000ULL, 0x0000c47000000000ULL, 0x0000c6a000000000ULL, 0x0000c71000000000ULL,
+    0x0000ce8000000000ULL, 0x0000cf3000000000ULL, 0x0000cde000000000ULL, 0x0000cc5000000000ULL,
+    0x0000c84000000000ULL, 0x0000c9f000000000ULL, 0x0000cb2000000000ULL, 0x0000ca9000000000ULL,
+    0x0000ee0000000000ULL, 0x0000efb000000000ULL, 0x0000ed6000000000ULL, 0x0000ecd000000000ULL,
+    0x0000e8c000000000ULL, 0x0000e97000000000ULL, 0x0000eba000000000ULL, 0x0000ea1000000000ULL,
+    0x0000e38000000000ULL, 0x0000e23000000000ULL, 0x0000e0e000000000ULL, 0x0000e15000000000ULL,
+    0x0000e54000000000ULL, 0x0000e4f000000000ULL, 0x0000e62000000000ULL, 0x0000e79000000000ULL,
+    0x0000f50000000000ULL, 0x0000f4b000000000ULL, 0x0000f66000000000ULL, 0x0000f7d000000000ULL,
+    0x0000f3c000000000ULL, 0x0000f27000000000ULL, 0x0000f0a000000000ULL, 0x0000f11000000000ULL,
+    0x0000f88000000000ULL, 0x0000f93000000000ULL, 0x0000fbe000000000ULL, 0x0000fa5000000000ULL,
+    0x0000fe4000000000ULL, 0x0000fff000000000ULL, 0x0000fd2000000000ULL, 0x0000fc9000000000ULL,
+    0x0000b40000000000ULL, 0x0000b5b000000000ULL, 0x0000b76000000000ULL, 0x0000b6d000000000ULL,
+    0x0000b2c000000000ULL, 0x0000b37000000000ULL, 0x0000b1a000000000ULL, 0x0000b01000000000ULL,
+    0x0000b98000000000ULL, 0x0000b83000000000ULL, 0x0000bae000000000ULL, 0x0000bb5000000000ULL,
+    0x0000bf4000000000ULL, 0x0000bef000000000ULL, 0x0000bc2000000000ULL, 0x0000bd9000000000ULL,
+    0x0000af0000000000ULL, 0x0000aeb000000000ULL, 0x0000ac6000000000ULL, 0x0000add000000000ULL,
+    0x0000a9c000000000ULL, 0x0000a87000000000ULL, 0x0000aaa000000000ULL, 0x0000ab1000000000ULL,
+    0x0000a28000000000ULL, 0x0000a33000000000ULL, 0x0000a1e000000000ULL, 0x0000a05000000000ULL,
+    0x0000a44000000000ULL, 0x0000a5f000000000ULL, 0x0000a72000000000ULL, 0x0000a69000000000ULL,
+    0x0000820000000000ULL, 0x000083b000000000ULL, 0x0000816000000000ULL, 0x000080d000000000ULL,
+    0x000084c000000000ULL, 0x0000857000000000ULL, 0x000087a000000000ULL, 0x0000861000000000ULL,
+    0x00008f8000000000ULL, 0x00008e3000000000ULL, 0x00008ce000000000ULL, 0x00008d5000000000ULL,
+    0x0000894000000000ULL, 0x000088f000000000ULL, 0x00008a2000000000ULL, 0x00008b9000000000ULL,
+    0x0000990000000000ULL, 0x000098b000000000ULL, 0x00009a6000000000ULL, 0x00009bd000000000ULL,
+    0x00009fc000000000ULL, 0x00009e7000000000ULL, 0x00009ca000000000ULL, 0x00009d1000000000ULL,
+    0x0000948000000000ULL, 0x0000953000000000ULL, 0x000097e000000000ULL, 0x0000965000000000ULL,
+    0x0000924000000000ULL, 0x000093f000000000ULL, 0x0000912000000000ULL, 0x0000909000000000ULL
+  },
+  {
+    0x0000000000000000ULL, 0x00000001b0000000ULL, 0x0000000360000000ULL, 0x00000002d0000000ULL,
+    0x00000006c0000000ULL, 0x0000000770000000ULL, 0x00000005a0000000ULL, 0x0000000410000000ULL,
+    0x0000000d80000000ULL, 0x0000000c30000000ULL, 0x0000000ee0000000ULL, 0x0000000f50000000ULL,
+    0x0000000b40000000ULL, 0x0000000af0000000ULL, 0x0000000820000000ULL, 0x0000000990000000ULL,
+    0x0000001b00000000ULL, 0x0000001ab0000000ULL, 0x0000001860000000ULL, 0x00000019d0000000ULL,
+    0x0000001dc0000000ULL, 0x0000001c70000000ULL, 0x0000001ea0000000ULL, 0x0000001f10000000ULL,
+    0x0000001680000000ULL, 0x0000001730000000ULL, 0x00000015e0000000ULL, 0x0000001450000000ULL,
+    0x0000001040000000ULL, 0x00000011f0000000ULL, 0x0000001320000000ULL, 0x0000001290000000ULL,
+    0x0000003600000000ULL, 0x00000037b0000000ULL, 0x0000003560000000ULL, 0x00000034d0000000ULL,
+    0x00000030c0000000ULL, 0x0000003170000000ULL, 0x00000033a0000000ULL, 0x0000003210000000ULL,
+    0x0000003b80000000ULL, 0x0000003a30000000ULL, 0x00000038e0000000ULL, 0x0000003950000000ULL,
+    0x0000003d40000000ULL, 0x0000003cf0000000ULL, 0x0000003e20000000ULL, 0x0000003f90000000ULL,
+    0x0000002d00000000ULL, 0x0000002cb0000000ULL, 0x0000002e60000000ULL, 0x0000002fd0000000ULL,
+    0x0000002bc0000000ULL, 0x0000002a70000000ULL, 0x00000028a0000000ULL, 0x0000002910000000ULL,
+    0x0000002080000000ULL, 0x0000002130000000ULL, 0x00000023e0000000ULL, 0x0000002250000000ULL,
+    0x0000002640000000ULL, 0x00000027f0000000ULL, 0x0000002520000000ULL, 0x0000002490000000ULL,
+    0x0000006c00000000ULL, 0x0000006db0000000ULL, 0x0000006f60000000ULL, 0x0000006ed0000000ULL,
+    0x0000006ac0000000ULL, 0x0000006b70000000ULL, 0x00000069a0000000ULL, 0x0000006810000000ULL,
+    0x0000006180000000ULL, 0x0000006030000000ULL, 0x00000062e0000000ULL, 0x0000006350000000ULL,
+    0x0000006740000000ULL, 0x00000066f0000000ULL, 0x0000006420000000ULL, 0x0000006590000000ULL,
+    0x0000007700000000ULL, 0x00000076b0000000ULL, 0x0000007460000000ULL, 0x00000075d0000000ULL,
+    0x00000071c0000000ULL, 0x0000007070000000ULL, 0x00000072a0000000ULL, 0x0000007310000000ULL,
+    0x0000007a80000000ULL, 0x0000007b30000000ULL, 0x00000079e0000000ULL, 0x0000007850000000ULL,
+    0x0000007c40000000ULL, 0x0000007df0000000ULL, 0x0000007f20000000ULL, 0x0000007e90000000ULL,
+    0x0000005a00000000ULL, 0x0000005bb0000000ULL, 0x0000005960000000ULL, 0x00000058d0000000ULL,
+    0x0000005cc0000000ULL, 0x0000005d70000000ULL, 0x0000005fa0000000ULL, 0x0000005e10000000ULL,
+    0x0000005780000000ULL, 0x0000005630000000ULL, 0x00000054e0000000ULL, 0x0000005550000000ULL,
+    0x0000005140000000ULL, 0x00000050f0000000ULL, 0x0000005220000000ULL, 0x0000005390000000ULL,
+    0x0000004100000000ULL, 0x00000040b0000000ULL, 0x0000004260000000ULL, 0x00000043d0000000ULL,
+    0x00000047c0000000ULL, 0x0000004670000000ULL, 0x00000044a0000000ULL, 0x0000004510000000ULL,
+    0x0000004c80000000ULL, 0x0000004d30000000ULL, 0x0000004fe0000000ULL, 0x0000004e50000000ULL,
+    0x0000004a40000000ULL, 0x0000004bf0000000ULL, 0x0000004920000000ULL, 0x0000004890000000ULL,
+    0x000000d800000000ULL, 0x000000d9b0000000ULL, 0x000000db60000000ULL, 0x000000dad0000000ULL,
+    0x000000dec0000000ULL, 0x000000df70000000ULL, 0x000000dda0000000ULL, 0x000000dc10000000ULL,
+    0x000000d580000000ULL, 0x000000d430000000ULL, 0x000000d6e0000000ULL, 0x000000d750000000ULL,
+    0x000000d340000000ULL, 0x000000d2f0000000ULL, 0x000000d020000000ULL, 0x000000d190000000ULL,
+    0x000000c300000000ULL, 0x000000c2b0000000ULL, 0x000000c060000000ULL, 0x000000c1d0000000ULL,
+    0x000000c5c0000000ULL, 0x000000c470000000ULL, 0x000000c6a0000000ULL, 0x000000c710000000ULL,
+    0x000000ce80000000ULL, 0x000000cf30000000ULL, 0x000000cde0000000ULL, 0x000000cc50000000ULL,
+    0x000000c840000000ULL, 0x000000c9f0000000ULL, 0x000000cb20000000ULL, 0x000000ca90000000ULL,
+    0x000000ee00000000ULL, 0x000000efb0000000ULL, 0x000000ed60000000ULL, 0x000000ecd0000000ULL,
+    0x000000e8c0000000ULL, 0x000000e970000000ULL, 0x000000eba0000000ULL, 0x000000ea10000000ULL,
+    0x000000e380000000ULL, 0x000000e230000000ULL, 0x000000e0e0000000ULL, 0x000000e150000000ULL,
+    0x000000e540000000ULL, 0x000000e4f0000000ULL, 0x000000e620000000ULL, 0x000000e790000000ULL,
+    0x000000f500000000ULL, 0x000000f4b0000000ULL, 0x000000f660000000ULL, 0x000000f7d0000000ULL,
+    0x000000f3c0000000ULL, 0x000000f270000000ULL, 0x000000f0a0000000ULL, 0x000000f110000000ULL,
+    0x000000f880000000ULL, 0x000000f930000000ULL, 0x000000fbe0000000ULL, 0x000000fa50000000ULL,
+    0x000000fe40000000ULL, 0x000000fff0000000ULL, 0x000000fd20000000ULL, 0x000000fc90000000ULL,
+    0x000000b400000000ULL, 0x000000b5b0000000ULL, 0x000000b760000000ULL, 0x000000b6d0000000ULL,
+    0x000000b2c0000000ULL, 0x000000b370000000ULL, 0x000000b1a0000000ULL, 0x000000b010000000ULL,
+    0x000000b980000000ULL, 0x000000b830000000ULL, 0x000000bae0000000ULL, 0x000000bb50000000ULL,
+    0x000000bf40000000ULL, 0x000000bef0000000ULL, 0x000000bc20000000ULL, 0x000000bd90000000ULL,
+    0x000000af00000000ULL, 0x000000aeb0000000ULL, 0x000000ac60000000ULL, 0x000000add0000000ULL,
+    0x000000a9c0000000ULL, 0x000000a870000000ULL, 0x000000aaa0000000ULL, 0x000000ab10000000ULL,
+    0x000000a280000000ULL, 0x000000a330000000ULL, 0x000000a1e0000000ULL, 0x000000a050000000ULL,
+    0x000000a440000000ULL, 0x000000a5f0000000ULL, 0x000000a720000000ULL, 0x000000a690000000ULL,
+    0x0000008200000000ULL, 0x00000083b0000000ULL, 0x0000008160000000ULL, 0x00000080d0000000ULL,
+    0x00000084c0000000ULL, 0x0000008570000000ULL, 0x00000087a0000000ULL, 0x0000008610000000ULL,
+    0x0000008f80000000ULL, 0x0000008e30000000ULL, 0x0000008ce0000000ULL, 0x0000008d50000000ULL,
+    0x0000008940000000ULL, 0x00000088f0000000ULL, 0x0000008a20000000ULL, 0x0000008b90000000ULL,
+    0x0000009900000000ULL, 0x00000098b0000000ULL, 0x0000009a60000000ULL, 0x0000009bd0000000ULL,
+    0x0000009fc0000000ULL, 0x0000009e70000000ULL, 0x0000009ca0000000ULL, 0x0000009d10000000ULL,
+    0x0000009480000000ULL, 0x0000009530000000ULL, 0x00000097e0000000ULL, 0x0000009650000000ULL,
+    0x0000009240000000ULL, 0x00000093f0000000ULL, 0x0000009120000000ULL, 0x0000009090000000ULL
+  },
+  {
+    0x0000000000000000ULL, 0x0000000001b00000ULL, 0x0000000003600000ULL, 0x0000000002d00000ULL,
+    0x0000000006c00000ULL, 0x0000000007700000ULL, 0x0000000005a00000ULL, 0x0000000004100000ULL,
+    0x000000000d800000ULL, 0x000000000c300000ULL, 0x000000000ee00000ULL, 0x000000000f500000ULL,
+    0x000000000b400000ULL, 0x000000000af00000ULL, 0x0000000008200000ULL, 0x0000000009900000ULL,
+    0x000000001b000000ULL, 0x000000001ab00000ULL, 0x0000000018600000ULL, 0x0000000019d00000ULL,
+    0x000000001dc00000ULL, 0x000000001c700000ULL, 0x000000001ea00000ULL, 0x000000001f100000ULL,
+    0x0000000016800000ULL, 0x0000000017300000ULL, 0x0000000015e00000ULL, 0x0000000014500000ULL,
+    0x0000000010400000ULL, 0x0000000011f00000ULL, 0x0000000013200000ULL, 0x0000000012900000ULL,
+    0x0000000036000000ULL, 0x0000000037b00000ULL, 0x0000000035600000ULL, 0x0000000034d00000ULL,
+    0x0000000030c00000ULL, 0x0000000031700000ULL, 0x0000000033a00000ULL, 0x0000000032100000ULL,
+    0x000000003b800000ULL, 0x000000003a300000ULL, 0x0000000038e00000ULL, 0x0000000039500000ULL,
+    0x000000003d400000ULL, 0x000000003cf00000ULL, 0x000000003e200000ULL, 0x000000003f900000ULL,
+    0x000000002d000000ULL, 0x000000002cb00000ULL, 0x000000002e600000ULL, 0x000000002fd00000ULL,
+    0x000000002bc00000ULL, 0x000000002a700000ULL, 0x0000000028a00000ULL, 0x0000000029100000ULL,
+    0x0000000020800000ULL, 0x0000000021300000ULL, 0x0000000023e00000ULL, 0x0000000022500000ULL,
+    0x0000000026400000ULL, 0x0000000027f00000ULL, 0x0000000025200000ULL, 0x0000000024900000ULL,
+    0x000000006c000000ULL, 0x000000006db00000ULL, 0x000000006f600000ULL, 0x000000006ed00000ULL,
+    0x000000006ac00000ULL, 0x000000006b700000ULL, 0x0000000069a00000ULL, 0x0000000068100000ULL,
+    0x0000000061800000ULL, 0x0000000060300000ULL, 0x0000000062e00000ULL, 0x0000000063500000ULL,
+    0x0000000067400000ULL, 0x0000000066f00000ULL, 0x0000000064200000ULL, 0x0000000065900000ULL,
+    0x0000000077000000ULL, 0x0000000076b00000ULL, 0x0000000074600000ULL, 0x0000000075d00000ULL,
+    0x0000000071c00000ULL, 0x0000000070700000ULL, 0x0000000072a00000ULL, 0x0000000073100000ULL,
+    0x000000007a800000ULL, 0x000000007b300000ULL, 0x0000000079e00000ULL, 0x0000000078500000ULL,
+    0x000000007c400000ULL, 0x000000007df00000ULL, 0x000000007f200000ULL, 0x000000007e900000ULL,
+    0x000000005a000000ULL, 0x000000005bb00000ULL, 0x0000000059600000ULL, 0x0000000058d00000ULL,
+    0x000000005cc00000ULL, 0x000000005d700000ULL, 0x000000005fa00000ULL, 0x000000005e100000ULL,
+    0x0000000057800000ULL, 0x0000000056300000ULL, 0x0000000054e00000ULL, 0x0000000055500000ULL,
+    0x0000000051400000ULL, 0x0000000050f00000ULL, 0x0000000052200000ULL, 0x0000000053900000ULL,
+    0x0000000041000000ULL, 0x0000000040b00000ULL, 0x0000000042600000ULL, 0x0000000043d00000ULL,
+    0x0000000047c00000ULL, 0x0000000046700000ULL, 0x0000000044a00000ULL, 0x0000000045100000ULL,
+    0x000000004c800000ULL, 0x000000004d300000ULL, 0x000000004fe00000ULL, 0x000000004e500000ULL,
+    0x000000004a400000ULL, 0x000000004bf00000ULL, 0x0000000049200000ULL, 0x0000000048900000ULL,
+    0x00000000d8000000ULL, 0x00000000d9b00000ULL, 0x00000000db600000ULL, 0x00000000dad00000ULL,
+    0x00000000dec00000ULL, 0x00000000df700000ULL, 0x00000000dda00000ULL, 0x00000000dc100000ULL,
+    0x00000000d5800000ULL, 0x00000000d4300000ULL, 0x00000000d6e00000ULL, 0x00000000d7500000ULL,
+    0x00000000d3400000ULL, 0x00000000d2f00000ULL, 0x00000000d0200000ULL, 0x00000000d1900000ULL,
+    0x00000000c3000000ULL, 0x00000000c2b00000ULL, 0x00000000c0600000ULL, 0x00000000c1d00000ULL,
+    0x00000000c5c00000ULL, 0x00000000c4700000ULL, 0x00000000c6a00000ULL, 0x00000000c7100000ULL,
+    0x00000000ce800000ULL, 0x00000000cf300000ULL, 0x00000000cde00000ULL, 0x00000000cc500000ULL,
+    0x00000000c8400000ULL, 0x00000000c9f00000ULL, 0x00000000cb200000ULL, 0x00000000ca900000ULL,
+    0x00000000ee000000ULL, 0x00000000efb00000ULL, 0x00000000ed600000ULL, 0x00000000ecd00000ULL,
+    0x00000000e8c00000ULL, 0x00000000e9700000ULL, 0x00000000eba00000ULL, 0x00000000ea100000ULL,
+    0x00000000e3800000ULL, 0x00000000e2300000ULL, 0x00000000e0e00000ULL, 0x00000000e1500000ULL,
+    0x00000000e5400000ULL, 0x00000000e4f00000ULL, 0x00000000e6200000ULL, 0x00000000e7900000ULL,
+    0x00000000f5000000ULL, 0x00000000f4b00000ULL, 0x00000000f6600000ULL, 0x00000000f7d00000ULL,
+    0x00000000f3c00000ULL, 0x00000000f2700000ULL, 0x00000000f0a00000ULL, 0x00000000f1100000ULL,
+    0x00000000f8800000ULL, 0x00000000f9300000ULL, 0x00000000fbe00000ULL, 0x00000000fa500000ULL,
+    0x00000000fe400000ULL, 0x00000000fff00000ULL, 0x00000000fd200000ULL, 0x00000000fc900000ULL,
+    0x00000000b4000000ULL, 0x00000000b5b00000ULL, 0x00000000b7600000ULL, 0x00000000b6d00000ULL,
+    0x00000000b2c00000ULL, 0x00000000b3700000ULL, 0x00000000b1a00000ULL, 0x00000000b0100000ULL,
+    0x00000000b9800000ULL, 0x00000000b8300000ULL, 0x00000000bae00000ULL, 0x00000000bb500000ULL,
+    0x00000000bf400000ULL, 0x00000000bef00000ULL, 0x00000000bc200000ULL, 0x00000000bd900000ULL,
+    0x00000000af000000ULL, 0x00000000aeb00000ULL, 0x00000000ac600000ULL, 0x00000000add00000ULL,
+    0x00000000a9c00000ULL, 0x00000000a8700000ULL, 0x00000000aaa00000ULL, 0x00000000ab100000ULL,
+    0x00000000a2800000ULL, 0x00000000a3300000ULL, 0x00000000a1e00000ULL, 0x00000000a0500000ULL,
+    0x00000000a4400000ULL, 0x00000000a5f00000ULL, 0x00000000a7200000ULL, 0x00000000a6900000ULL,
+    0x0000000082000000ULL, 0x0000000083b00000ULL, 0x0000000081600000ULL, 0x0000000080d00000ULL,
+    0x0000000084c00000ULL, 0x0000000085700000ULL, 0x0000000087a00000ULL, 0x0000000086100000ULL,
+    0x000000008f800000ULL, 0x000000008e300000ULL, 0x000000008ce00000ULL, 0x000000008d500000ULL,
+    0x0000000089400000ULL, 0x0000000088f00000ULL, 0x000000008a200000ULL, 0x000000008b900000ULL,
+    0x0000000099000000ULL, 0x0000000098b00000ULL, 0x000000009a600000ULL, 0x000000009bd00000ULL,
+    0x000000009fc00000ULL, 0x000000009e700000ULL, 0x000000009ca00000ULL, 0x000000009d100000ULL,
+    0x0000000094800000ULL, 0x0000000095300000ULL, 0x0000000097e00000ULL, 0x0000000096500000ULL,
+    0x0000000092400000ULL, 0x0000000093f00000ULL, 0x0000000091200000ULL, 0x0000000090900000ULL
+  },
+  {
+    0x0000000000000000ULL, 0x000000000001b000ULL, 0x0000000000036000ULL, 0x000000000002d000ULL,
+    0x000000000006c000ULL, 0x0000000000077000ULL, 0x000000000005a000ULL, 0x0000000000041000ULL,
+    0x00000000000d8000ULL, 0x00000000000c3000ULL, 0x00000000000ee000ULL, 0x00000000000f5000ULL,
+    0x00000000000b4000ULL, 0x00000000000af000ULL, 0x0000000000082000ULL, 0x0000000000099000ULL,
+    0x00000000001b0000ULL, 0x00000000001ab000ULL, 0x0000000000186000ULL, 0x000000000019d000ULL,
+    0x00000000001dc000ULL, 0x00000000001c7000ULL, 0x00000000001ea000ULL, 0x00000000001f1000ULL,
+    0x0000000000168000ULL, 0x0000000000173000ULL, 0x000000000015e000ULL, 0x0000000000145000ULL,
+    0x0000000000104000ULL, 0x000000000011f000ULL, 0x0000000000132000ULL, 0x0000000000129000ULL,
+    0x0000000000360000ULL, 0x000000000037b000ULL, 0x0000000000356000ULL, 0x000000000034d000ULL,
+    0x000000000030c000ULL, 0x0000000000317000ULL, 0x000000000033a000ULL, 0x0000000000321000ULL,
+    0x00000000003b8000ULL, 0x00000000003a3000ULL, 0x000000000038e000ULL, 0x0000000000395000ULL,
+    0x00000000003d4000ULL, 0x00000000003cf000ULL, 0x00000000003e2000ULL, 0x00000000003f9000ULL,
+    0x00000000002d0000ULL, 0x00000000002cb000ULL, 0x00000000002e6000ULL, 0x00000000002fd000ULL,
+    0x00000000002bc000ULL, 0x00000000002a7000ULL, 0x000000000028a000ULL, 0x0000000000291000ULL,
+    0x0000000000208000ULL, 0x0000000000213000ULL, 0x000000000023e000ULL, 0x0000000000225000ULL,
+    0x0000000000264000ULL, 0x000000000027f000ULL, 0x0000000000252000ULL, 0x0000000000249000ULL,
+    0x00000000006c0000ULL, 0x00000000006db000ULL, 0x00000000006f6000ULL, 0x00000000006ed000ULL,
+    0x00000000006ac000ULL, 0x00000000006b7000ULL, 0x000000000069a000ULL, 0x0000000000681000ULL,
+    0x0000000000618000ULL, 0x0000000000603000ULL, 0x000000000062e000ULL, 0x0000000000635000ULL,
+    0x0000000000674000ULL, 0x000000000066f000ULL, 0x0000000000642000ULL, 0x0000000000659000ULL,
+    0x0000000000770000ULL, 0x000000000076b000ULL, 0x0000000000746000ULL, 0x000000000075d000ULL,
+    0x000000000071c000ULL, 0x0000000000707000ULL, 0x000000000072a000ULL, 0x0000000000731000ULL,
+    0x00000000007a8000ULL, 0x00000000007b3000ULL, 0x000000000079e000ULL, 0x0000000000785000ULL,
+    0x00000000007c4000ULL, 0x00000000007df000ULL, 0x00000000007f2000ULL, 0x00000000007e9000ULL,
+    0x00000000005a0000ULL, 0x00000000005bb000ULL, 0x0000000000596000ULL, 0x000000000058d000ULL,
+    0x00000000005cc000ULL, 0x00000000005d7000ULL, 0x00000000005fa000ULL, 0x00000000005e1000ULL,
+    0x0000000000578000ULL, 0x0000000000563000ULL, 0x000000000054e000ULL, 0x0000000000555000ULL,
+    0x0000000000514000ULL, 0x000000000050f000ULL, 0x0000000000522000ULL, 0x0000000000539000ULL,
+    0x0000000000410000ULL, 0x000000000040b000ULL, 0x0000000000426000ULL, 0x000000000043d000ULL,
+    0x000000000047c000ULL, 0x0000000000467000ULL, 0x000000000044a000ULL, 0x0000000000451000ULL,
+    0x00000000004c8000ULL, 0x00000000004d3000ULL, 0x00000000004fe000ULL, 0x00000000004e5000ULL,
+    0x00000000004a4000ULL, 0x00000000004bf000ULL, 0x0000000000492000ULL, 0x0000000000489000ULL,
+    0x0000000000d80000ULL, 0x0000000000d9b000ULL, 0x0000000000db6000ULL, 0x0000000000dad000ULL,
+    0x0000000000dec000ULL, 0x0000000000df7000ULL, 0x0000000000dda000ULL, 0x0000000000dc1000ULL,
+    0x0000000000d58000ULL, 0x0000000000d43000ULL, 0x0000000000d6e000ULL, 0x0000000000d75000ULL,
+    0x0000000000d34000ULL, 0x0000000000d2f000ULL, 0x0000000000d02000ULL, 0x0000000000d19000ULL,
+    0x0000000000c30000ULL, 0x0000000000c2b000ULL, 0x0000000000c06000ULL, 0x0000000000c1d000ULL,
+    0x0000000000c5c000ULL, 0x0000000000c47000ULL, 0x0000000000c6a000ULL, 0x0000000000c71000ULL,
+    0x0000000000ce8000ULL, 0x0000000000cf3000ULL, 0x0000000000cde000ULL, 0x0000000000cc5000ULL,
+    0x0000000000c84000ULL, 0x0000000000c9f000ULL, 0x0000000000cb2000ULL, 0x0000000000ca9000ULL,
+    0x0000000000ee0000ULL, 0x0000000000efb000ULL, 0x0000000000ed6000ULL, 0x0000000000ecd000ULL,
+    0x0000000000e8c000ULL, 0x0000000000e97000ULL, 0x0000000000eba000ULL, 0x0000000000ea1000ULL,
+    0x0000000000e38000ULL, 0x0000000000e23000ULL, 0x0000000000e0e000ULL, 0x0000000000e15000ULL,
+    0x0000000000e54000ULL, 0x0000000000e4f000ULL, 0x0000000000e62000ULL, 0x0000000000e79000ULL,
+    0x0000000000f50000ULL, 0x0000000000f4b000ULL, 0x0000000000f66000ULL, 0x0000000000f7d000ULL,
+    0x0000000000f3c000ULL, 0x0000000000f27000ULL, 0x0000000000f0a000ULL, 0x0000000000f11000ULL,
+    0x0000000000f88000ULL, 0x0000000000f93000ULL, 0x0000000000fbe000ULL, 0x0000000000fa5000ULL,
+    0x0000000000fe4000ULL, 0x0000000000fff000ULL, 0x0000000000fd2000ULL, 0x0000000000fc9000ULL,
+    0x0000000000b40000ULL, 0x0000000000b5b000ULL, 0x0000000000b76000ULL, 0x0000000000b6d000ULL,
+    0x0000000000b2c000ULL, 0x0000000000b37000ULL, 0x0000000000b1a000ULL, 0x0000000000b01000ULL,
+    0x0000000000b98000ULL, 0x0000000000b83000ULL, 0x0000000000bae000ULL, 0x0000000000bb5000ULL,
+    0x0000000000bf4000ULL, 0x0000000000bef000ULL, 0x0000000000bc2000ULL, 0x0000000000bd9000ULL,
+    0x0000000000af0000ULL, 0x0000000000aeb000ULL, 0x0000000000ac6000ULL, 0x0000000000add000ULL,
+    0x0000000000a9c000ULL, 0x0000000000a87000ULL, 0x0000000000aaa000ULL, 0x0000000000ab1000ULL,
+    0x0000000000a28000ULL, 0x0000000000a33000ULL, 0x0000000000a1e000ULL, 0x0000000000a05000ULL,
+    0x0000000000a44000ULL, 0x0000000000a5f000ULL, 0x0000000000a72000ULL, 0x0000000000a69000ULL,
+    0x0000000000820000ULL, 0x000000000083b000ULL, 0x0000000000816000ULL, 0x000000000080d000ULL,
+    0x000000000084c000ULL, 0x0000000000857000ULL, 0x000000000087a000ULL, 0x0000000000861000ULL,
+    0x00000000008f8000ULL, 0x00000000008e3000ULL, 0x00000000008ce000ULL, 0x00000000008d5000ULL,
+    0x0000000000894000ULL, 0x000000000088f000ULL, 0x00000000008a2000ULL, 0x00000000008b9000ULL,
+    0x0000000000990000ULL, 0x000000000098b000ULL, 0x00000000009a6000ULL, 0x00000000009bd000ULL,
+    0x00000000009fc000ULL, 0x00000000009e7000ULL, 0x00000000009ca000ULL, 0x00000000009d1000ULL,
+    0x0000000000948000ULL, 0x0000000000953000ULL, 0x000000000097e000ULL, 0x0000000000965000ULL,
+    0x0000000000924000ULL, 0x000000000093f000ULL, 0x0000000000912000ULL, 0x0000000000909000ULL
+  },
+  {
+    0x0000000000000000ULL, 0x00000000000001b0ULL, 0x0000000000000360ULL, 0x00000000000002d0ULL,
+    0x00000000000006c0ULL, 0x0000000000000770ULL, 0x00000000000005a0ULL, 0x0000000000000410ULL,
+    0x0000000000000d80ULL, 0x0000000000000c30ULL, 0x0000000000000ee0ULL, 0x0000000000000f50ULL,
+    0x0000000000000b40ULL, 0x0000000000000af0ULL, 0x0000000000000820ULL, 0x0000000000000990ULL,
+    0x0000000000001b00ULL, 0x0000000000001ab0ULL, 0x0000000000001860ULL, 0x00000000000019d0ULL,
+    0x0000000000001dc0ULL, 0x0000000000001c70ULL, 0x0000000000001ea0ULL, 0x0000000000001f10ULL,
+    0x0000000000001680ULL, 0x0000000000001730ULL, 0x00000000000015e0ULL, 0x0000000000001450ULL,
+    0x0000000000001040ULL, 0x00000000000011f0ULL, 0x0000000000001320ULL, 0x0000000000001290ULL,
+    0x0000000000003600ULL, 0x00000000000037b0ULL, 0x0000000000003560ULL, 0x00000000000034d0ULL,
+    0x00000000000030c0ULL, 0x0000000000003170ULL, 0x00000000000033a0ULL, 0x0000000000003210ULL,
+    0x0000000000003b80ULL, 0x0000000000003a30ULL, 0x00000000000038e0ULL, 0x0000000000003950ULL,
+    0x0000000000003d40ULL, 0x0000000000003cf0ULL, 0x0000000000003e20ULL, 0x0000000000003f90ULL,
+    0x0000000000002d00ULL, 0x0000000000002cb0ULL, 0x0000000000002e60ULL, 0x0000000000002fd0ULL,
+    0x0000000000002bc0ULL, 0x0000000000002a70ULL, 0x00000000000028a0ULL, 0x0000000000002910ULL,
+    0x0000000000002080ULL, 0x0000000000002130ULL, 0x00000000000023e0ULL, 0x0000000000002250ULL,
+    0x0000000000002640ULL, 0x00000000000027f0ULL, 0x0000000000002520ULL, 0x0000000000002490ULL,
+    0x0000000000006c00ULL, 0x0000000000006db0ULL, 0x0000000000006f60ULL, 0x0000000000006ed0ULL,
+    0x0000000000006ac0ULL, 0x0000000000006b70ULL, 0x00000000000069a0ULL, 0x0000000000006810ULL,
+    0x0000000000006180ULL, 0x0000000000006030ULL, 0x00000000000062e0ULL, 0x0000000000006350ULL,
+    0x0000000000006740ULL, 0x00000000000066f0ULL, 0x0000000000006420ULL, 0x0000000000006590ULL,
+    0x0000000000007700ULL, 0x00000000000076b0ULL, 0x0000000000007460ULL, 0x00000000000075d0ULL,
+    0x00000000000071c0ULL, 0x0000000000007070ULL, 0x00000000000072a0ULL, 0x0000000000007310ULL,
+    0x0000000000007a80ULL, 0x0000000000007b30ULL, 0x00000000000079e0ULL, 0x0000000000007850ULL,
+    0x0000000000007c40ULL, 0x0000000000007df0ULL, 0x0000000000007f20ULL, 0x0000000000007e90ULL,
+    0x0000000000005a00ULL, 0x0000000000005bb0ULL, 0x0000000000005960ULL, 0x00000000000058d0ULL,
+    0x0000000000005cc0ULL, 0x0000000000005d70ULL, 0x0000000000005fa0ULL, 0x0000000000005e10ULL,
+    0x0000000000005780ULL, 0x0000000000005630ULL, 0x00000000000054e0ULL, 0x0000000000005550ULL,
+    0x0000000000005140ULL, 0x00000000000050f0ULL, 0x0000000000005220ULL, 0x0000000000005390ULL,
+    0x0000000000004100ULL, 0x00000000000040b0ULL, 0x0000000000004260ULL, 0x00000000000043d0ULL,
+    0x00000000000047c0ULL, 0x0000000000004670ULL, 0x00000000000044a0ULL, 0x0000000000004510ULL,
+    0x0000000000004c80ULL, 0x0000000000004d30ULL, 0x0000000000004fe0ULL, 0x0000000000004e50ULL,
+    0x0000000000004a40ULL, 0x0000000000004bf0ULL, 0x0000000000004920ULL, 0x0000000000004890ULL,
+    0x000000000000d800ULL, 0x000000000000d9b0ULL, 0x000000000000db60ULL, 0x000000000000dad0ULL,
+    0x000000000000dec0ULL, 0x000000000000df70ULL, 0x000000000000dda0ULL, 0x000000000000dc10ULL,
+    0x000000000000d580ULL, 0x000000000000d430ULL, 0x000000000000d6e0ULL, 0x000000000000d750ULL,
+    0x000000000000d340ULL, 0x000000000000d2f0ULL, 0x000000000000d020ULL, 0x000000000000d190ULL,
+    0x000000000000c300ULL, 0x000000000000c2b0ULL, 0x000000000000c060ULL, 0x000000000000c1d0ULL,
+    0x000000000000c5c0ULL, 0x000000000000c470ULL, 0x000000000000c6a0ULL, 0x000000000000c710ULL,
+    0x000000000000ce80ULL, 0x000000000000cf30ULL, 0x000000000000cde0ULL, 0x000000000000cc50ULL,
+    0x000000000000c840ULL, 0x000000000000c9f0ULL, 0x000000000000cb20ULL, 0x000000000000ca90ULL,
+    0x000000000000ee00ULL, 0x000000000000efb0ULL, 0x000000000000ed60ULL, 0x000000000000ecd0ULL,
+    0x000000000000e8c0ULL, 0x000000000000e970ULL, 0x000000000000eba0ULL, 0x000000000000ea10ULL,
+    0x000000000000e380ULL, 0x000000000000e230ULL, 0x000000000000e0e0ULL, 0x000000000000e150ULL,
+    0x000000000000e540ULL, 0x000000000000e4f0ULL, 0x000000000000e620ULL, 0x000000000000e790ULL,
+    0x000000000000f500ULL, 0x000000000000f4b0ULL, 0x000000000000f660ULL, 0x000000000000f7d0ULL,
+    0x000000000000f3c0ULL, 0x000000000000f270ULL, 0x000000000000f0a0ULL, 0x000000000000f110ULL,
+    0x000000000000f880ULL, 0x000000000000f930ULL, 0x000000000000fbe0ULL, 0x000000000000fa50ULL,
+    0x000000000000fe40ULL, 0x000000000000fff0ULL, 0x000000000000fd20ULL, 0x000000000000fc90ULL,
+    0x000000000000b400ULL, 0x000000000000b5b0ULL, 0x000000000000b760ULL, 0x000000000000b6d0ULL,
+    0x000000000000b2c0ULL, 0x000000000000b370ULL, 0x000000000000b1a0ULL, 0x000000000000b010ULL,
+    0x000000000000b980ULL, 0x000000000000b830ULL, 0x000000000000bae0ULL, 0x000000000000bb50ULL,
+    0x000000000000bf40ULL, 0x000000000000bef0ULL, 0x000000000000bc20ULL, 0x000000000000bd90ULL,
+    0x000000000000af00ULL, 0x000000000000aeb0ULL, 0x000000000000ac60ULL, 0x000000000000add0ULL,
+    0x000000000000a9c0ULL, 0x000000000000a870ULL, 0x000000000000aaa0ULL, 0x000000000000ab10ULL,
+    0x000000000000a280ULL, 0x000000000000a330ULL, 0x000000000000a1e0ULL, 0x000000000000a050ULL,
+    0x000000000000a440ULL, 0x000000000000a5f0ULL, 0x000000000000a720ULL, 0x000000000000a690ULL,
+    0x0000000000008200ULL, 0x00000000000083b0ULL, 0x0000000000008160ULL, 0x00000000000080d0ULL,
+    0x00000000000084c0ULL, 0x0000000000008570ULL, 0x00000000000087a0ULL, 0x0000000000008610ULL,
+    0x0000000000008f80ULL, 0x0000000000008e30ULL, 0x0000000000008ce0ULL, 0x0000000000008d50ULL,
+    0x0000000000008940ULL, 0x00000000000088f0ULL, 0x0000000000008a20ULL, 0x0000000000008b90ULL,
+    0x0000000000009900ULL, 0x00000000000098b0ULL, 0x0000000000009a60ULL, 0x0000000000009bd0ULL,
+    0x0000000000009fc0ULL, 0x0000000000009e70ULL, 0x0000000000009ca0ULL, 0x0000000000009d10ULL,
+    0x0000000000009480ULL, 0x0000000000009530ULL, 0x00000000000097e0ULL, 0x0000000000009650ULL,
+    0x0000000000009240ULL, 0x00000000000093f0ULL, 0x0000000000009120ULL, 0x0000000000009090ULL
+  },
+  {
+    0x0000000000000000ULL, 0xf500000000000001ULL, 0x5a00000000000003ULL, 0xaf00000000000002ULL,
+    0xb400000000000006ULL, 0x4100000000000007ULL, 0xee00000000000005ULL, 0x1b00000000000004ULL,
+    0xd80000000000000dULL, 0x2d0000000000000cULL, 0x820000000000000eULL, 0x770000000000000fULL,
+    0x6c0000000000000bULL, 0x990000000000000aULL, 0x3600000000000008ULL, 0xc300000000000009ULL,
+    0x000000000000001bULL, 0xf50000000000001aULL, 0x5a00000000000018ULL, 0xaf00000000000019ULL,
+    0xb40000000000001dULL, 0x410000000000001cULL, 0xee0000000000001eULL, 0x1b0000000000001fULL,
+    0xd800000000000016ULL, 0x2d00000000000017ULL, 0x8200000000000015ULL, 0x7700000000000014ULL,
+    0x6c00000000000010ULL, 0x9900000000000011ULL, 0x3600000000000013ULL, 0xc300000000000012ULL,
+    0x0000000000000036ULL, 0xf500000000000037ULL, 0x5a00000000000035ULL, 0xaf00000000000034ULL,
+    0xb400000000000030ULL, 0x4100000000000031ULL, 0xee00000000000033ULL, 0x1b00000000000032ULL,
+    0xd80000000000003bULL, 0x2d0000000000003aULL, 0x8200000000000038ULL, 0x7700000000000039ULL,
+    0x6c0000000000003dULL, 0x990000000000003cULL, 0x360000000000003eULL, 0xc30000000000003fULL,
+    0x000000000000002dULL, 0xf50000000000002cULL, 0x5a0000000000002eULL, 0xaf0000000000002fULL,
+    0xb40000000000002bULL, 0x410000000000002aULL, 0xee00000000000028ULL, 0x1b00000000000029ULL,
+    0xd800000000000020ULL, 0x2d00000000000021ULL, 0x8200000000000023ULL, 0x7700000000000022ULL,
+    0x6c00000000000026ULL, 0x9900000000000027ULL, 0x3600000000000025ULL, 0xc300000000000024ULL,
+    0x000000000000006cULL, 0xf50000000000006dULL, 0x5a0000000000006fULL, 0xaf0000000000006eULL,
+    0xb40000000000006aULL, 0x410000000000006bULL, 0xee00000000000069ULL, 0x1b00000000000068ULL,
+    0xd800000000000061ULL, 0x2d00000000000060ULL, 0x8200000000000062ULL, 0x7700000000000063ULL,
+    0x6c00000000000067ULL, 0x9900000000000066ULL, 0x3600000000000064ULL, 0xc300000000000065ULL,
+    0x0000000000000077ULL, 0xf500000000000076ULL, 0x5a00000000000074ULL, 0xaf00000000000075ULL,
+    0xb400000000000071ULL, 0x4100000000000070ULL, 0xee00000000000072ULL, 0x1b00000000000073ULL,
+    0xd80000000000007aULL, 0x2d0000000000007bULL, 0x8200000000000079ULL, 0x7700000000000078ULL,
+    0x6c0000000000007cULL, 0x990000000000007dULL, 0x360000000000007fULL, 0xc30000000000007eULL,
+    0x000000000000005aULL, 0xf50000000000005bULL, 0x5a00000000000059ULL, 0xaf00000000000058ULL,
+    0xb40000000000005cULL, 0x410000000000005dULL, 0xee0000000000005fULL, 0x1b0000000000005eULL,
+    0xd800000000000057ULL, 0x2d00000000000056ULL, 0x8200000000000054ULL, 0x7700000000000055ULL,
+    0x6c00000000000051ULL, 0x9900000000000050ULL, 0x3600000000000052ULL, 0xc300000000000053ULL,
+    0x0000000000000041ULL, 0xf500000000000040ULL, 0x5a00000000000042ULL, 0xaf00000000000043ULL,
+    0xb400000000000047ULL, 0x4100000000000046ULL, 0xee00000000000044ULL, 0x1b00000000000045ULL,
+    0xd80000000000004cULL, 0x2d0000000000004dULL, 0x820000000000004fULL, 0x770000000000004eULL,
+    0x6c0000000000004aULL, 0x990000000000004bULL, 0x3600000000000049ULL, 0xc300000000000048ULL,
+    0x00000000000000d8ULL, 0xf5000000000000d9ULL, 0x5a000000000000dbULL, 0xaf000000000000daULL,
+    0xb4000000000000deULL, 0x41000000000000dfULL, 0xee000000000000ddULL, 0x1b000000000000dcULL,
+    0xd8000000000000d5ULL, 0x2d000000000000d4ULL, 0x82000000000000d6ULL, 0x77000000000000d7ULL,
+    0x6c000000000000d3ULL, 0x99000000000000d2ULL, 0x36000000000000d0ULL, 0xc3000000000000d1ULL,
+    0x00000000000000c3ULL, 0xf5000000000000c2ULL, 0x5a000000000000c0ULL, 0xaf000000000000c1ULL,
+    0xb4000000000000c5ULL, 0x41000000000000c4ULL, 0xee000000000000c6ULL, 0x1b000000000000c7ULL,
+    0xd8000000000000ceULL, 0x2d000000000000cfULL, 0x82000000000000cdULL, 0x77000000000000ccULL,
+    0x6c000000000000c8ULL, 0x99000000000000c9ULL, 0x36000000000000cbULL, 0xc3000000000000caULL,
+    0x00000000000000eeULL, 0xf5000000000000efULL, 0x5a000000000000edULL, 0xaf000000000000ecULL,
+    0xb4000000000000e8ULL, 0x41000000000000e9ULL, 0xee000000000000ebULL, 0x1b000000000000eaULL,
+    0xd8000000000000e3ULL, 0x2d000000000000e2ULL, 0x82000000000000e0ULL, 0x77000000000000e1ULL,
+    0x6c000000000000e5ULL, 0x99000000000000e4ULL, 0x36000000000000e6ULL, 0xc3000000000000e7ULL,
+    0x00000000000000f5ULL, 0xf5000000000000f4ULL, 0x5a000000000000f6ULL, 0xaf000000000000f7ULL,
+    0xb4000000000000f3ULL, 0x41000000000000f2ULL, 0xee000000000000f0ULL, 0x1b000000000000f1ULL,
+    0xd8000000000000f8ULL, 0x2d000000000000f9ULL, 0x82000000000000fbULL, 0x77000000000000faULL,
+    0x6c000000000000feULL, 0x99000000000000ffULL, 0x36000000000000fdULL, 0xc3000000000000fcULL,
+    0x00000000000000b4ULL, 0xf5000000000000b5ULL, 0x5a000000000000b7ULL, 0xaf000000000000b6ULL,
+    0xb4000000000000b2ULL, 0x41000000000000b3ULL, 0xee000000000000b1ULL, 0x1b000000000000b0ULL,
+    0xd8000000000000b9ULL, 0x2d000000000000b8ULL, 0x82000000000000baULL, 0x77000000000000bbULL,
+    0x6c000000000000bfULL, 0x99000000000000beULL, 0x36000000000000bcULL, 0xc3000000000000bdULL,
+    0x00000000000000afULL, 0xf5000000000000aeULL, 0x5a000000000000acULL, 0xaf000000000000adULL,
+    0xb4000000000000a9ULL, 0x41000000000000a8ULL, 0xee000000000000aaULL, 0x1b000000000000abULL,
+    0xd8000000000000a2ULL, 0x2d000000000000a3ULL, 0x82000000000000a1ULL, 0x77000000000000a0ULL,
+    0x6c000000000000a4ULL, 0x99000000000000a5ULL, 0x36000000000000a7ULL, 0xc3000000000000a6ULL,
+    0x0000000000000082ULL, 0xf500000000000083ULL, 0x5a00000000000081ULL, 0xaf00000000000080ULL,
+    0xb400000000000084ULL, 0x4100000000000085ULL, 0xee00000000000087ULL, 0x1b00000000000086ULL,
+    0xd80000000000008fULL, 0x2d0000000000008eULL, 0x820000000000008cULL, 0x770000000000008dULL,
+    0x6c00000000000089ULL, 0x9900000000000088ULL, 0x360000000000008aULL, 0xc30000000000008bULL,
+    0x0000000000000099ULL, 0xf500000000000098ULL, 0x5a0000000000009aULL, 0xaf0000000000009bULL,
+    0xb40000000000009fULL, 0x410000000000009eULL, 0xee0000000000009cULL, 0x1b0000000000009dULL,
+    0xd800000000000094ULL, 0x2d00000000000095ULL, 0x8200000000000097ULL, 0x7700000000000096ULL,
+    0x6c00000000000092ULL, 0x9900000000000093ULL, 0x3600000000000091ULL, 0xc300000000000090ULL
+  }
+};
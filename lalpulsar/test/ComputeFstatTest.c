@@ -30,6 +30,10 @@
 #include <lal/LFTandTSutils.h>
 #include <lal/LALString.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // basic consistency checks of the ComputeFstat module: compare F-stat results for all
 // *available* Fstat methods against each other
 
@@ -221,7 +225,7 @@ main ( int argc, char *argv[] )
                         }
 
                       // for resampling methods, check time series extraction and consistency
-                      if ( iMethod >= FMETHOD_RESAMP_GENERIC ) {
+                      if ( iMethod >= FMETHOD_RESAMP_GENERIC && iMethod <= FMETHOD_RESAMP_BEST ) {
                         if ( first_SRC_a == NULL) {
                           XLAL_CHECK ( XLALExtractResampledTimeseries ( &first_SRC_a, &first_SRC_b, input_seg2[iMethod] ) == XLAL_SUCCESS, XLAL_EFUNC );
                           XLAL_CHECK ( first_SRC_a != NULL, XLAL_EFAULT );
@@ -281,6 +285,90 @@ main ( int argc, char *argv[] )
 
     } // for iSky < numSkyPoints
 
+  // ----- test XLALComputeFstatBatch() against sequential calls to XLALComputeFstat()
+  {
+    const UINT4 numBatchSky = 3, numBatchf1dot = 4, numBatch = numBatchSky * numBatchf1dot;
+    PulsarDopplerParams batchDopplers[numBatch];
+    FstatResults *batchResults[numBatch];
+    for ( UINT4 i = 0; i < numBatch; i ++ )
+      {
+        // interleave sky positions, so that the batch has to re-order them to re-use buffers
+        batchDopplers[i] = Doppler;
+        batchDopplers[i].Alpha += ( i % numBatchSky ) * dSky;
+        batchDopplers[i].fkdot[1] += ( i / numBatchSky ) * df1dot;
+      }
+    for ( UINT4 iMethod = FMETHOD_START; iMethod < FMETHOD_END; iMethod ++ )
+      {
+        if ( !XLALFstatMethodIsAvailable(iMethod) || (iMethod == FMETHOD_DEMOD_BEST) || (iMethod == FMETHOD_RESAMP_BEST) ) {
+          continue;
+        }
+        // one independent input per thread
+        FstatInputVector *batchInputs;
+        XLAL_CHECK ( (batchInputs = XLALCreateFstatInputVector ( 2 )) != NULL, XLAL_EFUNC );
+        optionalArgs.FstatMethod = iMethod;
+        optionalArgs.prevInput = NULL;
+        optionalArgs.resampFFTPowerOf2 = (1 == 1);
+        for ( UINT4 n = 0; n < batchInputs->length; n ++ ) {
+          XLAL_CHECK ( (batchInputs->data[n] = XLALCreateFstatInput ( catalog, minCoverFreq, maxCoverFreq, dFreq, ephem, &optionalArgs )) != NULL, XLAL_EFUNC );
+        }
+        XLAL_INIT_MEM ( batchResults );
+        XLAL_CHECK ( XLALComputeFstatBatch ( batchResults, batchInputs, batchDopplers, numBatch, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+        FstatResults *seqResults = NULL;
+        for ( UINT4 i = 0; i < numBatch; i ++ )
+          {
+            XLAL_CHECK ( XLALComputeFstat ( &seqResults, batchInputs->data[0], &batchDopplers[i], numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+            XLAL_CHECK ( batchResults[i] != NULL, XLAL_EFAULT );
+            XLAL_CHECK ( batchResults[i]->numFreqBins == numFreqBins, XLAL_EFAILED );
+            XLAL_CHECK ( batchResults[i]->doppler.Alpha == batchDopplers[i].Alpha && batchResults[i]->doppler.fkdot[1] == batchDopplers[i].fkdot[1], XLAL_EFAILED,
+                         "Method '%s': batch result %u has wrong Doppler parameters", XLALGetFstatInputMethodName(batchInputs->data[0]), i );
+            for ( UINT4 k = 0; k < numFreqBins; k ++ ) {
+              XLAL_CHECK ( batchResults[i]->twoF[k] == seqResults->twoF[k], XLAL_EFAILED,
+                           "Method '%s': batch 2F[%u] = %g at point %u differs from sequential 2F = %g", XLALGetFstatInputMethodName(batchInputs->data[0]), k, batchResults[i]->twoF[k], i, seqResults->twoF[k] );
+            }
+            XLALDestroyFstatResults ( batchResults[i] );
+          }
+        XLALDestroyFstatResults ( seqResults );
+
+        // inputs sharing a workspace cannot be used in a batch
+        if ( iMethod >= FMETHOD_RESAMP_GENERIC && iMethod <= FMETHOD_RESAMP_BEST )
+          {
+            XLALDestroyFstatInput ( batchInputs->data[1] );
+            optionalArgs.prevInput = batchInputs->data[0];
+            XLAL_CHECK ( (batchInputs->data[1] = XLALCreateFstatInput ( catalog, minCoverFreq, maxCoverFreq, dFreq, ephem, &optionalArgs )) != NULL, XLAL_EFUNC );
+            XLAL_INIT_MEM ( batchResults );
+            int errnum;
+            XLAL_TRY_SILENT ( XLALComputeFstatBatch ( batchResults, batchInputs, batchDopplers, numBatch, numFreqBins, whatToCompute ), errnum );
+            XLAL_CHECK ( errnum == XLAL_EINVAL, XLAL_EFAILED, "Method '%s': batch with a shared workspace did not fail", XLALGetFstatInputMethodName(batchInputs->data[0]) );
+          }
+
+        XLALDestroyFstatInputVector ( batchInputs );
+      } // for iMethod < FMETHOD_END
+  }
+
+  // ----- test that FMETHOD_DEMOD_PARALLEL gives the same results whatever the number of OpenMP threads
+#ifdef _OPENMP
+  {
+    const int maxThreads = omp_get_max_threads();
+    FstatInput *input_par = input_seg1[FMETHOD_DEMOD_PARALLEL];
+    FstatResults *results_par1 = NULL, *results_parN = NULL;
+    omp_set_num_threads ( 1 );
+    XLAL_CHECK ( XLALComputeFstat ( &results_par1, input_par, &Doppler, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+    omp_set_num_threads ( 3 );
+    XLAL_CHECK ( XLALComputeFstat ( &results_parN, input_par, &Doppler, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+    omp_set_num_threads ( maxThreads );
+    // each thread computes whole frequency bins and detectors, so results must agree exactly
+    for ( UINT4 k = 0; k < numFreqBins; k ++ ) {
+      XLAL_CHECK ( results_par1->twoF[k] == results_parN->twoF[k], XLAL_EFAILED,
+                   "DemodParallel 2F[%u] = %g with 1 thread differs from %g with 3 threads", k, results_par1->twoF[k], results_parN->twoF[k] );
+      XLAL_CHECK ( results_par1->Fa[k] == results_parN->Fa[k] && results_par1->Fb[k] == results_parN->Fb[k], XLAL_EFAILED,
+                   "DemodParallel Fa/Fb[%u] with 1 thread differ from 3 threads", k );
+    }
+    XLALDestroyFstatResults ( results_par1 );
+    XLALDestroyFstatResults ( results_parN );
+  }
+#endif
+
   // ----- test XLALFstatInputTimeslice()
   // setup optional Fstat arguments
   optionalArgs.FstatMethod = FMETHOD_DEMOD_BEST; // only use demod best
@@ -241,7 +241,6 @@ test_XLALSincInterpolateCOMPLEX8TimeSeries ( void )
     } // for j < numSamplesOut
 
   XLAL_CHECK ( XLALSincInterpolateCOMPLEX8TimeSeries ( tsOut->data, times_out, tsIn, Dterms ) == XLAL_SUCCESS, XLAL_EFUNC );
-  XLALDestroyREAL8Vector ( times_out );
 
   // ---------- check accuracy of interpolation
   COMPLEX8TimeSeries *tsFull;
@@ -269,7 +268,27 @@ test_XLALSincInterpolateCOMPLEX8TimeSeries ( void )
   VectorComparison XLAL_INIT_DECL(cmp);
   XLAL_CHECK ( XLALCompareCOMPLEX8Vectors ( &cmp, tsOut->data, tsFull->data, &tol ) == XLAL_SUCCESS, XLAL_EFUNC );
 
+  // ---------- interpolate again using a polyphase table of kernel weights, which should agree closely
+  SincInterpolationLUT *lut;
+  XLAL_CHECK ( (lut = XLALCreateSincInterpolationLUT ( Dterms, 1024 )) != NULL, XLAL_EFUNC );
+  COMPLEX8Vector *yLUT;
+  XLAL_CHECK ( (yLUT = XLALCreateCOMPLEX8Vector ( numSamplesOut )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( XLALSincInterpolateCOMPLEX8TimeSeriesLUT ( yLUT, times_out, tsIn, lut ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  VectorComparison XLAL_INIT_DECL(tolLUT);
+  tolLUT.relErr_L1 	= 1e-5;
+  tolLUT.relErr_L2	= 1e-5;
+  tolLUT.angleV		= 1e-5;
+  tolLUT.relErr_atMaxAbsx	= 1e-5;
+  tolLUT.relErr_atMaxAbsy	= 1e-5;
+
+  XLALPrintInfo ("Comparing sinc-interpolated timeseries using polyphase table to direct sinc-interpolation:\n");
+  XLAL_CHECK ( XLALCompareCOMPLEX8Vectors ( &cmp, yLUT, tsOut->data, &tolLUT ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // ---------- free memory
+  XLALDestroySincInterpolationLUT ( lut );
+  XLALDestroyCOMPLEX8Vector ( yLUT );
+  XLALDestroyREAL8Vector ( times_out );
   XLALDestroyCOMPLEX8TimeSeries ( tsIn );
   XLALDestroyCOMPLEX8TimeSeries ( tsOut );
   XLALDestroyCOMPLEX8TimeSeries ( tsFull );
@@ -100,6 +100,38 @@ static int CompareSFTVectors(SFTVector *sft_vect, SFTVector *sft_vect2)
   return(0);
 }
 
+/* return 1 if the file 'fname' contains the string 'str', 0 if it does not, -1 on error */
+static int FileContains(const char *fname, const char *str);
+static int FileContains(const char *fname, const char *str)
+{
+  FILE *fp;
+  CHAR *buf;
+  long n;
+  size_t len = strlen(str);
+  int found = 0;
+  if ((fp = fopen(fname, "rb")) == NULL) {
+    XLALPrintError ( "FileContains(): failed to open '%s'!\n", fname);
+    return(-1);
+  }
+  if (fseek(fp, 0, SEEK_END) != 0 || (n = ftell(fp)) < 0 || fseek(fp, 0, SEEK_SET) != 0) {
+    XLALPrintError ( "FileContains(): failed to get length of '%s'!\n", fname);
+    fclose(fp);
+    return(-1);
+  }
+  if ((buf = XLALMalloc(n + 1)) == NULL || fread(buf, 1, n, fp) != (size_t)n) {
+    XLALPrintError ( "FileContains(): failed to read '%s'!\n", fname);
+    XLALFree(buf);
+    fclose(fp);
+    return(-1);
+  }
+  fclose(fp);
+  for (size_t i = 0; !found && i + len <= (size_t)n; i++) {
+    found = (memcmp(buf + i, str, len) == 0);
+  }
+  XLALFree(buf);
+  return(found);
+}
+
 int main( void )
 {
   const char *fn = __func__;
@@ -339,6 +371,154 @@ int main( void )
   sft_vect = NULL;
   XLALDestroySFTCatalog(catalog);
 
+  /* ----- check views of a memory-mapped merged SFT against XLALLoadSFTs() */
+  {
+    const CHAR *concatSFT = "H-3_H1_60SFT_test_concat-000012345-302.sft";
+    XLAL_CHECK_MAIN ( ( catalog = XLALSFTdataFind ( concatSFT, NULL ) ) != NULL, XLAL_EFUNC );
+    SFTFileMap *map;
+    XLAL_CHECK_MAIN ( ( map = XLALCreateSFTFileMap ( concatSFT ) ) != NULL, XLAL_EFUNC );
+    const SFTCatalog *blocks = XLALSFTFileMapCatalog ( map );
+    XLAL_CHECK_MAIN ( blocks != NULL && blocks->length == catalog->length, XLAL_EFAILED );
+
+    SFTtype views[blocks->length];
+    COMPLEX8Vector viewData[blocks->length];
+    SFTVector viewVect = { .length = blocks->length, .data = views };
+
+    /* the whole SFTs, then a band strictly inside them */
+    const REAL8 df = catalog->data[0].header.deltaF;
+    const REAL8 fMin[2] = { -1, catalog->data[0].header.f0 + df };
+    const REAL8 fMax[2] = { -1, catalog->data[0].header.f0 + ( catalog->data[0].numBins - 1 ) * df };
+    for ( UINT4 i = 0; i < 2; i ++ )
+      {
+        XLAL_CHECK_MAIN ( ( sft_vect = XLALLoadSFTs ( catalog, fMin[i], fMax[i] ) ) != NULL, XLAL_EFUNC );
+        for ( UINT4 k = 0; k < blocks->length; k ++ ) {
+          XLAL_CHECK_MAIN ( XLALSFTFileMapBandView ( &views[k], &viewData[k], map, k, fMin[i], fMax[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+        }
+        XLAL_CHECK_MAIN ( CompareSFTVectors ( sft_vect, &viewVect ) == 0, XLAL_EFAILED, "SFT file map views differ from XLALLoadSFTs() for band %u\n", i );
+        XLALDestroySFTVector ( sft_vect );
+        sft_vect = NULL;
+      }
+
+    /* bands outside the SFTs must be rejected */
+    XLAL_CHECK_MAIN ( XLALSFTFileMapBandView ( &views[0], &viewData[0], map, 0, fMin[1] - 2 * df, fMax[1] ) != XLAL_SUCCESS, XLAL_EFAILED ); XLALClearErrno();
+    XLAL_CHECK_MAIN ( XLALSFTFileMapBandView ( &views[0], &viewData[0], map, blocks->length, -1, -1 ) != XLAL_SUCCESS, XLAL_EFAILED ); XLALClearErrno();
+
+    XLALDestroySFTFileMap ( map );
+    XLALDestroySFTCatalog ( catalog );
+  }
+
+  /* ----- check that XLALSFTdataFind() returns the same catalog with a persistent SFT index */
+  {
+#define SFT_INDEX_FNAME "SFTfileIOTest.sftindex"
+    const CHAR *pattern = TEST_DATA_DIR "SFT-test[123567]*;H-3_H1_60SFT_test_concat-000012345-302.sft";
+    remove ( SFT_INDEX_FNAME );
+    XLAL_CHECK_MAIN ( ( catalog = XLALSFTdataFind ( pattern, NULL ) ) != NULL, XLAL_EFUNC );
+
+    /* build the index, read it back, then check that an index with a corrupt version number is rebuilt */
+    XLAL_CHECK_MAIN ( setenv ( "LAL_SFT_INDEX_FILENAME", SFT_INDEX_FNAME, 1 ) == 0, XLAL_ESYS );
+    UINT4 index_version = 0;
+    for ( UINT4 i = 0; i < 4; i ++ )
+      {
+        if ( i == 2 )
+          {
+            /* the version number follows the 8-byte magic string */
+            FILE *fp;
+            const UINT4 bad_version = ~0U;
+            XLAL_CHECK_MAIN ( ( fp = fopen ( SFT_INDEX_FNAME, "r+b" ) ) != NULL, XLAL_EIO );
+            XLAL_CHECK_MAIN ( fseek ( fp, 8, SEEK_SET ) == 0 && fread ( &index_version, sizeof ( index_version ), 1, fp ) == 1, XLAL_EIO );
+            XLAL_CHECK_MAIN ( index_version != bad_version, XLAL_EFAILED );
+            XLAL_CHECK_MAIN ( fseek ( fp, 8, SEEK_SET ) == 0 && fwrite ( &bad_version, sizeof ( bad_version ), 1, fp ) == 1, XLAL_EIO );
+            fclose ( fp );
+          }
+        SFTCatalog *catalog2;
+        XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFind ( pattern, NULL ) ) != NULL, XLAL_EFUNC );
+        XLAL_CHECK_MAIN ( catalog2->length == catalog->length, XLAL_EFAILED );
+        for ( UINT4 k = 0; k < catalog->length; k ++ )
+          {
+            const SFTDescriptor *desc = &catalog->data[k];
+            const SFTDescriptor *desc2 = &catalog2->data[k];
+            XLAL_CHECK_MAIN ( strcmp ( XLALshowSFTLocator ( desc->locator ), XLALshowSFTLocator ( desc2->locator ) ) == 0, XLAL_EFAILED, "Pass %u: SFT #%u locators differ\n", i, k );
+            XLAL_CHECK_MAIN ( strcmp ( desc->header.name, desc2->header.name ) == 0
+                              && XLALGPSCmp ( &desc->header.epoch, &desc2->header.epoch ) == 0
+                              && desc->header.f0 == desc2->header.f0
+                              && desc->header.deltaF == desc2->header.deltaF, XLAL_EFAILED, "Pass %u: SFT #%u headers differ\n", i, k );
+            XLAL_CHECK_MAIN ( desc->numBins == desc2->numBins && desc->version == desc2->version && desc->crc64 == desc2->crc64, XLAL_EFAILED, "Pass %u: SFT #%u descriptors differ\n", i, k );
+            XLAL_CHECK_MAIN ( ( desc->comment == NULL && desc2->comment == NULL )
+                              || ( desc->comment != NULL && desc2->comment != NULL && strcmp ( desc->comment, desc2->comment ) == 0 ), XLAL_EFAILED, "Pass %u: SFT #%u comments differ\n", i, k );
+          }
+        XLALDestroySFTCatalog ( catalog2 );
+        if ( i == 2 )
+          {
+            FILE *fp;
+            UINT4 version = 0;
+            XLAL_CHECK_MAIN ( ( fp = fopen ( SFT_INDEX_FNAME, "rb" ) ) != NULL, XLAL_EIO );
+            XLAL_CHECK_MAIN ( fseek ( fp, 8, SEEK_SET ) == 0 && fread ( &version, sizeof ( version ), 1, fp ) == 1, XLAL_EIO );
+            fclose ( fp );
+            XLAL_CHECK_MAIN ( version == index_version, XLAL_EFAILED, "Corrupt SFT index was not rewritten\n" );
+          }
+      }
+
+    /* check that CRC64 checksums cached in the index give the same results */
+    for ( UINT4 i = 0; i < 2; i ++ )
+      {
+        SFTCatalog *catalog2;
+        XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFind ( pattern, NULL ) ) != NULL, XLAL_EFUNC );
+        XLAL_CHECK_MAIN ( XLALCheckCRCSFTCatalog ( &crc_check, catalog2 ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN ( crc_check, XLAL_EFAILED, "Pass %u: SFTs have correct checksums but XLALCheckCRCSFTCatalog() claimed they haven't\n", i );
+        XLALDestroySFTCatalog ( catalog2 );
+        XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFind ( TEST_DATA_DIR "SFT-bad6", NULL ) ) != NULL, XLAL_EFUNC );
+        XLAL_CHECK_MAIN ( XLALCheckCRCSFTCatalog ( &crc_check, catalog2 ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN ( !crc_check, XLAL_EFAILED, "Pass %u: XLALCheckCRCSFTCatalog() failed to catch invalid CRC checksum in SFT-bad6\n", i );
+        XLALDestroySFTCatalog ( catalog2 );
+      }
+
+    /* check that different names of the same file share one entry, and that the entry of an
+     * indexed file is dropped, once the file no longer exists, when the index is next rewritten */
+    {
+#define SFT_PRUNE_FNAME "SFTfileIOTest-prune.sft"
+#define SFT_NEW_FNAME "SFTfileIOTest-new.sft"
+      SFTCatalog *catalog2;
+      SFTVector *sfts;
+      XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFind ( TEST_DATA_DIR "SFT-test1", NULL ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN ( ( sfts = XLALLoadSFTs ( catalog2, -1, -1 ) ) != NULL, XLAL_EFUNC );
+      XLALDestroySFTCatalog ( catalog2 );
+      XLAL_CHECK_MAIN ( XLALWriteSFT2file ( &sfts->data[0], SFT_PRUNE_FNAME, "An SFT file for testing SFT index pruning" ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN ( XLALWriteSFT2file ( &sfts->data[0], SFT_NEW_FNAME, "An SFT file for testing SFT index pruning" ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLALDestroySFTVector ( sfts );
+      XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFind ( SFT_PRUNE_FNAME, NULL ) ) != NULL, XLAL_EFUNC );
+      XLALDestroySFTCatalog ( catalog2 );
+      XLAL_CHECK_MAIN ( FileContains ( SFT_INDEX_FNAME, SFT_PRUNE_FNAME ) == 1, XLAL_EFAILED, "SFT index does not contain '%s'\n", SFT_PRUNE_FNAME );
+
+      /* the number of entries follows the 8-byte magic string and the version number */
+      UINT4 numEntries[2] = { 0, 0 };
+      for ( UINT4 i = 0; i < 2; i ++ )
+        {
+          FILE *fp;
+          if ( i == 1 )
+            {
+              XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFind ( "./" SFT_PRUNE_FNAME, NULL ) ) != NULL, XLAL_EFUNC );
+              XLAL_CHECK_MAIN ( strcmp ( XLALshowSFTLocator ( catalog2->data[0].locator ), "./" SFT_PRUNE_FNAME " : 0" ) == 0, XLAL_EFAILED, "Locator '%s' does not use the matched filename\n", XLALshowSFTLocator ( catalog2->data[0].locator ) );
+              XLALDestroySFTCatalog ( catalog2 );
+            }
+          XLAL_CHECK_MAIN ( ( fp = fopen ( SFT_INDEX_FNAME, "rb" ) ) != NULL, XLAL_EIO );
+          XLAL_CHECK_MAIN ( fseek ( fp, 12, SEEK_SET ) == 0 && fread ( &numEntries[i], sizeof ( numEntries[i] ), 1, fp ) == 1, XLAL_EIO );
+          fclose ( fp );
+        }
+      XLAL_CHECK_MAIN ( numEntries[1] == numEntries[0], XLAL_EFAILED, "SFT index has %u entries after looking up another name of an indexed file, expected %u\n", numEntries[1], numEntries[0] );
+
+      XLAL_CHECK_MAIN ( remove ( SFT_PRUNE_FNAME ) == 0, XLAL_EIO );
+      XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFind ( SFT_NEW_FNAME, NULL ) ) != NULL, XLAL_EFUNC );
+      XLALDestroySFTCatalog ( catalog2 );
+      XLAL_CHECK_MAIN ( FileContains ( SFT_INDEX_FNAME, SFT_NEW_FNAME ) == 1, XLAL_EFAILED, "SFT index does not contain '%s'\n", SFT_NEW_FNAME );
+      XLAL_CHECK_MAIN ( FileContains ( SFT_INDEX_FNAME, SFT_PRUNE_FNAME ) == 0, XLAL_EFAILED, "SFT index still contains removed file '%s'\n", SFT_PRUNE_FNAME );
+      XLAL_CHECK_MAIN ( remove ( SFT_NEW_FNAME ) == 0, XLAL_EIO );
+    }
+
+    XLAL_CHECK_MAIN ( unsetenv ( "LAL_SFT_INDEX_FILENAME" ) == 0, XLAL_ESYS );
+
+    XLALDestroySFTCatalog ( catalog );
+  }
+
   /* ---------- test timestamps-reading functions by comparing LAL- and XLAL-versions against each other ---------- */
   {
 #define TS_FNAME "testTimestamps.dat"
@@ -297,7 +297,7 @@ static void PrecessingNRSur_LoadFitData(
     nwritten = snprintf(tmp_name, str_size, "%s_coefs", name);
     assert(nwritten < str_size);
     (*fit_data)->coefs = NULL;
-    ReadHDF5RealVectorDataset(sub, tmp_name, &((*fit_data)->coefs));
+    ReadHDF5RealVectorDatasetMapped(sub, tmp_name, &((*fit_data)->coefs));
 
     nwritten = snprintf(tmp_name, str_size, "%s_bfOrders", name);
     assert(nwritten < str_size);
@@ -361,7 +361,7 @@ static void PrecessingNRSur_LoadDynamicsNode(
         omega_copr_data->coefs = NULL;
         omega_copr_data->basisFunctionOrders = NULL;
         omega_copr_data->componentIndices = NULL;
-        ReadHDF5RealVectorDataset(sub, "omega_orb_coefs", &(omega_copr_data->coefs));
+        ReadHDF5RealVectorDatasetMapped(sub, "omega_orb_coefs", &(omega_copr_data->coefs));
         ReadHDF5LongMatrixDataset(sub, "omega_orb_bfOrders", &(omega_copr_data->basisFunctionOrders));
         ReadHDF5LongVectorDataset(sub, "omega_orb_bVecIndices", &(omega_copr_data->componentIndices));
         omega_copr_data->n_coefs = omega_copr_data->coefs->size;
@@ -373,7 +373,7 @@ static void PrecessingNRSur_LoadDynamicsNode(
         chiA_dot_data->coefs = NULL;
         chiA_dot_data->basisFunctionOrders = NULL;
         chiA_dot_data->componentIndices = NULL;
-        ReadHDF5RealVectorDataset(sub, "chiA_coefs", &(chiA_dot_data->coefs));
+        ReadHDF5RealVectorDatasetMapped(sub, "chiA_coefs", &(chiA_dot_data->coefs));
         ReadHDF5LongMatrixDataset(sub, "chiA_bfOrders", &(chiA_dot_data->basisFunctionOrders));
         ReadHDF5LongVectorDataset(sub, "chiA_bVecIndices", &(chiA_dot_data->componentIndices));
         chiA_dot_data->n_coefs = chiA_dot_data->coefs->size;
@@ -396,7 +396,7 @@ static void PrecessingNRSur_LoadDynamicsNode(
         if (n==0) {
             chiB_dot_data->n_coefs = 0;
         } else {
-            ReadHDF5RealVectorDataset(sub, "chiB_coefs", &(chiB_dot_data->coefs));
+            ReadHDF5RealVectorDatasetMapped(sub, "chiB_coefs", &(chiB_dot_data->coefs));
             ReadHDF5LongMatrixDataset(sub, "chiB_bfOrders", &(chiB_dot_data->basisFunctionOrders));
             ReadHDF5LongVectorDataset(sub, "chiB_bVecIndices", &(chiB_dot_data->componentIndices));
             chiB_dot_data->n_coefs = chiB_dot_data->coefs->size;
@@ -499,9 +499,12 @@ static void PrecessingNRSur_LoadWaveformDataPiece(
     *data = XLALMalloc(sizeof(WaveformDataPiece));
 
     gsl_matrix *EI_basis = NULL;
-    ReadHDF5RealMatrixDataset(sub, "EIBasis", &EI_basis);
     if (invert_sign) {
+        ReadHDF5RealMatrixDataset(sub, "EIBasis", &EI_basis);
         gsl_matrix_scale(EI_basis, -1);
+    } else {
+        // The basis is not modified, so map it read-only from the file
+        ReadHDF5RealMatrixDatasetMapped(sub, "EIBasis", &EI_basis);
     }
     (*data)->empirical_interpolant_basis = EI_basis;
 
@@ -521,7 +524,7 @@ static void PrecessingNRSur_LoadWaveformDataPiece(
         node_data->coefs = NULL;
         node_data->basisFunctionOrders = NULL;
         snprintf(sub_name, str_size, "coefs_%d", i);
-        ReadHDF5RealVectorDataset(nodeModelers, sub_name, &(node_data->coefs));
+        ReadHDF5RealVectorDatasetMapped(nodeModelers, sub_name, &(node_data->coefs));
         snprintf(sub_name, str_size, "bfOrders_%d", i);
         ReadHDF5LongMatrixDataset(nodeModelers, sub_name, &(node_data->basisFunctionOrders));
         node_data->n_coefs = node_data->coefs->size;
@@ -66,6 +66,8 @@ UNUSED static UINT4 align_wfs_window_from_22(gsl_vector* f_array_1, gsl_vector*
 UNUSED static int CheckVectorFromHDF5(LALH5File *file, const char name[], const double *v, size_t n);
 UNUSED static int ReadHDF5RealVectorDataset(LALH5File *file, const char *name, gsl_vector **data);
 UNUSED static int ReadHDF5RealMatrixDataset(LALH5File *file, const char *name, gsl_matrix **data);
+UNUSED static int ReadHDF5RealVectorDatasetMapped(LALH5File *file, const char *name, gsl_vector **data);
+UNUSED static int ReadHDF5RealMatrixDatasetMapped(LALH5File *file, const char *name, gsl_matrix **data);
 UNUSED static int ReadHDF5LongVectorDataset(LALH5File *file, const char *name, gsl_vector_long **data);
 UNUSED static int ReadHDF5LongMatrixDataset(LALH5File *file, const char *name, gsl_matrix_long **data);
 UNUSED static void PrintInfoStringAttribute(LALH5File *file, const char attribute[]);
@@ -271,6 +273,131 @@ static int ReadHDF5RealMatrixDataset(LALH5File *file, const char *name, gsl_matr
 	return 0;
 }
 
+// Like ReadHDF5RealVectorDataset(), but if *data is NULL and the dataset is
+// stored contiguously and uncompressed, the returned gsl_vector views the data
+// mapped read-only from the file; such data is shared between processes and
+// only read from disk when accessed. The data must not be modified;
+// gsl_vector_free() releases the view but not the mapping.
+static int ReadHDF5RealVectorDatasetMapped(LALH5File *file, const char *name, gsl_vector **data) {
+	LALH5Dataset *dset;
+	UINT4Vector *dimLength;
+	union { const void *c; double *d; } mapped;
+	size_t n;
+
+	if (file == NULL || name == NULL || data == NULL)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (*data != NULL)
+		return ReadHDF5RealVectorDataset(file, name, data);
+
+	dset = XLALH5DatasetRead(file, name);
+	if (dset == NULL)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	// Fall back to reading a copy of the data
+	if (XLALH5DatasetQueryType(dset) != LAL_D_TYPE_CODE || !XLALH5DatasetCheckMappable(dset)) {
+		XLALH5DatasetFree(dset);
+		XLALClearErrno();
+		return ReadHDF5RealVectorDataset(file, name, data);
+	}
+
+	dimLength = XLALH5DatasetQueryDims(dset);
+	if (dimLength == NULL) {
+		XLALH5DatasetFree(dset);
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+	if (dimLength->length != 1) {
+		XLALDestroyUINT4Vector(dimLength);
+		XLALH5DatasetFree(dset);
+		XLAL_ERROR(XLAL_EDIMS, "Dataset `%s' must be 1-dimensional", name);
+	}
+
+	n = dimLength->data[0];
+	XLALDestroyUINT4Vector(dimLength);
+
+	// Mapping may still fail, e.g. if the file can no longer be found by
+	// name after a change of working directory; fall back as above
+	mapped.c = XLALH5DatasetMapData(dset);
+	XLALH5DatasetFree(dset);
+	if (mapped.c == NULL) {
+		XLALClearErrno();
+		return ReadHDF5RealVectorDataset(file, name, data);
+	}
+
+	// gsl_vector_free() uses free() and does not free data it does not own
+	*data = malloc(sizeof(**data));
+	if (*data == NULL)
+		XLAL_ERROR(XLAL_ENOMEM);
+	(*data)->size = n;
+	(*data)->stride = 1;
+	(*data)->data = mapped.d;
+	(*data)->block = NULL;
+	(*data)->owner = 0;
+
+	return 0;
+}
+
+// Like ReadHDF5RealMatrixDataset(), but maps the data read-only from the file
+// if possible; see ReadHDF5RealVectorDatasetMapped()
+static int ReadHDF5RealMatrixDatasetMapped(LALH5File *file, const char *name, gsl_matrix **data) {
+	LALH5Dataset *dset;
+	UINT4Vector *dimLength;
+	union { const void *c; double *d; } mapped;
+	size_t n1, n2;
+
+	if (file == NULL || name == NULL || data == NULL)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (*data != NULL)
+		return ReadHDF5RealMatrixDataset(file, name, data);
+
+	dset = XLALH5DatasetRead(file, name);
+	if (dset == NULL)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	// Fall back to reading a copy of the data
+	if (XLALH5DatasetQueryType(dset) != LAL_D_TYPE_CODE || !XLALH5DatasetCheckMappable(dset)) {
+		XLALH5DatasetFree(dset);
+		XLALClearErrno();
+		return ReadHDF5RealMatrixDataset(file, name, data);
+	}
+
+	dimLength = XLALH5DatasetQueryDims(dset);
+	if (dimLength == NULL) {
+		XLALH5DatasetFree(dset);
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+	if (dimLength->length != 2) {
+		XLALDestroyUINT4Vector(dimLength);
+		XLALH5DatasetFree(dset);
+		XLAL_ERROR(XLAL_EDIMS, "Dataset `%s' must be 2-dimensional", name);
+	}
+
+	n1 = dimLength->data[0];
+	n2 = dimLength->data[1];
+	XLALDestroyUINT4Vector(dimLength);
+
+	// Mapping may still fail, e.g. if the file can no longer be found by
+	// name after a change of working directory; fall back as above
+	mapped.c = XLALH5DatasetMapData(dset);
+	XLALH5DatasetFree(dset);
+	if (mapped.c == NULL) {
+		XLALClearErrno();
+		return ReadHDF5RealMatrixDataset(file, name, data);
+	}
+
+	// gsl_matrix_free() uses free() and does not free data it does not own
+	*data = malloc(sizeof(**data));
+	if (*data == NULL)
+		XLAL_ERROR(XLAL_ENOMEM);
+	(*data)->size1 = n1;
+	(*data)->size2 = n2;
+	(*data)->tda = n2;
+	(*data)->data = mapped.d;
+	(*data)->block = NULL;
+	(*data)->owner = 0;
+
+	return 0;
+}
+
 static int ReadHDF5LongVectorDataset(LALH5File *file, const char *name, gsl_vector_long **data) {
 	LALH5Dataset *dset;
 	UINT4Vector *dimLength;
@@ -750,19 +750,19 @@ UNUSED static int SEOBNRROMdataDS_Init_submodel(
   LALH5File *file = XLALH5FileOpen(path, "r");
   LALH5File *sub = XLALH5GroupOpen(file, grp_name);
 
-  // Read ROM coefficients
+  // Read ROM coefficients; the bulk of the data is mapped read-only from the file
 
   //// c-modes coefficients
   char* path_to_dataset = concatenate_strings(3,"CF_modes/",mode_array[index_mode],"/coeff_re_flattened");
-  ReadHDF5RealVectorDataset(sub, path_to_dataset, & (*submodel)->cvec_real);
+  ReadHDF5RealVectorDatasetMapped(sub, path_to_dataset, & (*submodel)->cvec_real);
   free(path_to_dataset);
   path_to_dataset = concatenate_strings(3,"CF_modes/",mode_array[index_mode],"/coeff_im_flattened");
-  ReadHDF5RealVectorDataset(sub, path_to_dataset, & (*submodel)->cvec_imag);
+  ReadHDF5RealVectorDatasetMapped(sub, path_to_dataset, & (*submodel)->cvec_imag);
   free(path_to_dataset);
   //// orbital phase coefficients
   //// They are used only in the 22 mode
   if(index_mode == 0){
-    ReadHDF5RealVectorDataset(sub, "phase_carrier/coeff_flattened", & (*submodel)->cvec_phase);
+    ReadHDF5RealVectorDatasetMapped(sub, "phase_carrier/coeff_flattened", & (*submodel)->cvec_phase);
   }
 
 
@@ -770,15 +770,15 @@ UNUSED static int SEOBNRROMdataDS_Init_submodel(
 
   //// c-modes basis
   path_to_dataset = concatenate_strings(3,"CF_modes/",mode_array[index_mode],"/basis_re");
-  ReadHDF5RealMatrixDataset(sub, path_to_dataset, & (*submodel)->Breal);
+  ReadHDF5RealMatrixDatasetMapped(sub, path_to_dataset, & (*submodel)->Breal);
   free(path_to_dataset);
   path_to_dataset = concatenate_strings(3,"CF_modes/",mode_array[index_mode],"/basis_im");
-  ReadHDF5RealMatrixDataset(sub, path_to_dataset, & (*submodel)->Bimag);
+  ReadHDF5RealMatrixDatasetMapped(sub, path_to_dataset, & (*submodel)->Bimag);
   free(path_to_dataset);
   //// orbital phase basis
   //// Used only in the 22 mode
   if(index_mode == 0){
-    ReadHDF5RealMatrixDataset(sub, "phase_carrier/basis", & (*submodel)->Bphase);
+    ReadHDF5RealMatrixDatasetMapped(sub, "phase_carrier/basis", & (*submodel)->Bphase);
   }
   // Read sparse frequency points
 
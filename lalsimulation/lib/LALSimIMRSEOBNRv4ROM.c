@@ -420,13 +420,13 @@ UNUSED static int SEOBNRROMdataDS_Init_submodel(
   LALH5File *file = XLALH5FileOpen(path, "r");
   LALH5File *sub = XLALH5GroupOpen(file, grp_name);
 
-  // Read ROM coefficients
-  ReadHDF5RealVectorDataset(sub, "Amp_ciall", & (*submodel)->cvec_amp);
-  ReadHDF5RealVectorDataset(sub, "Phase_ciall", & (*submodel)->cvec_phi);
+  // Read ROM coefficients; the bulk of the data is mapped read-only from the file
+  ReadHDF5RealVectorDatasetMapped(sub, "Amp_ciall", & (*submodel)->cvec_amp);
+  ReadHDF5RealVectorDatasetMapped(sub, "Phase_ciall", & (*submodel)->cvec_phi);
 
   // Read ROM basis functions
-  ReadHDF5RealMatrixDataset(sub, "Bamp", & (*submodel)->Bamp);
-  ReadHDF5RealMatrixDataset(sub, "Bphase", & (*submodel)->Bphi);
+  ReadHDF5RealMatrixDatasetMapped(sub, "Bamp", & (*submodel)->Bamp);
+  ReadHDF5RealMatrixDatasetMapped(sub, "Bphase", & (*submodel)->Bphi);
 
   // Read sparse frequency points
   ReadHDF5RealVectorDataset(sub, "Mf_grid_Amp", & (*submodel)->gA);
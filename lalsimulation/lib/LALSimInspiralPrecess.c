@@ -17,9 +17,45 @@
  *  MA  02110-1301  USA
  */
 
+#include <string.h>
 #include <lal/LALSimInspiralPrecess.h>
 #include <lal/LALAtomicDatatypes.h>
 
+/* maximum number of samples for which the Wigner d matrix elements are computed at once */
+#define ROTATE_MODES_BLOCK 1024
+
+/* maximum number of Wigner d matrix elements stored for a block of samples */
+#define ROTATE_MODES_DSIZE 131072
+
+/* number of samples per block, such that the Wigner d matrix elements for
+ * l <= lmax fit in ROTATE_MODES_DSIZE elements */
+static unsigned int RotateModesBlockLength( int lmax )
+{
+	unsigned int nb = ROTATE_MODES_DSIZE / XLALWignerdMatrixIndex( lmax+1, -lmax-1, -lmax-1 );
+	if( nb < 1 ) return 1;
+	return nb < ROTATE_MODES_BLOCK ? nb : ROTATE_MODES_BLOCK;
+}
+
+/* phases exp(-i*m*angle) for -lmax <= m <= lmax, stored in e[(m+lmax)*nb+k],
+ * from a single complex exponential per sample */
+static void RotateModesPhases( COMPLEX16 *e, int lmax, const REAL8 *angle, unsigned int nb )
+{
+	unsigned int k;
+	int m;
+	for(k=0; k<nb; k++)
+		e[lmax*nb+k] = 1.0;
+	if( lmax < 1 )
+		return;
+	for(k=0; k<nb; k++)
+		e[(lmax+1)*nb+k] = cpolar( 1.0, -angle[k] );
+	for(m=2; m<=lmax; m++)
+		for(k=0; k<nb; k++)
+			e[(lmax+m)*nb+k] = e[(lmax+m-1)*nb+k] * e[(lmax+1)*nb+k];
+	for(m=1; m<=lmax; m++)
+		for(k=0; k<nb; k++)
+			e[(lmax-m)*nb+k] = conj( e[(lmax+m)*nb+k] );
+}
+
 /**
  * @addtogroup LALSimInspiralPrecess_h
  * @{
@@ -40,39 +76,67 @@ int XLALSimInspiralPrecessionRotateModes(
                 REAL8TimeSeries* gam /**< gamma Euler angle time series */
 ){
 
-	unsigned int i;
+	unsigned int i, i0, nb, blocklen, length;
 	int l, lmax, m, mp;
+	int errnum = 0;
 	lmax = XLALSphHarmTimeSeriesGetMaxL( h_lm );
-	// Temporary holding variables
-	complex double *x_lm = XLALCalloc( 2*lmax+1, sizeof(complex double) );
-	COMPLEX16TimeSeries **h_xx = XLALCalloc( 2*lmax+1, sizeof(COMPLEX16TimeSeries) );
+	length = alpha->data->length;
+	blocklen = RotateModesBlockLength( lmax );
+	// Modes of a given l, and a copy of their input values for a block of samples
+	COMPLEX16TimeSeries **h_xx = XLALCalloc( 2*lmax+1, sizeof(COMPLEX16TimeSeries*) );
+	COMPLEX16 *x_lm = XLALMalloc( (2*lmax+1) * blocklen * sizeof(COMPLEX16) );
+	// Wigner d matrix elements and phases for a block of samples
+	REAL8 *d = XLALMalloc( XLALWignerdMatrixIndex( lmax+1, -lmax-1, -lmax-1 ) * blocklen * sizeof(REAL8) );
+	COMPLEX16 *ealpha = XLALMalloc( (2*lmax+1) * blocklen * sizeof(COMPLEX16) );
+	COMPLEX16 *egam = XLALMalloc( (2*lmax+1) * blocklen * sizeof(COMPLEX16) );
+	if( !h_xx || !x_lm || !d || !ealpha || !egam ){
+		errnum = XLAL_ENOMEM;
+		goto cleanup;
+	}
 
-	for(i=0; i<alpha->data->length; i++){
+	for(i0=0; i0<length; i0+=nb){
+		nb = length - i0 < blocklen ? length - i0 : blocklen;
+		if( XLALWignerdMatrixBatch( d, lmax, beta->data->data + i0, nb ) != XLAL_SUCCESS ){
+			errnum = XLAL_EFUNC;
+			goto cleanup;
+		}
+		RotateModesPhases( ealpha, lmax, alpha->data->data + i0, nb );
+		RotateModesPhases( egam, lmax, gam->data->data + i0, nb );
 		for(l=2; l<=lmax; l++){
+			// Copy the input values of the modes present, then zero them
 			for(m=0; m<2*l+1; m++){
 				h_xx[m] = XLALSphHarmTimeSeriesGetMode(h_lm, l, m-l);
-				if( !h_xx[m] ){
-					x_lm[m] = 0;
-				} else {
-					x_lm[m] = h_xx[m]->data->data[i];
-					h_xx[m]->data->data[i] = 0;
-				}
+				if( !h_xx[m] ) continue;
+				memcpy( x_lm + m*nb, h_xx[m]->data->data + i0, nb * sizeof(COMPLEX16) );
+				memset( h_xx[m]->data->data + i0, 0, nb * sizeof(COMPLEX16) );
 			}
 
+			// Absent modes do not contribute, and are not set
 			for(m=0; m<2*l+1; m++){
+				if( !h_xx[m] ) continue;
+				COMPLEX16 *out = h_xx[m]->data->data + i0;
+				const COMPLEX16 *eg = egam + (m-l+lmax)*nb;
 				for(mp=0; mp<2*l+1; mp++){
-					if( !h_xx[m] ) continue;
-					if(!(creal(h_xx[m]->data->data[i])==0 && creal(x_lm[mp])==0)) {
-					  h_xx[m]->data->data[i] +=
-					    x_lm[mp] * XLALWignerDMatrix( l, mp-l, m-l, alpha->data->data[i], beta->data->data[i], gam->data->data[i] );
-					  }
+					if( !h_xx[mp] ) continue;
+					const COMPLEX16 *in = x_lm + mp*nb;
+					const COMPLEX16 *ea = ealpha + (mp-l+lmax)*nb;
+					const REAL8 *dl = d + XLALWignerdMatrixIndex( l, mp-l, m-l )*nb;
+					for(i=0; i<nb; i++){
+						out[i] += in[i] * ( ea[i] * dl[i] * eg[i] );
+					}
 				}
 			}
 		}
 	}
 
-	XLALFree( x_lm );
+cleanup:
 	XLALFree( h_xx );
+	XLALFree( x_lm );
+	XLALFree( d );
+	XLALFree( ealpha );
+	XLALFree( egam );
+	if( errnum )
+		XLAL_ERROR( errnum );
 	return XLAL_SUCCESS;
 }
 
@@ -360,27 +424,89 @@ int XLALSimInspiralPrecessionRotateModesOut(SphHarmTimeSeries **hlm_out,   /**<
   if (*hlm_out)
     XLAL_ERROR(XLAL_EFAILED);
 
-  unsigned int i;
+  unsigned int i, i0, nb, length;
   int l, m, mp;
+  int errnum = 0;
   int lmax = XLALSphHarmTimeSeriesGetMaxL( hlm_in );
   int lmin = XLALSphHarmTimeSeriesGetMinL( hlm_in );
+  unsigned int blocklen = RotateModesBlockLength( lmax );
+  // modes are indexed by l*l+l+m
+  COMPLEX16TimeSeries **inmode = XLALCalloc( (lmax+1)*(lmax+1), sizeof(COMPLEX16TimeSeries*) );
+  COMPLEX16TimeSeries **outmode = XLALCalloc( (lmax+1)*(lmax+1), sizeof(COMPLEX16TimeSeries*) );
+  // Wigner d matrix elements and phases for a block of samples
+  REAL8 *mbeta = XLALMalloc( blocklen * sizeof(REAL8) );
+  REAL8 *d = XLALMalloc( XLALWignerdMatrixIndex( lmax+1, -lmax-1, -lmax-1 ) * blocklen * sizeof(REAL8) );
+  COMPLEX16 *ealpha = XLALMalloc( (2*lmax+1) * blocklen * sizeof(COMPLEX16) );
+  COMPLEX16 *egam = XLALMalloc( (2*lmax+1) * blocklen * sizeof(COMPLEX16) );
+  if( !inmode || !outmode || !mbeta || !d || !ealpha || !egam ){
+    errnum = XLAL_ENOMEM;
+    goto cleanup;
+  }
+
   for( l=lmin; l <= lmax; l++ ) {
-    COMPLEX16TimeSeries **inmode= XLALCalloc( 2*lmax+1, sizeof(COMPLEX16TimeSeries) );
     for( m=-l; m<=l; m++){
-      inmode[m+l] = XLALSphHarmTimeSeriesGetMode(hlm_in, l, m );
+      inmode[l*l+l+m] = XLALSphHarmTimeSeriesGetMode(hlm_in, l, m );
     }
     for( m=-l; m<=l; m++){
-      COMPLEX16TimeSeries *outmode = XLALCreateCOMPLEX16TimeSeries(inmode[m+l]->name,&inmode[m+l]->epoch,0.,inmode[m+l]->deltaT,&inmode[m+l]->sampleUnits,inmode[m+l]->data->length);
-      for(i=0; i<inmode[m+l]->data->length; i++)
-	outmode->data->data[i]=0.;
-      for(mp=-l; mp<=l; mp++){
-	for(i=0; i<inmode[m+l]->data->length; i++) {
-	  outmode->data->data[i] += inmode[mp+l]->data->data[i] * XLALWignerDMatrix( l, mp, m, alpha->data->data[i], -beta->data->data[i], gam->data->data[i] );
+      COMPLEX16TimeSeries *in = inmode[l*l+l+m];
+      outmode[l*l+l+m] = XLALCreateCOMPLEX16TimeSeries(in->name,&in->epoch,0.,in->deltaT,&in->sampleUnits,in->data->length);
+      if( !outmode[l*l+l+m] ){
+        errnum = XLAL_EFUNC;
+        goto cleanup;
+      }
+      for(i=0; i<in->data->length; i++)
+	outmode[l*l+l+m]->data->data[i]=0.;
+    }
+  }
+
+  length = inmode[lmin*lmin]->data->length;
+  for( i0=0; i0<length; i0+=nb ) {
+    nb = length - i0 < blocklen ? length - i0 : blocklen;
+    for(i=0; i<nb; i++)
+      mbeta[i] = -beta->data->data[i0+i];
+    if( XLALWignerdMatrixBatch( d, lmax, mbeta, nb ) != XLAL_SUCCESS ){
+      errnum = XLAL_EFUNC;
+      goto cleanup;
+    }
+    RotateModesPhases( ealpha, lmax, alpha->data->data + i0, nb );
+    RotateModesPhases( egam, lmax, gam->data->data + i0, nb );
+    for( l=lmin; l <= lmax; l++ ) {
+      for( m=-l; m<=l; m++){
+	COMPLEX16 *out = outmode[l*l+l+m]->data->data + i0;
+	const COMPLEX16 *eg = egam + (m+lmax)*nb;
+	for(mp=-l; mp<=l; mp++){
+	  const COMPLEX16 *in = inmode[l*l+l+mp]->data->data + i0;
+	  const COMPLEX16 *ea = ealpha + (mp+lmax)*nb;
+	  const REAL8 *dl = d + XLALWignerdMatrixIndex( l, mp, m )*nb;
+	  for(i=0; i<nb; i++) {
+	    out[i] += in[i] * ( ea[i] * dl[i] * eg[i] );
+	  }
 	}
       }
-      *hlm_out=XLALSphHarmTimeSeriesAddMode(*hlm_out,outmode,l,m);
     }
   }
+
+  for( l=lmin; l <= lmax; l++ ) {
+    for( m=-l; m<=l; m++){
+      *hlm_out=XLALSphHarmTimeSeriesAddMode(*hlm_out,outmode[l*l+l+m],l,m);
+    }
+  }
+
+cleanup:
+  // free the workspaces, and any output modes created before an error
+  if( outmode ){
+    for( l=lmin; l <= lmax; l++ )
+      for( m=-l; m<=l; m++)
+        XLALDestroyCOMPLEX16TimeSeries(outmode[l*l+l+m]);
+  }
+  XLALFree(inmode);
+  XLALFree(outmode);
+  XLALFree(mbeta);
+  XLALFree(d);
+  XLALFree(ealpha);
+  XLALFree(egam);
+  if( errnum )
+    XLAL_ERROR(errnum);
   return XLAL_SUCCESS;
 }
 
@@ -3,6 +3,18 @@
 #include <lal/LALSimInspiral.h>
 #include <lal/LALSimInspiralWaveformParams.h>
 
+/* pthread locking to make key handle resolution thread-safe */
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#define LAL_ONCE_T pthread_once_t
+#define LAL_ONCE_INIT PTHREAD_ONCE_INIT
+#define LAL_ONCE(once, init) pthread_once((once), (init))
+#else
+#define LAL_ONCE_T int
+#define LAL_ONCE_INIT 1
+#define LAL_ONCE(once, init) (*(once) ? (init)(), *(once) = 0 : 0)
+#endif
+
 #if 1 /* generate definitions for source */
 
 #define DEFINE_INSERT_FUNC(NAME, TYPE, KEY, DEFAULT) \
@@ -11,12 +23,26 @@
 		return XLALDictInsert ## TYPE ## Value(params, KEY, value); \
 	}
 
+/* the key handle of each lookup function is resolved once, on first use */
 #define DEFINE_LOOKUP_FUNC(NAME, TYPE, KEY, DEFAULT) \
+	static const LALDictKey *LookupKey ## NAME = NULL; \
+	static void LookupKeyInit ## NAME(void) \
+	{ \
+		LookupKey ## NAME = XLALDictKeyHandle(KEY); \
+	} \
 	TYPE XLALSimInspiralWaveformParamsLookup ## NAME(LALDict *params) \
 	{ \
+		static LAL_ONCE_T once = LAL_ONCE_INIT; \
+		LALDictEntry *entry; \
 		TYPE value = DEFAULT; \
-		if (params && XLALDictContains(params, KEY)) \
-			value = XLALDictLookup ## TYPE ## Value(params, KEY); \
+		if (params == NULL) \
+			return value; \
+		LAL_ONCE(&once, LookupKeyInit ## NAME); \
+		if (LookupKey ## NAME == NULL) \
+			XLAL_ERROR_VAL(DEFAULT, XLAL_EFUNC); \
+		entry = XLALDictLookupHandle(params, LookupKey ## NAME); \
+		if (entry) \
+			value = XLALValueGet ## TYPE(XLALDictEntryGetValue(entry)); \
 		return value; \
 	}
 
@@ -213,11 +239,9 @@ LALValue* XLALSimInspiralWaveformParamsLookupModeArray(LALDict *params)
 {
 	/* Initialise and set Default to NULL */
 	LALValue * value = NULL;
-	if (params && XLALDictContains(params, "ModeArray"))
-	{
-		LALDictEntry * entry = XLALDictLookup(params, "ModeArray");
+	LALDictEntry * entry = params ? XLALDictLookup(params, "ModeArray") : NULL;
+	if (entry)
 		value = XLALValueDuplicate(XLALDictEntryGetValue(entry));
-	}
 	return value;
 }
 
@@ -225,11 +249,9 @@ LALValue* XLALSimInspiralWaveformParamsLookupModeArrayJframe(LALDict *params)
 {
 	/* Initialise and set Default to NULL */
 	LALValue * value = NULL;
-	if (params && XLALDictContains(params, "ModeArrayJframe"))
-	{
-		LALDictEntry * entry = XLALDictLookup(params, "ModeArrayJframe");
+	LALDictEntry * entry = params ? XLALDictLookup(params, "ModeArrayJframe") : NULL;
+	if (entry)
 		value = XLALValueDuplicate(XLALDictEntryGetValue(entry));
-	}
 	return value;
 }
 
@@ -139,8 +139,9 @@ static int NRHybSur_LoadDataPiece(
     sub = XLALH5GroupOpen(file, sub_grp_name);
     *data_piece = XLALMalloc(sizeof(DataPiece));
 
+    // The read-only surrogate data is mapped from the file where possible
     gsl_matrix *ei_basis = NULL;
-    int ret = ReadHDF5RealMatrixDataset(sub, "ei_basis", &ei_basis);
+    int ret = ReadHDF5RealMatrixDatasetMapped(sub, "ei_basis", &ei_basis);
     if (ret != XLAL_SUCCESS) {
         XLAL_ERROR(XLAL_EFUNC, "Failed to load ei_basis.");
     }
@@ -209,7 +210,7 @@ static int NRHybSur_LoadDataPiece(
 
         // Load arrays needed for fit
         hyperparams->length_scale = NULL;
-        ret = ReadHDF5RealVectorDataset(node_function, "length_scale",
+        ret = ReadHDF5RealVectorDatasetMapped(node_function, "length_scale",
                 &(hyperparams->length_scale));
         if (ret != XLAL_SUCCESS) {
             XLALFree(node_name);
@@ -217,7 +218,7 @@ static int NRHybSur_LoadDataPiece(
         }
 
         hyperparams->alpha = NULL;
-        ret = ReadHDF5RealVectorDataset(node_function, "alpha",
+        ret = ReadHDF5RealVectorDatasetMapped(node_function, "alpha",
                 &(hyperparams->alpha));
         if (ret != XLAL_SUCCESS) {
             XLALFree(node_name);
@@ -225,7 +226,7 @@ static int NRHybSur_LoadDataPiece(
         }
 
         fit_data->lin_coef = NULL;
-        ret = ReadHDF5RealVectorDataset(node_function, "lin_coef",
+        ret = ReadHDF5RealVectorDatasetMapped(node_function, "lin_coef",
                 &(fit_data->lin_coef));
         if (ret != XLAL_SUCCESS) {
             XLALFree(node_name);
@@ -31,8 +31,16 @@
 #include <lal/TimeSeries.h>
 #include <lal/TimeFreqFFT.h>
 #include <lal/Units.h>
+#include <lal/Random.h>
 #include <lal/LALSimNoise.h>
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
+/* number of output strides generated by each iteration of XLALSimNoiseParallel() */
+#define SIMNOISE_PARALLEL_CHUNK 16
+
 
 /* 
  * This routine generates a single segment of data.  Note that this segment is
@@ -73,6 +81,41 @@ static int XLALSimNoiseSegment(REAL8TimeSeries *s, REAL8FrequencySeries *psd, gs
 	return 0;
 }
 
+/*
+ * As XLALSimNoiseSegment(), but draws the frequency-domain deviates from a
+ * counter-based random number stream.  The segment is a function only of the
+ * position of the stream, which is advanced by the number of deviates used;
+ * the FFT plan and frequency series are supplied by the caller.
+ */
+static int XLALSimNoiseSegmentPhilox(REAL8TimeSeries *s, REAL8FrequencySeries *psd, PhiloxRandomParams *rng, REAL8FFTPlan *plan, COMPLEX16FrequencySeries *stilde)
+{
+	size_t k;
+	REAL8Vector deviates;
+
+	stilde->epoch = s->epoch;
+	stilde->deltaF = 1.0/(s->data->length * s->deltaT);
+
+	/* correct units: [stilde] = sqrt([psd] * seconds) */
+	XLALUnitMultiply(&stilde->sampleUnits, &psd->sampleUnits, &lalSecondUnit);
+	XLALUnitSqrt(&stilde->sampleUnits, &stilde->sampleUnits);
+
+	/* draw the real and imaginary parts of all frequency bins in one go */
+	deviates.length = 2 * stilde->data->length;
+	deviates.data = (REAL8 *)stilde->data->data;
+	if (XLALPhiloxNormalDeviates(&deviates, rng) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	for (k = 0; k < stilde->data->length; ++k) {
+		double sigma = 0.5 * sqrt(psd->data->data[k] / psd->deltaF);
+		stilde->data->data[k] *= sigma;
+	}
+
+	if (XLALREAL8FreqTimeFFT(s, stilde, plan) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	return 0;
+}
+
 /**
  * @addtogroup LALSimNoise_c
  * @brief Routines to produce a continuous stream of simulated
@@ -197,6 +240,216 @@ int XLALSimNoise(
 	return 0;
 }
 
+/**
+ * @brief As XLALSimNoise(), but draws the noise from a counter-based random
+ * number stream.
+ *
+ * The arguments and calling instructions are the same as for XLALSimNoise(),
+ * except that the random numbers are taken from the Philox stream @p rng
+ * (see @ref PhiloxRandom_c), which is advanced by 2 (N/2 + 1) deviates for
+ * each noise realization generated, where N is the length of the time series.
+ * A noise realization is thus a function only of the position of the stream,
+ * which makes it possible to generate the same noise in parallel with
+ * XLALSimNoiseParallel().
+ */
+int XLALSimNoisePhilox(
+	REAL8TimeSeries *s,		/**< [in/out] noise time series */
+	size_t stride,			/**< [in] stride (samples) */
+	REAL8FrequencySeries *psd,	/**< [in] power spectrum frequency series */
+	PhiloxRandomParams *rng		/**< [in/out] counter-based random number stream */
+)
+{
+	REAL8FFTPlan *plan;
+	COMPLEX16FrequencySeries *stilde;
+	REAL8Vector *overlap = NULL;
+	size_t j;
+
+	XLAL_CHECK(s && psd && rng, XLAL_EFAULT);
+
+	/* make sure that the resolution of the frequency series is
+	 * commensurate with the requested time series */
+	if (s->data->length/2 + 1 != psd->data->length
+			|| (size_t)floor(0.5 + 1.0/(s->deltaT * psd->deltaF)) != s->data->length)
+		XLAL_ERROR(XLAL_EINVAL);
+
+	/* stride cannot be longer than data length */
+	if (stride > s->data->length)
+		XLAL_ERROR(XLAL_EINVAL);
+
+	plan = XLALCreateReverseREAL8FFTPlan(s->data->length, 0);
+	stilde = XLALCreateCOMPLEX16FrequencySeries("STILDE", &s->epoch, 0.0, psd->deltaF, &lalDimensionlessUnit, psd->data->length);
+	if (!plan || !stilde)
+		goto error;
+
+	if (stride == 0) { /* generate segment with no feathering */
+		if (XLALSimNoiseSegmentPhilox(s, psd, rng, plan, stilde) < 0)
+			goto error;
+		XLALDestroyCOMPLEX16FrequencySeries(stilde);
+		XLALDestroyREAL8FFTPlan(plan);
+		return 0;
+	} else if (stride == s->data->length) {
+		/* will generate two independent noise realizations
+		 * and feather them together with full overlap */
+		if (XLALSimNoiseSegmentPhilox(s, psd, rng, plan, stilde) < 0)
+			goto error;
+		stride = 0;
+	}
+
+	overlap = XLALCreateREAL8Sequence(s->data->length - stride);
+	if (!overlap)
+		goto error;
+
+	/* copy overlap region between the old and the new data to temporary storage */
+	memcpy(overlap->data, s->data->data + stride, overlap->length*sizeof(*overlap->data));
+
+	/* generate the new data */
+	if (XLALSimNoiseSegmentPhilox(s, psd, rng, plan, stilde) < 0)
+		goto error;
+
+	/* feather old data in overlap region with new data */
+	for (j = 0; j < overlap->length; ++j) {
+		double x = cos(LAL_PI*j/(2.0 * overlap->length));
+		double y = sin(LAL_PI*j/(2.0 * overlap->length));
+		s->data->data[j] = x*overlap->data[j] + y*s->data->data[j];
+	}
+
+	XLALDestroyREAL8Sequence(overlap);
+	XLALDestroyCOMPLEX16FrequencySeries(stilde);
+	XLALDestroyREAL8FFTPlan(plan);
+
+	/* advance time */
+	XLALGPSAdd(&s->epoch, stride * s->deltaT);
+	return 0;
+
+error:
+	XLALDestroyREAL8Sequence(overlap);
+	XLALDestroyCOMPLEX16FrequencySeries(stilde);
+	XLALDestroyREAL8FFTPlan(plan);
+	XLAL_ERROR(XLAL_EFUNC);
+}
+
+/**
+ * @brief Generates a long stretch of continuous noise in parallel.
+ *
+ * The time series @p h, which may have any length, is filled with noise
+ * having the power spectrum @p psd.  The noise is generated in segments of
+ * length N = 1/(psd->deltaF * h->deltaT), which must be even, and is
+ * identical to the output of the following sequence of calls:
+ *
+ * @code
+ * XLALSimNoisePhilox(seg, 0, psd, rng); // first N/2 points of h
+ * XLALSimNoisePhilox(seg, N/2, psd, rng); // next N/2 points of h
+ * XLALSimNoisePhilox(seg, N/2, psd, rng); // etc.
+ * @endcode
+ *
+ * where @p seg is a time series of length N, and only the first N/2 points of
+ * @p seg are kept after each call.  Since each segment is a function only of
+ * the position of the stream @p rng at which it starts, and each stretch of
+ * N/2 output points depends only on two consecutive segments, the segments
+ * are generated in parallel (using OpenMP, if enabled); the output is
+ * bitwise identical regardless of the number of threads used.
+ *
+ * On return, @p rng is advanced past all the random numbers used, so that
+ * further calls generate independent noise.
+ */
+int XLALSimNoiseParallel(
+	REAL8TimeSeries *h,		/**< [out] noise time series */
+	REAL8FrequencySeries *psd,	/**< [in] power spectrum frequency series */
+	PhiloxRandomParams *rng		/**< [in/out] counter-based random number stream */
+)
+{
+	size_t seglen, stride, numstrides, numchunks, numdeviates, n;
+	int errnum = 0;
+
+	XLAL_CHECK(h && psd && rng, XLAL_EFAULT);
+
+	/* the segment length is set by the resolution of the frequency series */
+	seglen = floor(0.5 + 1.0/(h->deltaT * psd->deltaF));
+	XLAL_CHECK(seglen > 0 && seglen % 2 == 0, XLAL_EINVAL, "Segment length %zu must be even and non-zero", seglen);
+	XLAL_CHECK(seglen/2 + 1 == psd->data->length, XLAL_EINVAL, "Frequency series has length %u, expected %zu", psd->data->length, seglen/2 + 1);
+	stride = seglen / 2;
+	numstrides = (h->data->length + stride - 1) / stride;
+	numchunks = (numstrides + SIMNOISE_PARALLEL_CHUNK - 1) / SIMNOISE_PARALLEL_CHUNK;
+	numdeviates = 2 * psd->data->length;
+
+	/* each chunk generates the segments for its output strides, plus the
+	 * segment preceding the chunk which supplies the first overlap */
+	#pragma omp parallel for schedule(dynamic)
+	for (n = 0; n < numchunks; ++n) {
+		const size_t i0 = n * SIMNOISE_PARALLEL_CHUNK;
+		const size_t i1 = (i0 + SIMNOISE_PARALLEL_CHUNK < numstrides) ? i0 + SIMNOISE_PARALLEL_CHUNK : numstrides;
+		PhiloxRandomParams r = *rng;
+		REAL8FFTPlan *plan;
+		COMPLEX16FrequencySeries *stilde;
+		REAL8TimeSeries *seg;
+		REAL8Vector *overlap;
+		size_t i, j;
+
+		#pragma omp flush(errnum)
+		if (errnum)
+			continue;
+
+		plan = XLALCreateReverseREAL8FFTPlan(seglen, 0);
+		stilde = XLALCreateCOMPLEX16FrequencySeries("STILDE", &h->epoch, 0.0, psd->deltaF, &lalDimensionlessUnit, psd->data->length);
+		seg = XLALCreateREAL8TimeSeries(h->name, &h->epoch, h->f0, h->deltaT, &h->sampleUnits, seglen);
+		overlap = XLALCreateREAL8Sequence(stride);
+		if (!plan || !stilde || !seg || !overlap) {
+			errnum = XLAL_EFUNC;
+			#pragma omp flush(errnum)
+			goto done;
+		}
+
+		if (i0 > 0) {
+			XLALPhiloxRandomJump(&r, (i0 - 1) * numdeviates);
+			if (XLALSimNoiseSegmentPhilox(seg, psd, &r, plan, stilde) < 0) {
+				errnum = XLAL_EFUNC;
+				#pragma omp flush(errnum)
+				goto done;
+			}
+			memcpy(overlap->data, seg->data->data + stride, stride * sizeof(*overlap->data));
+		}
+
+		for (i = i0; i < i1; ++i) {
+			const size_t len = (i + 1 < numstrides) ? stride : h->data->length - i * stride;
+			REAL8 *out = h->data->data + i * stride;
+			if (XLALSimNoiseSegmentPhilox(seg, psd, &r, plan, stilde) < 0) {
+				errnum = XLAL_EFUNC;
+				#pragma omp flush(errnum)
+				goto done;
+			}
+			if (i == 0) {
+				/* first segment is used without feathering */
+				memcpy(out, seg->data->data, len * sizeof(*out));
+			} else {
+				/* feather old data in overlap region with new data */
+				for (j = 0; j < len; ++j) {
+					double x = cos(LAL_PI*j/(2.0 * stride));
+					double y = sin(LAL_PI*j/(2.0 * stride));
+					out[j] = x*overlap->data[j] + y*seg->data->data[j];
+				}
+			}
+			memcpy(overlap->data, seg->data->data + stride, stride * sizeof(*overlap->data));
+		}
+
+done:
+		XLALDestroyREAL8Sequence(overlap);
+		XLALDestroyREAL8TimeSeries(seg);
+		XLALDestroyCOMPLEX16FrequencySeries(stilde);
+		XLALDestroyREAL8FFTPlan(plan);
+	}
+
+	if (errnum)
+		XLAL_ERROR(errnum);
+
+	/* units are those of the noise segments: [h] = sqrt([psd] * seconds) * hertz */
+	XLALUnitMultiply(&h->sampleUnits, &psd->sampleUnits, &lalSecondUnit);
+	XLALUnitSqrt(&h->sampleUnits, &h->sampleUnits);
+	XLALUnitMultiply(&h->sampleUnits, &h->sampleUnits, &lalHertzUnit);
+
+	XLALPhiloxRandomJump(rng, numstrides * numdeviates);
+	return 0;
+}
+
 /** @} */
 
 /*
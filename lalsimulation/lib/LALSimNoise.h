@@ -34,6 +34,7 @@
 
 #include <stddef.h>
 #include <lal/LALDatatypes.h>
+#include <lal/Random.h>
 #include <gsl/gsl_rng.h>
 
 #if defined(__cplusplus)
@@ -69,6 +70,8 @@ SWIGLAL(FUNCTION_POINTER(aLIGOQuantumHighFrequency, XLALSimNoisePSDAdvVirgo,
 
 
 int XLALSimNoise(REAL8TimeSeries *s, size_t stride, REAL8FrequencySeries *psd, gsl_rng *rng);
+int XLALSimNoisePhilox(REAL8TimeSeries *s, size_t stride, REAL8FrequencySeries *psd, PhiloxRandomParams *rng);
+int XLALSimNoiseParallel(REAL8TimeSeries *h, REAL8FrequencySeries *psd, PhiloxRandomParams *rng);
 
 
 /*
@@ -0,0 +1,102 @@
+/*
+ *  Copyright (C) 2021 Yiqi Xie
+ *
+ *  Check that XLALSimNoiseParallel() reproduces sequential calls to
+ *  XLALSimNoisePhilox() exactly, no matter how many OpenMP threads are used.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/FrequencySeries.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+#include <lal/Random.h>
+#include <lal/LALSimNoise.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+int main(void)
+{
+	const double flow = 10.0;
+	const double segdur = 4.0;
+	const double srate = 1024.0;
+	const size_t seglen = segdur * srate;
+	const size_t stride = seglen / 2;
+	const size_t reclen = 37 * stride + 101;
+	const UINT8 seed = 1234, stream = 5;
+	LIGOTimeGPS epoch = {0, 0};
+	REAL8FrequencySeries *psd;
+	REAL8TimeSeries *seg, *rec1, *rec2;
+	PhiloxRandomParams rng;
+	UINT8 position;
+	size_t i, j;
+
+	XLALSetErrorHandler(XLALAbortErrorHandler);
+
+	psd = XLALCreateREAL8FrequencySeries("PSD", &epoch, 0.0, 1.0 / segdur, &lalSecondUnit, seglen / 2 + 1);
+	seg = XLALCreateREAL8TimeSeries("STRAIN", &epoch, 0.0, 1.0 / srate, &lalStrainUnit, seglen);
+	rec1 = XLALCreateREAL8TimeSeries("STRAIN", &epoch, 0.0, 1.0 / srate, &lalStrainUnit, reclen);
+	rec2 = XLALCreateREAL8TimeSeries("STRAIN", &epoch, 0.0, 1.0 / srate, &lalStrainUnit, reclen);
+	XLALSimNoisePSD(psd, flow, XLALSimNoisePSDaLIGOZeroDetHighPower);
+
+	/* generate the record sequentially */
+	XLALResetPhiloxRandomParams(&rng, seed, stream);
+	for (i = 0, j = 0; j < reclen; ++i) {
+		size_t n = reclen - j < stride ? reclen - j : stride;
+		XLALSimNoisePhilox(seg, i ? stride : 0, psd, &rng);
+		memcpy(rec1->data->data + j, seg->data->data, n * sizeof(*rec1->data->data));
+		j += n;
+	}
+	position = rng.position;
+
+	/* generate the record in parallel, with different numbers of threads */
+	for (i = 1; i <= 4; i *= 2) {
+#ifdef _OPENMP
+		omp_set_num_threads(i);
+#endif
+		XLALResetPhiloxRandomParams(&rng, seed, stream);
+		XLALSimNoiseParallel(rec2, psd, &rng);
+		if (rng.position != position) {
+			fprintf(stderr, "FAIL: random number stream at position %llu, expected %llu\n", (unsigned long long)rng.position, (unsigned long long)position);
+			return 1;
+		}
+		for (j = 0; j < reclen; ++j)
+			if (rec2->data->data[j] != rec1->data->data[j]) {
+				fprintf(stderr, "FAIL: sample %zu with %zu threads is %.17g, expected %.17g\n", j, i, rec2->data->data[j], rec1->data->data[j]);
+				return 1;
+			}
+		if (XLALUnitCompare(&rec2->sampleUnits, &lalStrainUnit) != 0) {
+			fprintf(stderr, "FAIL: noise does not have units of strain\n");
+			return 1;
+		}
+	}
+
+	XLALDestroyREAL8TimeSeries(rec2);
+	XLALDestroyREAL8TimeSeries(rec1);
+	XLALDestroyREAL8TimeSeries(seg);
+	XLALDestroyREAL8FrequencySeries(psd);
+	LALCheckMemoryLeaks();
+
+	return 0;
+}